@@ -0,0 +1,23 @@
+#include <iostream>
+#include <fkYAML/node.hpp>
+
+int main()
+{
+    // a document with a large sequence.
+    fkyaml::node root = {{"name", "items"}, {"items", fkyaml::node::sequence()}};
+    auto& items = root["items"].get_value_ref<fkyaml::node::sequence_type&>();
+    for (int i = 0; i < 10000; i++)
+    {
+        items.push_back({{"id", i}, {"tags", {"foo", "bar"}}});
+    }
+
+    // copy the document on 4 threads.
+    fkyaml::node copy = root.clone_parallel(4);
+    std::cout << std::boolalpha << (copy == root) << std::endl;
+
+    // the copy is independent of the original.
+    copy["items"][9999]["id"] = 0;
+    std::cout << root["items"][9999]["id"].get_value<int>() << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,27 @@
+#include <iostream>
+#include <string>
+#include <fkYAML/node.hpp>
+
+int main()
+{
+    std::string input = "web:\n"
+                        "  description: an example service managed by the platform team\n"
+                        "  replicas: 3\n"
+                        "db:\n"
+                        "  description: an example service managed by the platform team\n"
+                        "  replicas: 1\n";
+    fkyaml::node node = fkyaml::node::deserialize(input);
+
+    // compact the node tree after deserialization.
+    node.compact();
+
+    // the compacted node tree has the same contents.
+    std::cout << node << std::endl;
+
+    // but the long duplicated strings are now shared.
+    const std::string& web_desc = node["web"]["description"].get_value_ref<const std::string&>();
+    const std::string& db_desc = node["db"]["description"].get_value_ref<const std::string&>();
+    std::cout << std::boolalpha << (&web_desc == &db_desc) << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,28 @@
+#include <iostream>
+#include <string>
+#include <fkYAML/node.hpp>
+
+int main()
+{
+    std::string input = "web:\n"
+                        "  labels:\n"
+                        "    team: platform\n"
+                        "    tier: public\n"
+                        "  replicas: 3\n"
+                        "api:\n"
+                        "  labels:\n"
+                        "    team: platform\n"
+                        "    tier: public\n"
+                        "  replicas: 3\n";
+
+    // deserialize the input and compact the resulting node tree.
+    const fkyaml::node node = fkyaml::node::compact_document(input);
+    std::cout << node << std::endl;
+
+    // the identical subtrees share one container.
+    const auto& web = node["web"].get_value_ref<const fkyaml::node::mapping_type&>();
+    const auto& api = node["api"].get_value_ref<const fkyaml::node::mapping_type&>();
+    std::cout << std::boolalpha << (&web == &api) << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,19 @@
+#include <iostream>
+#include <fkYAML/node.hpp>
+
+int main()
+{
+    fkyaml::node seq_1 = {1, 2, 3};
+    fkyaml::node seq_2 = {1, 2, 4};
+    fkyaml::node str = "foo";
+
+    // the sign of the result tells the order.
+    std::cout << std::boolalpha;
+    std::cout << (seq_1.compare(seq_2) < 0) << std::endl;
+    std::cout << (seq_2.compare(seq_1) > 0) << std::endl;
+    std::cout << (seq_1.compare(seq_1) == 0) << std::endl;
+
+    // nodes of different types are ordered by their types.
+    std::cout << (seq_1.compare(str) < 0) << std::endl;
+    return 0;
+}
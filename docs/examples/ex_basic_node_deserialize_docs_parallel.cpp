@@ -0,0 +1,32 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <fkYAML/node.hpp>
+
+int main()
+{
+    // a YAML stream which contains multiple documents.
+    std::string s = R"(---
+name: foo
+replicas: 1
+---
+name: bar
+replicas: 3
+...
+%YAML 1.1
+---
+name: baz
+replicas: 2
+)";
+
+    // deserialize the documents on 2 threads.
+    std::vector<fkyaml::node> docs = fkyaml::node::deserialize_docs_parallel(s, 2);
+
+    // the documents are stored in the order of appearance.
+    for (const auto& doc : docs)
+    {
+        std::cout << doc["name"].get_value<std::string>() << ": " << doc["replicas"].get_value<int>() << std::endl;
+    }
+
+    return 0;
+}
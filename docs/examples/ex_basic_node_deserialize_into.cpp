@@ -0,0 +1,19 @@
+#include <iostream>
+#include <string>
+#include <fkYAML/node.hpp>
+
+int main()
+{
+    fkyaml::node config = fkyaml::node::deserialize("host: localhost\nport: 8080\nworkers: [a, b, c]");
+    const fkyaml::node* p_host = &config["host"];
+
+    // reload the updated contents into the same node.
+    fkyaml::node::deserialize_into("host: example.com\nport: 8081\nworkers: [a, b]", config);
+
+    std::cout << config << std::endl;
+
+    // the unchanged parts of the tree are reused.
+    std::cout << std::boolalpha << (p_host == &config["host"]) << std::endl;
+
+    return 0;
+}
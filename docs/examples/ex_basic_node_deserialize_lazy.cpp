@@ -0,0 +1,34 @@
+#include <iostream>
+#include <string>
+#include <fkYAML/node.hpp>
+
+int main()
+{
+    std::string s = R"(server:
+  host: localhost
+  port: 8080
+plugins:
+  - name: foo
+    enabled: true
+  - name: bar
+    enabled: false
+)";
+
+    // no basic_node objects are created at this point.
+    fkyaml::lazy_node root = fkyaml::node::deserialize_lazy(s);
+
+    // only the accessed values are converted.
+    std::cout << root["server"]["port"].get_value<int>() << std::endl;
+
+    for (const auto& plugin : root["plugins"])
+    {
+        if (plugin["enabled"].get_value<bool>())
+        {
+            std::cout << plugin["name"].get_value<std::string>() << std::endl;
+        }
+    }
+
+    std::cout << std::boolalpha << root.contains("logging") << std::endl;
+
+    return 0;
+}
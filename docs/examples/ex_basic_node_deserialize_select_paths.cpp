@@ -0,0 +1,28 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <fkYAML/node.hpp>
+
+int main()
+{
+    std::string s = R"(kind: Pod
+spec:
+  containers:
+    - name: app
+      image: app:1.0
+      ports: [80, 443]
+    - name: sidecar
+      image: proxy:2.3
+  volumes:
+    data: /var/data
+)";
+
+    // deserialize only the container images.
+    std::vector<std::string> paths = {"spec.containers[*].image"};
+    fkyaml::node n = fkyaml::node::deserialize(s, paths);
+
+    // the other nodes are not contained in the result.
+    std::cout << n << std::endl;
+
+    return 0;
+}
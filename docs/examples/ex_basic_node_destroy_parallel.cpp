@@ -0,0 +1,19 @@
+#include <iostream>
+#include <fkYAML/node.hpp>
+
+int main()
+{
+    // a document with a large sequence.
+    fkyaml::node root = fkyaml::node::sequence();
+    auto& items = root.get_value_ref<fkyaml::node::sequence_type&>();
+    for (int i = 0; i < 10000; i++)
+    {
+        items.push_back({{"id", i}, {"tags", {"foo", "bar"}}});
+    }
+
+    // destroy the document on 4 threads.
+    root.destroy_parallel(4);
+    std::cout << std::boolalpha << root.is_null() << std::endl;
+
+    return 0;
+}
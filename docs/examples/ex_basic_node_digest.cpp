@@ -0,0 +1,19 @@
+#include <iostream>
+#include <fkYAML/node.hpp>
+
+int main()
+{
+    fkyaml::node desired = fkyaml::node::deserialize("app:\n  image: nginx\n  replicas: 3\ndb:\n  image: postgres");
+    desired.make_copy_on_write();
+
+    // copies share the containers and their cached digests.
+    fkyaml::node actual = desired;
+    std::cout << std::boolalpha;
+    std::cout << (actual.digest() == desired.digest()) << std::endl;
+
+    // only the path to the modified node is digested again.
+    actual["app"]["replicas"] = 5;
+    std::cout << (actual.digest() == desired.digest()) << std::endl;
+    std::cout << (actual["db"].digest() == desired["db"].digest()) << std::endl;
+    return 0;
+}
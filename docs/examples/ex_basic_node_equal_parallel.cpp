@@ -0,0 +1,22 @@
+#include <iostream>
+#include <fkYAML/node.hpp>
+
+int main()
+{
+    // a document with a large sequence.
+    fkyaml::node root = fkyaml::node::sequence();
+    auto& items = root.get_value_ref<fkyaml::node::sequence_type&>();
+    for (int i = 0; i < 10000; i++)
+    {
+        items.push_back({{"id", i}, {"name", "item" + std::to_string(i)}});
+    }
+    fkyaml::node copy = root;
+
+    // compare the documents on 4 threads.
+    std::cout << std::boolalpha << root.equal_parallel(copy, 4) << std::endl;
+
+    copy[5000]["name"] = "foo";
+    std::cout << root.equal_parallel(copy, 4) << std::endl;
+
+    return 0;
+}
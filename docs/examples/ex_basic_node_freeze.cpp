@@ -0,0 +1,36 @@
+#include <iostream>
+#include <string>
+#include <fkYAML/node.hpp>
+
+int main()
+{
+    fkyaml::node node = fkyaml::node::deserialize(R"(server:
+  host: localhost
+  port: 8080
+plugins:
+  - name: foo
+    enabled: true
+  - name: bar
+    enabled: false
+)");
+
+    // create a read-only copy which is stored in a few contiguous arrays.
+    fkyaml::frozen_node root = node.freeze();
+
+    // the frozen copy is independent of the original node.
+    node["server"]["port"] = 9090;
+
+    std::cout << root["server"]["port"].get_value<int>() << std::endl;
+
+    for (const auto& plugin : root["plugins"])
+    {
+        if (plugin["enabled"].get_value<bool>())
+        {
+            std::cout << plugin["name"].get_value<std::string>() << std::endl;
+        }
+    }
+
+    std::cout << std::boolalpha << root.contains("logging") << std::endl;
+
+    return 0;
+}
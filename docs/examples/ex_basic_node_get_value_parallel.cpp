@@ -0,0 +1,22 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <fkYAML/node.hpp>
+
+int main()
+{
+    // a large sequence of strings.
+    fkyaml::node root = fkyaml::node::sequence();
+    auto& seq = root.get_value_ref<fkyaml::node::sequence_type&>();
+    for (int i = 0; i < 10000; i++)
+    {
+        seq.push_back("item" + std::to_string(i));
+    }
+
+    // convert the elements on 4 threads.
+    auto names = root.get_value_parallel<std::vector<std::string>>(4);
+    std::cout << names.size() << std::endl;
+    std::cout << names[9999] << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,33 @@
+#include <iostream>
+#include <fkYAML/node.hpp>
+
+int main()
+{
+    fkyaml::node base = fkyaml::node::deserialize("server:\n"
+                                                  "  host: localhost\n"
+                                                  "  port: 8080\n"
+                                                  "client:\n"
+                                                  "  timeout: 30\n");
+
+    // let copies of the base config share its values.
+    base.make_copy_on_write();
+
+    // copying takes constant time.
+    fkyaml::node snapshot = base;
+
+    // only the path to the modified node is copied.
+    snapshot["server"]["port"] = 9090;
+
+    std::cout << base["server"]["port"] << std::endl;
+    std::cout << snapshot["server"]["port"] << std::endl;
+
+    // unmodified values are still shared.
+    const fkyaml::node& const_base = base;
+    const fkyaml::node& const_snapshot = snapshot;
+    std::cout << std::boolalpha
+              << (&const_base["client"].get_value_ref<const fkyaml::node::mapping_type&>() ==
+                  &const_snapshot["client"].get_value_ref<const fkyaml::node::mapping_type&>())
+              << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,86 @@
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <fkYAML/node.hpp>
+
+// prints parse events with the compiler checking the signatures.
+struct event_printer : public fkyaml::node::sax_handler_type
+{
+    bool start_document(yaml_version_t) override
+    {
+        std::cout << "+DOC" << std::endl;
+        return true;
+    }
+    bool end_document() override
+    {
+        std::cout << "-DOC" << std::endl;
+        return true;
+    }
+    bool start_mapping() override
+    {
+        std::cout << "+MAP" << std::endl;
+        return true;
+    }
+    bool end_mapping() override
+    {
+        std::cout << "-MAP" << std::endl;
+        return true;
+    }
+    bool start_sequence() override
+    {
+        std::cout << "+SEQ" << std::endl;
+        return true;
+    }
+    bool end_sequence() override
+    {
+        std::cout << "-SEQ" << std::endl;
+        return true;
+    }
+    bool key() override
+    {
+        std::cout << "KEY" << std::endl;
+        return true;
+    }
+    bool scalar(std::nullptr_t) override
+    {
+        std::cout << "null" << std::endl;
+        return true;
+    }
+    bool scalar(boolean_type value) override
+    {
+        std::cout << std::boolalpha << value << std::endl;
+        return true;
+    }
+    bool scalar(integer_type value) override
+    {
+        std::cout << value << std::endl;
+        return true;
+    }
+    bool scalar(float_number_type value) override
+    {
+        std::cout << value << std::endl;
+        return true;
+    }
+    bool scalar(string_type& value) override
+    {
+        std::cout << value << std::endl;
+        return true;
+    }
+    bool anchor(const string_type& name) override
+    {
+        std::cout << "&" << name << std::endl;
+        return true;
+    }
+    bool alias(const string_type& name) override
+    {
+        std::cout << "*" << name << std::endl;
+        return true;
+    }
+};
+
+int main()
+{
+    event_printer printer;
+    fkyaml::node::sax_parse("foo: &anchor 123\nbar:\n  - *anchor\n  - true", printer);
+    return 0;
+}
@@ -0,0 +1,109 @@
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <fkYAML/node.hpp>
+
+// sums up the "replicas" values without building nodes.
+struct replicas_counter
+{
+    bool start_document(fkyaml::node::yaml_version_t)
+    {
+        return true;
+    }
+    bool end_document()
+    {
+        return true;
+    }
+    bool start_mapping()
+    {
+        ++depth;
+        return true;
+    }
+    bool end_mapping()
+    {
+        --depth;
+        return true;
+    }
+    bool start_sequence()
+    {
+        ++depth;
+        return true;
+    }
+    bool end_sequence()
+    {
+        --depth;
+        return true;
+    }
+    bool key()
+    {
+        is_key = true;
+        return true;
+    }
+    bool scalar(std::nullptr_t)
+    {
+        return value_found();
+    }
+    bool scalar(fkyaml::node::boolean_type)
+    {
+        return value_found();
+    }
+    bool scalar(fkyaml::node::integer_type value)
+    {
+        if (is_replicas)
+        {
+            total += value;
+        }
+        return value_found();
+    }
+    bool scalar(fkyaml::node::float_number_type)
+    {
+        return value_found();
+    }
+    bool scalar(fkyaml::node::string_type& value)
+    {
+        if (is_key)
+        {
+            is_key = false;
+            is_replicas = (value == "replicas");
+            return true;
+        }
+        return value_found();
+    }
+    bool anchor(const fkyaml::node::string_type&)
+    {
+        return true;
+    }
+    bool alias(const fkyaml::node::string_type&)
+    {
+        return value_found();
+    }
+
+    bool value_found()
+    {
+        is_replicas = false;
+        return true;
+    }
+
+    int depth = 0;
+    bool is_key = false;
+    bool is_replicas = false;
+    fkyaml::node::integer_type total = 0;
+};
+
+int main()
+{
+    std::string s = R"(services:
+  - name: foo
+    replicas: 1
+  - name: bar
+    replicas: 3
+)";
+
+    replicas_counter counter;
+    bool is_completed = fkyaml::node::sax_parse(s, counter);
+
+    std::cout << std::boolalpha << is_completed << std::endl;
+    std::cout << counter.total << std::endl;
+
+    return 0;
+}
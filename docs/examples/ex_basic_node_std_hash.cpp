@@ -0,0 +1,20 @@
+#include <iostream>
+#include <unordered_map>
+#include <fkYAML/node.hpp>
+
+int main()
+{
+    // use YAML nodes as keys of an unordered associative container.
+    std::unordered_map<fkyaml::node, std::string> map;
+    map.emplace(fkyaml::node(123), "integer");
+    map.emplace(fkyaml::node("foo"), "string");
+    map.emplace(fkyaml::node::sequence({true, false}), "sequence");
+
+    // equal nodes have the same hash value.
+    fkyaml::node n = fkyaml::node::sequence({true, false});
+    std::cout << std::boolalpha;
+    std::cout << (std::hash<fkyaml::node>()(n) == std::hash<fkyaml::node>()(map.find(n)->first)) << std::endl;
+    std::cout << map.at(n) << std::endl;
+    std::cout << map.at(fkyaml::node(123)) << std::endl;
+    return 0;
+}
@@ -0,0 +1,16 @@
+#include <iostream>
+#include <fkYAML/node.hpp>
+
+int main()
+{
+    // mapping node values are stored in std::unordered_map.
+    fkyaml::unordered_node n = fkyaml::unordered_node::deserialize("foo: 123\nbar: [true, false]");
+    std::cout << n["foo"].get_value<int>() << std::endl;
+
+    // equality does not depend on the order of key-value pairs.
+    fkyaml::unordered_node other = fkyaml::unordered_node::mapping();
+    other["bar"] = fkyaml::unordered_node::sequence({true, false});
+    other["foo"] = 123;
+    std::cout << std::boolalpha << (n == other) << std::endl;
+    return 0;
+}
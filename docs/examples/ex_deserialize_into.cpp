@@ -0,0 +1,63 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <fkYAML/node.hpp>
+
+namespace ns
+{
+
+struct endpoint
+{
+    std::string name;
+    int port = 0;
+};
+
+// declare which YAML keys are bound to which fields.
+template <typename BinderType>
+void bind_fields(BinderType& binder, endpoint& e)
+{
+    binder("name", e.name);
+    binder("port", e.port);
+}
+
+struct config
+{
+    std::string host;
+    bool debug = false;
+    std::vector<endpoint> endpoints;
+};
+
+template <typename BinderType>
+void bind_fields(BinderType& binder, config& c)
+{
+    binder("host", c.host);
+    binder("debug", c.debug);
+    binder("endpoints", c.endpoints);
+}
+
+} // namespace ns
+
+int main()
+{
+    std::string input = "host: localhost\n"
+                        "debug: true\n"
+                        "endpoints:\n"
+                        "  - name: http\n"
+                        "    port: 80\n"
+                        "  - name: https\n"
+                        "    port: 443\n"
+                        "comment: unknown keys are skipped.\n";
+
+    // deserialize the input directly into a config object without building a node tree.
+    ns::config cfg;
+    fkyaml::deserialize_into(input, cfg);
+
+    std::cout << "host: " << cfg.host << std::endl;
+    std::cout << "debug: " << std::boolalpha << cfg.debug << std::endl;
+    for (const auto& e : cfg.endpoints)
+    {
+        std::cout << e.name << " -> " << e.port << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,25 @@
+#include <iostream>
+#include <string>
+#include <fkYAML/node.hpp>
+
+int main()
+{
+    std::string s = R"(version: 2
+services:
+  - name: foo
+    replicas: 1
+)";
+
+    fkyaml::event_reader reader(s);
+    for (auto e = reader.next(); e.type != fkyaml::event_reader::event_t::END_OF_STREAM; e = reader.next())
+    {
+        if (e.is_key && e.text == "version")
+        {
+            // the rest of the input is never parsed.
+            std::cout << "version: " << reader.next().value().get_value<int>() << std::endl;
+            break;
+        }
+    }
+
+    return 0;
+}
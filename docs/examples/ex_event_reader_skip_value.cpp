@@ -0,0 +1,40 @@
+#include <iostream>
+#include <string>
+#include <fkYAML/node.hpp>
+
+int main()
+{
+    std::string s = R"(services:
+  - name: foo
+    replicas: 1
+  - name: bar
+    replicas: 3
+name: example
+)";
+
+    using event_t = fkyaml::event_reader::event_t;
+    fkyaml::event_reader reader(s);
+
+    while (reader.peek().type != event_t::END_OF_STREAM)
+    {
+        fkyaml::event_reader::event e = reader.next();
+        if (!e.is_key || e.type != event_t::SCALAR)
+        {
+            continue;
+        }
+
+        std::string key = e.text;
+        if (key == "name")
+        {
+            std::cout << "name: " << reader.next().text << std::endl;
+        }
+        else
+        {
+            // no events are created for the skipped value.
+            std::cout << "skip " << key << std::endl;
+            reader.skip_value();
+        }
+    }
+
+    return 0;
+}
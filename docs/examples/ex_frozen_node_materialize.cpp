@@ -0,0 +1,16 @@
+#include <iostream>
+#include <fkYAML/node.hpp>
+
+int main()
+{
+    fkyaml::node node = fkyaml::node::deserialize("foo:\n  bar: [1, 2]\nbaz: true");
+    fkyaml::frozen_node root = node.freeze();
+
+    // create a basic_node object from the viewed node.
+    fkyaml::node foo = root["foo"].materialize();
+    std::cout << foo << std::endl;
+
+    std::cout << std::boolalpha << (root.materialize() == node) << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,32 @@
+#include <iostream>
+#include <string>
+#include <fkYAML/node.hpp>
+
+int main()
+{
+    std::string input = "web:\n"
+                        "  app.kubernetes.io/managed-by: helm\n"
+                        "  replicas: 3\n"
+                        "db:\n"
+                        "  app.kubernetes.io/managed-by: kustomize\n"
+                        "  replicas: 1\n";
+
+    // deserialize the input with an interner so that equal mapping keys share one string.
+    fkyaml::key_interner interner;
+    fkyaml::node node = fkyaml::node::deserialize(input, interner);
+
+    std::cout << node << std::endl;
+
+    // "replicas" is short enough to be stored in place, so only one key has been interned.
+    std::cout << "interned keys: " << interner.size() << std::endl;
+
+    const std::string& web_key = node["web"].begin().key().get_value_ref<const std::string&>();
+    const std::string& db_key = node["db"].begin().key().get_value_ref<const std::string&>();
+    std::cout << std::boolalpha << (&web_key == &db_key) << std::endl;
+
+    // find() looks up interned strings without registering new ones.
+    std::cout << (interner.find("app.kubernetes.io/managed-by") != nullptr) << std::endl;
+    std::cout << (interner.find("replicas") != nullptr) << std::endl;
+
+    return 0;
+}
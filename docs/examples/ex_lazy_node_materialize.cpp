@@ -0,0 +1,22 @@
+#include <iostream>
+#include <string>
+#include <fkYAML/node.hpp>
+
+int main()
+{
+    std::string s = R"(server:
+  host: localhost
+  port: 8080
+plugins:
+  - foo
+  - bar
+)";
+
+    fkyaml::lazy_node root = fkyaml::node::deserialize_lazy(s);
+
+    // create basic_node objects only for the "server" mapping.
+    fkyaml::node server = root["server"].materialize();
+    std::cout << server << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,42 @@
+#include <iostream>
+#include <string>
+#include <fkYAML/node.hpp>
+
+int main()
+{
+    fkyaml::node source = fkyaml::node::deserialize(std::string("server:\n  host: localhost\n  port: 8080\ndebug: true"));
+    fkyaml::node target = fkyaml::node::deserialize(std::string("server:\n  host: localhost\n  port: 9090\nlog: info"));
+
+    // create the edits which turn `source` into `target`.
+    fkyaml::node_patch script = fkyaml::diff(source, target);
+    for (const fkyaml::node_edit& edit : script)
+    {
+        switch (edit.op)
+        {
+        case fkyaml::node_edit::op_t::ADD:
+            std::cout << "add ";
+            break;
+        case fkyaml::node_edit::op_t::REMOVE:
+            std::cout << "remove ";
+            break;
+        case fkyaml::node_edit::op_t::REPLACE:
+            std::cout << "replace ";
+            break;
+        }
+        for (const fkyaml::node& key : edit.path)
+        {
+            std::cout << "/" << key.get_value<std::string>();
+        }
+        if (!edit.value.is_null())
+        {
+            std::cout << " " << edit.value;
+        }
+        std::cout << std::endl;
+    }
+
+    // apply the edits to `source`.
+    fkyaml::patch(source, script);
+    std::cout << std::boolalpha << (source == target) << std::endl;
+
+    return 0;
+}
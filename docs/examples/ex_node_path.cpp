@@ -0,0 +1,28 @@
+#include <iostream>
+#include <string>
+#include <fkYAML/node.hpp>
+
+int main()
+{
+    fkyaml::node root = fkyaml::node::deserialize(std::string(R"(spec:
+  containers:
+    - name: web
+      image: nginx
+    - name: sidecar
+      image: envoy
+)"));
+
+    // compile the paths once and evaluate them as many times as you need.
+    const fkyaml::path image("spec.containers[0].image");
+    const fkyaml::path missing("spec.containers[2].image");
+
+    std::cout << image.at(root) << std::endl;
+    std::cout << std::boolalpha << missing.contains(root) << std::endl;
+    std::cout << (missing.find(root) == nullptr) << std::endl;
+
+    // modify the node at the path.
+    image.at(root) = "apache";
+    std::cout << root["spec"]["containers"][0]["image"] << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,24 @@
+#include <iostream>
+#include <string>
+#include <fkYAML/node.hpp>
+
+int main()
+{
+    // destroys retired nodes on a background thread.
+    fkyaml::node_reclaimer reclaimer;
+
+    fkyaml::node config = fkyaml::node::deserialize(std::string("version: 1\nservers: [a, b, c]"));
+
+    // swap in a new configuration without destroying the old one on this thread.
+    fkyaml::node new_config = fkyaml::node::deserialize(std::string("version: 2\nservers: [d, e]"));
+    std::swap(config, new_config);
+    reclaimer.retire(std::move(new_config));
+
+    std::cout << config["version"].get_value<int>() << std::endl;
+    std::cout << std::boolalpha << new_config.is_null() << std::endl;
+
+    // wait until the old configuration is destroyed.
+    reclaimer.wait();
+
+    return 0;
+}
@@ -0,0 +1,43 @@
+#include <iostream>
+#include <string>
+#include <fkYAML/node.hpp>
+
+// replaces the values of "password" keys and counts the strings.
+struct redactor : fkyaml::node_visitor
+{
+    bool mapping_value(const fkyaml::node& key, fkyaml::node& value)
+    {
+        if (key.is_string() && key.get_value_ref<const std::string&>() == "password")
+        {
+            value = "***";
+            // skip the redacted value.
+            return false;
+        }
+        return true;
+    }
+
+    void string_scalar(fkyaml::node& /*unused*/, const std::string& /*unused*/)
+    {
+        ++strings;
+    }
+
+    int strings = 0;
+};
+
+int main()
+{
+    fkyaml::node root = fkyaml::node::deserialize(std::string(R"(user: admin
+password: secret
+servers:
+  - host: example.com
+    password: hunter2
+)"));
+
+    redactor visitor;
+    fkyaml::visit(root, visitor);
+
+    std::cout << root << std::endl;
+    std::cout << "strings: " << visitor.strings << std::endl;
+
+    return 0;
+}
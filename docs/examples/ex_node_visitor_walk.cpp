@@ -0,0 +1,30 @@
+#include <iostream>
+#include <string>
+#include <fkYAML/node.hpp>
+
+int main()
+{
+    const fkyaml::node root = fkyaml::node::deserialize(std::string(R"(name: app
+ports:
+  - 80
+  - 443
+limits:
+  cpu: 2
+  memory: 512
+)"));
+
+    // count the integer nodes outside sequences.
+    int count = 0;
+    fkyaml::walk(root, [&count](const fkyaml::node& node) {
+        if (node.is_integer())
+        {
+            ++count;
+        }
+        // skip the elements of sequences.
+        return !node.is_sequence();
+    });
+
+    std::cout << count << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,23 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <fkYAML/node.hpp>
+
+int main()
+{
+    std::vector<std::string> requests = {
+        "method: get_user\nparams: {id: 1}",
+        "method: list_users\nparams: {limit: 10}",
+        "method: delete_user\nparams: {id: 2}",
+    };
+
+    // create a parser once and reuse it for all the requests.
+    fkyaml::parser parser;
+    for (const auto& request : requests)
+    {
+        fkyaml::node n = parser.parse(request);
+        std::cout << n["method"].get_value<std::string>() << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,155 @@
+///  _______   __ __   __  _____   __  __  __
+/// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+/// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.2
+/// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+///
+/// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+/// SPDX-License-Identifier: MIT
+///
+/// @file
+
+#ifndef FK_YAML_DETAIL_CONTAINER_UTILS_HPP_
+#define FK_YAML_DETAIL_CONTAINER_UTILS_HPP_
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include <fkYAML/detail/macros/version_macros.hpp>
+#include <fkYAML/detail/meta/detect.hpp>
+#include <fkYAML/detail/meta/stl_supplement.hpp>
+
+/// @brief namespace for fkYAML library.
+FK_YAML_NAMESPACE_BEGIN
+
+/// @brief namespace for internal implementations of fkYAML library.
+namespace detail
+{
+
+/// @brief A type of the result of shrink_to_fit() calls.
+/// @tparam ContainerType A container type.
+template <typename ContainerType>
+using shrink_to_fit_fn_t = decltype(std::declval<ContainerType&>().shrink_to_fit());
+
+/// @brief A type of the result of reserve() calls.
+/// @tparam ContainerType A container type.
+template <typename ContainerType>
+using reserve_fn_t =
+    decltype(std::declval<ContainerType&>().reserve(std::declval<typename ContainerType::size_type>()));
+
+/// @brief A type of the result of emplace_back() calls.
+/// @tparam ContainerType A container type.
+/// @tparam Args Types of arguments passed to emplace_back().
+template <typename ContainerType, typename... Args>
+using emplace_back_fn_t = decltype(std::declval<ContainerType&>().emplace_back(std::declval<Args>()...));
+
+/// @brief A type of the hash function object of hash-based containers.
+/// @tparam ContainerType A container type.
+template <typename ContainerType>
+using hasher_t = typename ContainerType::hasher;
+
+/// @brief Check if the given mapping type is hash-based, i.e., its iteration order depends on its contents as well as
+/// the history of insertions. (e.g., std::unordered_map)
+/// @tparam MappingType A mapping container type.
+template <typename MappingType>
+struct is_unordered_mapping : is_detected<hasher_t, MappingType>
+{
+};
+
+/// @brief A type of the function object which compares the elements of sorted containers.
+/// @tparam ContainerType A container type.
+template <typename ContainerType>
+using value_compare_t = typename ContainerType::value_compare;
+
+/// @brief Check if the given mapping type keeps its entries in the order of insertions, i.e., it's neither sorted by
+/// keys nor hash-based. (e.g., fkyaml::ordered_map)
+/// @tparam MappingType A mapping container type.
+template <typename MappingType>
+struct is_insertion_ordered_mapping
+    : conjunction<negation<is_detected<value_compare_t, MappingType>>, negation<is_unordered_mapping<MappingType>>>
+{
+};
+
+namespace container_utils_impl
+{
+
+template <typename ContainerType>
+inline void shrink_to_fit(ContainerType& container, std::true_type /*unused*/)
+{
+    container.shrink_to_fit();
+}
+
+template <typename ContainerType>
+inline void shrink_to_fit(ContainerType& /*unused*/, std::false_type /*unused*/)
+{
+}
+
+template <typename ContainerType>
+inline void reserve(ContainerType& container, std::size_t size, std::true_type /*unused*/)
+{
+    container.reserve(size);
+}
+
+template <typename ContainerType>
+inline void reserve(ContainerType& /*unused*/, std::size_t /*unused*/, std::false_type /*unused*/)
+{
+}
+
+template <typename MappingType, typename KeyType, typename ValueType>
+inline void append(MappingType& map, KeyType&& key, ValueType&& value, std::true_type /*unused*/)
+{
+    map.emplace_back(std::forward<KeyType>(key), std::forward<ValueType>(value));
+}
+
+template <typename MappingType, typename KeyType, typename ValueType>
+inline void append(MappingType& map, KeyType&& key, ValueType&& value, std::false_type /*unused*/)
+{
+    map.emplace_hint(map.end(), std::forward<KeyType>(key), std::forward<ValueType>(value));
+}
+
+} // namespace container_utils_impl
+
+/// @brief Shrink the capacity of the given container to fit its size if the container has capacity.
+/// @tparam ContainerType A container type.
+/// @param container A container object.
+template <typename ContainerType>
+inline void shrink_to_fit_if_possible(ContainerType& container)
+{
+    container_utils_impl::shrink_to_fit(container, is_detected<shrink_to_fit_fn_t, ContainerType> {});
+}
+
+/// @brief Reserve the capacity of the given container if the container has capacity.
+/// @tparam ContainerType A container type.
+/// @param container A container object.
+/// @param size The number of elements to be reserved.
+template <typename ContainerType>
+inline void reserve_if_possible(ContainerType& container, std::size_t size)
+{
+    container_utils_impl::reserve(container, size, is_detected<reserve_fn_t, ContainerType> {});
+}
+
+/// @brief Append a key-value pair to the end of the given mapping.
+/// @note The key must not exist in the mapping, and must come after all the existing keys if the mapping is sorted.
+/// Sequence-based mappings (e.g., ordered_map) are appended to with emplace_back(), and associative ones (e.g.,
+/// std::map) with emplace_hint() so that the insertion takes amortized constant time.
+/// @tparam MappingType A mapping container type.
+/// @tparam KeyType A type of the key.
+/// @tparam ValueType A type of the value.
+/// @param map A mapping container object.
+/// @param key A key to be appended.
+/// @param value A value to be appended.
+template <typename MappingType, typename KeyType, typename ValueType>
+inline void append_mapping_entry(MappingType& map, KeyType&& key, ValueType&& value)
+{
+    container_utils_impl::append(
+        map,
+        std::forward<KeyType>(key),
+        std::forward<ValueType>(value),
+        is_detected<emplace_back_fn_t, MappingType, KeyType, ValueType> {});
+}
+
+} // namespace detail
+
+FK_YAML_NAMESPACE_END
+
+#endif /* FK_YAML_DETAIL_CONTAINER_UTILS_HPP_ */
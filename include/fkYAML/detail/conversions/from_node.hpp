@@ -20,6 +20,7 @@
 #include <fkYAML/detail/meta/node_traits.hpp>
 #include <fkYAML/detail/meta/stl_supplement.hpp>
 #include <fkYAML/detail/meta/type_traits.hpp>
+#include <fkYAML/detail/node_string_accessor.hpp>
 #include <fkYAML/detail/types/node_t.hpp>
 #include <fkYAML/exception.hpp>
 
@@ -254,7 +255,8 @@ inline void from_node(const BasicNodeType& n, typename BasicNodeType::string_typ
     {
         throw type_error("The target node value type is not string type.", n.type());
     }
-    s = n.template get_value_ref<const typename BasicNodeType::string_type&>();
+    using accessor_type = node_string_accessor<BasicNodeType>;
+    s.assign(accessor_type::data(n), accessor_type::size(n));
 }
 
 /// @brief A function object to call from_node functions.
@@ -33,8 +33,7 @@ namespace detail
 /// @brief The external constructor template for basic_node objects.
 /// @note All the non-specialized instanciations results in compilation error since such instantiations are not
 /// supported.
-/// @warning All the specialization must call n.m_node_value.destroy(n.m_node_type) first in construct function to avoid
-/// memory leak.
+/// @warning All the specialization must call n.destroy_value() first in construct function to avoid memory leak.
 /// @tparam node_t The resulting YAMK node value type.
 template <node_t>
 struct external_node_constructor;
@@ -50,8 +49,8 @@ struct external_node_constructor<node_t::SEQUENCE>
     template <typename BasicNodeType, enable_if_t<is_basic_node<BasicNodeType>::value, int> = 0>
     static void construct(BasicNodeType& n, const typename BasicNodeType::sequence_type& s) noexcept
     {
-        n.m_node_value.destroy(n.m_node_type);
-        n.m_node_type = node_t::SEQUENCE;
+        n.destroy_value();
+        n.m_node_value.attrs.set_type(node_t::SEQUENCE);
         n.m_node_value.p_sequence = BasicNodeType::template create_object<typename BasicNodeType::sequence_type>(s);
     }
 
@@ -62,8 +61,8 @@ struct external_node_constructor<node_t::SEQUENCE>
     template <typename BasicNodeType, enable_if_t<is_basic_node<BasicNodeType>::value, int> = 0>
     static void construct(BasicNodeType& n, typename BasicNodeType::sequence_type&& s) noexcept
     {
-        n.m_node_value.destroy(n.m_node_type);
-        n.m_node_type = node_t::SEQUENCE;
+        n.destroy_value();
+        n.m_node_value.attrs.set_type(node_t::SEQUENCE);
         n.m_node_value.p_sequence =
             BasicNodeType::template create_object<typename BasicNodeType::sequence_type>(std::move(s));
     }
@@ -80,8 +79,8 @@ struct external_node_constructor<node_t::MAPPING>
     template <typename BasicNodeType, enable_if_t<is_basic_node<BasicNodeType>::value, int> = 0>
     static void construct(BasicNodeType& n, const typename BasicNodeType::mapping_type& m) noexcept
     {
-        n.m_node_value.destroy(n.m_node_type);
-        n.m_node_type = node_t::MAPPING;
+        n.destroy_value();
+        n.m_node_value.attrs.set_type(node_t::MAPPING);
         n.m_node_value.p_mapping = BasicNodeType::template create_object<typename BasicNodeType::mapping_type>(m);
     }
 
@@ -92,8 +91,8 @@ struct external_node_constructor<node_t::MAPPING>
     template <typename BasicNodeType, enable_if_t<is_basic_node<BasicNodeType>::value, int> = 0>
     static void construct(BasicNodeType& n, typename BasicNodeType::mapping_type&& m) noexcept
     {
-        n.m_node_value.destroy(n.m_node_type);
-        n.m_node_type = node_t::MAPPING;
+        n.destroy_value();
+        n.m_node_value.attrs.set_type(node_t::MAPPING);
         n.m_node_value.p_mapping =
             BasicNodeType::template create_object<typename BasicNodeType::mapping_type>(std::move(m));
     }
@@ -110,8 +109,8 @@ struct external_node_constructor<node_t::NULL_OBJECT>
     template <typename BasicNodeType, enable_if_t<is_basic_node<BasicNodeType>::value, int> = 0>
     static void construct(BasicNodeType& n, std::nullptr_t /*unused*/) noexcept
     {
-        n.m_node_value.destroy(n.m_node_type);
-        n.m_node_type = node_t::NULL_OBJECT;
+        n.destroy_value();
+        n.m_node_value.attrs.set_type(node_t::NULL_OBJECT);
         n.m_node_value.p_mapping = nullptr;
     }
 };
@@ -127,8 +126,8 @@ struct external_node_constructor<node_t::BOOLEAN>
     template <typename BasicNodeType, enable_if_t<is_basic_node<BasicNodeType>::value, int> = 0>
     static void construct(BasicNodeType& n, typename BasicNodeType::boolean_type b) noexcept
     {
-        n.m_node_value.destroy(n.m_node_type);
-        n.m_node_type = node_t::BOOLEAN;
+        n.destroy_value();
+        n.m_node_value.attrs.set_type(node_t::BOOLEAN);
         n.m_node_value.boolean = b;
     }
 };
@@ -144,8 +143,8 @@ struct external_node_constructor<node_t::INTEGER>
     template <typename BasicNodeType, enable_if_t<is_basic_node<BasicNodeType>::value, int> = 0>
     static void construct(BasicNodeType& n, typename BasicNodeType::integer_type i) noexcept
     {
-        n.m_node_value.destroy(n.m_node_type);
-        n.m_node_type = node_t::INTEGER;
+        n.destroy_value();
+        n.m_node_value.attrs.set_type(node_t::INTEGER);
         n.m_node_value.integer = i;
     }
 };
@@ -161,8 +160,8 @@ struct external_node_constructor<node_t::FLOAT_NUMBER>
     template <typename BasicNodeType, enable_if_t<is_basic_node<BasicNodeType>::value, int> = 0>
     static void construct(BasicNodeType& n, typename BasicNodeType::float_number_type f) noexcept
     {
-        n.m_node_value.destroy(n.m_node_type);
-        n.m_node_type = node_t::FLOAT_NUMBER;
+        n.destroy_value();
+        n.m_node_value.attrs.set_type(node_t::FLOAT_NUMBER);
         n.m_node_value.float_val = f;
     }
 };
@@ -178,9 +177,9 @@ struct external_node_constructor<node_t::STRING>
     template <typename BasicNodeType, enable_if_t<is_basic_node<BasicNodeType>::value, int> = 0>
     static void construct(BasicNodeType& n, const typename BasicNodeType::string_type& s) noexcept
     {
-        n.m_node_value.destroy(n.m_node_type);
-        n.m_node_type = node_t::STRING;
-        n.m_node_value.p_string = BasicNodeType::template create_object<typename BasicNodeType::string_type>(s);
+        n.destroy_value();
+        n.m_node_value.attrs.set_type(node_t::STRING);
+        n.m_node_value.construct_string(s);
     }
 
     /// @brief Constructs a basic_node object with rvalue strings.
@@ -190,10 +189,22 @@ struct external_node_constructor<node_t::STRING>
     template <typename BasicNodeType, enable_if_t<is_basic_node<BasicNodeType>::value, int> = 0>
     static void construct(BasicNodeType& n, typename BasicNodeType::string_type&& s) noexcept
     {
-        n.m_node_value.destroy(n.m_node_type);
-        n.m_node_type = node_t::STRING;
-        n.m_node_value.p_string =
-            BasicNodeType::template create_object<typename BasicNodeType::string_type>(std::move(s));
+        n.destroy_value();
+        n.m_node_value.attrs.set_type(node_t::STRING);
+        n.m_node_value.construct_string(std::move(s));
+    }
+
+    /// @brief Constructs a basic_node object with an interned string shared with other nodes.
+    /// @tparam BasicNodeType A basic_node template instance type.
+    /// @param n A basic_node object.
+    /// @param p_str A shared pointer to an interned string.
+    template <typename BasicNodeType, enable_if_t<is_basic_node<BasicNodeType>::value, int> = 0>
+    static void construct(BasicNodeType& n, typename BasicNodeType::key_interner_type::pointer&& p_str) noexcept
+    {
+        n.destroy_value();
+        n.m_node_value.attrs.set_type(node_t::STRING);
+        n.m_node_value.attrs.set_shared(true);
+        n.m_node_value.construct_shared_string(std::move(p_str));
     }
 
     /// @brief Constructs a basic_node object with compatible strings.
@@ -210,9 +221,9 @@ struct external_node_constructor<node_t::STRING>
             int> = 0>
     static void construct(BasicNodeType& n, const CompatibleStringType& s) noexcept
     {
-        n.m_node_value.destroy(n.m_node_type);
-        n.m_node_type = node_t::STRING;
-        n.m_node_value.p_string = BasicNodeType::template create_object<typename BasicNodeType::string_type>(s);
+        n.destroy_value();
+        n.m_node_value.attrs.set_type(node_t::STRING);
+        n.m_node_value.construct_string(typename BasicNodeType::string_type(s));
     }
 };
 
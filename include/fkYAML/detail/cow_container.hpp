@@ -0,0 +1,250 @@
+///  _______   __ __   __  _____   __  __  __
+/// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+/// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.2
+/// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+///
+/// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+/// SPDX-License-Identifier: MIT
+///
+/// @file
+
+#ifndef FK_YAML_DETAIL_COW_CONTAINER_HPP_
+#define FK_YAML_DETAIL_COW_CONTAINER_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include <fkYAML/detail/macros/version_macros.hpp>
+
+/// @brief namespace for fkYAML library.
+FK_YAML_NAMESPACE_BEGIN
+
+/// @brief namespace for internal implementations of fkYAML library.
+namespace detail
+{
+
+/// @brief A container which is shared among nodes with a reference count and copied when it is modified.
+/// @note
+/// Since this class derives from the container type, a pointer to the container type can refer to either a plain
+/// container or a shared one, and nodes distinguish them with their attributes. The reference count is atomic so that
+/// nodes sharing a container can be used in different threads. A shared container also caches the digest of its
+/// contents since it is never modified in place while shared.
+/// @tparam ContainerType A container type to be shared.
+template <typename ContainerType>
+class cow_container : public ContainerType
+{
+public:
+    /// @brief Construct a new cow_container object referenced only by its creator.
+    /// @tparam Args Types of arguments passed to the constructor of the container type.
+    /// @param args Arguments passed to the constructor of the container type.
+    template <typename... Args>
+    explicit cow_container(Args&&... args)
+        : ContainerType(std::forward<Args>(args)...)
+    {
+    }
+
+    /// @brief Add a reference to this container.
+    void add_ref() noexcept
+    {
+        m_ref_count.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /// @brief Release a reference to this container.
+    /// @return true if the released reference was the last one, false otherwise.
+    bool release() noexcept
+    {
+        return m_ref_count.fetch_sub(1, std::memory_order_acq_rel) == 1;
+    }
+
+    /// @brief Check whether this container is referenced only by the caller.
+    /// @return true if this container is not shared with others, false otherwise.
+    bool is_unique() const noexcept
+    {
+        return m_ref_count.load(std::memory_order_acquire) == 1;
+    }
+
+    /// @brief Get the cached digest of this container.
+    /// @return The cached digest, or 0 if it has not been calculated.
+    std::uint64_t cached_digest() const noexcept
+    {
+        return m_digest.load(std::memory_order_relaxed);
+    }
+
+    /// @brief Cache the digest of this container.
+    /// @param digest A non-zero digest.
+    void cache_digest(std::uint64_t digest) const noexcept
+    {
+        m_digest.store(digest, std::memory_order_relaxed);
+    }
+
+    /// @brief Clear the cached digest. Must be called whenever this container may be modified.
+    void clear_digest() noexcept
+    {
+        m_digest.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    /// The number of references to this container.
+    std::atomic<std::size_t> m_ref_count {1};
+    /// The cached digest of this container, or 0 if it has not been calculated.
+    mutable std::atomic<std::uint64_t> m_digest {0};
+};
+
+/// @brief A pointer to an immutable cow_container object, which shares the container with its copies.
+/// @note Unlike std::shared_ptr, this pointer consists of a single raw pointer since the reference count is stored in
+/// the container itself. The container is destroyed when the last pointer to it is destroyed.
+/// @tparam ContainerType A container type to be shared.
+template <typename ContainerType>
+class cow_pointer
+{
+public:
+    /// A type for the shared containers.
+    using element_type = const cow_container<ContainerType>;
+
+    /// @brief Construct a new cow_pointer object which points to nothing.
+    cow_pointer() noexcept = default;
+
+    /// @brief Construct a new cow_pointer object which points to nothing.
+    cow_pointer(std::nullptr_t /*unused*/) noexcept
+    {
+    }
+
+    /// @brief Copy constructor of the cow_pointer class.
+    /// @param other A cow_pointer object to be copied with.
+    cow_pointer(const cow_pointer& other) noexcept
+        : mp_container(other.mp_container)
+    {
+        if (mp_container)
+        {
+            mp_container->add_ref();
+        }
+    }
+
+    /// @brief Move constructor of the cow_pointer class.
+    /// @param other A cow_pointer object to be moved from.
+    cow_pointer(cow_pointer&& other) noexcept
+        : mp_container(other.mp_container)
+    {
+        other.mp_container = nullptr;
+    }
+
+    /// @brief Destroy the cow_pointer object, and the container as well if no other pointer refers to it.
+    ~cow_pointer() noexcept
+    {
+        reset();
+    }
+
+    /// @brief Assignment operator of the cow_pointer class.
+    /// @param rhs A cow_pointer object to be assigned.
+    /// @return Reference to this cow_pointer object.
+    cow_pointer& operator=(cow_pointer rhs) noexcept
+    {
+        swap(rhs);
+        return *this;
+    }
+
+    /// @brief Create a new container shared through the returned pointer.
+    /// @tparam Args Types of arguments passed to the constructor of the container type.
+    /// @param args Arguments passed to the constructor of the container type.
+    /// @return A pointer to the created container.
+    template <typename... Args>
+    static cow_pointer create(Args&&... args)
+    {
+        cow_pointer p;
+        p.mp_container = new cow_container<ContainerType>(std::forward<Args>(args)...);
+        return p;
+    }
+
+    /// @brief Release the reference to the container.
+    void reset() noexcept
+    {
+        if (mp_container && mp_container->release())
+        {
+            delete mp_container;
+        }
+        mp_container = nullptr;
+    }
+
+    /// @brief Swap the containers pointed to by this pointer and the given one.
+    /// @param other A cow_pointer object to be swapped with.
+    void swap(cow_pointer& other) noexcept
+    {
+        cow_container<ContainerType>* p_tmp = mp_container;
+        mp_container = other.mp_container;
+        other.mp_container = p_tmp;
+    }
+
+    /// @brief Get the raw pointer to the shared container.
+    /// @return The raw pointer to the shared container, or nullptr if this points to nothing.
+    element_type* get() const noexcept
+    {
+        return mp_container;
+    }
+
+    /// @brief Dereference the pointer to the shared container.
+    /// @return Constant reference to the shared container.
+    const ContainerType& operator*() const noexcept
+    {
+        return *mp_container;
+    }
+
+    /// @brief Access the members of the shared container.
+    /// @return Constant pointer to the shared container.
+    const ContainerType* operator->() const noexcept
+    {
+        return mp_container;
+    }
+
+    /// @brief Check whether this pointer points to a container.
+    /// @return true if this pointer points to a container, false otherwise.
+    explicit operator bool() const noexcept
+    {
+        return mp_container != nullptr;
+    }
+
+    /// @brief Check whether both pointers point to the same container.
+    /// @param lhs A cow_pointer object.
+    /// @param rhs A cow_pointer object.
+    /// @return true if both pointers point to the same container, false otherwise.
+    friend bool operator==(const cow_pointer& lhs, const cow_pointer& rhs) noexcept
+    {
+        return lhs.mp_container == rhs.mp_container;
+    }
+
+    /// @brief Check whether both pointers point to different containers.
+    /// @param lhs A cow_pointer object.
+    /// @param rhs A cow_pointer object.
+    /// @return true if both pointers point to different containers, false otherwise.
+    friend bool operator!=(const cow_pointer& lhs, const cow_pointer& rhs) noexcept
+    {
+        return lhs.mp_container != rhs.mp_container;
+    }
+
+    /// @brief Check whether the pointer points to nothing.
+    /// @param lhs A cow_pointer object.
+    /// @return true if `lhs` points to nothing, false otherwise.
+    friend bool operator==(const cow_pointer& lhs, std::nullptr_t /*unused*/) noexcept
+    {
+        return lhs.mp_container == nullptr;
+    }
+
+    /// @brief Check whether the pointer points to a container.
+    /// @param lhs A cow_pointer object.
+    /// @return true if `lhs` points to a container, false otherwise.
+    friend bool operator!=(const cow_pointer& lhs, std::nullptr_t /*unused*/) noexcept
+    {
+        return lhs.mp_container != nullptr;
+    }
+
+private:
+    /// The shared container, or nullptr if this points to nothing.
+    cow_container<ContainerType>* mp_container {nullptr};
+};
+
+} // namespace detail
+
+FK_YAML_NAMESPACE_END
+
+#endif /* FK_YAML_DETAIL_COW_CONTAINER_HPP_ */
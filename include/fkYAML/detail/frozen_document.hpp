@@ -0,0 +1,147 @@
+///  _______   __ __   __  _____   __  __  __
+/// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+/// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.2
+/// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+///
+/// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+/// SPDX-License-Identifier: MIT
+///
+/// @file
+
+#ifndef FK_YAML_DETAIL_FROZEN_DOCUMENT_HPP_
+#define FK_YAML_DETAIL_FROZEN_DOCUMENT_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <fkYAML/detail/macros/version_macros.hpp>
+#include <fkYAML/detail/types/node_t.hpp>
+#include <fkYAML/detail/types/yaml_version_t.hpp>
+
+/// @brief namespace for fkYAML library.
+FK_YAML_NAMESPACE_BEGIN
+
+/// @brief namespace for internal implementations of fkYAML library.
+namespace detail
+{
+
+/// @brief An immutable YAML document stored in a few contiguous arrays.
+/// @note
+/// Nodes are stored in depth-first order, so the children of a container follow the container's entry, and the entries
+/// of a mapping alternate between keys and values. String values are stored in a single buffer. Each mapping has a
+/// minimal perfect hash index over its keys (hash-and-displace), so a key is looked up with at most two hash mixes and
+/// a single key comparison. Sequences which have container elements have a table of the element positions so that
+/// elements are accessed in constant time as well.
+/// @tparam BasicNodeType A basic_node template instance type which defines the types of scalar values.
+template <typename BasicNodeType>
+struct basic_frozen_document
+{
+    /** A type for boolean node values. */
+    using boolean_type = typename BasicNodeType::boolean_type;
+    /** A type for integer node values. */
+    using integer_type = typename BasicNodeType::integer_type;
+    /** A type for float number node values. */
+    using float_number_type = typename BasicNodeType::float_number_type;
+    /** A type for string node values. */
+    using string_type = typename BasicNodeType::string_type;
+
+    /// The index value which means the absence of a table.
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    /// @brief A node in the document.
+    struct entry
+    {
+        /// The type of the node.
+        node_t type;
+        /// The index of the entry which follows this node and all its children.
+        std::size_t next;
+        /// The number of elements (sequence), key/value pairs (mapping) or characters (string).
+        std::size_t size;
+        /// The offset of the element table (sequence) or the hash index (mapping), or npos if the node has none.
+        std::size_t table;
+        /// The scalar value or the offset of the string in strings.
+        union
+        {
+            boolean_type boolean;
+            integer_type integer;
+            float_number_type float_val;
+            std::size_t position;
+        } value;
+    };
+
+    /// @brief Calculate the hash value of a key which is used to find the key in the hash index of a mapping.
+    /// @note
+    /// Float numbers and containers are hashed only by their types since they are not compared bitwise. Mappings whose
+    /// keys cannot be told apart by their hash values fall back to linear search.
+    /// @param type The type of the key.
+    /// @param bits The bit pattern of a boolean or an integer key. Ignored for other types.
+    /// @param p_str The characters of a string key. Ignored for other types.
+    /// @param len The number of characters of a string key. Ignored for other types.
+    /// @return The hash value of the key.
+    static std::uint64_t hash_key(node_t type, std::uint64_t bits, const char* p_str, std::size_t len) noexcept
+    {
+        std::uint64_t h = 0xcbf29ce484222325ULL ^ static_cast<std::uint64_t>(type);
+        switch (type)
+        {
+        case node_t::BOOLEAN:
+        case node_t::INTEGER:
+            h ^= bits;
+            break;
+        case node_t::STRING:
+            // FNV-1a
+            for (std::size_t i = 0; i < len; i++)
+            {
+                h = (h ^ static_cast<std::uint8_t>(p_str[i])) * 0x100000001b3ULL;
+            }
+            break;
+        default:
+            break;
+        }
+        return mix(h);
+    }
+
+    /// @brief Calculate the slot of a key in a hash index with a displacement.
+    /// @param hash The hash value of the key.
+    /// @param displacement A positive displacement value.
+    /// @param size The number of slots in the hash index.
+    /// @return The slot of the key.
+    static std::size_t displaced_slot(std::uint64_t hash, std::ptrdiff_t displacement, std::size_t size) noexcept
+    {
+        return static_cast<std::size_t>(
+            mix(hash + static_cast<std::uint64_t>(displacement) * 0x9e3779b97f4a7c15ULL) % size);
+    }
+
+    /// @brief Scramble the bits of a hash value. (the finalizer of splitmix64)
+    /// @param h A hash value.
+    /// @return The scrambled hash value.
+    static std::uint64_t mix(std::uint64_t h) noexcept
+    {
+        h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        h = (h ^ (h >> 27)) * 0x94d049bb133111ebULL;
+        return h ^ (h >> 31);
+    }
+
+    /// The nodes in depth-first order.
+    std::vector<entry> entries {};
+    /// The concatenated string values.
+    string_type strings {};
+    /// The entry indices of the elements of sequences which have container elements.
+    std::vector<std::size_t> elements {};
+    /// The displacements of the buckets in the hash indexes of mappings. A negative value -(s+1) refers to the slot s
+    /// directly, and 0 marks an empty bucket.
+    std::vector<std::ptrdiff_t> displacements {};
+    /// The entry indices of the keys in the slots of the hash indexes of mappings.
+    std::vector<std::size_t> slots {};
+    /// The YAML version of the document.
+    yaml_version_t version {yaml_version_t::VER_1_2};
+};
+
+template <typename BasicNodeType>
+constexpr std::size_t basic_frozen_document<BasicNodeType>::npos;
+
+} // namespace detail
+
+FK_YAML_NAMESPACE_END
+
+#endif /* FK_YAML_DETAIL_FROZEN_DOCUMENT_HPP_ */
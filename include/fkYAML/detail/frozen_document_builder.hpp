@@ -0,0 +1,384 @@
+///  _______   __ __   __  _____   __  __  __
+/// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+/// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.2
+/// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+///
+/// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+/// SPDX-License-Identifier: MIT
+///
+/// @file
+
+#ifndef FK_YAML_DETAIL_FROZEN_DOCUMENT_BUILDER_HPP_
+#define FK_YAML_DETAIL_FROZEN_DOCUMENT_BUILDER_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <fkYAML/detail/frozen_document.hpp>
+#include <fkYAML/detail/macros/version_macros.hpp>
+#include <fkYAML/detail/meta/node_traits.hpp>
+#include <fkYAML/detail/node_string_accessor.hpp>
+#include <fkYAML/detail/types/node_t.hpp>
+
+/// @brief namespace for fkYAML library.
+FK_YAML_NAMESPACE_BEGIN
+
+/// @brief namespace for internal implementations of fkYAML library.
+namespace detail
+{
+
+/// @brief A class which builds a frozen document from a basic_node object without recursion.
+/// @tparam BasicNodeType A basic_node template instance type.
+template <typename BasicNodeType>
+class basic_frozen_document_builder
+{
+    static_assert(is_basic_node<BasicNodeType>::value, "basic_frozen_document_builder only accepts basic_node<...>");
+
+    /** A type for frozen documents. */
+    using document_type = basic_frozen_document<BasicNodeType>;
+    /** A type for document entries. */
+    using entry_type = typename document_type::entry;
+    /** A type for sequence node value containers. */
+    using sequence_type = typename BasicNodeType::sequence_type;
+    /** A type for mapping node value containers. */
+    using mapping_type = typename BasicNodeType::mapping_type;
+    /** A type for boolean node values. */
+    using boolean_type = typename BasicNodeType::boolean_type;
+    /** A type for integer node values. */
+    using integer_type = typename BasicNodeType::integer_type;
+    /** A type for float number node values. */
+    using float_number_type = typename BasicNodeType::float_number_type;
+    /** A type for string node values. */
+    using string_type = typename BasicNodeType::string_type;
+
+    /// The maximum displacement tried for a bucket before giving up the hash index of a mapping.
+    static constexpr std::ptrdiff_t max_displacement = 1 << 16;
+
+    /// @brief A container node whose children are being recorded.
+    class frame
+    {
+    public:
+        /// @brief Construct a new frame object.
+        /// @param index The index of the entry of the container.
+        /// @param node A container node.
+        frame(std::size_t index, const BasicNodeType& node)
+            : m_index(index),
+              m_is_mapping(node.is_mapping())
+        {
+            if (m_is_mapping)
+            {
+                const mapping_type& map = node.template get_value_ref<const mapping_type&>();
+                m_map_itr = map.begin();
+                m_map_end = map.end();
+            }
+            else
+            {
+                const sequence_type& seq = node.template get_value_ref<const sequence_type&>();
+                m_seq_itr = seq.begin();
+                m_seq_end = seq.end();
+            }
+        }
+
+        /// @brief Get the index of the entry of the container.
+        /// @return The index of the entry of the container.
+        std::size_t index() const noexcept
+        {
+            return m_index;
+        }
+
+        /// @brief Get the next child in document order. Mapping keys and values are returned alternately.
+        /// @return The pointer to the next child, or nullptr if no children are left.
+        const BasicNodeType* next()
+        {
+            if (m_is_mapping)
+            {
+                if (m_is_value_next)
+                {
+                    m_is_value_next = false;
+                    return &(m_map_itr++)->second;
+                }
+                if (m_map_itr == m_map_end)
+                {
+                    return nullptr;
+                }
+                m_is_value_next = true;
+                return &m_map_itr->first;
+            }
+
+            return (m_seq_itr == m_seq_end) ? nullptr : &*(m_seq_itr++);
+        }
+
+    private:
+        /// The index of the entry of the container.
+        std::size_t m_index;
+        /// Whether the container is a mapping.
+        bool m_is_mapping;
+        /// Whether the value of the current mapping entry is returned next.
+        bool m_is_value_next {false};
+        /// The next sequence element.
+        typename sequence_type::const_iterator m_seq_itr {};
+        /// The end of the sequence.
+        typename sequence_type::const_iterator m_seq_end {};
+        /// The next mapping entry.
+        typename mapping_type::const_iterator m_map_itr {};
+        /// The end of the mapping.
+        typename mapping_type::const_iterator m_map_end {};
+    };
+
+    /// @brief A key of a mapping being indexed.
+    struct hashed_key
+    {
+        /// The bucket of the key.
+        std::size_t bucket;
+        /// The hash value of the key.
+        std::uint64_t hash;
+        /// The index of the entry of the key.
+        std::size_t index;
+    };
+
+public:
+    /// @brief Build a frozen document from the given node and all the nodes in it.
+    /// @param root A root node of the document.
+    /// @return The frozen document.
+    static std::shared_ptr<document_type> build(const BasicNodeType& root)
+    {
+        std::shared_ptr<document_type> p_doc = std::make_shared<document_type>();
+        document_type& doc = *p_doc;
+        doc.version = root.get_yaml_version();
+
+        std::vector<frame> stack;
+        if (append(doc, root))
+        {
+            stack.emplace_back(0, root);
+        }
+
+        while (!stack.empty())
+        {
+            const BasicNodeType* p_child = stack.back().next();
+            if (!p_child)
+            {
+                const std::size_t index = stack.back().index();
+                stack.pop_back();
+                close(doc, index);
+                continue;
+            }
+
+            const std::size_t child_index = doc.entries.size();
+            if (append(doc, *p_child))
+            {
+                stack.emplace_back(child_index, *p_child);
+            }
+        }
+
+        return p_doc;
+    }
+
+private:
+    /// @brief Append an entry for the given node to the document. Children are not appended.
+    /// @param doc A document being built.
+    /// @param node A node to be appended.
+    /// @return true if the node is a container, false otherwise.
+    static bool append(document_type& doc, const BasicNodeType& node)
+    {
+        entry_type e {};
+        e.type = node.type();
+        e.next = doc.entries.size() + 1;
+        e.table = document_type::npos;
+
+        bool is_container = false;
+        switch (e.type)
+        {
+        case node_t::SEQUENCE:
+            e.size = node.template get_value_ref<const sequence_type&>().size();
+            is_container = true;
+            break;
+        case node_t::MAPPING:
+            e.size = node.template get_value_ref<const mapping_type&>().size();
+            is_container = true;
+            break;
+        case node_t::NULL_OBJECT:
+            break;
+        case node_t::BOOLEAN:
+            e.value.boolean = node.template get_value_ref<const boolean_type&>();
+            break;
+        case node_t::INTEGER:
+            e.value.integer = node.template get_value_ref<const integer_type&>();
+            break;
+        case node_t::FLOAT_NUMBER:
+            e.value.float_val = node.template get_value_ref<const float_number_type&>();
+            break;
+        case node_t::STRING: {
+            using accessor_type = node_string_accessor<BasicNodeType>;
+            e.value.position = doc.strings.size();
+            e.size = accessor_type::size(node);
+            doc.strings.append(accessor_type::data(node), e.size);
+            break;
+        }
+        }
+
+        doc.entries.push_back(e);
+        return is_container;
+    }
+
+    /// @brief Finish the entry of a container whose children have all been appended.
+    /// @param doc A document being built.
+    /// @param index The index of the entry of the container.
+    static void close(document_type& doc, std::size_t index)
+    {
+        entry_type& e = doc.entries[index];
+        e.next = doc.entries.size();
+
+        if (e.type == node_t::MAPPING)
+        {
+            e.table = build_hash_index(doc, index);
+        }
+        else if (e.next - index - 1 != e.size)
+        {
+            // elements can be located without a table only if all of them are scalars.
+            e.table = doc.elements.size();
+            for (std::size_t i = index + 1; i != e.next; i = doc.entries[i].next)
+            {
+                doc.elements.push_back(i);
+            }
+        }
+    }
+
+    /// @brief Build a minimal perfect hash index over the keys of a mapping with the hash-and-displace method.
+    /// @param doc A document being built.
+    /// @param index The index of the entry of the mapping.
+    /// @return The offset of the hash index, or npos if the keys cannot be indexed.
+    static std::size_t build_hash_index(document_type& doc, std::size_t index)
+    {
+        const std::size_t size = doc.entries[index].size;
+        if (size == 0)
+        {
+            return document_type::npos;
+        }
+
+        std::vector<hashed_key> keys;
+        keys.reserve(size);
+        for (std::size_t i = index + 1; i != doc.entries[index].next; i = doc.entries[doc.entries[i].next].next)
+        {
+            const std::uint64_t hash = hash_entry(doc, i);
+            keys.push_back(hashed_key {static_cast<std::size_t>(hash % size), hash, i});
+        }
+        std::sort(keys.begin(), keys.end(), [](const hashed_key& lhs, const hashed_key& rhs) {
+            return lhs.bucket < rhs.bucket || (lhs.bucket == rhs.bucket && lhs.hash < rhs.hash);
+        });
+
+        // collect the buckets as ranges in keys, the largest first.
+        std::vector<std::pair<std::size_t, std::size_t>> buckets;
+        for (std::size_t first = 0, last = 0; first < size; first = last)
+        {
+            while (last < size && keys[last].bucket == keys[first].bucket)
+            {
+                if (last > first && keys[last].hash == keys[last - 1].hash)
+                {
+                    // keys which cannot be told apart by their hash values can never be displaced apart.
+                    return document_type::npos;
+                }
+                ++last;
+            }
+            buckets.emplace_back(first, last);
+        }
+        std::stable_sort(
+            buckets.begin(),
+            buckets.end(),
+            [](const std::pair<std::size_t, std::size_t>& lhs, const std::pair<std::size_t, std::size_t>& rhs) {
+                return lhs.second - lhs.first > rhs.second - rhs.first;
+            });
+
+        const std::size_t offset = doc.slots.size();
+        doc.displacements.resize(offset + size, 0);
+        doc.slots.resize(offset + size, document_type::npos);
+        std::ptrdiff_t* p_displacements = doc.displacements.data() + offset;
+        std::size_t* p_slots = doc.slots.data() + offset;
+
+        std::vector<std::size_t> candidates;
+        std::size_t free_slot = 0;
+        for (const auto& bucket : buckets)
+        {
+            const hashed_key& first_key = keys[bucket.first];
+
+            if (bucket.second - bucket.first == 1)
+            {
+                // a key alone in its bucket is placed in any free slot directly.
+                while (p_slots[free_slot] != document_type::npos)
+                {
+                    ++free_slot;
+                }
+                p_slots[free_slot] = first_key.index;
+                p_displacements[first_key.bucket] = -static_cast<std::ptrdiff_t>(free_slot) - 1;
+                continue;
+            }
+
+            std::ptrdiff_t displacement = 1;
+            for (; displacement <= max_displacement; displacement++)
+            {
+                candidates.clear();
+                for (std::size_t i = bucket.first; i < bucket.second; i++)
+                {
+                    const std::size_t slot = document_type::displaced_slot(keys[i].hash, displacement, size);
+                    if (p_slots[slot] != document_type::npos ||
+                        std::find(candidates.begin(), candidates.end(), slot) != candidates.end())
+                    {
+                        break;
+                    }
+                    candidates.push_back(slot);
+                }
+                if (candidates.size() == bucket.second - bucket.first)
+                {
+                    break;
+                }
+            }
+
+            if (displacement > max_displacement)
+            {
+                doc.displacements.resize(offset); // LCOV_EXCL_LINE
+                doc.slots.resize(offset);         // LCOV_EXCL_LINE
+                return document_type::npos;       // LCOV_EXCL_LINE
+            }
+
+            for (std::size_t i = 0; i < candidates.size(); i++)
+            {
+                p_slots[candidates[i]] = keys[bucket.first + i].index;
+            }
+            p_displacements[first_key.bucket] = displacement;
+        }
+
+        return offset;
+    }
+
+    /// @brief Calculate the hash value of a key entry.
+    /// @param doc A document being built.
+    /// @param index The index of the key entry.
+    /// @return The hash value of the key entry.
+    static std::uint64_t hash_entry(const document_type& doc, std::size_t index)
+    {
+        const entry_type& e = doc.entries[index];
+        switch (e.type)
+        {
+        case node_t::BOOLEAN:
+            return document_type::hash_key(e.type, e.value.boolean ? 1 : 0, nullptr, 0);
+        case node_t::INTEGER:
+            return document_type::hash_key(e.type, static_cast<std::uint64_t>(e.value.integer), nullptr, 0);
+        case node_t::STRING:
+            return document_type::hash_key(e.type, 0, doc.strings.data() + e.value.position, e.size);
+        default:
+            return document_type::hash_key(e.type, 0, nullptr, 0);
+        }
+    }
+};
+
+template <typename BasicNodeType>
+constexpr std::ptrdiff_t basic_frozen_document_builder<BasicNodeType>::max_displacement;
+
+} // namespace detail
+
+FK_YAML_NAMESPACE_END
+
+#endif /* FK_YAML_DETAIL_FROZEN_DOCUMENT_BUILDER_HPP_ */
@@ -0,0 +1,1043 @@
+///  _______   __ __   __  _____   __  __  __
+/// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+/// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.2
+/// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+///
+/// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+/// SPDX-License-Identifier: MIT
+///
+/// @file
+
+#ifndef FK_YAML_DETAIL_INPUT_BINDING_READER_HPP_
+#define FK_YAML_DETAIL_INPUT_BINDING_READER_HPP_
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <fkYAML/detail/macros/version_macros.hpp>
+#include <fkYAML/detail/input/node_builder.hpp>
+#include <fkYAML/detail/meta/detect.hpp>
+#include <fkYAML/detail/meta/node_traits.hpp>
+#include <fkYAML/detail/meta/stl_supplement.hpp>
+#include <fkYAML/detail/node_string_accessor.hpp>
+#include <fkYAML/detail/types/node_t.hpp>
+#include <fkYAML/detail/types/yaml_version_t.hpp>
+#include <fkYAML/exception.hpp>
+
+/// @brief namespace for fkYAML library.
+FK_YAML_NAMESPACE_BEGIN
+
+/// @brief namespace for internal implementations of fkYAML library.
+namespace detail
+{
+
+/// @brief Definition of the kinds of requests to bound values.
+enum class bound_event_t
+{
+    NULL_OBJECT,    //!< assign a null scalar.
+    BOOLEAN,        //!< assign a boolean scalar.
+    INTEGER,        //!< assign an integer scalar.
+    FLOAT_NUMBER,   //!< assign a float number scalar.
+    STRING,         //!< assign a string scalar.
+    START_MAPPING,  //!< start reading a mapping.
+    START_SEQUENCE, //!< start reading a sequence.
+    KEY,            //!< find the value for a mapping key.
+    ELEMENT,        //!< add a new sequence element.
+    NODE,           //!< assign a basic_node object.
+};
+
+template <typename BasicNodeType>
+struct basic_bound_event;
+
+/// @brief A reference to a value which parse events are written into.
+/// @tparam BasicNodeType A basic_node template instance type.
+template <typename BasicNodeType>
+struct basic_bound_target
+{
+    /** A type for functions which handle requests to values. */
+    using handler_type = bool (*)(void*, basic_bound_event<BasicNodeType>&);
+
+    /// @brief Construct a new basic_bound_target object which refers to no value.
+    basic_bound_target() = default;
+
+    /// @brief Construct a new basic_bound_target object which refers to a value.
+    /// @param p_target_value The pointer to the value.
+    /// @param p_target_handler The function which handles requests to the value.
+    basic_bound_target(void* p_target_value, handler_type p_target_handler) noexcept
+        : p_value(p_target_value),
+          p_handler(p_target_handler)
+    {
+    }
+
+    /// The pointer to the value.
+    void* p_value {nullptr};
+    /// The function which handles requests to the value.
+    handler_type p_handler {nullptr};
+
+    /// @brief Check if this refers to a value.
+    /// @return true if this refers to a value, false otherwise.
+    bool is_valid() const noexcept
+    {
+        return p_value != nullptr;
+    }
+
+    /// @brief Let the value handle a request.
+    /// @param event A request to the value.
+    /// @return true if the value has handled the request, false otherwise.
+    bool handle(basic_bound_event<BasicNodeType>& event) const
+    {
+        return p_handler(p_value, event);
+    }
+};
+
+/// @brief A request to a bound value.
+/// @tparam BasicNodeType A basic_node template instance type.
+template <typename BasicNodeType>
+struct basic_bound_event
+{
+    /// The kind of the request.
+    bound_event_t type {bound_event_t::NULL_OBJECT};
+    /// The boolean scalar value.
+    typename BasicNodeType::boolean_type boolean {};
+    /// The integer scalar value.
+    typename BasicNodeType::integer_type integer {};
+    /// The float number scalar value.
+    typename BasicNodeType::float_number_type float_val {};
+    /// The string scalar value or the mapping key if it is a string.
+    typename BasicNodeType::string_type* p_string {nullptr};
+    /// The type of the mapping key.
+    node_t key_type {node_t::NULL_OBJECT};
+    /// The node value.
+    BasicNodeType* p_node {nullptr};
+    /// [out] The value for the mapping key or the new sequence element.
+    basic_bound_target<BasicNodeType> child {};
+    /// [out] The index of the field for the mapping key, which is used to detect duplicate keys.
+    std::size_t field_index {static_cast<std::size_t>(-1)};
+    /// [out] Whether the mapping key has already been read.
+    bool is_duplicate {false};
+};
+
+/// @brief A field binder which finds the field whose name is equal to a mapping key.
+/// @note
+/// An object of this class is passed to user-defined bind_fields() functions, which call it with every field, so
+/// that a key is looked up with a sequence of string comparisons generated at compile time.
+/// @tparam BasicNodeType A basic_node template instance type.
+template <typename BasicNodeType>
+class basic_field_lookup;
+
+/// @brief A type which represents bind_fields function.
+/// @tparam BinderType A type of field binders.
+/// @tparam T A type whose fields are bound.
+template <typename BinderType, typename T>
+using bind_fields_function_t = decltype(bind_fields(std::declval<BinderType&>(), std::declval<T&>()));
+
+/// @brief Type traits to check if T provides bind_fields function found by ADL.
+/// @tparam BasicNodeType A basic_node template instance type.
+/// @tparam T A type to be checked.
+template <typename BasicNodeType, typename T>
+struct has_bind_fields : is_detected<bind_fields_function_t, basic_field_lookup<BasicNodeType>, T>
+{
+};
+
+/// @brief Type traits to check if T is a std::vector which bound values can be written into.
+/// @tparam T A type to be checked.
+template <typename T>
+struct is_bound_vector : std::false_type
+{
+};
+
+/// @brief A partial specialization of is_bound_vector for std::vector except std::vector<bool>.
+/// @tparam ElemType An element type.
+/// @tparam Allocator An allocator type.
+template <typename ElemType, typename Allocator>
+struct is_bound_vector<std::vector<ElemType, Allocator>> : negation<std::is_same<ElemType, bool>>
+{
+};
+
+/// @brief Type traits to check if T is a std::map or std::unordered_map with string keys.
+/// @tparam BasicNodeType A basic_node template instance type.
+/// @tparam T A type to be checked.
+template <typename BasicNodeType, typename T>
+struct is_bound_map : std::false_type
+{
+};
+
+/// @brief A partial specialization of is_bound_map for std::map.
+template <typename BasicNodeType, typename KeyType, typename ValueType, typename Compare, typename Allocator>
+struct is_bound_map<BasicNodeType, std::map<KeyType, ValueType, Compare, Allocator>>
+    : std::is_same<KeyType, typename BasicNodeType::string_type>
+{
+};
+
+/// @brief A partial specialization of is_bound_map for std::unordered_map.
+template <
+    typename BasicNodeType, typename KeyType, typename ValueType, typename Hash, typename KeyEqual, typename Allocator>
+struct is_bound_map<BasicNodeType, std::unordered_map<KeyType, ValueType, Hash, KeyEqual, Allocator>>
+    : std::is_same<KeyType, typename BasicNodeType::string_type>
+{
+};
+
+/// @brief Type traits to check if T is one of the scalar types of BasicNodeType.
+/// @tparam BasicNodeType A basic_node template instance type.
+/// @tparam T A type to be checked.
+template <typename BasicNodeType, typename T>
+struct is_bound_scalar : disjunction<
+                             std::is_same<T, typename BasicNodeType::boolean_type>,
+                             std::is_same<T, typename BasicNodeType::integer_type>,
+                             std::is_same<T, typename BasicNodeType::float_number_type>,
+                             std::is_same<T, typename BasicNodeType::string_type>>
+{
+};
+
+/// @brief The handler of requests to values which are converted from basic_node objects with get_value().
+/// @tparam BasicNodeType A basic_node template instance type.
+/// @tparam T A type of values.
+/// @tparam typename N/A
+template <typename BasicNodeType, typename T, typename = void>
+struct bound_value_handler
+{
+    /// @brief Handle a request to a value.
+    /// @param p_value The pointer to a value.
+    /// @param event A request to the value.
+    /// @return true if the request has been handled, false otherwise.
+    static bool handle(void* p_value, basic_bound_event<BasicNodeType>& event)
+    {
+        if (event.type != bound_event_t::NODE)
+        {
+            return false;
+        }
+        assign(*static_cast<T*>(p_value), *event.p_node);
+        return true;
+    }
+
+private:
+    /// @brief Assign a node to a basic_node object.
+    /// @param value A basic_node object.
+    /// @param node A node to be assigned.
+    template <typename U, enable_if_t<is_basic_node<U>::value, int> = 0>
+    static void assign(U& value, BasicNodeType& node)
+    {
+        value = std::move(node);
+    }
+
+    /// @brief Assign a node to a value with get_value().
+    /// @param value A value.
+    /// @param node A node to be converted.
+    template <typename U, enable_if_t<!is_basic_node<U>::value, int> = 0>
+    static void assign(U& value, BasicNodeType& node)
+    {
+        value = node.template get_value<U>();
+    }
+};
+
+/// @brief The handler of requests to values of the scalar types of BasicNodeType.
+/// @tparam BasicNodeType A basic_node template instance type.
+/// @tparam T A type of values.
+template <typename BasicNodeType, typename T>
+struct bound_value_handler<BasicNodeType, T, enable_if_t<is_bound_scalar<BasicNodeType, T>::value>>
+{
+    /// @brief Handle a request to a value.
+    /// @param p_value The pointer to a value.
+    /// @param event A request to the value.
+    /// @return true if the request has been handled, false otherwise.
+    static bool handle(void* p_value, basic_bound_event<BasicNodeType>& event)
+    {
+        T& value = *static_cast<T*>(p_value);
+        switch (event.type)
+        {
+        case bound_event_t::BOOLEAN:
+            return assign(value, event.boolean);
+        case bound_event_t::INTEGER:
+            return assign(value, event.integer);
+        case bound_event_t::FLOAT_NUMBER:
+            return assign(value, event.float_val);
+        case bound_event_t::STRING:
+            return assign(value, *event.p_string);
+        case bound_event_t::NODE:
+            value = event.p_node->template get_value<T>();
+            return true;
+        default:
+            return false;
+        }
+    }
+
+private:
+    /// @brief Assign a scalar of the same type.
+    /// @param value A value.
+    /// @param scalar A scalar value to be assigned.
+    /// @return true always.
+    static bool assign(T& value, T& scalar)
+    {
+        value = std::move(scalar);
+        return true;
+    }
+
+    /// @brief Reject a scalar of another type so that it is converted with get_value().
+    /// @return false always.
+    template <typename U>
+    static bool assign(T& /*unused*/, U& /*unused*/)
+    {
+        return false;
+    }
+};
+
+/// @brief The handler of requests to std::vector values.
+/// @tparam BasicNodeType A basic_node template instance type.
+/// @tparam T A type of values.
+template <typename BasicNodeType, typename T>
+struct bound_value_handler<BasicNodeType, T, enable_if_t<is_bound_vector<T>::value>>
+{
+    /// @brief Handle a request to a value.
+    /// @param p_value The pointer to a value.
+    /// @param event A request to the value.
+    /// @return true if the request has been handled, false otherwise.
+    static bool handle(void* p_value, basic_bound_event<BasicNodeType>& event)
+    {
+        using elem_type = typename T::value_type;
+
+        T& value = *static_cast<T*>(p_value);
+        switch (event.type)
+        {
+        case bound_event_t::START_SEQUENCE:
+            value.clear();
+            return true;
+        case bound_event_t::ELEMENT:
+            value.emplace_back();
+            event.child = {&value.back(), &bound_value_handler<BasicNodeType, elem_type>::handle};
+            return true;
+        case bound_event_t::START_MAPPING:
+            throw type_error("The target node value is not sequence type.", node_t::MAPPING);
+        case bound_event_t::NODE:
+            throw type_error("The target node value is not sequence type.", event.p_node->type());
+        default:
+            return false;
+        }
+    }
+};
+
+/// @brief The handler of requests to std::map or std::unordered_map values with string keys.
+/// @tparam BasicNodeType A basic_node template instance type.
+/// @tparam T A type of values.
+template <typename BasicNodeType, typename T>
+struct bound_value_handler<BasicNodeType, T, enable_if_t<is_bound_map<BasicNodeType, T>::value>>
+{
+    /// @brief Handle a request to a value.
+    /// @param p_value The pointer to a value.
+    /// @param event A request to the value.
+    /// @return true if the request has been handled, false otherwise.
+    static bool handle(void* p_value, basic_bound_event<BasicNodeType>& event)
+    {
+        using mapped_type = typename T::mapped_type;
+
+        T& value = *static_cast<T*>(p_value);
+        switch (event.type)
+        {
+        case bound_event_t::START_MAPPING:
+            value.clear();
+            return true;
+        case bound_event_t::KEY: {
+            if (event.p_string == nullptr)
+            {
+                throw type_error("The target node value type is not string type.", event.key_type);
+            }
+            auto emplace_result = value.emplace(std::move(*event.p_string), mapped_type());
+            event.is_duplicate = !emplace_result.second;
+            event.child = {&emplace_result.first->second, &bound_value_handler<BasicNodeType, mapped_type>::handle};
+            return true;
+        }
+        case bound_event_t::START_SEQUENCE:
+            throw type_error("The target node value type is not mapping type.", node_t::SEQUENCE);
+        case bound_event_t::NODE:
+            throw type_error("The target node value type is not mapping type.", event.p_node->type());
+        default:
+            return false;
+        }
+    }
+};
+
+/// @brief The handler of requests to values of types which provide bind_fields function.
+/// @tparam BasicNodeType A basic_node template instance type.
+/// @tparam T A type of values.
+template <typename BasicNodeType, typename T>
+struct bound_value_handler<
+    BasicNodeType, T,
+    enable_if_t<conjunction<
+        has_bind_fields<BasicNodeType, T>, negation<is_bound_scalar<BasicNodeType, T>>, negation<is_bound_vector<T>>,
+        negation<is_bound_map<BasicNodeType, T>>>::value>>
+{
+    /// @brief Handle a request to a value.
+    /// @param p_value The pointer to a value.
+    /// @param event A request to the value.
+    /// @return true if the request has been handled, false otherwise.
+    static bool handle(void* p_value, basic_bound_event<BasicNodeType>& event)
+    {
+        T& value = *static_cast<T*>(p_value);
+        switch (event.type)
+        {
+        case bound_event_t::START_MAPPING:
+            return true;
+        case bound_event_t::KEY: {
+            if (event.p_string == nullptr)
+            {
+                // keys other than strings never match field names.
+                return true;
+            }
+            basic_field_lookup<BasicNodeType> lookup(*event.p_string);
+            bind_fields(lookup, value);
+            event.child = lookup.get_target();
+            event.field_index = lookup.get_index();
+            return true;
+        }
+        case bound_event_t::START_SEQUENCE:
+            throw type_error("The target node value type is not mapping type.", node_t::SEQUENCE);
+        case bound_event_t::NODE:
+            throw type_error("The target node value type is not mapping type.", event.p_node->type());
+        default:
+            return false;
+        }
+    }
+};
+
+template <typename BasicNodeType>
+class basic_field_lookup
+{
+    /** A type for string node values. */
+    using string_type = typename BasicNodeType::string_type;
+
+public:
+    /// @brief Construct a new basic_field_lookup object.
+    /// @param key A mapping key to be looked up.
+    explicit basic_field_lookup(const string_type& key) noexcept
+        : m_key(key)
+    {
+    }
+
+public:
+    /// @brief Bind a field with its name.
+    /// @tparam T A type of the field.
+    /// @param name The name of the field, which is compared with mapping keys.
+    /// @param field A reference to the field.
+    template <typename T>
+    void operator()(const char* name, T& field)
+    {
+        if (m_target.is_valid())
+        {
+            return;
+        }
+
+        if (m_key == name)
+        {
+            m_target = {&field, &bound_value_handler<BasicNodeType, T>::handle};
+            return;
+        }
+        ++m_index;
+    }
+
+    /// @brief Get the field whose name is equal to the key.
+    /// @return The field, or an invalid target if no field has been found.
+    basic_bound_target<BasicNodeType> get_target() const noexcept
+    {
+        return m_target;
+    }
+
+    /// @brief Get the index of the field whose name is equal to the key.
+    /// @return The index of the field, or static_cast<std::size_t>(-1) if no field has been found.
+    std::size_t get_index() const noexcept
+    {
+        return m_target.is_valid() ? m_index : static_cast<std::size_t>(-1);
+    }
+
+private:
+    /// The mapping key to be looked up.
+    const string_type& m_key;
+    /// The field found so far.
+    basic_bound_target<BasicNodeType> m_target {};
+    /// The number of the fields which have been compared with the key.
+    std::size_t m_index {0};
+};
+
+/// @brief Create a reference to a value which parse events are written into.
+/// @tparam BasicNodeType A basic_node template instance type.
+/// @tparam T A type of the value.
+/// @param value A value.
+/// @return A reference to the value.
+template <typename BasicNodeType, typename T>
+inline basic_bound_target<BasicNodeType> make_bound_target(T& value)
+{
+    return {&value, &bound_value_handler<BasicNodeType, T>::handle};
+}
+
+/// @brief An event handler which writes parse events directly into values of user types.
+/// @note
+/// Scalars are written into fields bound with bind_fields(), std::vector elements, std::map values and the scalar
+/// types of BasicNodeType without creating basic_node objects. Values of other types are built as basic_node objects
+/// and converted with get_value(). Mapping keys which do not match any field are skipped.
+/// @tparam BasicNodeType A basic_node template instance type.
+template <typename BasicNodeType>
+class basic_binding_reader
+{
+    static_assert(is_basic_node<BasicNodeType>::value, "basic_binding_reader only accepts basic_node<...>");
+
+    /** A type for boolean node values. */
+    using boolean_type = typename BasicNodeType::boolean_type;
+    /** A type for integer node values. */
+    using integer_type = typename BasicNodeType::integer_type;
+    /** A type for float number node values. */
+    using float_number_type = typename BasicNodeType::float_number_type;
+    /** A type for string node values. */
+    using string_type = typename BasicNodeType::string_type;
+    /** A type for references to bound values. */
+    using target_type = basic_bound_target<BasicNodeType>;
+    /** A type for requests to bound values. */
+    using event_type = basic_bound_event<BasicNodeType>;
+
+    /// @brief Definition of the ways to handle the current events.
+    enum class read_mode_t
+    {
+        BIND,    //!< write events into bound values.
+        BUILD,   //!< build a basic_node object for a value of a type which has no direct binding.
+        DISCARD, //!< discard all events of a value which is not bound.
+    };
+
+    /// @brief A container value being read.
+    struct read_frame
+    {
+        /// The container value.
+        target_type target;
+        /// Whether the container is a mapping.
+        bool is_mapping;
+        /// Whether the next node is a mapping key.
+        bool needs_key;
+        /// Whether a mapping key has been read and its value has not.
+        bool has_key;
+        /// The value for the last mapping key.
+        target_type child;
+        /// The index of the first field index of this container in m_read_fields.
+        std::size_t read_fields_begin;
+    };
+
+public:
+    /// @brief Construct a new basic_binding_reader object.
+    /// @param root A reference to the value which the root node is written into.
+    explicit basic_binding_reader(target_type root) noexcept
+        : m_root(root)
+    {
+    }
+
+public:
+    /// @brief Get the message of the error which stopped reading.
+    /// @return The error message, or an empty string if no error has occurred.
+    const std::string& get_error_message() const noexcept
+    {
+        return m_error_message;
+    }
+
+    /// @brief Handle the beginning of a document.
+    /// @param version The YAML version of the document.
+    /// @return true to continue parsing.
+    bool start_document(yaml_version_t version)
+    {
+        m_yaml_version = version;
+        return true;
+    }
+
+    /// @brief Handle the end of a document.
+    /// @return true to continue parsing.
+    bool end_document()
+    {
+        m_anchor_table.clear();
+        return true;
+    }
+
+    /// @brief Handle the beginning of a mapping.
+    /// @return true to continue parsing, false otherwise.
+    bool start_mapping()
+    {
+        return start_container(true);
+    }
+
+    /// @brief Handle the end of a mapping.
+    /// @return true to continue parsing, false otherwise.
+    bool end_mapping()
+    {
+        return end_container(true);
+    }
+
+    /// @brief Handle the beginning of a sequence.
+    /// @return true to continue parsing, false otherwise.
+    bool start_sequence()
+    {
+        return start_container(false);
+    }
+
+    /// @brief Handle the end of a sequence.
+    /// @return true to continue parsing, false otherwise.
+    bool end_sequence()
+    {
+        return end_container(false);
+    }
+
+    /// @brief Handle the beginning of a mapping key.
+    /// @return true to continue parsing, false otherwise.
+    bool key()
+    {
+        switch (m_mode)
+        {
+        case read_mode_t::BUILD:
+            m_needs_other_key = true;
+            return check_built(m_builder.key());
+        case read_mode_t::DISCARD:
+            m_needs_other_key = true;
+            return true;
+        case read_mode_t::BIND:
+        default:
+            if (!m_frames.empty() && m_frames.back().is_mapping)
+            {
+                m_frames.back().needs_key = true;
+            }
+            return true;
+        }
+    }
+
+    /// @brief Handle a null scalar.
+    /// @return true to continue parsing, false otherwise.
+    bool scalar(std::nullptr_t)
+    {
+        std::nullptr_t value = nullptr;
+        return handle_scalar(value, node_t::NULL_OBJECT);
+    }
+
+    /// @brief Handle a boolean scalar.
+    /// @param value A boolean scalar value.
+    /// @return true to continue parsing, false otherwise.
+    bool scalar(boolean_type value)
+    {
+        return handle_scalar(value, node_t::BOOLEAN);
+    }
+
+    /// @brief Handle an integer scalar.
+    /// @param value An integer scalar value.
+    /// @return true to continue parsing, false otherwise.
+    bool scalar(integer_type value)
+    {
+        return handle_scalar(value, node_t::INTEGER);
+    }
+
+    /// @brief Handle a float number scalar.
+    /// @param value A float number scalar value.
+    /// @return true to continue parsing, false otherwise.
+    bool scalar(float_number_type value)
+    {
+        return handle_scalar(value, node_t::FLOAT_NUMBER);
+    }
+
+    /// @brief Handle a string scalar.
+    /// @param value A string scalar value.
+    /// @return true to continue parsing, false otherwise.
+    bool scalar(string_type& value)
+    {
+        return handle_scalar(value, node_t::STRING);
+    }
+
+    /// @brief Handle an anchor name which will be attached to the next scalar or alias.
+    /// @param name An anchor name.
+    /// @return true to continue parsing, false otherwise.
+    bool anchor(const string_type& name)
+    {
+        m_anchor_name = name;
+        m_needs_anchor = true;
+        if (m_mode == read_mode_t::BUILD)
+        {
+            m_built_anchors.insert(name);
+            return check_built(m_builder.anchor(name));
+        }
+        return true;
+    }
+
+    /// @brief Handle an alias node.
+    /// @param name An anchor name referenced by the alias.
+    /// @return true to continue parsing, false otherwise.
+    bool alias(const string_type& name)
+    {
+        if (m_mode == read_mode_t::BUILD && m_built_anchors.find(name) != m_built_anchors.end())
+        {
+            // keep the alias in the node being built if its anchor is in the node as well.
+            m_needs_other_key = false;
+            m_needs_anchor = false;
+            return check_built(m_builder.alias(name));
+        }
+
+        auto itr = m_anchor_table.find(name);
+        if (itr == m_anchor_table.end())
+        {
+            m_error_message = "The given anchor name must appear prior to the alias node.";
+            return false;
+        }
+
+        // an alias is read as a copy of the anchored scalar.
+        BasicNodeType value = itr->second;
+        switch (value.type())
+        {
+        case node_t::BOOLEAN:
+            return scalar(value.template get_value<boolean_type>());
+        case node_t::INTEGER:
+            return scalar(value.template get_value<integer_type>());
+        case node_t::FLOAT_NUMBER:
+            return scalar(value.template get_value<float_number_type>());
+        case node_t::STRING: {
+            string_type buffer;
+            return scalar(node_string_accessor<BasicNodeType>::get(value, buffer));
+        }
+        case node_t::NULL_OBJECT:
+        default:
+            return scalar(nullptr);
+        }
+    }
+
+private:
+    /// @brief Handle a scalar according to the current mode.
+    /// @tparam ValueType A type of the scalar value.
+    /// @param value A scalar value.
+    /// @param type The type of the scalar value.
+    /// @return true to continue parsing, false otherwise.
+    template <typename ValueType>
+    bool handle_scalar(ValueType& value, node_t type)
+    {
+        switch (m_mode)
+        {
+        case read_mode_t::BUILD:
+            save_anchor(value);
+            return check_built(m_builder.scalar(value));
+        case read_mode_t::DISCARD:
+            save_anchor(value);
+            return true;
+        case read_mode_t::BIND:
+        default:
+            break;
+        }
+
+        if (!m_frames.empty() && m_frames.back().needs_key)
+        {
+            event_type event;
+            event.type = bound_event_t::KEY;
+            event.p_string = string_of(value);
+            event.key_type = type;
+            return read_key(event);
+        }
+
+        save_anchor(value);
+
+        target_type target {};
+        if (!next_target(target))
+        {
+            return false;
+        }
+        if (!target.is_valid())
+        {
+            return true;
+        }
+
+        event_type event;
+        set_scalar(event, value);
+        if (!target.handle(event))
+        {
+            // convert the scalar with get_value() if the bound value does not accept it as is.
+            BasicNodeType node(std::move(value));
+            event.type = bound_event_t::NODE;
+            event.p_node = &node;
+            target.handle(event);
+        }
+        return true;
+    }
+
+    /// @brief Handle the beginning of a container according to the current mode.
+    /// @param is_mapping Whether the container is a mapping.
+    /// @return true to continue parsing, false otherwise.
+    bool start_container(bool is_mapping)
+    {
+        switch (m_mode)
+        {
+        case read_mode_t::BUILD:
+            m_needs_other_key = false;
+            ++m_depth;
+            return check_built(is_mapping ? m_builder.start_mapping() : m_builder.start_sequence());
+        case read_mode_t::DISCARD:
+            m_needs_other_key = false;
+            ++m_depth;
+            return true;
+        case read_mode_t::BIND:
+        default:
+            break;
+        }
+
+        if (!m_frames.empty() && m_frames.back().needs_key)
+        {
+            // containers as mapping keys never match field names.
+            event_type event;
+            event.type = bound_event_t::KEY;
+            event.key_type = is_mapping ? node_t::MAPPING : node_t::SEQUENCE;
+            if (!read_key(event))
+            {
+                return false;
+            }
+            start_discarding();
+            return true;
+        }
+
+        target_type target {};
+        if (!next_target(target))
+        {
+            return false;
+        }
+        if (!target.is_valid())
+        {
+            start_discarding();
+            return true;
+        }
+
+        event_type event;
+        event.type = is_mapping ? bound_event_t::START_MAPPING : bound_event_t::START_SEQUENCE;
+        if (target.handle(event))
+        {
+            m_frames.push_back({target, is_mapping, false, false, target_type(), m_read_fields.size()});
+            return true;
+        }
+
+        // build the container as a basic_node object if the bound value has no direct binding.
+        m_mode = read_mode_t::BUILD;
+        m_depth = 1;
+        m_build_target = target;
+        m_needs_other_key = false;
+        m_builder = basic_node_builder<BasicNodeType>();
+        m_built_anchors.clear();
+        m_builder.start_document(m_yaml_version);
+        return check_built(is_mapping ? m_builder.start_mapping() : m_builder.start_sequence());
+    }
+
+    /// @brief Handle the end of a container according to the current mode.
+    /// @param is_mapping Whether the container is a mapping.
+    /// @return true to continue parsing, false otherwise.
+    bool end_container(bool is_mapping)
+    {
+        switch (m_mode)
+        {
+        case read_mode_t::BUILD: {
+            if (!check_built(is_mapping ? m_builder.end_mapping() : m_builder.end_sequence()))
+            {
+                return false;
+            }
+            if (--m_depth == 0)
+            {
+                m_mode = read_mode_t::BIND;
+                event_type event;
+                event.type = bound_event_t::NODE;
+                event.p_node = &m_builder.get_root();
+                m_build_target.handle(event);
+            }
+            return true;
+        }
+        case read_mode_t::DISCARD:
+            if (--m_depth == 0)
+            {
+                m_mode = read_mode_t::BIND;
+            }
+            return true;
+        case read_mode_t::BIND:
+        default:
+            m_read_fields.resize(m_frames.back().read_fields_begin);
+            m_frames.pop_back();
+            return true;
+        }
+    }
+
+    /// @brief Take over the error message of the node builder if it has failed.
+    /// @param is_built Whether the node builder has handled an event successfully.
+    /// @return true to continue parsing, false otherwise.
+    bool check_built(bool is_built)
+    {
+        if (!is_built)
+        {
+            m_error_message = m_builder.get_error_message();
+        }
+        return is_built;
+    }
+
+    /// @brief Start discarding all the events of a value which is not bound.
+    void start_discarding()
+    {
+        m_mode = read_mode_t::DISCARD;
+        m_depth = 1;
+        m_needs_other_key = false;
+    }
+
+    /// @brief Find the bound value for a mapping key in the current mapping.
+    /// @param event A request which contains the mapping key.
+    /// @return true to continue parsing, false otherwise.
+    bool read_key(event_type& event)
+    {
+        read_frame& frame = m_frames.back();
+        frame.needs_key = false;
+        frame.has_key = true;
+        frame.target.handle(event);
+        frame.child = event.child;
+
+        bool is_duplicate = event.is_duplicate;
+        if (event.field_index != static_cast<std::size_t>(-1))
+        {
+            for (std::size_t i = frame.read_fields_begin; i < m_read_fields.size(); i++)
+            {
+                is_duplicate = is_duplicate || m_read_fields[i] == event.field_index;
+            }
+            m_read_fields.push_back(event.field_index);
+        }
+
+        if (is_duplicate)
+        {
+            m_error_message = "Detected duplication in mapping keys.";
+            return false;
+        }
+        return true;
+    }
+
+    /// @brief Get the bound value for the next node.
+    /// @param target [out] The bound value, or an invalid target if the next node is not bound.
+    /// @return true to continue parsing, false otherwise.
+    bool next_target(target_type& target)
+    {
+        if (m_frames.empty())
+        {
+            target = m_root;
+            m_root = target_type();
+            return true;
+        }
+
+        read_frame& frame = m_frames.back();
+        if (frame.is_mapping)
+        {
+            if (!frame.has_key)
+            {
+                m_error_message = "A mapping value found without key.";
+                return false;
+            }
+            frame.has_key = false;
+            target = frame.child;
+            return true;
+        }
+
+        event_type event;
+        event.type = bound_event_t::ELEMENT;
+        frame.target.handle(event);
+        target = event.child;
+        return true;
+    }
+
+    /// @brief Keep the value of an anchored scalar in case an alias of it is read.
+    /// @tparam ValueType A type of the scalar value.
+    /// @param value A scalar value.
+    template <typename ValueType>
+    void save_anchor(ValueType& value)
+    {
+        if (m_needs_other_key)
+        {
+            // anchors are attached to values, not to mapping keys.
+            m_needs_other_key = false;
+            return;
+        }
+        if (m_needs_anchor)
+        {
+            m_anchor_table[m_anchor_name] = BasicNodeType(value);
+            m_needs_anchor = false;
+        }
+    }
+
+    /// @brief Get the pointer to a string scalar.
+    /// @param value A string scalar value.
+    /// @return The pointer to the string.
+    static string_type* string_of(string_type& value) noexcept
+    {
+        return &value;
+    }
+
+    /// @brief Get the pointer to a string scalar.
+    /// @return nullptr always since the scalar is not a string.
+    template <typename ValueType>
+    static string_type* string_of(ValueType& /*unused*/) noexcept
+    {
+        return nullptr;
+    }
+
+    /// @brief Set a null scalar to a request.
+    static void set_scalar(event_type& event, std::nullptr_t /*unused*/) noexcept
+    {
+        event.type = bound_event_t::NULL_OBJECT;
+    }
+
+    /// @brief Set a boolean scalar to a request.
+    static void set_scalar(event_type& event, boolean_type value) noexcept
+    {
+        event.type = bound_event_t::BOOLEAN;
+        event.boolean = value;
+    }
+
+    /// @brief Set an integer scalar to a request.
+    static void set_scalar(event_type& event, integer_type value) noexcept
+    {
+        event.type = bound_event_t::INTEGER;
+        event.integer = value;
+    }
+
+    /// @brief Set a float number scalar to a request.
+    static void set_scalar(event_type& event, float_number_type value) noexcept
+    {
+        event.type = bound_event_t::FLOAT_NUMBER;
+        event.float_val = value;
+    }
+
+    /// @brief Set a string scalar to a request.
+    static void set_scalar(event_type& event, string_type& value) noexcept
+    {
+        event.type = bound_event_t::STRING;
+        event.p_string = &value;
+    }
+
+private:
+    /// The value which the root node is written into.
+    target_type m_root;
+    /// The stack of the container values being read.
+    std::vector<read_frame> m_frames {};
+    /// The indices of the fields which have been read in the containers being read.
+    std::vector<std::size_t> m_read_fields {};
+    /// The current way to handle events.
+    read_mode_t m_mode {read_mode_t::BIND};
+    /// The depth of the containers being built or discarded.
+    std::size_t m_depth {0};
+    /// Whether the next built or discarded node is a mapping key.
+    bool m_needs_other_key {false};
+    /// The builder of the node for a value which has no direct binding.
+    basic_node_builder<BasicNodeType> m_builder {};
+    /// The value which the node being built is converted into.
+    target_type m_build_target {};
+    /// The anchor names which appear in the node being built.
+    std::unordered_set<string_type> m_built_anchors {};
+    /// The YAML version of the current document.
+    yaml_version_t m_yaml_version {yaml_version_t::VER_1_2};
+    /// Whether an anchor name is waiting for the next node.
+    bool m_needs_anchor {false};
+    /// The anchor name waiting for the next node.
+    string_type m_anchor_name {};
+    /// The values of the anchored scalars.
+    std::unordered_map<string_type, BasicNodeType> m_anchor_table {};
+    /// The message of the error which stopped reading.
+    std::string m_error_message {};
+};
+
+} // namespace detail
+
+FK_YAML_NAMESPACE_END
+
+#endif /* FK_YAML_DETAIL_INPUT_BINDING_READER_HPP_ */
@@ -0,0 +1,363 @@
+///  _______   __ __   __  _____   __  __  __
+/// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+/// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.2
+/// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+///
+/// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+/// SPDX-License-Identifier: MIT
+///
+/// @file
+
+#ifndef FK_YAML_DETAIL_INPUT_DOCUMENT_SCANNER_HPP_
+#define FK_YAML_DETAIL_INPUT_DOCUMENT_SCANNER_HPP_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <fkYAML/detail/macros/version_macros.hpp>
+
+/// @brief namespace for fkYAML library.
+FK_YAML_NAMESPACE_BEGIN
+
+/// @brief namespace for internal implementations of fkYAML library.
+namespace detail
+{
+
+/// @brief A range of a single YAML document in an input buffer.
+struct document_range
+{
+    /// The position of the first character of the document (including its directives).
+    std::size_t begin;
+    /// The position of the past-the-last character of the document.
+    std::size_t end;
+};
+
+/// @brief A class which finds document boundaries in a UTF-8 encoded YAML stream without tokenizing it.
+/// @note
+/// Document markers (`---` and `...`) are recognized only at the beginning of a line. Quoted scalars are tracked so
+/// that malformed multi-line quoted scalars are reported by the deserializer as a whole instead of being split into
+/// two broken documents. Lines of block scalars are skipped without tracking quotes since quotes in them are just
+/// contents, e.g., an unmatched `"` in a shell script must not hide the next document marker.
+class document_scanner
+{
+public:
+    /// @brief Scan the given buffer and collect the ranges of the documents in it.
+    /// @param buffer A UTF-8 encoded input buffer.
+    /// @return The ranges of the documents in the order of appearance.
+    static std::vector<document_range> scan(const std::string& buffer)
+    {
+        std::vector<document_range> ranges;
+
+        const std::size_t size = buffer.size();
+        std::size_t doc_begin = 0;
+        std::size_t directive_begin = size;
+        bool has_explicit_start = false;
+        bool has_contents = false;
+        char quote = '\0';
+        // the indentation of the line which begins the current block scalar, or npos if not in a block scalar.
+        std::size_t block_indent = std::string::npos;
+
+        std::size_t line_begin = 0;
+        while (line_begin < size)
+        {
+            std::size_t line_end = buffer.find('\n', line_begin);
+            line_end = (line_end == std::string::npos) ? size : line_end + 1;
+
+            if (block_indent != std::string::npos)
+            {
+                // blank lines and lines indented deeper than the indicator line belong to the block scalar.
+                if (!has_node_contents(buffer, line_begin, line_end) ||
+                    get_indentation(buffer, line_begin, line_end) > block_indent)
+                {
+                    line_begin = line_end;
+                    continue;
+                }
+                block_indent = std::string::npos;
+            }
+
+            if (quote == '\0')
+            {
+                if (is_marker_line(buffer, line_begin, line_end, '-'))
+                {
+                    std::size_t next_begin = (directive_begin < line_begin) ? directive_begin : line_begin;
+                    if (has_explicit_start || has_contents)
+                    {
+                        ranges.push_back({doc_begin, next_begin});
+                    }
+                    doc_begin = next_begin;
+                    directive_begin = size;
+                    has_explicit_start = true;
+                    has_contents = false;
+
+                    // the marker line may contain the beginning of the document contents like `--- foo: bar`.
+                    quote = scan_quotes(buffer, line_begin + 3, line_end, quote);
+                    if (quote == '\0' && ends_with_block_indicator(buffer, line_begin, line_end))
+                    {
+                        block_indent = 0;
+                    }
+                    line_begin = line_end;
+                    continue;
+                }
+
+                if (is_marker_line(buffer, line_begin, line_end, '.'))
+                {
+                    if (has_explicit_start || has_contents)
+                    {
+                        ranges.push_back({doc_begin, line_end});
+                    }
+                    doc_begin = line_end;
+                    directive_begin = size;
+                    has_explicit_start = false;
+                    has_contents = false;
+                    line_begin = line_end;
+                    continue;
+                }
+
+                if (buffer[line_begin] == '%' && !has_explicit_start && !has_contents)
+                {
+                    // directives belong to the document which begins with the next `---` marker.
+                    if (directive_begin == size)
+                    {
+                        directive_begin = line_begin;
+                    }
+                    line_begin = line_end;
+                    continue;
+                }
+
+                if (!has_contents && has_node_contents(buffer, line_begin, line_end))
+                {
+                    has_contents = true;
+                }
+            }
+
+            quote = scan_quotes(buffer, line_begin, line_end, quote);
+            if (quote == '\0' && ends_with_block_indicator(buffer, line_begin, line_end))
+            {
+                block_indent = get_indentation(buffer, line_begin, line_end);
+            }
+            line_begin = line_end;
+        }
+
+        if (has_explicit_start || has_contents)
+        {
+            ranges.push_back({doc_begin, size});
+        }
+
+        return ranges;
+    }
+
+private:
+    /// @brief Check if the given line is a document marker line made of three `c` characters.
+    /// @param buffer An input buffer.
+    /// @param begin The beginning position of the line.
+    /// @param end The past-the-end position of the line.
+    /// @param c A character for the marker. (`-` or `.`)
+    /// @return true if the line begins with a document marker, false otherwise.
+    static bool is_marker_line(const std::string& buffer, std::size_t begin, std::size_t end, char c) noexcept
+    {
+        if (end - begin < 3 || buffer[begin] != c || buffer[begin + 1] != c || buffer[begin + 2] != c)
+        {
+            return false;
+        }
+
+        if (begin + 3 == end)
+        {
+            return true;
+        }
+
+        switch (buffer[begin + 3])
+        {
+        case ' ':
+        case '\t':
+        case '\r':
+        case '\n':
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    /// @brief Check if the given line contains anything other than white spaces and comments.
+    /// @param buffer An input buffer.
+    /// @param begin The beginning position of the line.
+    /// @param end The past-the-end position of the line.
+    /// @return true if the line has some node contents, false otherwise.
+    static bool has_node_contents(const std::string& buffer, std::size_t begin, std::size_t end) noexcept
+    {
+        for (std::size_t i = begin; i < end; i++)
+        {
+            switch (buffer[i])
+            {
+            case ' ':
+            case '\t':
+            case '\r':
+            case '\n':
+                break;
+            case '#':
+                return false;
+            default:
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// @brief Count the leading spaces of the given line.
+    /// @param buffer An input buffer.
+    /// @param begin The beginning position of the line.
+    /// @param end The past-the-end position of the line.
+    /// @return The number of spaces at the beginning of the line.
+    static std::size_t get_indentation(const std::string& buffer, std::size_t begin, std::size_t end) noexcept
+    {
+        std::size_t i = begin;
+        while (i < end && buffer[i] == ' ')
+        {
+            i++;
+        }
+        return i - begin;
+    }
+
+    /// @brief Check if the given line ends with a block scalar header like `|`, `>-` or `|2+`, which may be followed
+    /// by a comment.
+    /// @note The line must not end inside a quoted scalar.
+    /// @param buffer An input buffer.
+    /// @param begin The beginning position of the line.
+    /// @param end The past-the-end position of the line.
+    /// @return true if the following lines may be contents of a block scalar, false otherwise.
+    static bool ends_with_block_indicator(const std::string& buffer, std::size_t begin, std::size_t end) noexcept
+    {
+        // find the end of the line contents before a comment.
+        std::size_t last = end;
+        for (std::size_t i = begin; i < end; i++)
+        {
+            if (buffer[i] == '#' && (i == begin || buffer[i - 1] == ' ' || buffer[i - 1] == '\t'))
+            {
+                last = i;
+                break;
+            }
+        }
+
+        while (last > begin && is_white_space(buffer[last - 1]))
+        {
+            last--;
+        }
+
+        // skip chomping and indentation indicators, which are at most two characters in total.
+        for (int n = 0; n < 2 && last > begin; n++)
+        {
+            const char c = buffer[last - 1];
+            if (c != '+' && c != '-' && (c < '1' || c > '9'))
+            {
+                break;
+            }
+            last--;
+        }
+
+        if (last == begin || (buffer[last - 1] != '|' && buffer[last - 1] != '>'))
+        {
+            return false;
+        }
+        return last - 1 == begin || is_white_space(buffer[last - 2]);
+    }
+
+    /// @brief Check if the given character is a white space or a line break.
+    /// @param c A character.
+    /// @return true if `c` is a white space or a line break, false otherwise.
+    static bool is_white_space(char c) noexcept
+    {
+        return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+    }
+
+    /// @brief Track quoted scalars in the given line.
+    /// @param buffer An input buffer.
+    /// @param begin The beginning position of the line.
+    /// @param end The past-the-end position of the line.
+    /// @param quote The quote character of a quoted scalar continued from the previous line, or `\0` if none.
+    /// @return The quote character of a quoted scalar which continues to the next line, or `\0` if none.
+    static char scan_quotes(const std::string& buffer, std::size_t begin, std::size_t end, char quote) noexcept
+    {
+        for (std::size_t i = begin; i < end; i++)
+        {
+            char c = buffer[i];
+
+            if (quote == '\"')
+            {
+                if (c == '\\')
+                {
+                    // skip an escaped character.
+                    i++;
+                }
+                else if (c == '\"')
+                {
+                    quote = '\0';
+                }
+                continue;
+            }
+
+            if (quote == '\'')
+            {
+                if (c == '\'')
+                {
+                    if (i + 1 < end && buffer[i + 1] == '\'')
+                    {
+                        // skip an escaped single quote (`''`).
+                        i++;
+                    }
+                    else
+                    {
+                        quote = '\0';
+                    }
+                }
+                continue;
+            }
+
+            switch (c)
+            {
+            case '\"':
+            case '\'':
+                // quotes inside plain scalars (like `it's`) do not begin quoted scalars.
+                if (i == begin || is_token_boundary(buffer[i - 1]))
+                {
+                    quote = c;
+                }
+                break;
+            case '#':
+                if (i == begin || buffer[i - 1] == ' ' || buffer[i - 1] == '\t')
+                {
+                    // the rest of the line is a comment.
+                    return quote;
+                }
+                break;
+            default:
+                break;
+            }
+        }
+
+        return quote;
+    }
+
+    /// @brief Check if a token can begin right after the given character.
+    /// @param c A character which precedes the current position.
+    /// @return true if a token can begin after `c`, false otherwise.
+    static bool is_token_boundary(char c) noexcept
+    {
+        switch (c)
+        {
+        case ' ':
+        case '\t':
+        case '[':
+        case '{':
+        case ',':
+            return true;
+        default:
+            return false;
+        }
+    }
+};
+
+} // namespace detail
+
+FK_YAML_NAMESPACE_END
+
+#endif /* FK_YAML_DETAIL_INPUT_DOCUMENT_SCANNER_HPP_ */
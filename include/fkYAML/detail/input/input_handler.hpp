@@ -45,21 +45,42 @@ private:
     };
 
 public:
+    /// @brief Construct a new input_handler object with an empty input buffer.
+    input_handler() = default;
+
     /// @brief Construct a new input_handler object.
     /// @tparam InputAdapterType The type of the input adapter.
     /// @param input_adapter An input adapter object
     template <typename InputAdapterType, enable_if_t<is_input_adapter<InputAdapterType>::value, int> = 0>
     explicit input_handler(InputAdapterType&& input_adapter)
-        : m_buffer_size(0)
     {
-        m_buffer.clear();
+        reset(std::forward<InputAdapterType>(input_adapter));
+    }
+
+    /// @brief Replace the input buffer with the contents of another input.
+    /// @note The capacity of the input buffer is retained so that it can be reused for the new input.
+    /// @tparam InputAdapterType The type of the input adapter.
+    /// @param input_adapter An input adapter object
+    template <typename InputAdapterType, enable_if_t<is_input_adapter<InputAdapterType>::value, int> = 0>
+    void reset(InputAdapterType&& input_adapter)
+    {
+        clear();
 
         int ch = s_end_of_input;
         while ((ch = input_adapter.get_character()) != s_end_of_input)
         {
             m_buffer.push_back(char_traits_type::to_char_type(ch));
-            m_buffer_size++;
         }
+        m_buffer_size = m_buffer.size();
+    }
+
+    /// @brief Empty the input buffer.
+    /// @note The capacity of the input buffer is retained so that it can be reused for the next input.
+    void clear() noexcept
+    {
+        m_buffer.clear();
+        m_buffer_size = 0;
+        m_position = position {};
     }
 
     /// @brief Get the character at the current position.
@@ -44,6 +44,7 @@ namespace detail
 {
 
 /// @brief A class which lexically analizes YAML formatted inputs.
+/// @note Scalar tokens are only classified while being scanned. They are converted into values on get_*() calls.
 /// @tparam BasicNodeType A type of the container for YAML values.
 template <typename BasicNodeType, enable_if_t<is_basic_node<BasicNodeType>::value, int> = 0>
 class lexical_analyzer
@@ -75,10 +76,34 @@ public:
     /// @param input_adapter An input adapter object.
     template <typename InputAdapterType, enable_if_t<is_input_adapter<InputAdapterType>::value, int> = 0>
     explicit lexical_analyzer(InputAdapterType&& input_adapter)
-        : m_input_handler(std::move(input_adapter))
+        : m_input_handler(std::forward<InputAdapterType>(input_adapter))
     {
     }
 
+    /// @brief Reset the internal states to analyze another input.
+    /// @note The capacities of the internal buffers are retained so that they can be reused for the new input.
+    /// @tparam InputAdapterType The type of the input adapter.
+    /// @param input_adapter An input adapter object.
+    template <typename InputAdapterType, enable_if_t<is_input_adapter<InputAdapterType>::value, int> = 0>
+    void reset(InputAdapterType&& input_adapter)
+    {
+        clear();
+        m_input_handler.reset(std::forward<InputAdapterType>(input_adapter));
+    }
+
+    /// @brief Empty the input buffer and reset the internal states.
+    /// @note The capacities of the internal buffers are retained so that they can be reused for the next input.
+    void clear() noexcept
+    {
+        m_input_handler.clear();
+        m_value_buffer.clear();
+        m_encoded_size = 0;
+        m_last_token_begin_pos = 0;
+        m_last_token_begin_line = 0;
+        m_flow_context_depth = 0;
+        m_last_token_type = lexical_token_t::END_OF_BUFFER;
+    }
+
     /// @brief Get the next lexical token type by scanning the left of the input buffer.
     /// @return lexical_token_t The next lexical token type.
     lexical_token_t get_next_token()
@@ -310,7 +335,7 @@ public:
     {
         if (m_last_token_type == lexical_token_t::BOOLEAN_VALUE)
         {
-            return m_boolean_val;
+            return from_string(m_value_buffer, type_tag<boolean_type> {});
         }
         emit_error("Invalid request for a boolean value.");
     }
@@ -321,7 +346,7 @@ public:
     {
         if (m_last_token_type == lexical_token_t::INTEGER_VALUE)
         {
-            return m_integer_val;
+            return from_string(m_value_buffer, type_tag<integer_type> {});
         }
         emit_error("Invalid request for an integer value.");
     }
@@ -332,7 +357,7 @@ public:
     {
         if (m_last_token_type == lexical_token_t::FLOAT_NUMBER_VALUE)
         {
-            return m_float_val;
+            return from_string(m_value_buffer, type_tag<float_number_type> {});
         }
         emit_error("Invalid request for a float number value.");
     }
@@ -522,18 +547,6 @@ private:
             emit_error("Invalid character found in a number token."); // LCOV_EXCL_LINE
         }
 
-        switch (ret)
-        {
-        case lexical_token_t::INTEGER_VALUE:
-            m_integer_val = from_string(m_value_buffer, type_tag<integer_type> {});
-            break;
-        case lexical_token_t::FLOAT_NUMBER_VALUE:
-            m_float_val = from_string(m_value_buffer, type_tag<float_number_type> {});
-            break;
-        default:   // LCOV_EXCL_LINE
-            break; // LCOV_EXCL_LINE
-        }
-
         return ret;
     }
 
@@ -722,20 +735,17 @@ private:
         {
             if (m_value_buffer == "null" || m_value_buffer == "Null" || m_value_buffer == "NULL")
             {
-                from_string(m_value_buffer, type_tag<std::nullptr_t> {});
                 return lexical_token_t::NULL_VALUE;
             }
 
             if (m_value_buffer == "true" || m_value_buffer == "True" || m_value_buffer == "TRUE")
             {
-                m_boolean_val = from_string(m_value_buffer, type_tag<boolean_type> {});
                 return lexical_token_t::BOOLEAN_VALUE;
             }
 
             if (m_value_buffer == ".inf" || m_value_buffer == ".Inf" || m_value_buffer == ".INF" ||
                 m_value_buffer == ".nan" || m_value_buffer == ".NaN" || m_value_buffer == ".NAN")
             {
-                m_float_val = from_string(m_value_buffer, type_tag<float_number_type> {});
                 return lexical_token_t::FLOAT_NUMBER_VALUE;
             }
         }
@@ -743,13 +753,11 @@ private:
         {
             if (m_value_buffer == "false" || m_value_buffer == "False" || m_value_buffer == "FALSE")
             {
-                m_boolean_val = from_string(m_value_buffer, type_tag<boolean_type> {});
                 return lexical_token_t::BOOLEAN_VALUE;
             }
 
             if (m_value_buffer == "-.inf" || m_value_buffer == "-.Inf" || m_value_buffer == "-.INF")
             {
-                m_float_val = from_string(m_value_buffer, type_tag<float_number_type> {});
                 return lexical_token_t::FLOAT_NUMBER_VALUE;
             }
         }
@@ -1540,12 +1548,6 @@ private:
     uint32_t m_flow_context_depth {0};
     /// The last found token type.
     lexical_token_t m_last_token_type {lexical_token_t::END_OF_BUFFER};
-    /// A temporal bool holder.
-    boolean_type m_boolean_val {false};
-    /// A temporal integer holder.
-    integer_type m_integer_val {0};
-    /// A temporal floating point number holder.
-    float_number_type m_float_val {0.0};
 };
 
 } // namespace detail
@@ -0,0 +1,394 @@
+///  _______   __ __   __  _____   __  __  __
+/// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+/// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.2
+/// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+///
+/// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+/// SPDX-License-Identifier: MIT
+///
+/// @file
+
+#ifndef FK_YAML_DETAIL_INPUT_NODE_BUILDER_HPP_
+#define FK_YAML_DETAIL_INPUT_NODE_BUILDER_HPP_
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <fkYAML/detail/macros/version_macros.hpp>
+#include <fkYAML/detail/conversions/to_node.hpp>
+#include <fkYAML/detail/meta/node_traits.hpp>
+#include <fkYAML/detail/node_string_accessor.hpp>
+#include <fkYAML/detail/types/yaml_version_t.hpp>
+
+/// @brief namespace for fkYAML library.
+FK_YAML_NAMESPACE_BEGIN
+
+/// @brief namespace for internal implementations of fkYAML library.
+namespace detail
+{
+
+/// @brief An event handler which builds a node tree from parse events.
+/// @note
+/// This class has the same member functions as basic_sax_handler but does not derive from it so that the calls from
+/// the parser can be resolved statically.
+/// @tparam BasicNodeType A basic_node template instance type to be built.
+template <typename BasicNodeType>
+class basic_node_builder
+{
+    static_assert(is_basic_node<BasicNodeType>::value, "basic_node_builder only accepts basic_node<...>");
+
+    /** A type for mapping node value containers. */
+    using mapping_type = typename BasicNodeType::mapping_type;
+    /** A type for sequence node value containers. */
+    using sequence_type = typename BasicNodeType::sequence_type;
+    /** A type for boolean node values. */
+    using boolean_type = typename BasicNodeType::boolean_type;
+    /** A type for integer node values. */
+    using integer_type = typename BasicNodeType::integer_type;
+    /** A type for float number node values. */
+    using float_number_type = typename BasicNodeType::float_number_type;
+    /** A type for string node values. */
+    using string_type = typename BasicNodeType::string_type;
+    /** A type for pools of mapping key strings. */
+    using key_interner_type = typename BasicNodeType::key_interner_type;
+
+    /// @brief A container node being built.
+    struct build_frame
+    {
+        /// The container node.
+        BasicNodeType* p_node;
+        /// The value of the last key in the mapping node which has not been assigned yet.
+        BasicNodeType* p_value;
+        /// Whether the container node is a mapping key.
+        bool is_key;
+    };
+
+public:
+    /// @brief Construct a new basic_node_builder object.
+    basic_node_builder() = default;
+
+    /// @brief Construct a new basic_node_builder object which interns string mapping keys.
+    /// @param key_interner A pool of mapping key strings, which must outlive this builder.
+    explicit basic_node_builder(key_interner_type& key_interner)
+        : m_key_interner(&key_interner)
+    {
+    }
+
+public:
+    /// @brief Get the root node which has been built so far.
+    /// @return The root node.
+    BasicNodeType& get_root() noexcept
+    {
+        return m_root;
+    }
+
+    /// @brief Reset the internal states to build another node tree.
+    /// @note The capacities of the internal buffers are retained so that they can be reused for the next node tree.
+    void reset()
+    {
+        m_root = BasicNodeType();
+        m_frame_stack.clear();
+        m_key_nodes.clear();
+        m_yaml_version = yaml_version_t::VER_1_2;
+        m_needs_key = false;
+        m_needs_anchor_impl = false;
+        m_anchor_name.clear();
+        m_anchor_table.clear();
+        m_error_message.clear();
+    }
+
+    /// @brief Get the message of the error which stopped building the node tree.
+    /// @return The error message, or an empty string if no error has occurred.
+    const std::string& get_error_message() const noexcept
+    {
+        return m_error_message;
+    }
+
+    /// @brief Handle the beginning of a document.
+    /// @param version The YAML version of the document.
+    /// @return true to continue parsing.
+    bool start_document(yaml_version_t version)
+    {
+        m_yaml_version = version;
+        return true;
+    }
+
+    /// @brief Handle the end of a document.
+    /// @return true to continue parsing.
+    bool end_document()
+    {
+        m_anchor_table.clear();
+        m_key_nodes.clear();
+        return true;
+    }
+
+    /// @brief Handle the beginning of a mapping.
+    /// @return true to continue parsing, false otherwise.
+    bool start_mapping()
+    {
+        return start_container(BasicNodeType::mapping());
+    }
+
+    /// @brief Handle the end of a mapping.
+    /// @return true to continue parsing, false otherwise.
+    bool end_mapping()
+    {
+        return end_container();
+    }
+
+    /// @brief Handle the beginning of a sequence.
+    /// @return true to continue parsing, false otherwise.
+    bool start_sequence()
+    {
+        return start_container(BasicNodeType::sequence());
+    }
+
+    /// @brief Handle the end of a sequence.
+    /// @return true to continue parsing, false otherwise.
+    bool end_sequence()
+    {
+        return end_container();
+    }
+
+    /// @brief Handle the beginning of a mapping key.
+    /// @return true to continue parsing.
+    bool key()
+    {
+        m_needs_key = true;
+        return true;
+    }
+
+    /// @brief Handle a null scalar.
+    /// @return true to continue parsing, false otherwise.
+    bool scalar(std::nullptr_t)
+    {
+        return add_scalar(BasicNodeType());
+    }
+
+    /// @brief Handle a boolean scalar.
+    /// @param value A boolean scalar value.
+    /// @return true to continue parsing, false otherwise.
+    bool scalar(boolean_type value)
+    {
+        return add_scalar(BasicNodeType(value));
+    }
+
+    /// @brief Handle an integer scalar.
+    /// @param value An integer scalar value.
+    /// @return true to continue parsing, false otherwise.
+    bool scalar(integer_type value)
+    {
+        return add_scalar(BasicNodeType(value));
+    }
+
+    /// @brief Handle a float number scalar.
+    /// @param value A float number scalar value.
+    /// @return true to continue parsing, false otherwise.
+    bool scalar(float_number_type value)
+    {
+        return add_scalar(BasicNodeType(value));
+    }
+
+    /// @brief Handle a string scalar.
+    /// @param value A string scalar value which is moved into the node tree.
+    /// @return true to continue parsing, false otherwise.
+    bool scalar(string_type& value)
+    {
+        if (m_key_interner != nullptr && m_needs_key &&
+            value.size() > node_string_accessor<BasicNodeType>::inline_capacity())
+        {
+            // equal mapping keys share one interned string.
+            // short keys are not interned since they are stored in place in nodes without allocation.
+            BasicNodeType key;
+            external_node_constructor<node_t::STRING>::construct(key, m_key_interner->intern(std::move(value)));
+            return add_scalar(std::move(key));
+        }
+        return add_scalar(BasicNodeType(std::move(value)));
+    }
+
+    /// @brief Handle an anchor name which will be attached to the next scalar or alias.
+    /// @param name An anchor name.
+    /// @return true to continue parsing.
+    bool anchor(const string_type& name)
+    {
+        m_anchor_name = name;
+        m_needs_anchor_impl = true;
+        return true;
+    }
+
+    /// @brief Handle an alias node.
+    /// @param name An anchor name referenced by the alias.
+    /// @return true to continue parsing, false otherwise.
+    bool alias(const string_type& name)
+    {
+        auto itr = m_anchor_table.find(name);
+        if (itr == m_anchor_table.end())
+        {
+            m_error_message = "The given anchor name must appear prior to the alias node.";
+            return false;
+        }
+        return add_scalar(BasicNodeType::alias_of(itr->second));
+    }
+
+private:
+    /// @brief Add a new scalar (or alias) node to the node tree.
+    /// @param node A scalar node.
+    /// @return true to continue parsing, false otherwise.
+    bool add_scalar(BasicNodeType&& node)
+    {
+        // a pending anchor is attached to the next value, not to a mapping key.
+        bool is_key = m_needs_key && !m_frame_stack.empty() && m_frame_stack.back().p_node->is_mapping();
+
+        BasicNodeType* p_node = add_node(std::move(node));
+        if (p_node == nullptr)
+        {
+            return false;
+        }
+
+        if (m_needs_anchor_impl && !is_key)
+        {
+            p_node->add_anchor_name(m_anchor_name);
+            m_anchor_table[m_anchor_name] = *p_node;
+            m_needs_anchor_impl = false;
+            m_anchor_name.clear();
+        }
+        return true;
+    }
+
+    /// @brief Add a new container node to the node tree and make it the current one.
+    /// @param node An empty container node.
+    /// @return true to continue parsing, false otherwise.
+    bool start_container(BasicNodeType&& node)
+    {
+        bool is_key = m_needs_key && !m_frame_stack.empty();
+        if (is_key)
+        {
+            // a container key is built separately and added to the mapping at its end.
+            m_needs_key = false;
+            m_key_nodes.emplace_back(new BasicNodeType(std::move(node)));
+            m_frame_stack.push_back({m_key_nodes.back().get(), nullptr, true});
+            return true;
+        }
+
+        BasicNodeType* p_node = add_node(std::move(node));
+        if (p_node == nullptr)
+        {
+            return false;
+        }
+        m_frame_stack.push_back({p_node, nullptr, false});
+        return true;
+    }
+
+    /// @brief Finish the current container node.
+    /// @return true to continue parsing, false otherwise.
+    bool end_container()
+    {
+        build_frame frame = m_frame_stack.back();
+        m_frame_stack.pop_back();
+        if (!frame.is_key)
+        {
+            return true;
+        }
+
+        bool is_added = add_key(std::move(*frame.p_node));
+        m_key_nodes.pop_back();
+        return is_added;
+    }
+
+    /// @brief Add a new node at the current position in the node tree.
+    /// @param node A node to be added.
+    /// @return The pointer to the added node, or nullptr if an error has occurred.
+    BasicNodeType* add_node(BasicNodeType&& node)
+    {
+        if (m_frame_stack.empty())
+        {
+            m_root = std::move(node);
+            m_root.set_yaml_version(m_yaml_version);
+            return &m_root;
+        }
+
+        build_frame& frame = m_frame_stack.back();
+        if (frame.p_node->is_sequence())
+        {
+            sequence_type& seq = frame.p_node->template get_value_ref<sequence_type&>();
+            seq.emplace_back(std::move(node));
+            seq.back().set_yaml_version(m_yaml_version);
+            return &seq.back();
+        }
+
+        if (m_needs_key)
+        {
+            m_needs_key = false;
+            return add_key(std::move(node)) ? frame.p_value : nullptr;
+        }
+
+        BasicNodeType* p_value = frame.p_value;
+        if (p_value == nullptr)
+        {
+            m_error_message = "A mapping value found without key.";
+            return nullptr;
+        }
+        frame.p_value = nullptr;
+        *p_value = std::move(node);
+        p_value->set_yaml_version(m_yaml_version);
+        return p_value;
+    }
+
+    /// @brief Add a new key to the current mapping node.
+    /// @param key A key node.
+    /// @return true if the key has been added, false otherwise.
+    bool add_key(BasicNodeType&& key)
+    {
+        build_frame& frame = m_frame_stack.back();
+        if (!frame.p_node->is_mapping())
+        {
+            m_error_message = "A mapping key found in a non-mapping node.";
+            return false;
+        }
+        key.set_yaml_version(m_yaml_version);
+
+        // emplacement fails if the key already exists in the current mapping.
+        auto emplace_result =
+            frame.p_node->template get_value_ref<mapping_type&>().emplace(std::move(key), BasicNodeType());
+        if (!emplace_result.second)
+        {
+            m_error_message = "Detected duplication in mapping keys.";
+            return false;
+        }
+
+        frame.p_value = &(emplace_result.first->second);
+        return true;
+    }
+
+private:
+    /// The root node.
+    BasicNodeType m_root {};
+    /// The stack of container nodes being built.
+    std::vector<build_frame> m_frame_stack {};
+    /// The container keys being built.
+    std::vector<std::unique_ptr<BasicNodeType>> m_key_nodes {};
+    /// The YAML version of the current document.
+    yaml_version_t m_yaml_version {yaml_version_t::VER_1_2};
+    /// Whether the next node is a mapping key.
+    bool m_needs_key {false};
+    /// A flag to determine the need for YAML anchor node implementation.
+    bool m_needs_anchor_impl {false};
+    /// The last YAML anchor name.
+    string_type m_anchor_name {};
+    /// The table of YAML anchor nodes.
+    std::unordered_map<std::string, BasicNodeType> m_anchor_table {};
+    /// The message of the error which stopped building the node tree.
+    std::string m_error_message {};
+    /// The pool of mapping key strings, or nullptr if mapping keys are not interned.
+    key_interner_type* m_key_interner {nullptr};
+};
+
+} // namespace detail
+
+FK_YAML_NAMESPACE_END
+
+#endif /* FK_YAML_DETAIL_INPUT_NODE_BUILDER_HPP_ */
@@ -0,0 +1,634 @@
+///  _______   __ __   __  _____   __  __  __
+/// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+/// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.2
+/// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+///
+/// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+/// SPDX-License-Identifier: MIT
+///
+/// @file
+
+#ifndef FK_YAML_DETAIL_INPUT_NODE_UPDATER_HPP_
+#define FK_YAML_DETAIL_INPUT_NODE_UPDATER_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <fkYAML/detail/macros/version_macros.hpp>
+#include <fkYAML/detail/meta/node_traits.hpp>
+#include <fkYAML/detail/node_string_accessor.hpp>
+#include <fkYAML/detail/types/node_t.hpp>
+#include <fkYAML/detail/types/yaml_version_t.hpp>
+
+/// @brief namespace for fkYAML library.
+FK_YAML_NAMESPACE_BEGIN
+
+/// @brief namespace for internal implementations of fkYAML library.
+namespace detail
+{
+
+/// @brief An event handler which updates an existing node tree in place so that it represents the parsed document.
+/// @note
+/// The resulting node tree is the same as the one built by basic_node_builder, but the existing nodes are reused
+/// wherever the document has the same structure: mapping values are looked up by their keys, sequence elements are
+/// matched by their indices, and scalars of the same type are overwritten in place. So only the nodes which have
+/// changed since the last update allocate memory.
+/// @tparam BasicNodeType A basic_node template instance type to be updated.
+template <typename BasicNodeType>
+class basic_node_updater
+{
+    static_assert(is_basic_node<BasicNodeType>::value, "basic_node_updater only accepts basic_node<...>");
+
+    /** A type for mapping node value containers. */
+    using mapping_type = typename BasicNodeType::mapping_type;
+    /** A type for key-value pairs in mapping node value containers. */
+    using pair_type = typename mapping_type::value_type;
+    /** A type for sequence node value containers. */
+    using sequence_type = typename BasicNodeType::sequence_type;
+    /** A type for boolean node values. */
+    using boolean_type = typename BasicNodeType::boolean_type;
+    /** A type for integer node values. */
+    using integer_type = typename BasicNodeType::integer_type;
+    /** A type for float number node values. */
+    using float_number_type = typename BasicNodeType::float_number_type;
+    /** A type for string node values. */
+    using string_type = typename BasicNodeType::string_type;
+
+    /// @brief A container node being updated.
+    struct update_frame
+    {
+        /// The container node.
+        BasicNodeType* p_node;
+        /// The value of the last key in the mapping node which has not been assigned yet.
+        BasicNodeType* p_value;
+        /// The index of the next element in the sequence node.
+        std::size_t next_index;
+        /// The offset of the entries found in the mapping node in m_found_pairs.
+        std::size_t found_begin;
+        /// Whether the container node is a mapping key.
+        bool is_key;
+        /// The key-value pairs which are not in the mapping node yet. They are added at the end of the mapping.
+        std::vector<std::pair<BasicNodeType, BasicNodeType>> added_pairs;
+    };
+
+public:
+    /// @brief Construct a new basic_node_updater object.
+    /// @param target A node tree to be updated.
+    explicit basic_node_updater(BasicNodeType& target) noexcept
+        : m_target(&target)
+    {
+    }
+
+public:
+    /// @brief Get the message of the error which stopped updating the node tree.
+    /// @return The error message, or an empty string if no error has occurred.
+    const std::string& get_error_message() const noexcept
+    {
+        return m_error_message;
+    }
+
+    /// @brief Handle the beginning of a document.
+    /// @param version The YAML version of the document.
+    /// @return true to continue parsing.
+    bool start_document(yaml_version_t version)
+    {
+        m_yaml_version = version;
+        return true;
+    }
+
+    /// @brief Handle the end of a document.
+    /// @return true to continue parsing.
+    bool end_document()
+    {
+        m_anchor_table.clear();
+        m_key_nodes.clear();
+        return true;
+    }
+
+    /// @brief Handle the beginning of a mapping.
+    /// @return true to continue parsing, false otherwise.
+    bool start_mapping()
+    {
+        return start_container(node_t::MAPPING);
+    }
+
+    /// @brief Handle the end of a mapping.
+    /// @return true to continue parsing, false otherwise.
+    bool end_mapping()
+    {
+        return end_container();
+    }
+
+    /// @brief Handle the beginning of a sequence.
+    /// @return true to continue parsing, false otherwise.
+    bool start_sequence()
+    {
+        return start_container(node_t::SEQUENCE);
+    }
+
+    /// @brief Handle the end of a sequence.
+    /// @return true to continue parsing, false otherwise.
+    bool end_sequence()
+    {
+        return end_container();
+    }
+
+    /// @brief Handle the beginning of a mapping key.
+    /// @return true to continue parsing.
+    bool key()
+    {
+        m_needs_key = true;
+        return true;
+    }
+
+    /// @brief Handle a null scalar.
+    /// @return true to continue parsing, false otherwise.
+    bool scalar(std::nullptr_t)
+    {
+        return add_scalar(nullptr);
+    }
+
+    /// @brief Handle a boolean scalar.
+    /// @param value A boolean scalar value.
+    /// @return true to continue parsing, false otherwise.
+    bool scalar(boolean_type value)
+    {
+        return add_scalar(value);
+    }
+
+    /// @brief Handle an integer scalar.
+    /// @param value An integer scalar value.
+    /// @return true to continue parsing, false otherwise.
+    bool scalar(integer_type value)
+    {
+        return add_scalar(value);
+    }
+
+    /// @brief Handle a float number scalar.
+    /// @param value A float number scalar value.
+    /// @return true to continue parsing, false otherwise.
+    bool scalar(float_number_type value)
+    {
+        return add_scalar(value);
+    }
+
+    /// @brief Handle a string scalar.
+    /// @param value A string scalar value which may be moved into the node tree.
+    /// @return true to continue parsing, false otherwise.
+    bool scalar(string_type& value)
+    {
+        return add_scalar(value);
+    }
+
+    /// @brief Handle an anchor name which will be attached to the next scalar or alias.
+    /// @param name An anchor name.
+    /// @return true to continue parsing.
+    bool anchor(const string_type& name)
+    {
+        m_anchor_name = name;
+        m_needs_anchor_impl = true;
+        return true;
+    }
+
+    /// @brief Handle an alias node.
+    /// @param name An anchor name referenced by the alias.
+    /// @return true to continue parsing, false otherwise.
+    bool alias(const string_type& name)
+    {
+        auto itr = m_anchor_table.find(name);
+        if (itr == m_anchor_table.end())
+        {
+            m_error_message = "The given anchor name must appear prior to the alias node.";
+            return false;
+        }
+        return add_scalar(BasicNodeType::alias_of(itr->second));
+    }
+
+private:
+    /// @brief Check if a node can be updated in place, i.e., it's neither an anchor nor an alias.
+    /// @param node A node to be checked.
+    /// @return true if the node can be updated in place, false otherwise.
+    static bool is_reusable(const BasicNodeType& node) noexcept
+    {
+        return !node.is_anchor() && !node.is_alias();
+    }
+
+    /// @brief Overwrite a node with a null scalar.
+    /// @param node A node to be overwritten.
+    static void assign_scalar(BasicNodeType& node, std::nullptr_t)
+    {
+        if (!node.is_null() || !is_reusable(node))
+        {
+            node = BasicNodeType();
+        }
+    }
+
+    /// @brief Overwrite a node with a boolean scalar.
+    /// @param node A node to be overwritten.
+    /// @param value A boolean scalar value.
+    static void assign_scalar(BasicNodeType& node, boolean_type value)
+    {
+        if (node.is_boolean() && is_reusable(node))
+        {
+            node.template get_value_ref<boolean_type&>() = value;
+            return;
+        }
+        node = BasicNodeType(value);
+    }
+
+    /// @brief Overwrite a node with an integer scalar.
+    /// @param node A node to be overwritten.
+    /// @param value An integer scalar value.
+    static void assign_scalar(BasicNodeType& node, integer_type value)
+    {
+        if (node.is_integer() && is_reusable(node))
+        {
+            node.template get_value_ref<integer_type&>() = value;
+            return;
+        }
+        node = BasicNodeType(value);
+    }
+
+    /// @brief Overwrite a node with a float number scalar.
+    /// @param node A node to be overwritten.
+    /// @param value A float number scalar value.
+    static void assign_scalar(BasicNodeType& node, float_number_type value)
+    {
+        if (node.is_float_number() && is_reusable(node))
+        {
+            node.template get_value_ref<float_number_type&>() = value;
+            return;
+        }
+        node = BasicNodeType(value);
+    }
+
+    /// @brief Overwrite a node with a string scalar.
+    /// @param node A node to be overwritten.
+    /// @param value A string scalar value which may be moved into the node.
+    static void assign_scalar(BasicNodeType& node, string_type& value)
+    {
+        // a string stored in place has no buffer to be reused.
+        if (node.is_string() && !node_string_accessor<BasicNodeType>::is_inline(node) && is_reusable(node))
+        {
+            string_type& str = node.template get_value_ref<string_type&>();
+            if (str.capacity() >= value.size())
+            {
+                // reuse the existing buffer.
+                str.assign(value);
+            }
+            else
+            {
+                str = std::move(value);
+            }
+            return;
+        }
+        node = BasicNodeType(std::move(value));
+    }
+
+    /// @brief Overwrite a node with an alias node.
+    /// @param node A node to be overwritten.
+    /// @param alias An alias node.
+    static void assign_scalar(BasicNodeType& node, BasicNodeType&& alias)
+    {
+        node = std::move(alias);
+    }
+
+    /// @brief Put a new scalar (or alias) at the current position in the node tree.
+    /// @tparam ValueType A type of the scalar value.
+    /// @param value A scalar value.
+    /// @return true to continue parsing, false otherwise.
+    template <typename ValueType>
+    bool add_scalar(ValueType&& value)
+    {
+        if (!m_frames.empty() && !m_frames.back().p_node->is_sequence() && m_needs_key)
+        {
+            // a scalar key is written into the reusable key node only to look up the mapping.
+            // a pending anchor is attached to the next value, not to a mapping key.
+            m_needs_key = false;
+            assign_scalar(m_key_node, std::forward<ValueType>(value));
+            m_key_node.set_yaml_version(m_yaml_version);
+            return add_key(m_frames.back(), m_key_node, false);
+        }
+
+        BasicNodeType* p_node = next_node();
+        if (p_node == nullptr)
+        {
+            return false;
+        }
+
+        assign_scalar(*p_node, std::forward<ValueType>(value));
+        p_node->set_yaml_version(m_yaml_version);
+
+        if (m_needs_anchor_impl)
+        {
+            p_node->add_anchor_name(m_anchor_name);
+            m_anchor_table[m_anchor_name] = *p_node;
+            m_needs_anchor_impl = false;
+            m_anchor_name.clear();
+        }
+        return true;
+    }
+
+    /// @brief Start updating a container node at the current position in the node tree.
+    /// @param type The type of the container node.
+    /// @return true to continue parsing, false otherwise.
+    bool start_container(node_t type)
+    {
+        BasicNodeType* p_node = nullptr;
+        bool is_key = m_needs_key && !m_frames.empty();
+        if (is_key)
+        {
+            // a container key is built separately and looked up in the mapping at its end.
+            m_needs_key = false;
+            m_key_nodes.emplace_back(new BasicNodeType());
+            p_node = m_key_nodes.back().get();
+        }
+        else
+        {
+            p_node = next_node();
+            if (p_node == nullptr)
+            {
+                return false;
+            }
+        }
+
+        if (p_node->type() != type || !is_reusable(*p_node))
+        {
+            *p_node = (type == node_t::MAPPING) ? BasicNodeType::mapping() : BasicNodeType::sequence();
+        }
+        p_node->set_yaml_version(m_yaml_version);
+
+        m_frames.emplace_back();
+        update_frame& frame = m_frames.back();
+        frame.p_node = p_node;
+        frame.p_value = nullptr;
+        frame.next_index = 0;
+        frame.found_begin = m_found_pairs.size();
+        frame.is_key = is_key;
+        return true;
+    }
+
+    /// @brief Finish updating the current container node.
+    /// @return true to continue parsing, false otherwise.
+    bool end_container()
+    {
+        update_frame& frame = m_frames.back();
+        bool is_finished = frame.p_node->is_mapping() ? finish_mapping(frame) : finish_sequence(frame);
+        if (!is_finished)
+        {
+            return false;
+        }
+
+        bool is_key = frame.is_key;
+        BasicNodeType* p_node = frame.p_node;
+        m_frames.pop_back();
+        if (!is_key)
+        {
+            return true;
+        }
+
+        bool is_added = add_key(m_frames.back(), *p_node, true);
+        m_key_nodes.pop_back();
+        return is_added;
+    }
+
+    /// @brief Get the node at the current position in the node tree.
+    /// @return The pointer to the node, or nullptr if an error has occurred.
+    BasicNodeType* next_node()
+    {
+        if (m_frames.empty())
+        {
+            return m_target;
+        }
+
+        update_frame& frame = m_frames.back();
+        if (frame.p_node->is_sequence())
+        {
+            // reuse the element at the same index if any.
+            sequence_type& seq = frame.p_node->template get_value_ref<sequence_type&>();
+            if (frame.next_index < seq.size())
+            {
+                return &seq[frame.next_index++];
+            }
+            seq.emplace_back();
+            ++frame.next_index;
+            return &seq.back();
+        }
+
+        BasicNodeType* p_value = frame.p_value;
+        if (p_value == nullptr)
+        {
+            m_error_message = "A mapping value found without key.";
+            return nullptr;
+        }
+        frame.p_value = nullptr;
+        return p_value;
+    }
+
+    /// @brief Look up a key in the current mapping node and make its value the next node to be updated.
+    /// @param frame The frame of the current mapping node.
+    /// @param key A key node.
+    /// @param is_movable Whether the key node can be moved if it's a new key.
+    /// @return true if the key has been found or added, false otherwise.
+    bool add_key(update_frame& frame, BasicNodeType& key, bool is_movable)
+    {
+        if (!frame.p_node->is_mapping())
+        {
+            m_error_message = "A mapping key found in a non-mapping node.";
+            return false;
+        }
+        key.set_yaml_version(m_yaml_version);
+        reset_unassigned_value(frame);
+
+        mapping_type& map = frame.p_node->template get_value_ref<mapping_type&>();
+        auto itr = map.find(key);
+        // the existing key is replaced if its YAML version differs since keys cannot be modified in place.
+        if (itr != map.end() && itr->first.get_yaml_version() == m_yaml_version)
+        {
+            frame.p_value = &(itr->second);
+            m_found_pairs.push_back(&(*itr));
+            return true;
+        }
+
+        // new keys are kept aside until the end of the mapping so that the found entries are never moved.
+        if (is_movable)
+        {
+            frame.added_pairs.emplace_back(std::move(key), BasicNodeType());
+        }
+        else
+        {
+            frame.added_pairs.emplace_back(key, BasicNodeType());
+        }
+        frame.p_value = &(frame.added_pairs.back().second);
+        m_found_pairs.push_back(nullptr);
+        return true;
+    }
+
+    /// @brief Make the value of the last key null if no value has been assigned to it, as for a new key.
+    /// @param frame The frame of the current mapping node.
+    static void reset_unassigned_value(update_frame& frame)
+    {
+        if (frame.p_value != nullptr)
+        {
+            *frame.p_value = BasicNodeType();
+            frame.p_value = nullptr;
+        }
+    }
+
+    /// @brief Remove the stale entries from the current mapping node and add the new ones.
+    /// @param frame The frame of the current mapping node.
+    /// @return true if the mapping node has been updated, false if duplicate keys are detected.
+    bool finish_mapping(update_frame& frame)
+    {
+        reset_unassigned_value(frame);
+        mapping_type& map = frame.p_node->template get_value_ref<mapping_type&>();
+
+        auto found_begin = std::next(m_found_pairs.begin(), static_cast<std::ptrdiff_t>(frame.found_begin));
+        auto found_end = m_found_pairs.end();
+
+        // a key appears more than once in the document if the same entry has been found more than once.
+        m_sorted_pairs.clear();
+        std::copy_if(found_begin, found_end, std::back_inserter(m_sorted_pairs), [](pair_type* p_pair) {
+            return p_pair != nullptr;
+        });
+        std::sort(m_sorted_pairs.begin(), m_sorted_pairs.end(), std::less<pair_type*>());
+        if (std::adjacent_find(m_sorted_pairs.begin(), m_sorted_pairs.end()) != m_sorted_pairs.end())
+        {
+            m_error_message = "Detected duplication in mapping keys.";
+            return false;
+        }
+
+        using iterator_category = typename std::iterator_traits<typename mapping_type::iterator>::iterator_category;
+        bool is_updated = update_entries(frame, map, found_begin, found_end, iterator_category {});
+        m_found_pairs.erase(found_begin, found_end);
+        return is_updated;
+    }
+
+    /// @brief Remove the stale entries from a node-based mapping like std::map or std::unordered_map and add the new
+    /// ones.
+    /// @note Entries are never moved in node-based mappings, so they are updated in place.
+    /// @param frame The frame of the current mapping node.
+    /// @param map The mapping to be updated.
+    /// @return true if the mapping has been updated, false if duplicate keys are detected.
+    template <typename FoundItrType>
+    bool update_entries(
+        update_frame& frame, mapping_type& map, FoundItrType /*unused*/, FoundItrType /*unused*/,
+        std::forward_iterator_tag /*unused*/)
+    {
+        if (m_sorted_pairs.size() < map.size())
+        {
+            for (auto itr = map.begin(); itr != map.end();)
+            {
+                bool is_found = std::binary_search(
+                    m_sorted_pairs.begin(), m_sorted_pairs.end(), &(*itr), std::less<pair_type*>());
+                itr = is_found ? std::next(itr) : map.erase(itr);
+            }
+        }
+
+        for (auto& pair : frame.added_pairs)
+        {
+            auto emplace_result = map.emplace(std::move(pair.first), BasicNodeType());
+            if (!emplace_result.second)
+            {
+                m_error_message = "Detected duplication in mapping keys.";
+                return false;
+            }
+            emplace_result.first->second = std::move(pair.second);
+        }
+        return true;
+    }
+
+    /// @brief Rebuild a contiguous mapping like ordered_map in the order of the keys in the document.
+    /// @note Entries in contiguous mappings cannot be erased or inserted in the middle since their keys are constant,
+    /// so the mapping is rebuilt unless it's exactly the same as before.
+    /// @param frame The frame of the current mapping node.
+    /// @param map The mapping to be updated.
+    /// @param found_begin The beginning of the found entries in the order of the keys in the document.
+    /// @param found_end The end of the found entries in the order of the keys in the document.
+    /// @return true if the mapping has been updated, false if duplicate keys are detected.
+    template <typename FoundItrType>
+    bool update_entries(
+        update_frame& frame, mapping_type& map, FoundItrType found_begin, FoundItrType found_end,
+        std::random_access_iterator_tag /*unused*/)
+    {
+        if (frame.added_pairs.empty() && m_sorted_pairs.size() == map.size() &&
+            std::equal(map.begin(), map.end(), found_begin, [](const pair_type& pair, pair_type* p_pair) {
+                return &pair == p_pair;
+            }))
+        {
+            return true;
+        }
+
+        mapping_type rebuilt_map;
+        auto added_itr = frame.added_pairs.begin();
+        for (; found_begin != found_end; ++found_begin)
+        {
+            pair_type* p_pair = *found_begin;
+            if (p_pair != nullptr)
+            {
+                rebuilt_map.emplace(p_pair->first, BasicNodeType()).first->second = std::move(p_pair->second);
+                continue;
+            }
+
+            auto emplace_result = rebuilt_map.emplace(std::move(added_itr->first), BasicNodeType());
+            if (!emplace_result.second)
+            {
+                m_error_message = "Detected duplication in mapping keys.";
+                return false;
+            }
+            emplace_result.first->second = std::move(added_itr->second);
+            ++added_itr;
+        }
+        map = std::move(rebuilt_map);
+        return true;
+    }
+
+    /// @brief Remove the elements which are left after the last element in the document.
+    /// @param frame The frame of the current sequence node.
+    /// @return true always.
+    static bool finish_sequence(update_frame& frame)
+    {
+        sequence_type& seq = frame.p_node->template get_value_ref<sequence_type&>();
+        seq.erase(std::next(seq.begin(), static_cast<std::ptrdiff_t>(frame.next_index)), seq.end());
+        return true;
+    }
+
+private:
+    /// The root of the node tree to be updated.
+    BasicNodeType* m_target {nullptr};
+    /// The stack of container nodes being updated.
+    std::vector<update_frame> m_frames {};
+    /// The container keys being built.
+    std::vector<std::unique_ptr<BasicNodeType>> m_key_nodes {};
+    /// The reusable node for scalar keys to be looked up.
+    BasicNodeType m_key_node {};
+    /// The entries found in the mapping nodes being updated in the order of the keys. nullptr for new keys.
+    std::vector<pair_type*> m_found_pairs {};
+    /// The non-null entries found in the mapping node being finished, sorted by their addresses.
+    std::vector<pair_type*> m_sorted_pairs {};
+    /// The YAML version of the current document.
+    yaml_version_t m_yaml_version {yaml_version_t::VER_1_2};
+    /// Whether the next node is a mapping key.
+    bool m_needs_key {false};
+    /// A flag to determine the need for YAML anchor node implementation.
+    bool m_needs_anchor_impl {false};
+    /// The last YAML anchor name.
+    string_type m_anchor_name {};
+    /// The table of YAML anchor nodes.
+    std::unordered_map<std::string, BasicNodeType> m_anchor_table {};
+    /// The message of the error which stopped updating the node tree.
+    std::string m_error_message {};
+};
+
+} // namespace detail
+
+FK_YAML_NAMESPACE_END
+
+#endif /* FK_YAML_DETAIL_INPUT_NODE_UPDATER_HPP_ */
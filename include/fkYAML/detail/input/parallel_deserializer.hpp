@@ -0,0 +1,80 @@
+///  _______   __ __   __  _____   __  __  __
+/// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+/// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.2
+/// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+///
+/// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+/// SPDX-License-Identifier: MIT
+///
+/// @file
+
+#ifndef FK_YAML_DETAIL_INPUT_PARALLEL_DESERIALIZER_HPP_
+#define FK_YAML_DETAIL_INPUT_PARALLEL_DESERIALIZER_HPP_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <fkYAML/detail/macros/version_macros.hpp>
+#include <fkYAML/detail/input/deserializer.hpp>
+#include <fkYAML/detail/input/document_scanner.hpp>
+#include <fkYAML/detail/input/input_adapter.hpp>
+#include <fkYAML/detail/meta/input_adapter_traits.hpp>
+#include <fkYAML/detail/meta/node_traits.hpp>
+#include <fkYAML/detail/meta/stl_supplement.hpp>
+#include <fkYAML/detail/parallel_runner.hpp>
+
+/// @brief namespace for fkYAML library.
+FK_YAML_NAMESPACE_BEGIN
+
+/// @brief namespace for internal implementations of fkYAML library.
+namespace detail
+{
+
+/// @brief A class which deserializes the documents in a YAML stream concurrently.
+/// @tparam BasicNodeType A type of the container for deserialized YAML values.
+template <typename BasicNodeType>
+class basic_parallel_deserializer
+{
+    static_assert(is_basic_node<BasicNodeType>::value, "basic_parallel_deserializer only accepts basic_node<...>");
+
+    /// A type for the deserializer of each document.
+    using deserializer_type = basic_deserializer<BasicNodeType>;
+
+public:
+    /// @brief Deserialize all the documents in an input source.
+    /// @param input_adapter An input adapter object for the input source.
+    /// @param num_threads The number of worker threads. 0 means the number of hardware threads.
+    /// @return The root nodes of the deserialized documents in the order of appearance.
+    template <typename InputAdapterType, enable_if_t<is_input_adapter<InputAdapterType>::value, int> = 0>
+    std::vector<BasicNodeType> deserialize_docs(InputAdapterType&& input_adapter, std::size_t num_threads)
+    {
+        std::string buffer;
+        int ch = s_end_of_input;
+        while ((ch = input_adapter.get_character()) != s_end_of_input)
+        {
+            buffer.push_back(std::char_traits<char>::to_char_type(ch));
+        }
+
+        std::vector<document_range> ranges = document_scanner::scan(buffer);
+        std::vector<BasicNodeType> docs(ranges.size());
+
+        run_parallel(ranges.size(), num_threads, [&](std::size_t index) {
+            const char* begin = buffer.data() + ranges[index].begin;
+            const char* end = buffer.data() + ranges[index].end;
+            docs[index] = deserializer_type().deserialize(detail::input_adapter(begin, end));
+        });
+
+        return docs;
+    }
+
+private:
+    /// The value of EOF for the target characters.
+    static constexpr int s_end_of_input = std::char_traits<char>::eof();
+};
+
+} // namespace detail
+
+FK_YAML_NAMESPACE_END
+
+#endif /* FK_YAML_DETAIL_INPUT_PARALLEL_DESERIALIZER_HPP_ */
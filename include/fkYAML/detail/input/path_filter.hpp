@@ -0,0 +1,802 @@
+///  _______   __ __   __  _____   __  __  __
+/// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+/// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.2
+/// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+///
+/// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+/// SPDX-License-Identifier: MIT
+///
+/// @file
+
+#ifndef FK_YAML_DETAIL_INPUT_PATH_FILTER_HPP_
+#define FK_YAML_DETAIL_INPUT_PATH_FILTER_HPP_
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <fkYAML/detail/macros/version_macros.hpp>
+#include <fkYAML/detail/meta/node_traits.hpp>
+#include <fkYAML/detail/node_string_accessor.hpp>
+#include <fkYAML/detail/types/node_t.hpp>
+#include <fkYAML/detail/types/yaml_version_t.hpp>
+#include <fkYAML/exception.hpp>
+
+/// @brief namespace for fkYAML library.
+FK_YAML_NAMESPACE_BEGIN
+
+/// @brief namespace for internal implementations of fkYAML library.
+namespace detail
+{
+
+/// @brief A segment of a key path.
+struct path_segment
+{
+    /// @brief Definition of the kinds of path segments.
+    enum class kind_t
+    {
+        KEY,       //!< a string mapping key like `foo`.
+        ANY_KEY,   //!< any scalar mapping key (`*`).
+        INDEX,     //!< a sequence index like `[0]`.
+        ANY_INDEX, //!< any sequence index (`[*]`).
+    };
+
+    /// The kind of this segment.
+    kind_t kind;
+    /// The mapping key if kind is KEY.
+    std::string name;
+    /// The sequence index if kind is INDEX.
+    std::size_t index;
+};
+
+/// @brief Split a key path like `spec.containers[*].image` into segments.
+/// @param path A key path.
+/// @return The segments of the key path. An empty path results in no segments, which selects the whole document.
+inline std::vector<path_segment> parse_key_path(const std::string& path)
+{
+    std::vector<path_segment> segments;
+
+    std::size_t pos = 0;
+    const std::size_t size = path.size();
+    while (pos < size)
+    {
+        std::size_t name_begin = pos;
+        while (pos < size && path[pos] != '.' && path[pos] != '[')
+        {
+            ++pos;
+        }
+
+        if (pos == name_begin)
+        {
+            // every segment must start with a mapping key.
+            throw fkyaml::exception(("Invalid key path: " + path).c_str());
+        }
+
+        std::string name = path.substr(name_begin, pos - name_begin);
+        bool is_any = name == "*";
+        segments.push_back({is_any ? path_segment::kind_t::ANY_KEY : path_segment::kind_t::KEY, std::move(name), 0});
+
+        while (pos < size && path[pos] == '[')
+        {
+            std::size_t close = path.find(']', pos);
+            if (close == std::string::npos || close == pos + 1)
+            {
+                throw fkyaml::exception(("Invalid key path: " + path).c_str());
+            }
+
+            if (close == pos + 2 && path[pos + 1] == '*')
+            {
+                segments.push_back({path_segment::kind_t::ANY_INDEX, std::string(), 0});
+            }
+            else
+            {
+                std::size_t index = 0;
+                for (std::size_t i = pos + 1; i < close; i++)
+                {
+                    char c = path[i];
+                    if (c < '0' || '9' < c)
+                    {
+                        throw fkyaml::exception(("Invalid key path: " + path).c_str());
+                    }
+                    index = index * 10 + static_cast<std::size_t>(c - '0');
+                }
+                segments.push_back({path_segment::kind_t::INDEX, std::string(), index});
+            }
+            pos = close + 1;
+        }
+
+        if (pos < size)
+        {
+            // a segment must be followed by a separator which is followed by another segment.
+            if (path[pos] != '.' || pos + 1 == size)
+            {
+                throw fkyaml::exception(("Invalid key path: " + path).c_str());
+            }
+            ++pos;
+        }
+    }
+
+    return segments;
+}
+
+/// @brief An event handler which forwards only the events of the nodes on given key paths to another handler.
+/// @note
+/// A node is forwarded as a whole if its path matches one of the key paths. A container node is forwarded without
+/// its unmatched children if its path is a prefix of one of the key paths and it has at least one matched
+/// descendant. The events of all the other nodes are discarded without creating any values. The root node is always
+/// forwarded so that the result is an empty container if nothing matches.
+/// @tparam BasicNodeType A basic_node template instance type which defines the types of scalar values.
+/// @tparam HandlerType A type of the handler which receives the forwarded events.
+template <typename BasicNodeType, typename HandlerType>
+class basic_path_filter
+{
+    static_assert(is_basic_node<BasicNodeType>::value, "basic_path_filter only accepts basic_node<...>");
+
+    /** A type for boolean node values. */
+    using boolean_type = typename BasicNodeType::boolean_type;
+    /** A type for integer node values. */
+    using integer_type = typename BasicNodeType::integer_type;
+    /** A type for float number node values. */
+    using float_number_type = typename BasicNodeType::float_number_type;
+    /** A type for string node values. */
+    using string_type = typename BasicNodeType::string_type;
+
+    /// @brief Definition of the ways to handle the current events.
+    enum class filter_mode_t
+    {
+        SEARCH,  //!< look for nodes on the key paths.
+        FORWARD, //!< forward all events of a matched container.
+        DISCARD, //!< discard all events of an unmatched container.
+    };
+
+    /// @brief Definition of the results of matching a child node against the key paths.
+    enum class match_t
+    {
+        NONE,    //!< the child node is not on any key path.
+        PREFIX,  //!< the child node is on a key path but does not reach its end.
+        MATCHED, //!< the child node matches a key path.
+    };
+
+    /// @brief Definition of the kinds of the last mapping key.
+    enum class key_kind_t
+    {
+        NONE,   //!< no key or a key which never matches key paths.
+        STRING, //!< a string key.
+        OTHER,  //!< a null, boolean, integer or float number key.
+    };
+
+    /// @brief A container node on key paths.
+    struct filter_frame
+    {
+        /// Whether the container is a mapping.
+        bool is_mapping;
+        /// Whether the beginning of the container has been forwarded.
+        bool is_forwarded;
+        /// Whether the next node is a mapping key.
+        bool needs_key;
+        /// The kind of the last mapping key.
+        key_kind_t key_kind;
+        /// The index of the next element in the sequence.
+        std::size_t next_index;
+        /// The index of the first matching state of this container in m_states.
+        std::size_t states_begin;
+        /// The index of the past-the-last matching state of this container in m_states.
+        std::size_t states_end;
+        /// The last mapping key if it is a string.
+        string_type string_key;
+        /// The last mapping key if it is a scalar other than a string.
+        BasicNodeType scalar_key;
+    };
+
+    /// @brief A key path matched up to some segment.
+    struct match_state
+    {
+        /// The index of the key path.
+        std::size_t path_index;
+        /// The number of the matched segments.
+        std::size_t matched;
+    };
+
+public:
+    /// @brief Construct a new basic_path_filter object.
+    /// @param handler A handler which receives the forwarded events.
+    /// @param paths Key paths to select nodes.
+    basic_path_filter(HandlerType& handler, const std::vector<std::string>& paths)
+        : m_handler(handler)
+    {
+        m_paths.reserve(paths.size());
+        for (const std::string& path : paths)
+        {
+            m_paths.emplace_back(parse_key_path(path));
+        }
+    }
+
+public:
+    /// @brief Handle the beginning of a document.
+    /// @param version The YAML version of the document.
+    /// @return true to continue parsing, false otherwise.
+    bool start_document(yaml_version_t version)
+    {
+        return m_handler.start_document(version);
+    }
+
+    /// @brief Handle the end of a document.
+    /// @return true to continue parsing, false otherwise.
+    bool end_document()
+    {
+        m_anchor_table.clear();
+        m_forwarded_anchors.clear();
+        return m_handler.end_document();
+    }
+
+    /// @brief Handle the beginning of a mapping.
+    /// @return true to continue parsing, false otherwise.
+    bool start_mapping()
+    {
+        return start_container(true);
+    }
+
+    /// @brief Handle the end of a mapping.
+    /// @return true to continue parsing, false otherwise.
+    bool end_mapping()
+    {
+        return end_container(true);
+    }
+
+    /// @brief Handle the beginning of a sequence.
+    /// @return true to continue parsing, false otherwise.
+    bool start_sequence()
+    {
+        return start_container(false);
+    }
+
+    /// @brief Handle the end of a sequence.
+    /// @return true to continue parsing, false otherwise.
+    bool end_sequence()
+    {
+        return end_container(false);
+    }
+
+    /// @brief Handle the beginning of a mapping key.
+    /// @return true to continue parsing, false otherwise.
+    bool key()
+    {
+        switch (m_mode)
+        {
+        case filter_mode_t::FORWARD:
+            return m_handler.key();
+        case filter_mode_t::DISCARD:
+            m_needs_discarded_key = true;
+            return true;
+        case filter_mode_t::SEARCH:
+        default:
+            if (!m_frames.empty())
+            {
+                m_frames.back().needs_key = true;
+                m_frames.back().key_kind = key_kind_t::NONE;
+            }
+            return true;
+        }
+    }
+
+    /// @brief Handle a null scalar.
+    /// @return true to continue parsing, false otherwise.
+    bool scalar(std::nullptr_t)
+    {
+        std::nullptr_t value = nullptr;
+        return handle_scalar(value);
+    }
+
+    /// @brief Handle a boolean scalar.
+    /// @param value A boolean scalar value.
+    /// @return true to continue parsing, false otherwise.
+    bool scalar(boolean_type value)
+    {
+        return handle_scalar(value);
+    }
+
+    /// @brief Handle an integer scalar.
+    /// @param value An integer scalar value.
+    /// @return true to continue parsing, false otherwise.
+    bool scalar(integer_type value)
+    {
+        return handle_scalar(value);
+    }
+
+    /// @brief Handle a float number scalar.
+    /// @param value A float number scalar value.
+    /// @return true to continue parsing, false otherwise.
+    bool scalar(float_number_type value)
+    {
+        return handle_scalar(value);
+    }
+
+    /// @brief Handle a string scalar.
+    /// @param value A string scalar value.
+    /// @return true to continue parsing, false otherwise.
+    bool scalar(string_type& value)
+    {
+        return handle_scalar(value);
+    }
+
+    /// @brief Handle an anchor name which will be attached to the next scalar or alias.
+    /// @param name An anchor name.
+    /// @return true to continue parsing, false otherwise.
+    bool anchor(const string_type& name)
+    {
+        if (m_mode == filter_mode_t::FORWARD)
+        {
+            m_forwarded_anchors.insert(name);
+            return m_handler.anchor(name);
+        }
+
+        m_anchor_name = name;
+        m_needs_anchor = true;
+        return true;
+    }
+
+    /// @brief Handle an alias node.
+    /// @param name An anchor name referenced by the alias.
+    /// @return true to continue parsing, false otherwise.
+    bool alias(const string_type& name)
+    {
+        switch (m_mode)
+        {
+        case filter_mode_t::FORWARD:
+            return forward_alias(name);
+        case filter_mode_t::DISCARD:
+            if (m_needs_discarded_key)
+            {
+                m_needs_discarded_key = false;
+            }
+            else
+            {
+                m_needs_anchor = false;
+            }
+            return true;
+        case filter_mode_t::SEARCH:
+        default: {
+            if (m_frames.empty())
+            {
+                return true;
+            }
+
+            filter_frame& frame = m_frames.back();
+            if (frame.is_mapping && frame.needs_key)
+            {
+                // aliases as mapping keys never match key paths.
+                frame.needs_key = false;
+                frame.key_kind = key_kind_t::NONE;
+                return true;
+            }
+
+            match_t match = match_child(frame);
+            m_states.resize(frame.states_end);
+            if (match != match_t::MATCHED)
+            {
+                m_needs_anchor = false;
+                return true;
+            }
+            return forward_ancestors() && forward_key(frame) && forward_pending_anchor() && forward_alias(name);
+        }
+        }
+    }
+
+private:
+    /// @brief Handle a scalar according to the current mode.
+    /// @tparam ValueType A type of the scalar value.
+    /// @param value A scalar value.
+    /// @return true to continue parsing, false otherwise.
+    template <typename ValueType>
+    bool handle_scalar(ValueType& value)
+    {
+        switch (m_mode)
+        {
+        case filter_mode_t::FORWARD:
+            return m_handler.scalar(value);
+        case filter_mode_t::DISCARD:
+            if (m_needs_discarded_key)
+            {
+                // anchors are attached to values, not to mapping keys.
+                m_needs_discarded_key = false;
+            }
+            else if (m_needs_anchor)
+            {
+                save_anchor(value);
+            }
+            return true;
+        case filter_mode_t::SEARCH:
+        default: {
+            if (m_frames.empty())
+            {
+                // a scalar root node is forwarded only if the whole document is selected.
+                return has_empty_path() ? forward_pending_anchor() && m_handler.scalar(value) : true;
+            }
+
+            filter_frame& frame = m_frames.back();
+            if (frame.is_mapping && frame.needs_key)
+            {
+                frame.needs_key = false;
+                set_key(frame, value);
+                return true;
+            }
+
+            match_t match = match_child(frame);
+            m_states.resize(frame.states_end);
+            if (match != match_t::MATCHED)
+            {
+                if (m_needs_anchor)
+                {
+                    save_anchor(value);
+                }
+                return true;
+            }
+            return forward_ancestors() && forward_key(frame) && forward_pending_anchor() && m_handler.scalar(value);
+        }
+        }
+    }
+
+    /// @brief Handle the beginning of a container according to the current mode.
+    /// @param is_mapping Whether the container is a mapping.
+    /// @return true to continue parsing, false otherwise.
+    bool start_container(bool is_mapping)
+    {
+        switch (m_mode)
+        {
+        case filter_mode_t::FORWARD:
+            ++m_depth;
+            return is_mapping ? m_handler.start_mapping() : m_handler.start_sequence();
+        case filter_mode_t::DISCARD:
+            m_needs_discarded_key = false;
+            ++m_depth;
+            return true;
+        case filter_mode_t::SEARCH:
+        default:
+            break;
+        }
+
+        if (m_frames.empty())
+        {
+            if (has_empty_path())
+            {
+                return start_forwarding(is_mapping);
+            }
+
+            // the root container is always forwarded.
+            m_states.clear();
+            for (std::size_t i = 0; i < m_paths.size(); i++)
+            {
+                m_states.push_back({i, 0});
+            }
+            push_frame(is_mapping, 0);
+            m_frames.back().is_forwarded = true;
+            return is_mapping ? m_handler.start_mapping() : m_handler.start_sequence();
+        }
+
+        filter_frame& frame = m_frames.back();
+        if (frame.is_mapping && frame.needs_key)
+        {
+            // containers as mapping keys never match key paths.
+            frame.needs_key = false;
+            frame.key_kind = key_kind_t::NONE;
+            start_discarding();
+            return true;
+        }
+
+        std::size_t states_begin = frame.states_end;
+        match_t match = match_child(frame);
+        switch (match)
+        {
+        case match_t::MATCHED:
+            m_states.resize(frame.states_end);
+            return forward_ancestors() && forward_key(frame) && forward_pending_anchor() &&
+                   start_forwarding(is_mapping);
+        case match_t::PREFIX:
+            // the container is forwarded later when one of its descendants matches a key path.
+            push_frame(is_mapping, states_begin);
+            return true;
+        case match_t::NONE:
+        default:
+            m_states.resize(frame.states_end);
+            start_discarding();
+            return true;
+        }
+    }
+
+    /// @brief Handle the end of a container according to the current mode.
+    /// @param is_mapping Whether the container is a mapping.
+    /// @return true to continue parsing, false otherwise.
+    bool end_container(bool is_mapping)
+    {
+        switch (m_mode)
+        {
+        case filter_mode_t::FORWARD:
+            if (--m_depth == 0)
+            {
+                m_mode = filter_mode_t::SEARCH;
+            }
+            return is_mapping ? m_handler.end_mapping() : m_handler.end_sequence();
+        case filter_mode_t::DISCARD:
+            if (--m_depth == 0)
+            {
+                m_mode = filter_mode_t::SEARCH;
+            }
+            return true;
+        case filter_mode_t::SEARCH:
+        default:
+            break;
+        }
+
+        bool is_forwarded = m_frames.back().is_forwarded;
+        m_states.resize(m_frames.back().states_begin);
+        m_frames.pop_back();
+        if (!is_forwarded)
+        {
+            return true;
+        }
+        return is_mapping ? m_handler.end_mapping() : m_handler.end_sequence();
+    }
+
+    /// @brief Start forwarding all the events of a matched container.
+    /// @param is_mapping Whether the container is a mapping.
+    /// @return true to continue parsing, false otherwise.
+    bool start_forwarding(bool is_mapping)
+    {
+        m_mode = filter_mode_t::FORWARD;
+        m_depth = 1;
+        return is_mapping ? m_handler.start_mapping() : m_handler.start_sequence();
+    }
+
+    /// @brief Start discarding all the events of an unmatched container.
+    void start_discarding()
+    {
+        m_mode = filter_mode_t::DISCARD;
+        m_depth = 1;
+        m_needs_discarded_key = false;
+    }
+
+    /// @brief Push a new container on key paths whose matching states start at the given position.
+    /// @param is_mapping Whether the container is a mapping.
+    /// @param states_begin The index of the first matching state of the container in m_states.
+    void push_frame(bool is_mapping, std::size_t states_begin)
+    {
+        m_frames.emplace_back();
+        filter_frame& frame = m_frames.back();
+        frame.is_mapping = is_mapping;
+        frame.is_forwarded = false;
+        frame.needs_key = false;
+        frame.key_kind = key_kind_t::NONE;
+        frame.next_index = 0;
+        frame.states_begin = states_begin;
+        frame.states_end = m_states.size();
+    }
+
+    /// @brief Match the next child of a container against the key paths.
+    /// @note The matching states of the child are appended to m_states if the result is PREFIX.
+    /// @param frame The container of the child.
+    /// @return The result of matching.
+    match_t match_child(filter_frame& frame)
+    {
+        std::size_t index = frame.next_index++;
+        key_kind_t key_kind = frame.key_kind;
+
+        match_t result = match_t::NONE;
+        for (std::size_t i = frame.states_begin; i < frame.states_end; i++)
+        {
+            const match_state state = m_states[i];
+            const std::vector<path_segment>& path = m_paths[state.path_index];
+            const path_segment& segment = path[state.matched];
+
+            bool is_matched = false;
+            switch (segment.kind)
+            {
+            case path_segment::kind_t::KEY:
+                is_matched = key_kind == key_kind_t::STRING && frame.string_key == segment.name;
+                break;
+            case path_segment::kind_t::ANY_KEY:
+                is_matched = key_kind != key_kind_t::NONE;
+                break;
+            case path_segment::kind_t::INDEX:
+                is_matched = !frame.is_mapping && index == segment.index;
+                break;
+            case path_segment::kind_t::ANY_INDEX:
+            default:
+                is_matched = !frame.is_mapping;
+                break;
+            }
+
+            if (!is_matched)
+            {
+                continue;
+            }
+            if (state.matched + 1 == path.size())
+            {
+                return match_t::MATCHED;
+            }
+            m_states.push_back({state.path_index, state.matched + 1});
+            result = match_t::PREFIX;
+        }
+        return result;
+    }
+
+    /// @brief Forward the beginnings of the containers on key paths which have not been forwarded yet.
+    /// @return true to continue parsing, false otherwise.
+    bool forward_ancestors()
+    {
+        std::size_t first = m_frames.size();
+        while (first > 0 && !m_frames[first - 1].is_forwarded)
+        {
+            --first;
+        }
+
+        for (std::size_t i = first; i < m_frames.size(); i++)
+        {
+            filter_frame& frame = m_frames[i];
+            bool is_forwarded = forward_key(m_frames[i - 1]) &&
+                                (frame.is_mapping ? m_handler.start_mapping() : m_handler.start_sequence());
+            if (!is_forwarded)
+            {
+                return false;
+            }
+            frame.is_forwarded = true;
+        }
+        return true;
+    }
+
+    /// @brief Forward the last key of a mapping if the given container is a mapping.
+    /// @param frame A container.
+    /// @return true to continue parsing, false otherwise.
+    bool forward_key(filter_frame& frame)
+    {
+        if (!frame.is_mapping)
+        {
+            return true;
+        }
+
+        if (!m_handler.key())
+        {
+            return false;
+        }
+
+        if (frame.key_kind == key_kind_t::STRING)
+        {
+            return m_handler.scalar(frame.string_key);
+        }
+        return forward_scalar_node(frame.scalar_key);
+    }
+
+    /// @brief Forward the anchor name which has not been attached to any node yet.
+    /// @return true to continue parsing, false otherwise.
+    bool forward_pending_anchor()
+    {
+        if (!m_needs_anchor)
+        {
+            return true;
+        }
+        m_needs_anchor = false;
+        m_forwarded_anchors.insert(m_anchor_name);
+        return m_handler.anchor(m_anchor_name);
+    }
+
+    /// @brief Forward an alias node.
+    /// @note If the anchor has not been forwarded, the anchored value is forwarded with the anchor name instead.
+    /// @param name An anchor name referenced by the alias.
+    /// @return true to continue parsing, false otherwise.
+    bool forward_alias(const string_type& name)
+    {
+        if (m_forwarded_anchors.find(name) != m_forwarded_anchors.end())
+        {
+            return m_handler.alias(name);
+        }
+
+        auto itr = m_anchor_table.find(name);
+        if (itr == m_anchor_table.end())
+        {
+            return m_handler.alias(name);
+        }
+
+        m_forwarded_anchors.insert(name);
+        BasicNodeType value = itr->second;
+        return m_handler.anchor(name) && forward_scalar_node(value);
+    }
+
+    /// @brief Forward a scalar node as a scalar event.
+    /// @param node A scalar node.
+    /// @return true to continue parsing, false otherwise.
+    bool forward_scalar_node(BasicNodeType& node)
+    {
+        switch (node.type())
+        {
+        case node_t::BOOLEAN:
+            return m_handler.scalar(node.template get_value<boolean_type>());
+        case node_t::INTEGER:
+            return m_handler.scalar(node.template get_value<integer_type>());
+        case node_t::FLOAT_NUMBER:
+            return m_handler.scalar(node.template get_value<float_number_type>());
+        case node_t::STRING: {
+            string_type buffer;
+            return m_handler.scalar(node_string_accessor<BasicNodeType>::get(node, buffer));
+        }
+        case node_t::NULL_OBJECT:
+        default:
+            return m_handler.scalar(nullptr);
+        }
+    }
+
+    /// @brief Record a mapping key of a container on key paths.
+    /// @param frame A mapping.
+    /// @param value A string key.
+    void set_key(filter_frame& frame, string_type& value)
+    {
+        frame.key_kind = key_kind_t::STRING;
+        frame.string_key = value;
+    }
+
+    /// @brief Record a mapping key of a container on key paths.
+    /// @tparam ValueType A type of the key value.
+    /// @param frame A mapping.
+    /// @param value A scalar key other than a string.
+    template <typename ValueType>
+    void set_key(filter_frame& frame, ValueType value)
+    {
+        frame.key_kind = key_kind_t::OTHER;
+        frame.scalar_key = BasicNodeType(value);
+    }
+
+    /// @brief Keep the value of a discarded anchored scalar in case an alias of it is forwarded.
+    /// @tparam ValueType A type of the scalar value.
+    /// @param value An anchored scalar value.
+    template <typename ValueType>
+    void save_anchor(ValueType& value)
+    {
+        m_anchor_table[m_anchor_name] = BasicNodeType(value);
+        m_needs_anchor = false;
+    }
+
+    /// @brief Check if one of the key paths selects the whole document.
+    /// @return true if an empty key path is given, false otherwise.
+    bool has_empty_path() const noexcept
+    {
+        for (const std::vector<path_segment>& path : m_paths)
+        {
+            if (path.empty())
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    /// The handler which receives the forwarded events.
+    HandlerType& m_handler;
+    /// The segments of the key paths.
+    std::vector<std::vector<path_segment>> m_paths {};
+    /// The stack of the containers on key paths.
+    std::vector<filter_frame> m_frames {};
+    /// The matching states of the containers on key paths.
+    std::vector<match_state> m_states {};
+    /// The current way to handle events.
+    filter_mode_t m_mode {filter_mode_t::SEARCH};
+    /// The depth of the containers being forwarded or discarded.
+    std::size_t m_depth {0};
+    /// Whether the next discarded node is a mapping key.
+    bool m_needs_discarded_key {false};
+    /// Whether an anchor name is waiting for the next node.
+    bool m_needs_anchor {false};
+    /// The anchor name waiting for the next node.
+    string_type m_anchor_name {};
+    /// The values of the discarded anchored scalars.
+    std::unordered_map<string_type, BasicNodeType> m_anchor_table {};
+    /// The anchor names which have been forwarded.
+    std::unordered_set<string_type> m_forwarded_anchors {};
+};
+
+} // namespace detail
+
+FK_YAML_NAMESPACE_END
+
+#endif /* FK_YAML_DETAIL_INPUT_PATH_FILTER_HPP_ */
@@ -0,0 +1,143 @@
+///  _______   __ __   __  _____   __  __  __
+/// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+/// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.2
+/// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+///
+/// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+/// SPDX-License-Identifier: MIT
+///
+/// @file
+
+#ifndef FK_YAML_DETAIL_INPUT_SAX_HANDLER_HPP_
+#define FK_YAML_DETAIL_INPUT_SAX_HANDLER_HPP_
+
+#include <cstddef>
+
+#include <fkYAML/detail/macros/version_macros.hpp>
+#include <fkYAML/detail/meta/node_traits.hpp>
+#include <fkYAML/detail/types/yaml_version_t.hpp>
+
+/// @brief namespace for fkYAML library.
+FK_YAML_NAMESPACE_BEGIN
+
+/// @brief namespace for internal implementations of fkYAML library.
+namespace detail
+{
+
+/// @brief An interface of handlers for events which are generated while a YAML document is parsed.
+/// @note
+/// Event handlers do not have to derive from this class since the parser accepts any class which has member functions
+/// with the same signatures. Each function returns true to continue parsing, or false to stop it immediately.
+/// A handler may also have `bool raw_scalar(node_t type, string_type& text)`, which is then called for scalars instead
+/// of the scalar() functions with their texts not converted into values yet. This lets the handler convert only the
+/// scalars it needs.
+/// @tparam BasicNodeType A basic_node template instance type which defines the types of scalar values.
+/// @sa https://fktn-k.github.io/fkYAML/api/basic_node/sax_handler_type/
+template <typename BasicNodeType>
+class basic_sax_handler
+{
+    static_assert(is_basic_node<BasicNodeType>::value, "basic_sax_handler only accepts basic_node<...>");
+
+public:
+    /// A type for YAML specification versions.
+    using yaml_version_t = typename BasicNodeType::yaml_version_t;
+    /// A type for boolean scalar values.
+    using boolean_type = typename BasicNodeType::boolean_type;
+    /// A type for integer scalar values.
+    using integer_type = typename BasicNodeType::integer_type;
+    /// A type for float number scalar values.
+    using float_number_type = typename BasicNodeType::float_number_type;
+    /// A type for string scalar values.
+    using string_type = typename BasicNodeType::string_type;
+
+public:
+    /// @brief Construct a new basic_sax_handler object.
+    basic_sax_handler() = default;
+
+    /// @brief Copy constructor of the basic_sax_handler class.
+    basic_sax_handler(const basic_sax_handler&) = default;
+
+    /// @brief Move constructor of the basic_sax_handler class.
+    basic_sax_handler(basic_sax_handler&&) noexcept = default;
+
+    /// @brief Destroy the basic_sax_handler object.
+    virtual ~basic_sax_handler() = default;
+
+    /// @brief Copy assignment operator of the basic_sax_handler class.
+    /// @return Reference to this basic_sax_handler object.
+    basic_sax_handler& operator=(const basic_sax_handler&) = default;
+
+    /// @brief Move assignment operator of the basic_sax_handler class.
+    /// @return Reference to this basic_sax_handler object.
+    basic_sax_handler& operator=(basic_sax_handler&&) noexcept = default;
+
+public:
+    /// @brief Called at the beginning of a document.
+    /// @param version The YAML version specified with a %YAML directive, or the default one.
+    /// @return true to continue parsing, false otherwise.
+    virtual bool start_document(yaml_version_t version) = 0;
+
+    /// @brief Called at the end of a document.
+    /// @return true to continue parsing, false otherwise.
+    virtual bool end_document() = 0;
+
+    /// @brief Called at the beginning of a mapping.
+    /// @return true to continue parsing, false otherwise.
+    virtual bool start_mapping() = 0;
+
+    /// @brief Called at the end of a mapping.
+    /// @return true to continue parsing, false otherwise.
+    virtual bool end_mapping() = 0;
+
+    /// @brief Called at the beginning of a sequence.
+    /// @return true to continue parsing, false otherwise.
+    virtual bool start_sequence() = 0;
+
+    /// @brief Called at the end of a sequence.
+    /// @return true to continue parsing, false otherwise.
+    virtual bool end_sequence() = 0;
+
+    /// @brief Called right before the events of a mapping key. The events of its value follow those of the key.
+    /// @return true to continue parsing, false otherwise.
+    virtual bool key() = 0;
+
+    /// @brief Called for a null scalar.
+    /// @return true to continue parsing, false otherwise.
+    virtual bool scalar(std::nullptr_t) = 0;
+
+    /// @brief Called for a boolean scalar.
+    /// @param value A boolean scalar value.
+    /// @return true to continue parsing, false otherwise.
+    virtual bool scalar(boolean_type value) = 0;
+
+    /// @brief Called for an integer scalar.
+    /// @param value An integer scalar value.
+    /// @return true to continue parsing, false otherwise.
+    virtual bool scalar(integer_type value) = 0;
+
+    /// @brief Called for a float number scalar.
+    /// @param value A float number scalar value.
+    /// @return true to continue parsing, false otherwise.
+    virtual bool scalar(float_number_type value) = 0;
+
+    /// @brief Called for a string scalar.
+    /// @param value A string scalar value. It can be safely moved from.
+    /// @return true to continue parsing, false otherwise.
+    virtual bool scalar(string_type& value) = 0;
+
+    /// @brief Called right before the scalar or alias event to which an anchor name is attached.
+    /// @param name An anchor name.
+    /// @return true to continue parsing, false otherwise.
+    virtual bool anchor(const string_type& name) = 0;
+
+    /// @brief Called for an alias node. The referenced anchor is guaranteed to have appeared before.
+    /// @param name An anchor name referenced by the alias.
+    /// @return true to continue parsing, false otherwise.
+    virtual bool alias(const string_type& name) = 0;
+};
+
+} // namespace detail
+
+FK_YAML_NAMESPACE_END
+
+#endif /* FK_YAML_DETAIL_INPUT_SAX_HANDLER_HPP_ */
@@ -0,0 +1,1073 @@
+///  _______   __ __   __  _____   __  __  __
+/// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+/// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.2
+/// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+///
+/// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+/// SPDX-License-Identifier: MIT
+///
+/// @file
+
+#ifndef FK_YAML_DETAIL_INPUT_SAX_PARSER_HPP_
+#define FK_YAML_DETAIL_INPUT_SAX_PARSER_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <fkYAML/detail/macros/version_macros.hpp>
+#include <fkYAML/detail/assert.hpp>
+#include <fkYAML/detail/conversions/from_string.hpp>
+#include <fkYAML/detail/input/lexical_analyzer.hpp>
+#include <fkYAML/detail/meta/detect.hpp>
+#include <fkYAML/detail/meta/input_adapter_traits.hpp>
+#include <fkYAML/detail/meta/node_traits.hpp>
+#include <fkYAML/detail/meta/stl_supplement.hpp>
+#include <fkYAML/detail/types/lexical_token_t.hpp>
+#include <fkYAML/detail/types/node_t.hpp>
+#include <fkYAML/detail/types/yaml_version_t.hpp>
+#include <fkYAML/exception.hpp>
+
+/// @brief namespace for fkYAML library.
+FK_YAML_NAMESPACE_BEGIN
+
+/// @brief namespace for internal implementations of fkYAML library.
+namespace detail
+{
+
+/// @brief A type which represents the raw_scalar function of event handlers.
+/// @tparam SaxHandlerType A type of the event handler.
+/// @tparam StringType A type of the texts of scalars.
+template <typename SaxHandlerType, typename StringType>
+using raw_scalar_fn_t =
+    decltype(std::declval<SaxHandlerType&>().raw_scalar(std::declval<node_t>(), std::declval<StringType&>()));
+
+/// @brief A class which parses YAML documents and reports the structure to an event handler without building nodes.
+/// @note
+/// The parser keeps track of the structure being parsed with lightweight frames instead of nodes. The beginning of a
+/// container is reported when its first child is found or when the container ends, and the end of a container is
+/// reported once no frame refers to it any longer.
+/// Scalars are converted into values right before being reported, unless the handler has a raw_scalar() function.
+/// @tparam BasicNodeType A basic_node template instance type which defines the types of scalar values.
+/// @tparam SaxHandlerType A type of the event handler. See basic_sax_handler for the required member functions.
+template <typename BasicNodeType, typename SaxHandlerType>
+class basic_sax_parser
+{
+    static_assert(is_basic_node<BasicNodeType>::value, "basic_sax_parser only accepts basic_node<...>");
+
+    /** A type for boolean node values. */
+    using boolean_type = typename BasicNodeType::boolean_type;
+    /** A type for integer node values. */
+    using integer_type = typename BasicNodeType::integer_type;
+    /** A type for float number node values. */
+    using float_number_type = typename BasicNodeType::float_number_type;
+    /** A type for string node values. */
+    using string_type = typename BasicNodeType::string_type;
+
+    /// @brief Definition of the states of nodes being parsed.
+    enum class frame_state : std::uint8_t
+    {
+        UNSET,    //!< a node whose value has not been determined yet.
+        SCALAR,   //!< a node whose scalar value has already been reported.
+        MAPPING,  //!< a mapping node.
+        SEQUENCE, //!< a sequence node.
+    };
+
+    /// @brief A lightweight representation of a node being parsed.
+    struct parse_frame
+    {
+        /// The state of the node.
+        frame_state state;
+        /// Whether the beginning of the container has been reported.
+        bool is_started;
+        /// Whether the container has any child.
+        bool has_children;
+        /// The number of references from the parser and child frames.
+        std::size_t ref_count;
+        /// The index of the parent frame, or s_no_frame if the node is the root.
+        std::size_t parent;
+    };
+
+    /// @brief A flow container being parsed.
+    struct flow_context
+    {
+        /// The index of the frame for the container.
+        std::size_t frame;
+        /// Whether the container is an element of a sequence, whose frame is separated from that of the sequence.
+        bool is_element;
+        /// The size of the frame stack when the container began.
+        std::size_t frame_stack_size;
+        /// The size of the stack of indentation widths when the container began.
+        std::size_t indent_stack_size;
+    };
+
+public:
+    /// @brief Construct a new basic_sax_parser object.
+    /// @param handler An event handler to be notified of parse events.
+    explicit basic_sax_parser(SaxHandlerType& handler) noexcept
+        : m_handler(&handler)
+    {
+    }
+
+public:
+    /// @brief Parse a YAML document and report parse events to the handler.
+    /// @param input_adapter An input adapter object for the input source.
+    /// @return true if the whole input has been parsed, false if the handler stopped parsing.
+    template <typename InputAdapterType, enable_if_t<is_input_adapter<InputAdapterType>::value, int> = 0>
+    bool parse(InputAdapterType&& input_adapter)
+    {
+        start(std::forward<InputAdapterType>(input_adapter));
+        while (step())
+        {
+        }
+        return !m_is_aborted;
+    }
+
+    /// @brief Prepare for parsing a YAML document step by step with step() calls.
+    /// @param input_adapter An input adapter object for the input source.
+    template <typename InputAdapterType, enable_if_t<is_input_adapter<InputAdapterType>::value, int> = 0>
+    void start(InputAdapterType&& input_adapter)
+    {
+        reset();
+        if (m_lexer)
+        {
+            // reuse the lexer and its buffers from the previous parse.
+            m_lexer->reset(std::forward<InputAdapterType>(input_adapter));
+        }
+        else
+        {
+            m_lexer.reset(new lexical_analyzer<BasicNodeType>(std::forward<InputAdapterType>(input_adapter)));
+        }
+
+        m_root = m_current = create_frame(frame_state::MAPPING, s_no_frame);
+        retain(m_current);
+
+        m_token_type = m_lexer->get_next_token();
+        m_token_indent = m_lexer->get_last_token_begin_pos();
+        m_token_line = m_lexer->get_lines_processed();
+        m_is_finished = false;
+    }
+
+    /// @brief Parse the next token and report the resulting events to the handler.
+    /// @note A single step may report any number of events (including none).
+    /// @return true if the input has some more tokens to be parsed, false otherwise.
+    bool step()
+    {
+        if (m_is_finished)
+        {
+            return false;
+        }
+
+        m_event_indent = m_token_indent;
+        m_event_line = m_token_line;
+
+        bool needs_next_token = parse_token(*m_lexer, m_token_type, m_token_indent, m_token_line);
+        if (needs_next_token)
+        {
+            m_token_type = m_lexer->get_next_token();
+            m_token_indent = m_lexer->get_last_token_begin_pos();
+            m_token_line = m_lexer->get_lines_processed();
+        }
+
+        if (m_token_type == lexical_token_t::END_OF_BUFFER || m_is_aborted)
+        {
+            finish();
+            return false;
+        }
+        return true;
+    }
+
+    /// @brief Check if the handler has stopped parsing.
+    /// @return true if the handler has stopped parsing, false otherwise.
+    bool is_aborted() const noexcept
+    {
+        return m_is_aborted;
+    }
+
+    /// @brief Get the line of the last reported event.
+    /// @return The line of the last reported event.
+    std::size_t get_last_event_line() const noexcept
+    {
+        return m_event_line;
+    }
+
+    /// @brief Get the indentation width of the last reported event.
+    /// @return The indentation width of the last reported event.
+    std::size_t get_last_event_indent() const noexcept
+    {
+        return m_event_indent;
+    }
+
+private:
+    /// @brief Parse a token and the following ones if necessary.
+    /// @param lexer The lexical analyzer for the input.
+    /// @param type The type of the token. Updated if the following tokens have been got.
+    /// @param cur_indent The indentation width of the token. Updated if the following tokens have been got.
+    /// @param cur_line The line of the token. Updated if the following tokens have been got.
+    /// @return true if the next token needs to be got, false if it has already been got.
+    template <typename LexerType>
+    bool parse_token(LexerType& lexer, lexical_token_t& type, std::size_t& cur_indent, std::size_t& cur_line)
+    {
+        switch (type)
+        {
+        case lexical_token_t::END_OF_BUFFER:
+            // This handles an empty input.
+            break;
+        case lexical_token_t::EXPLICIT_KEY_PREFIX: {
+            bool needs_to_move_back = !m_indent_stack.empty() && cur_indent < m_indent_stack.back().first;
+            if (needs_to_move_back)
+            {
+                auto target_itr = std::find_if( // LCOV_EXCL_LINE
+                    m_indent_stack.rbegin(),
+                    m_indent_stack.rend(),
+                    [cur_indent](std::pair<std::size_t, bool> p) { return cur_indent > p.first; });
+
+                auto pop_num = std::distance(m_indent_stack.rbegin(), target_itr);
+                for (auto i = 0; i < pop_num; i++)
+                {
+                    // move back to the previous container node.
+                    move_back();
+                    m_indent_stack.pop_back();
+                }
+            }
+
+            if (m_frames[m_current].state == frame_state::UNSET)
+            {
+                change_state(m_current, frame_state::MAPPING);
+            }
+
+            push_current();
+            m_indent_stack.emplace_back(cur_indent, true);
+            report_key(m_current);
+
+            // an explicit key is parsed as a node separated from the current mapping.
+            std::size_t mapping = m_current;
+            type = lexer.get_next_token();
+            if (type == lexical_token_t::SEQUENCE_BLOCK_PREFIX)
+            {
+                m_indent_stack.emplace_back(lexer.get_last_token_begin_pos(), false);
+                set_current(create_frame(frame_state::SEQUENCE, mapping));
+                break;
+            }
+
+            set_current(create_frame(frame_state::UNSET, mapping));
+            cur_indent = lexer.get_last_token_begin_pos();
+            cur_line = lexer.get_lines_processed();
+
+            return false;
+        }
+        case lexical_token_t::KEY_SEPARATOR: {
+            bool is_stack_empty = m_frame_stack.empty();
+            if (is_stack_empty)
+            {
+                throw parse_error("A key separator found without key.", cur_line, cur_indent);
+            }
+
+            // hold the line count of the key separator for later use.
+            std::size_t old_indent = cur_indent;
+            std::size_t old_line = cur_line;
+
+            type = lexer.get_next_token();
+            if (type == lexical_token_t::COMMENT_PREFIX)
+            {
+                // just skip the comment and get the next token.
+                type = lexer.get_next_token();
+            }
+
+            cur_indent = lexer.get_last_token_begin_pos();
+            cur_line = lexer.get_lines_processed();
+
+            bool is_implicit_same_line =
+                (cur_line == old_line) && (m_indent_stack.empty() || old_indent > m_indent_stack.back().first);
+            if (is_implicit_same_line)
+            {
+                // a key separator for an implicit key with its value on the same line.
+                return false;
+            }
+
+            if (cur_line > old_line)
+            {
+                switch (type)
+                {
+                case lexical_token_t::SEQUENCE_BLOCK_PREFIX:
+                    // a key separator preceeding block sequence entries
+                    change_state(m_current, frame_state::SEQUENCE);
+                    break;
+                case lexical_token_t::EXPLICIT_KEY_PREFIX:
+                    // a key separator for a explicit block mapping key.
+                    change_state(m_current, frame_state::MAPPING);
+                    break;
+                // defer checking the existence of a key separator after the scalar until a parse_scalar()
+                // call.
+                case lexical_token_t::NULL_VALUE:
+                case lexical_token_t::BOOLEAN_VALUE:
+                case lexical_token_t::INTEGER_VALUE:
+                case lexical_token_t::FLOAT_NUMBER_VALUE:
+                case lexical_token_t::STRING_VALUE:
+                // defer handling these tokens until the next loop.
+                case lexical_token_t::MAPPING_FLOW_BEGIN:
+                case lexical_token_t::SEQUENCE_FLOW_BEGIN:
+                    break;
+                default:   // LCOV_EXCL_LINE
+                    break; // LCOV_EXCL_LINE
+                }
+
+                return false;
+            }
+
+            // handle explicit mapping key separators.
+
+            while (!m_indent_stack.back().second)
+            {
+                move_back();
+                m_indent_stack.pop_back();
+            }
+
+            if (m_frames[m_frame_stack.back()].state == frame_state::SEQUENCE)
+            {
+                move_back();
+            }
+            if (m_frame_stack.back() == m_current)
+            {
+                // This path is for nested explicit mapping keys like:
+                // ```yaml
+                // ? ? foo
+                //   : bar
+                // : baz
+                // ```
+                pop_frame();
+            }
+
+            // the end of the explicit key is reported when its frame is released.
+            std::size_t mapping = m_frame_stack.back();
+            m_frames[mapping].has_children = true;
+            set_current(create_frame(frame_state::UNSET, mapping));
+            push_frame(mapping);
+            m_indent_stack.back().second = false;
+
+            if (type == lexical_token_t::SEQUENCE_BLOCK_PREFIX)
+            {
+                change_state(m_current, frame_state::SEQUENCE);
+            }
+            cur_indent = lexer.get_last_token_begin_pos();
+            cur_line = lexer.get_lines_processed();
+            return false;
+        }
+        case lexical_token_t::VALUE_SEPARATOR:
+            break;
+        case lexical_token_t::ANCHOR_PREFIX: {
+            m_anchor_name = lexer.get_string();
+            m_needs_anchor_impl = true;
+            break;
+        }
+        case lexical_token_t::ALIAS_PREFIX: {
+            m_scalar_buffer = lexer.get_string();
+            auto itr = m_anchor_names.find(m_scalar_buffer);
+            if (itr == m_anchor_names.end())
+            {
+                throw parse_error(
+                    "The given anchor name must appear prior to the alias node.", cur_line, cur_indent);
+            }
+            assign_node_value(true);
+            break;
+        }
+        case lexical_token_t::COMMENT_PREFIX:
+            break;
+        case lexical_token_t::YAML_VER_DIRECTIVE: {
+            FK_YAML_ASSERT(m_current == m_root);
+            update_yaml_version_from(lexer.get_yaml_version());
+            break;
+        }
+        case lexical_token_t::TAG_DIRECTIVE:
+            // TODO: implement tag directive deserialization.
+        case lexical_token_t::INVALID_DIRECTIVE:
+            // TODO: should output a warning log. Currently just ignore this case.
+            break;
+        case lexical_token_t::SEQUENCE_BLOCK_PREFIX:
+            if (m_frames[m_current].state == frame_state::SEQUENCE)
+            {
+                bool is_empty = !m_frames[m_current].has_children;
+                if (is_empty)
+                {
+                    m_indent_stack.emplace_back(cur_indent, false);
+                    break;
+                }
+
+                // move back to the previous sequence if necessary.
+                while (m_frames[m_current].state != frame_state::SEQUENCE ||
+                       cur_indent != m_indent_stack.back().first)
+                {
+                    move_back();
+                    m_indent_stack.pop_back();
+                }
+                break;
+            }
+
+            // if the current node is a mapping.
+            if (m_frame_stack.empty())
+            {
+                throw parse_error("Invalid sequence block prefix(- ) found.", cur_line, cur_indent);
+            }
+
+            // move back to the previous sequence if necessary.
+            while (m_frames[m_current].state != frame_state::SEQUENCE || cur_indent != m_indent_stack.back().first)
+            {
+                move_back();
+                m_indent_stack.pop_back();
+            }
+
+            // for mappings in a sequence.
+            m_frames[m_current].has_children = true;
+            push_current();
+            set_current(create_frame(frame_state::MAPPING, m_current));
+            break;
+        case lexical_token_t::SEQUENCE_FLOW_BEGIN:
+            begin_flow_container(frame_state::SEQUENCE);
+            break;
+        case lexical_token_t::SEQUENCE_FLOW_END:
+            end_flow_container(frame_state::SEQUENCE, cur_line, cur_indent);
+            break;
+        case lexical_token_t::MAPPING_FLOW_BEGIN:
+            begin_flow_container(frame_state::MAPPING);
+            break;
+        case lexical_token_t::MAPPING_FLOW_END:
+            end_flow_container(frame_state::MAPPING, cur_line, cur_indent);
+            break;
+        case lexical_token_t::NULL_VALUE:
+        case lexical_token_t::BOOLEAN_VALUE:
+        case lexical_token_t::INTEGER_VALUE:
+        case lexical_token_t::FLOAT_NUMBER_VALUE:
+        case lexical_token_t::STRING_VALUE: {
+            // the text is copied since the lexer overwrites it while looking for a key separator.
+            m_scalar_type = to_scalar_type(type);
+            m_scalar_buffer = lexer.get_string();
+            bool do_continue = parse_scalar(lexer, cur_indent, cur_line, type);
+            if (do_continue)
+            {
+                return false;
+            }
+            break;
+        }
+        case lexical_token_t::END_OF_DIRECTIVES:
+            break;
+        case lexical_token_t::END_OF_DOCUMENT:
+            // TODO: This token should be handled to support multiple documents.
+            break;
+        }
+
+        return true;
+    }
+
+    /// @brief Report the ends of all the remaining containers and the end of the document.
+    void finish()
+    {
+        if (!m_is_aborted)
+        {
+            // release all the remaining frames so that the ends of their containers get reported.
+            release(m_current);
+            m_current = s_no_frame;
+            while (!m_frame_stack.empty())
+            {
+                pop_frame();
+            }
+
+            if (!m_is_aborted)
+            {
+                m_is_aborted = !m_handler->end_document();
+            }
+        }
+
+        m_is_finished = true;
+
+        // keep the lexer so that its buffers can be reused for the next input.
+        m_lexer->clear();
+    }
+
+    /// @brief Begin a flow container as the current node, or as a new element if the current node is a sequence.
+    /// @param state The state of the flow container.
+    void begin_flow_container(frame_state state)
+    {
+        flow_context context {m_current, false, m_frame_stack.size(), m_indent_stack.size()};
+        if (m_frames[m_current].state == frame_state::SEQUENCE)
+        {
+            m_frames[m_current].has_children = true;
+            push_current();
+            set_current(create_frame(state, m_current));
+            context.frame = m_current;
+            context.is_element = true;
+        }
+        else
+        {
+            change_state(m_current, state);
+        }
+        m_flow_stack.push_back(context);
+    }
+
+    /// @brief End the innermost flow container.
+    /// @param state The state of the flow container which the end token is for.
+    /// @param line The line of the end token.
+    /// @param indent The indentation width of the end token.
+    void end_flow_container(frame_state state, const std::size_t line, const std::size_t indent)
+    {
+        if (m_flow_stack.empty())
+        {
+            if (state == frame_state::SEQUENCE)
+            {
+                move_back();
+                return;
+            }
+            throw parse_error("Invalid mapping flow end(}) found.", line, indent);
+        }
+
+        flow_context context = m_flow_stack.back();
+        m_flow_stack.pop_back();
+
+        if (context.is_element)
+        {
+            // go back to the sequence which has the container as an element, discarding the states for its contents.
+            m_indent_stack.erase(
+                m_indent_stack.begin() + static_cast<std::ptrdiff_t>(context.indent_stack_size), m_indent_stack.end());
+            while (m_frame_stack.size() > context.frame_stack_size + 1)
+            {
+                pop_frame();
+            }
+            move_back();
+            return;
+        }
+
+        if (context.frame == m_root)
+        {
+            // the root node stays current until the end of the document.
+            return;
+        }
+
+        if (state == frame_state::SEQUENCE)
+        {
+            move_back();
+            return;
+        }
+        if (m_frame_stack.empty())
+        {
+            throw parse_error("Invalid mapping flow end(}) found.", line, indent); // LCOV_EXCL_LINE
+        }
+        set_current(m_frame_stack.back());
+    }
+
+    /// @brief Add the pending scalar as a new key to the current mapping and report it.
+    /// @param indent The indentation width of the key.
+    /// @param line The line of the key.
+    void add_new_key(const std::size_t indent, const std::size_t line)
+    {
+        m_event_indent = indent;
+        m_event_line = line;
+
+        if (!m_indent_stack.empty() && indent < m_indent_stack.back().first)
+        {
+            auto target_itr =
+                std::find_if(m_indent_stack.rbegin(), m_indent_stack.rend(), [indent](std::pair<std::size_t, bool> p) {
+                    return indent == p.first;
+                });
+            bool is_indent_valid = (target_itr != m_indent_stack.rend());
+            if (!is_indent_valid)
+            {
+                throw parse_error("Detected invalid indentaion.", line, indent);
+            }
+
+            auto pop_num = std::distance(m_indent_stack.rbegin(), target_itr);
+            for (auto i = 0; i < pop_num; i++)
+            {
+                // move back to the previous container node.
+                move_back();
+                m_indent_stack.pop_back();
+            }
+        }
+
+        if (m_frames[m_current].state == frame_state::SEQUENCE)
+        {
+            m_frames[m_current].has_children = true;
+            push_current();
+            set_current(create_frame(frame_state::MAPPING, m_current));
+        }
+
+        if (m_frames[m_current].state != frame_state::MAPPING)
+        {
+            throw parse_error("A mapping key found in a non-mapping node.", line, indent);
+        }
+
+        bool is_empty = !m_frames[m_current].has_children;
+        if (is_empty)
+        {
+            m_indent_stack.emplace_back(indent, false);
+        }
+        m_frames[m_current].has_children = true;
+
+        report_key(m_current);
+        report_scalar(false);
+
+        std::size_t mapping = m_current;
+        push_current();
+        set_current(create_frame(frame_state::UNSET, mapping));
+    }
+
+    /// @brief Assign the pending scalar or alias to the current node.
+    /// @param is_alias Whether the pending text is the name of an alias.
+    void assign_node_value(bool is_alias = false)
+    {
+        parse_frame& frame = m_frames[m_current];
+        if (frame.state == frame_state::SEQUENCE)
+        {
+            frame.has_children = true;
+            ensure_started(m_current);
+            report_anchor();
+            report_scalar(is_alias);
+            return;
+        }
+
+        // a scalar node
+        if (frame.is_started)
+        {
+            // the node has already been reported as a container.
+            report_end(m_current); // LCOV_EXCL_LINE
+        }
+        frame.state = frame_state::SCALAR;
+        frame.has_children = false;
+        if (frame.parent != s_no_frame)
+        {
+            ensure_started(frame.parent);
+        }
+        report_anchor();
+        report_scalar(is_alias);
+
+        if (!m_indent_stack.back().second)
+        {
+            move_back();
+        }
+    }
+
+    /// @brief Parse the pending scalar detected by a lexer.
+    /// @param indent The current indentation width. Can be updated in this function.
+    /// @param line The number of processed lines. Can be updated in this function.
+    /// @return true if next token has already been got, false otherwise.
+    template <typename LexerType>
+    bool parse_scalar(LexerType& lexer, std::size_t& indent, std::size_t& line, lexical_token_t& type)
+    {
+        if (m_frames[m_current].state == frame_state::MAPPING)
+        {
+            add_new_key(indent, line);
+            return false;
+        }
+
+        type = lexer.get_next_token();
+        if (type == lexical_token_t::KEY_SEPARATOR)
+        {
+            frame_state state = m_frames[m_current].state;
+            if (state == frame_state::UNSET || state == frame_state::SCALAR)
+            {
+                if (line != lexer.get_lines_processed())
+                {
+                    // This path is for explicit mapping key separator(:)
+                    assign_node_value();
+                    if (!m_indent_stack.back().second)
+                    {
+                        m_indent_stack.pop_back();
+                    }
+                    indent = lexer.get_last_token_begin_pos();
+                    line = lexer.get_lines_processed();
+                    return true;
+                }
+                change_state(m_current, frame_state::MAPPING);
+            }
+            add_new_key(indent, line);
+        }
+        else
+        {
+            assign_node_value();
+        }
+        indent = lexer.get_last_token_begin_pos();
+        line = lexer.get_lines_processed();
+        return true;
+    }
+
+    /// @brief Create a new frame.
+    /// @param state The initial state of the new frame.
+    /// @param parent The index of the parent frame, or s_no_frame for the root.
+    /// @return The index of the new frame. It must be retained by the caller.
+    std::size_t create_frame(frame_state state, std::size_t parent)
+    {
+        if (parent != s_no_frame)
+        {
+            retain(parent);
+        }
+
+        parse_frame frame {state, false, false, 0, parent};
+        if (m_free_frames.empty())
+        {
+            m_frames.push_back(frame);
+            return m_frames.size() - 1;
+        }
+
+        std::size_t index = m_free_frames.back();
+        m_free_frames.pop_back();
+        m_frames[index] = frame;
+        return index;
+    }
+
+    /// @brief Increment the reference count of a frame.
+    /// @param index The index of the target frame.
+    void retain(std::size_t index) noexcept
+    {
+        ++m_frames[index].ref_count;
+    }
+
+    /// @brief Decrement the reference count of a frame and finish it if no longer referenced.
+    /// @param index The index of the target frame.
+    void release(std::size_t index)
+    {
+        FK_YAML_ASSERT(m_frames[index].ref_count > 0);
+        if (--m_frames[index].ref_count > 0)
+        {
+            return;
+        }
+
+        parse_frame& frame = m_frames[index];
+        switch (frame.state)
+        {
+        case frame_state::UNSET:
+            // a node without any value is a null scalar.
+            if (frame.parent != s_no_frame)
+            {
+                ensure_started(frame.parent);
+            }
+            if (!m_is_aborted)
+            {
+                // the pending scalar, if any, must be left as it is.
+                string_type empty_text;
+                m_is_aborted = !report_scalar_value(node_t::NULL_OBJECT, empty_text);
+            }
+            break;
+        case frame_state::SCALAR:
+            break;
+        case frame_state::MAPPING:
+        case frame_state::SEQUENCE:
+            ensure_started(index);
+            report_end(index);
+            break;
+        }
+
+        std::size_t parent = frame.parent;
+        m_free_frames.push_back(index);
+        if (parent != s_no_frame)
+        {
+            release(parent);
+        }
+    }
+
+    /// @brief Make the given frame the current one.
+    /// @param index The index of the new current frame.
+    void set_current(std::size_t index)
+    {
+        retain(index);
+        std::size_t old = m_current;
+        m_current = index;
+        release(old);
+    }
+
+    /// @brief Move back to the frame on the top of the frame stack.
+    void move_back()
+    {
+        if (m_frame_stack.empty())
+        {
+            throw parse_error("Invalid YAML structure detected.", m_event_line, m_event_indent);
+        }
+
+        // the reference from the stack is taken over by m_current.
+        std::size_t old = m_current;
+        m_current = m_frame_stack.back();
+        m_frame_stack.pop_back();
+        release(old);
+    }
+
+    /// @brief Push the current frame to the frame stack.
+    void push_current()
+    {
+        push_frame(m_current);
+    }
+
+    /// @brief Push a frame to the frame stack.
+    /// @param index The index of the target frame.
+    void push_frame(std::size_t index)
+    {
+        retain(index);
+        m_frame_stack.push_back(index);
+    }
+
+    /// @brief Pop a frame from the frame stack.
+    void pop_frame()
+    {
+        std::size_t index = m_frame_stack.back();
+        m_frame_stack.pop_back();
+        release(index);
+    }
+
+    /// @brief Change the state of a frame to a container or replace its container with a new empty one.
+    /// @param index The index of the target frame.
+    /// @param state The new state of the frame.
+    void change_state(std::size_t index, frame_state state)
+    {
+        parse_frame& frame = m_frames[index];
+        if (frame.is_started && frame.state != state)
+        {
+            // the node has already been reported as a different container.
+            report_end(index);
+            frame.is_started = false;
+        }
+        frame.state = state;
+        frame.has_children = false;
+    }
+
+    /// @brief Report the beginning of a container (and its ancestors) if not reported yet.
+    /// @param index The index of the target frame.
+    void ensure_started(std::size_t index)
+    {
+        parse_frame& frame = m_frames[index];
+        if (frame.is_started || (frame.state != frame_state::MAPPING && frame.state != frame_state::SEQUENCE))
+        {
+            return;
+        }
+        frame.is_started = true;
+
+        if (frame.parent != s_no_frame)
+        {
+            ensure_started(frame.parent);
+        }
+        else if (!m_is_document_started)
+        {
+            m_is_document_started = true;
+            if (!m_is_aborted)
+            {
+                m_is_aborted = !m_handler->start_document(m_yaml_version);
+            }
+        }
+
+        if (!m_is_aborted)
+        {
+            bool is_mapping = (m_frames[index].state == frame_state::MAPPING);
+            m_is_aborted = is_mapping ? !m_handler->start_mapping() : !m_handler->start_sequence();
+        }
+    }
+
+    /// @brief Report the end of a container.
+    /// @param index The index of the target frame.
+    void report_end(std::size_t index)
+    {
+        if (!m_is_aborted)
+        {
+            bool is_mapping = (m_frames[index].state == frame_state::MAPPING);
+            m_is_aborted = is_mapping ? !m_handler->end_mapping() : !m_handler->end_sequence();
+        }
+    }
+
+    /// @brief Report the beginning of a key in a mapping.
+    /// @param mapping The index of the frame for the mapping.
+    void report_key(std::size_t mapping)
+    {
+        ensure_started(mapping);
+        if (!m_is_aborted)
+        {
+            m_is_aborted = !m_handler->key();
+        }
+    }
+
+    /// @brief Report a pending anchor name if any.
+    void report_anchor()
+    {
+        if (!m_needs_anchor_impl)
+        {
+            return;
+        }
+
+        m_anchor_names.insert(m_anchor_name);
+        if (!m_is_aborted)
+        {
+            m_is_aborted = !m_handler->anchor(m_anchor_name);
+        }
+        m_needs_anchor_impl = false;
+        m_anchor_name.clear();
+    }
+
+    /// @brief Get the type of the value which a scalar token is converted into.
+    /// @param type The type of a scalar token.
+    /// @return The type of the value of the scalar.
+    static node_t to_scalar_type(lexical_token_t type) noexcept
+    {
+        switch (type)
+        {
+        case lexical_token_t::NULL_VALUE:
+            return node_t::NULL_OBJECT;
+        case lexical_token_t::BOOLEAN_VALUE:
+            return node_t::BOOLEAN;
+        case lexical_token_t::INTEGER_VALUE:
+            return node_t::INTEGER;
+        case lexical_token_t::FLOAT_NUMBER_VALUE:
+            return node_t::FLOAT_NUMBER;
+        default:
+            return node_t::STRING;
+        }
+    }
+
+    /// @brief Report the pending scalar or alias.
+    /// @param is_alias Whether the pending text is the name of an alias.
+    void report_scalar(bool is_alias)
+    {
+        if (m_is_aborted)
+        {
+            return;
+        }
+
+        if (is_alias)
+        {
+            m_is_aborted = !m_handler->alias(m_scalar_buffer);
+            return;
+        }
+
+        m_is_aborted = !report_scalar_value(m_scalar_type, m_scalar_buffer);
+    }
+
+    /// @brief Report a scalar to the handler.
+    /// @param type The type of the value of the scalar.
+    /// @param text The text of the scalar.
+    /// @return true to continue parsing, false otherwise.
+    bool report_scalar_value(node_t type, string_type& text)
+    {
+        return report_scalar_value(type, text, is_detected<raw_scalar_fn_t, SaxHandlerType, string_type> {});
+    }
+
+    /// @brief Report the text of a scalar to a handler which converts it by itself.
+    /// @param type The type of the value of the scalar.
+    /// @param text The text of the scalar.
+    /// @return true to continue parsing, false otherwise.
+    bool report_scalar_value(node_t type, string_type& text, std::true_type /*unused*/)
+    {
+        return m_handler->raw_scalar(type, text);
+    }
+
+    /// @brief Convert a scalar into a value and report it.
+    /// @param type The type of the value of the scalar.
+    /// @param text The text of the scalar.
+    /// @return true to continue parsing, false otherwise.
+    bool report_scalar_value(node_t type, string_type& text, std::false_type /*unused*/)
+    {
+        switch (type)
+        {
+        case node_t::NULL_OBJECT:
+            return m_handler->scalar(nullptr);
+        case node_t::BOOLEAN:
+            return m_handler->scalar(from_string(text, type_tag<boolean_type> {}));
+        case node_t::INTEGER:
+            return m_handler->scalar(from_string(text, type_tag<integer_type> {}));
+        case node_t::FLOAT_NUMBER:
+            return m_handler->scalar(from_string(text, type_tag<float_number_type> {}));
+        default:
+            return m_handler->scalar(text);
+        }
+    }
+
+    /// @brief Update the target YAML version with an input string.
+    /// @param version_str A YAML version string.
+    void update_yaml_version_from(const string_type& version_str) noexcept
+    {
+        if (version_str == "1.1")
+        {
+            m_yaml_version = yaml_version_t::VER_1_1;
+            return;
+        }
+        m_yaml_version = yaml_version_t::VER_1_2;
+    }
+
+    /// @brief Reset the internal states for the next parse.
+    void reset() noexcept
+    {
+        m_frames.clear();
+        m_free_frames.clear();
+        m_frame_stack.clear();
+        m_flow_stack.clear();
+        m_indent_stack.clear();
+        m_current = s_no_frame;
+        m_root = s_no_frame;
+        m_yaml_version = yaml_version_t::VER_1_2;
+        m_is_document_started = false;
+        m_is_aborted = false;
+        m_needs_anchor_impl = false;
+        m_anchor_name.clear();
+        m_anchor_names.clear();
+    }
+
+private:
+    /// The index which represents no frame.
+    static constexpr std::size_t s_no_frame = std::numeric_limits<std::size_t>::max();
+
+    /// The event handler.
+    SaxHandlerType* m_handler {nullptr};
+    /// The lexical analyzer for the input being parsed.
+    std::unique_ptr<lexical_analyzer<BasicNodeType>> m_lexer {};
+    /// The type of the token to be parsed next.
+    lexical_token_t m_token_type {lexical_token_t::END_OF_BUFFER};
+    /// The indentation width of the token to be parsed next.
+    std::size_t m_token_indent {0};
+    /// The line of the token to be parsed next.
+    std::size_t m_token_line {0};
+    /// Whether the whole input has been parsed.
+    bool m_is_finished {true};
+    /// The pool of frames.
+    std::vector<parse_frame> m_frames {};
+    /// The indices of the frames which can be reused.
+    std::vector<std::size_t> m_free_frames {};
+    /// The index of the currently focused frame.
+    std::size_t m_current {s_no_frame};
+    /// The index of the root frame.
+    std::size_t m_root {s_no_frame};
+    /// The stack of frames.
+    std::vector<std::size_t> m_frame_stack {};
+    /// The stack of flow containers being parsed.
+    std::vector<flow_context> m_flow_stack {};
+    /// The stack of indentation widths.
+    std::vector<std::pair<std::size_t /*indent*/, bool /*is_explicit_key*/>> m_indent_stack {};
+    /// The YAML version specification type.
+    yaml_version_t m_yaml_version {yaml_version_t::VER_1_2};
+    /// Whether the beginning of the document has been reported.
+    bool m_is_document_started {false};
+    /// Whether the handler has stopped parsing.
+    bool m_is_aborted {false};
+    /// A flag to determine the need for YAML anchor node implementation.
+    bool m_needs_anchor_impl {false};
+    /// The last YAML anchor name.
+    string_type m_anchor_name {};
+    /// The type of the value of the pending scalar.
+    node_t m_scalar_type {node_t::NULL_OBJECT};
+    /// The text of the pending scalar, or the name of the pending alias.
+    string_type m_scalar_buffer {};
+    /// The set of anchor names which have appeared so far.
+    std::unordered_set<std::string> m_anchor_names {};
+    /// The line of the last reported event.
+    std::size_t m_event_line {0};
+    /// The indentation width of the last reported event.
+    std::size_t m_event_indent {0};
+};
+
+#ifndef FK_YAML_HAS_CXX_17
+template <typename BasicNodeType, typename SaxHandlerType>
+constexpr std::size_t basic_sax_parser<BasicNodeType, SaxHandlerType>::s_no_frame;
+#endif
+
+} // namespace detail
+
+FK_YAML_NAMESPACE_END
+
+#endif /* FK_YAML_DETAIL_INPUT_SAX_PARSER_HPP_ */
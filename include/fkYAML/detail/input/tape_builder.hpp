@@ -0,0 +1,551 @@
+///  _______   __ __   __  _____   __  __  __
+/// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+/// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.2
+/// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+///
+/// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+/// SPDX-License-Identifier: MIT
+///
+/// @file
+
+#ifndef FK_YAML_DETAIL_INPUT_TAPE_BUILDER_HPP_
+#define FK_YAML_DETAIL_INPUT_TAPE_BUILDER_HPP_
+
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <fkYAML/detail/macros/version_macros.hpp>
+#include <fkYAML/detail/meta/node_traits.hpp>
+#include <fkYAML/detail/node_tape.hpp>
+#include <fkYAML/detail/types/node_t.hpp>
+#include <fkYAML/detail/types/yaml_version_t.hpp>
+
+/// @brief namespace for fkYAML library.
+FK_YAML_NAMESPACE_BEGIN
+
+/// @brief namespace for internal implementations of fkYAML library.
+namespace detail
+{
+
+/// @brief An event handler which records parse events into a node tape.
+/// @note
+/// This class has the same member functions as basic_sax_handler but does not derive from it so that the calls from
+/// the parser can be resolved statically.
+/// @tparam BasicNodeType A basic_node template instance type which defines the types of scalar values.
+template <typename BasicNodeType>
+class basic_tape_builder
+{
+    static_assert(is_basic_node<BasicNodeType>::value, "basic_tape_builder only accepts basic_node<...>");
+
+    /** A type for node tapes. */
+    using tape_type = basic_node_tape<BasicNodeType>;
+    /** A type for tape entries. */
+    using entry_type = typename tape_type::entry;
+    /** A type for boolean node values. */
+    using boolean_type = typename BasicNodeType::boolean_type;
+    /** A type for integer node values. */
+    using integer_type = typename BasicNodeType::integer_type;
+    /** A type for float number node values. */
+    using float_number_type = typename BasicNodeType::float_number_type;
+    /** A type for string node values. */
+    using string_type = typename BasicNodeType::string_type;
+
+    /// @brief A container node being recorded.
+    struct build_frame
+    {
+        /// The index of the container entry.
+        std::size_t index;
+        /// The index of the last key entry in the mapping.
+        std::size_t key_index;
+        /// The position in m_keys where the keys of the mapping begin.
+        std::size_t keys_begin;
+        /// Whether the last key in the mapping has not got its value yet.
+        bool needs_value;
+    };
+
+public:
+    /// @brief Construct a new basic_tape_builder object.
+    basic_tape_builder()
+        : mp_tape(new tape_type())
+    {
+    }
+
+public:
+    /// @brief Get the tape which has been recorded so far.
+    /// @return The recorded tape.
+    std::shared_ptr<tape_type>& get_tape() noexcept
+    {
+        return mp_tape;
+    }
+
+    /// @brief Get the message of the error which stopped recording the tape.
+    /// @return The error message, or an empty string if no error has occurred.
+    const std::string& get_error_message() const noexcept
+    {
+        return m_error_message;
+    }
+
+    /// @brief Handle the beginning of a document.
+    /// @param version The YAML version of the document.
+    /// @return true to continue parsing.
+    bool start_document(yaml_version_t version)
+    {
+        mp_tape->version = version;
+        return true;
+    }
+
+    /// @brief Handle the end of a document.
+    /// @return true to continue parsing.
+    bool end_document()
+    {
+        m_anchor_table.clear();
+        m_key_table.clear();
+        return true;
+    }
+
+    /// @brief Handle the beginning of a mapping.
+    /// @return true to continue parsing, false otherwise.
+    bool start_mapping()
+    {
+        return start_container(node_t::MAPPING);
+    }
+
+    /// @brief Handle the end of a mapping.
+    /// @return true to continue parsing, false otherwise.
+    bool end_mapping()
+    {
+        return end_container();
+    }
+
+    /// @brief Handle the beginning of a sequence.
+    /// @return true to continue parsing, false otherwise.
+    bool start_sequence()
+    {
+        return start_container(node_t::SEQUENCE);
+    }
+
+    /// @brief Handle the end of a sequence.
+    /// @return true to continue parsing.
+    bool end_sequence()
+    {
+        return end_container();
+    }
+
+    /// @brief Handle the beginning of a mapping key.
+    /// @return true to continue parsing.
+    bool key()
+    {
+        m_needs_key = true;
+        return true;
+    }
+
+    /// @brief Handle a null scalar.
+    /// @return true to continue parsing, false otherwise.
+    bool scalar(std::nullptr_t)
+    {
+        return add_scalar(node_t::NULL_OBJECT) != nullptr;
+    }
+
+    /// @brief Handle a boolean scalar.
+    /// @param value A boolean scalar value.
+    /// @return true to continue parsing, false otherwise.
+    bool scalar(boolean_type value)
+    {
+        entry_type* p_entry = add_scalar(node_t::BOOLEAN);
+        if (p_entry != nullptr)
+        {
+            p_entry->value.boolean = value;
+        }
+        return p_entry != nullptr;
+    }
+
+    /// @brief Handle an integer scalar.
+    /// @param value An integer scalar value.
+    /// @return true to continue parsing, false otherwise.
+    bool scalar(integer_type value)
+    {
+        entry_type* p_entry = add_scalar(node_t::INTEGER);
+        if (p_entry != nullptr)
+        {
+            p_entry->value.integer = value;
+        }
+        return p_entry != nullptr;
+    }
+
+    /// @brief Handle a float number scalar.
+    /// @param value A float number scalar value.
+    /// @return true to continue parsing, false otherwise.
+    bool scalar(float_number_type value)
+    {
+        entry_type* p_entry = add_scalar(node_t::FLOAT_NUMBER);
+        if (p_entry != nullptr)
+        {
+            p_entry->value.float_val = value;
+        }
+        return p_entry != nullptr;
+    }
+
+    /// @brief Handle a string scalar.
+    /// @param value A string scalar value which is appended to the string buffer of the tape.
+    /// @return true to continue parsing, false otherwise.
+    bool scalar(string_type& value)
+    {
+        entry_type* p_entry = add_scalar(node_t::STRING);
+        if (p_entry != nullptr)
+        {
+            p_entry->size = value.size();
+            p_entry->value.position = mp_tape->strings.size();
+            mp_tape->strings.append(value);
+        }
+        return p_entry != nullptr;
+    }
+
+    /// @brief Handle an anchor name which will be attached to the next scalar or alias.
+    /// @param name An anchor name.
+    /// @return true to continue parsing.
+    bool anchor(const string_type& name)
+    {
+        m_anchor_name = name;
+        m_needs_anchor_impl = true;
+        return true;
+    }
+
+    /// @brief Handle an alias node.
+    /// @param name An anchor name referenced by the alias.
+    /// @return true to continue parsing, false otherwise.
+    bool alias(const string_type& name)
+    {
+        auto itr = m_anchor_table.find(name);
+        if (itr == m_anchor_table.end())
+        {
+            m_error_message = "The given anchor name must appear prior to the alias node.";
+            return false;
+        }
+
+        // an alias shares the type and the anchor name with the anchored node.
+        const entry_type target = mp_tape->entries[itr->second];
+        entry_type* p_entry = add_scalar(target.type);
+        if (p_entry == nullptr)
+        {
+            return false;
+        }
+        p_entry->is_alias = true;
+        p_entry->anchor = target.anchor;
+        p_entry->value.position = target.is_alias ? target.value.position : itr->second;
+        return true;
+    }
+
+private:
+    /// @brief Add a new scalar (or alias) entry to the tape.
+    /// @param type The type of the scalar.
+    /// @return The pointer to the added entry, or nullptr if an error has occurred.
+    entry_type* add_scalar(node_t type)
+    {
+        // a pending anchor is attached to the next value, not to a mapping key.
+        bool is_key = m_needs_key && !m_frame_stack.empty() &&
+                      mp_tape->entries[m_frame_stack.back().index].type == node_t::MAPPING;
+
+        entry_type* p_entry = add_entry(type);
+        if (p_entry == nullptr)
+        {
+            return nullptr;
+        }
+
+        if (m_needs_anchor_impl && !is_key)
+        {
+            std::size_t index = mp_tape->entries.size() - 1;
+            mp_tape->anchor_names.push_back(std::move(m_anchor_name));
+            p_entry->anchor = mp_tape->anchor_names.size();
+            m_anchor_table[mp_tape->anchor_names.back()] = index;
+            m_needs_anchor_impl = false;
+            m_anchor_name.clear();
+        }
+        return p_entry;
+    }
+
+    /// @brief Add a new container entry to the tape and make it the current one.
+    /// @param type The type of the container.
+    /// @return true to continue parsing, false otherwise.
+    bool start_container(node_t type)
+    {
+        if (m_needs_key && !m_frame_stack.empty() &&
+            mp_tape->entries[m_frame_stack.back().index].type == node_t::SEQUENCE)
+        {
+            m_error_message = "A mapping key found in a non-mapping node.";
+            return false;
+        }
+
+        if (add_entry(type) == nullptr)
+        {
+            return false;
+        }
+        m_frame_stack.push_back({mp_tape->entries.size() - 1, 0, m_keys.size(), false});
+        return true;
+    }
+
+    /// @brief Finish the current container entry.
+    /// @return true to continue parsing, false otherwise.
+    bool end_container()
+    {
+        if (m_frame_stack.back().needs_value)
+        {
+            // the last key has no value.
+            if (!register_key(m_frame_stack.back()))
+            {
+                return false;
+            }
+            push_entry(node_t::NULL_OBJECT);
+        }
+
+        entry_type& container = mp_tape->entries[m_frame_stack.back().index];
+        container.next = mp_tape->entries.size();
+        m_keys.resize(m_frame_stack.back().keys_begin);
+        m_frame_stack.pop_back();
+        return true;
+    }
+
+    /// @brief Add a new entry at the current position in the tape.
+    /// @param type The type of the new entry.
+    /// @return The pointer to the added entry, or nullptr if an error has occurred.
+    entry_type* add_entry(node_t type)
+    {
+        if (m_frame_stack.empty())
+        {
+            return push_entry(type);
+        }
+
+        build_frame& frame = m_frame_stack.back();
+        entry_type& container = mp_tape->entries[frame.index];
+        if (container.type == node_t::SEQUENCE)
+        {
+            ++container.size;
+            return push_entry(type);
+        }
+
+        if (m_needs_key)
+        {
+            m_needs_key = false;
+            if (frame.needs_value)
+            {
+                // the previous key has no value.
+                if (!register_key(frame))
+                {
+                    return nullptr;
+                }
+                push_entry(node_t::NULL_OBJECT);
+            }
+            frame.key_index = mp_tape->entries.size();
+            frame.needs_value = true;
+            ++mp_tape->entries[frame.index].size;
+            return push_entry(type);
+        }
+
+        if (!frame.needs_value)
+        {
+            m_error_message = "A mapping value found without key.";
+            return nullptr;
+        }
+
+        // the key has been completed at this point even if it's a container.
+        if (!register_key(frame))
+        {
+            return nullptr;
+        }
+        frame.needs_value = false;
+        return push_entry(type);
+    }
+
+    /// @brief Register the last key in the current mapping unless the mapping already has the same key.
+    /// @param frame The frame of the current mapping.
+    /// @return true if the key has been registered, false otherwise.
+    bool register_key(const build_frame& frame)
+    {
+        std::size_t hash = hash_entry(frame.key_index);
+        std::size_t num_prev_keys = mp_tape->entries[frame.index].size - 1;
+
+        // most mappings are small enough to search their keys linearly without allocating hash table nodes.
+        if (num_prev_keys < s_linear_search_limit)
+        {
+            for (std::size_t i = frame.keys_begin; i < m_keys.size(); i++)
+            {
+                if (m_keys[i].first == hash && equals(m_keys[i].second, frame.key_index))
+                {
+                    m_error_message = "Detected duplication in mapping keys.";
+                    return false;
+                }
+            }
+            m_keys.emplace_back(hash, frame.key_index);
+            return true;
+        }
+
+        if (num_prev_keys == s_linear_search_limit)
+        {
+            // move the keys found so far into the hash table.
+            for (std::size_t i = frame.keys_begin; i < m_keys.size(); i++)
+            {
+                m_key_table.emplace(
+                    m_keys[i].first ^ (frame.index * 0x9e3779b9u), std::make_pair(frame.index, m_keys[i].second));
+            }
+            m_keys.resize(frame.keys_begin);
+        }
+
+        hash ^= frame.index * 0x9e3779b9u;
+        auto range = m_key_table.equal_range(hash);
+        for (auto itr = range.first; itr != range.second; ++itr)
+        {
+            if (itr->second.first == frame.index && equals(itr->second.second, frame.key_index))
+            {
+                m_error_message = "Detected duplication in mapping keys.";
+                return false;
+            }
+        }
+        m_key_table.emplace(hash, std::make_pair(frame.index, frame.key_index));
+        return true;
+    }
+
+    /// @brief Get the index of an entry, or of the anchored entry if the entry is an alias.
+    /// @param index The index of an entry.
+    /// @return The index of the entry which has the value.
+    std::size_t resolve(std::size_t index) const noexcept
+    {
+        const entry_type& e = mp_tape->entries[index];
+        return e.is_alias ? e.value.position : index;
+    }
+
+    /// @brief Compute a hash value of a node in the tape. Nodes which compare equal have the same hash value.
+    /// @param index The index of the entry of the node.
+    /// @return The hash value of the node.
+    std::size_t hash_entry(std::size_t index) const
+    {
+        const entry_type& e = mp_tape->entries[resolve(index)];
+        std::size_t hash = static_cast<std::size_t>(e.type);
+        switch (e.type)
+        {
+        case node_t::BOOLEAN:
+            hash += std::hash<boolean_type>()(e.value.boolean);
+            break;
+        case node_t::INTEGER:
+            hash += std::hash<integer_type>()(e.value.integer);
+            break;
+        case node_t::STRING:
+            for (std::size_t i = 0; i < e.size; i++)
+            {
+                hash = hash * 31 + static_cast<unsigned char>(mp_tape->strings[e.value.position + i]);
+            }
+            break;
+        case node_t::SEQUENCE:
+        case node_t::MAPPING:
+            hash += e.size;
+            break;
+        default:
+            // float numbers are compared with a tolerance, so they cannot be hashed by value.
+            break;
+        }
+        return hash;
+    }
+
+    /// @brief Check equality between nodes in the tape in the same way as basic_node::operator==.
+    /// @param lhs The index of the entry of a node.
+    /// @param rhs The index of the entry of another node.
+    /// @return true if the nodes are equal, false otherwise.
+    bool equals(std::size_t lhs, std::size_t rhs) const
+    {
+        const entry_type& l = mp_tape->entries[resolve(lhs)];
+        const entry_type& r = mp_tape->entries[resolve(rhs)];
+        if (l.type != r.type)
+        {
+            return false;
+        }
+
+        switch (l.type)
+        {
+        case node_t::SEQUENCE:
+        case node_t::MAPPING: {
+            if (l.size != r.size)
+            {
+                return false;
+            }
+            for (std::size_t i = resolve(lhs) + 1, j = resolve(rhs) + 1; i != l.next;
+                 i = mp_tape->entries[i].next, j = mp_tape->entries[j].next)
+            {
+                if (!equals(i, j))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+        case node_t::NULL_OBJECT:
+            return true;
+        case node_t::BOOLEAN:
+            return l.value.boolean == r.value.boolean;
+        case node_t::INTEGER:
+            return l.value.integer == r.value.integer;
+        case node_t::FLOAT_NUMBER:
+            return std::abs(l.value.float_val - r.value.float_val) < std::numeric_limits<float_number_type>::epsilon();
+        case node_t::STRING:
+            return l.size == r.size &&
+                   mp_tape->strings.compare(l.value.position, l.size, mp_tape->strings, r.value.position, r.size) == 0;
+        default:           // LCOV_EXCL_LINE
+            return false; // LCOV_EXCL_LINE
+        }
+    }
+
+    /// @brief Append a new entry to the tape.
+    /// @param type The type of the new entry.
+    /// @return The pointer to the appended entry.
+    entry_type* push_entry(node_t type)
+    {
+        std::size_t index = mp_tape->entries.size();
+        entry_type e;
+        e.type = type;
+        e.is_alias = false;
+        e.next = index + 1;
+        e.size = 0;
+        e.anchor = 0;
+        e.value.position = 0;
+        mp_tape->entries.push_back(e);
+        return &mp_tape->entries.back();
+    }
+
+private:
+    /// The tape being recorded.
+    std::shared_ptr<tape_type> mp_tape;
+    /// The stack of container entries being recorded.
+    std::vector<build_frame> m_frame_stack {};
+    /// Whether the next node is a mapping key.
+    bool m_needs_key {false};
+    /// A flag to determine the need for YAML anchor node implementation.
+    bool m_needs_anchor_impl {false};
+    /// The last YAML anchor name.
+    string_type m_anchor_name {};
+    /// The table of the indices of anchored entries.
+    std::unordered_map<std::string, std::size_t> m_anchor_table {};
+    /// The maximum number of keys in a mapping which are searched linearly for duplication.
+    static constexpr std::size_t s_linear_search_limit = 16;
+
+    /// The hash values and indices of the keys in the small mappings being recorded.
+    std::vector<std::pair<std::size_t, std::size_t>> m_keys {};
+    /// The table of the keys in the large mappings of the current document. (hash -> (mapping index, key index))
+    std::unordered_multimap<std::size_t, std::pair<std::size_t, std::size_t>> m_key_table {};
+    /// The message of the error which stopped recording the tape.
+    std::string m_error_message {};
+};
+
+#ifndef FK_YAML_HAS_CXX_17
+template <typename BasicNodeType>
+constexpr std::size_t basic_tape_builder<BasicNodeType>::s_linear_search_limit;
+#endif
+
+} // namespace detail
+
+FK_YAML_NAMESPACE_END
+
+#endif /* FK_YAML_DETAIL_INPUT_TAPE_BUILDER_HPP_ */
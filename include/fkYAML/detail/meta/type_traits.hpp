@@ -11,6 +11,8 @@
 #ifndef FK_YAML_DETAIL_META_TYPE_TRAITS_HPP_
 #define FK_YAML_DETAIL_META_TYPE_TRAITS_HPP_
 
+#include <cstddef>
+#include <functional>
 #include <limits>
 #include <type_traits>
 
@@ -128,6 +130,35 @@ struct is_complete_type<T, decltype(void(sizeof(T)))> : std::true_type
 {
 };
 
+/// @brief Type traits to check if T objects can be hashed with std::hash.
+/// @tparam T A type to be checked if hashable.
+/// @tparam typename N/A
+template <typename T, typename = void>
+struct is_hashable : std::false_type
+{
+};
+
+/// @brief A partial specialization of is_hashable if T objects can be hashed with std::hash.
+/// @tparam T A type to be checked if hashable.
+template <typename T>
+struct is_hashable<
+    T, enable_if_t<std::is_convertible<
+           decltype(std::declval<const std::hash<T>&>()(std::declval<const T&>())), std::size_t>::value>>
+    : std::true_type
+{
+};
+
+/// @brief A type which represents T::value_type.
+/// @tparam T A target type to check if it has value_type.
+template <typename T>
+using detect_value_type_helper_t = typename T::value_type;
+
+/// @brief Type traits to get the character type of a string type, which falls back to char if StringType doesn't have
+/// value_type as its member.
+/// @tparam StringType A string type.
+template <typename StringType>
+using string_char_type_t = typename detector_impl::detector<char, void, detect_value_type_helper_t, StringType>::type;
+
 /// @brief A utility struct to generate static constant instance.
 /// @tparam T A target type for the resulting static constant instance.
 template <typename T>
@@ -0,0 +1,571 @@
+///  _______   __ __   __  _____   __  __  __
+/// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+/// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.2
+/// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+///
+/// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+/// SPDX-License-Identifier: MIT
+///
+/// @file
+
+#ifndef FK_YAML_DETAIL_NODE_COMPACTOR_HPP_
+#define FK_YAML_DETAIL_NODE_COMPACTOR_HPP_
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <fkYAML/detail/macros/version_macros.hpp>
+#include <fkYAML/detail/container_utils.hpp>
+#include <fkYAML/detail/conversions/to_node.hpp>
+#include <fkYAML/detail/meta/node_traits.hpp>
+#include <fkYAML/detail/node_hash.hpp>
+#include <fkYAML/detail/node_string_accessor.hpp>
+#include <fkYAML/detail/types/node_t.hpp>
+
+/// @brief namespace for fkYAML library.
+FK_YAML_NAMESPACE_BEGIN
+
+/// @brief namespace for internal implementations of fkYAML library.
+namespace detail
+{
+
+/// @brief A class which reduces the memory used by a node tree.
+/// @note
+/// Container capacities are shrunk to fit their sizes, and strings which appear more than once (or have already been
+/// interned) are replaced with strings shared through a key interner. Strings short enough to be stored in place in
+/// nodes are left as they are since they don't use any heap memory. Then identical container subtrees are found by
+/// their digests and share one copy-on-write container. (hash-consing) Containers already shared with other nodes are
+/// left as they are without being copied, and so are their descendants.
+/// @tparam BasicNodeType A basic_node template instance type.
+template <typename BasicNodeType>
+class basic_node_compactor
+{
+    static_assert(is_basic_node<BasicNodeType>::value, "basic_node_compactor only accepts basic_node<...>");
+
+    /** A type for sequence node value containers. */
+    using sequence_type = typename BasicNodeType::sequence_type;
+    /** A type for mapping node value containers. */
+    using mapping_type = typename BasicNodeType::mapping_type;
+    /** A type for float number node values. */
+    using float_number_type = typename BasicNodeType::float_number_type;
+    /** A type for string node values. */
+    using string_type = typename BasicNodeType::string_type;
+    /** A type for characters of string node values. */
+    using char_type = typename string_type::value_type;
+    /** A type for pools of shared strings. */
+    using key_interner_type = typename BasicNodeType::key_interner_type;
+    /** A type for shared pointers to interned strings. */
+    using pointer = typename key_interner_type::pointer;
+    /** A type for accessors to string node values. */
+    using accessor_type = node_string_accessor<BasicNodeType>;
+    /** A type for maps from container nodes to their hash values. */
+    using digest_memo_type = typename node_hash<BasicNodeType>::digest_memo_type;
+
+    /// @brief A hash function object for strings referenced by pointers.
+    struct deref_hash
+    {
+        std::size_t operator()(const string_type* p_str) const
+        {
+            return std::hash<string_type>()(*p_str);
+        }
+    };
+
+    /// @brief An equality function object for strings referenced by pointers.
+    struct deref_equal
+    {
+        bool operator()(const string_type* lhs, const string_type* rhs) const
+        {
+            return *lhs == *rhs;
+        }
+    };
+
+public:
+    /// @brief Construct a new basic_node_compactor object.
+    /// @param interner A pool of strings to be shared, which must outlive this compactor.
+    explicit basic_node_compactor(key_interner_type& interner)
+        : m_interner(interner)
+    {
+    }
+
+public:
+    /// @brief Compact the given node tree.
+    /// @param root The root node of the node tree.
+    void compact(BasicNodeType& root)
+    {
+        intern_duplicates(root);
+        share_strings(root);
+        share_subtrees(root);
+    }
+
+private:
+    /// @brief Check whether the children of the given container node can be modified without copying the container.
+    /// @param node A container node.
+    /// @return true if the container is not shared with other nodes, false otherwise.
+    static bool is_modifiable(const BasicNodeType& node) noexcept
+    {
+        return node.m_node_value.is_exclusive();
+    }
+
+    /// @brief Intern the strings which appear more than once in the node tree.
+    /// @param root The root node of the node tree.
+    void intern_duplicates(const BasicNodeType& root)
+    {
+        std::unordered_map<const string_type*, std::size_t, deref_hash, deref_equal> counts;
+        std::vector<const BasicNodeType*> stack(1, &root);
+
+        while (!stack.empty())
+        {
+            const BasicNodeType& node = *stack.back();
+            stack.pop_back();
+
+            switch (node.type())
+            {
+            case node_t::SEQUENCE:
+                if (!is_modifiable(node))
+                {
+                    break;
+                }
+                for (const BasicNodeType& elem : *node.m_node_value.p_sequence)
+                {
+                    stack.push_back(&elem);
+                }
+                break;
+            case node_t::MAPPING:
+                if (!is_modifiable(node))
+                {
+                    break;
+                }
+                for (const auto& entry : *node.m_node_value.p_mapping)
+                {
+                    stack.push_back(&entry.first);
+                    stack.push_back(&entry.second);
+                }
+                break;
+            case node_t::STRING: {
+                // strings stored in place in nodes gain nothing from sharing.
+                if (accessor_type::is_inline(node))
+                {
+                    break;
+                }
+                const string_type& str = node.template get_value_ref<const string_type&>();
+                if (++counts[&str] == 2)
+                {
+                    m_interner.intern(str);
+                }
+                break;
+            }
+            default:
+                break;
+            }
+        }
+    }
+
+    /// @brief Share the interned strings and shrink the containers in the node tree.
+    /// @param root The root node of the node tree.
+    void share_strings(BasicNodeType& root)
+    {
+        std::vector<BasicNodeType*> stack(1, &root);
+
+        while (!stack.empty())
+        {
+            BasicNodeType& node = *stack.back();
+            stack.pop_back();
+
+            switch (node.type())
+            {
+            case node_t::SEQUENCE: {
+                if (!is_modifiable(node))
+                {
+                    break;
+                }
+                // the container is accessed directly so that a copy-on-write one is not copied.
+                sequence_type& seq = *node.m_node_value.p_sequence;
+                shrink_to_fit_if_possible(seq);
+                for (BasicNodeType& elem : seq)
+                {
+                    stack.push_back(&elem);
+                }
+                break;
+            }
+            case node_t::MAPPING: {
+                if (!is_modifiable(node))
+                {
+                    break;
+                }
+                mapping_type& map = *node.m_node_value.p_mapping;
+                compact_keys(map);
+                for (auto& entry : map)
+                {
+                    stack.push_back(&entry.second);
+                }
+                break;
+            }
+            case node_t::STRING:
+                share_string(node);
+                break;
+            default:
+                break;
+            }
+        }
+    }
+
+    /// @brief Find the interned string to be shared by the given string node.
+    /// @param node A string node.
+    /// @return The interned string, or nullptr if the string is not to be shared or has already been shared.
+    pointer find_shared_string(const BasicNodeType& node) const
+    {
+        if (accessor_type::is_inline(node))
+        {
+            return nullptr;
+        }
+
+        const string_type& str = node.template get_value_ref<const string_type&>();
+        pointer p_str = m_interner.find(str);
+        // a shared string is referenced by the node itself.
+        return (p_str && p_str.get() != &str) ? p_str : nullptr;
+    }
+
+    /// @brief Replace the value of the given string node with the interned string if any.
+    /// @param node A string node.
+    void share_string(BasicNodeType& node)
+    {
+        pointer p_str = find_shared_string(node);
+        if (p_str)
+        {
+            external_node_constructor<node_t::STRING>::construct(node, std::move(p_str));
+        }
+    }
+
+    /// @brief Share the interned strings in the keys of the given mapping and shrink the mapping.
+    /// @note Since keys cannot be modified in place, the mapping is rebuilt if any key is to be changed.
+    /// @param map A mapping node value.
+    void compact_keys(mapping_type& map)
+    {
+        bool needs_rebuild = false;
+        for (const auto& entry : map)
+        {
+            if (entry.first.is_sequence() || entry.first.is_mapping() ||
+                (entry.first.is_string() && find_shared_string(entry.first)))
+            {
+                needs_rebuild = true;
+                break;
+            }
+        }
+
+        if (!needs_rebuild)
+        {
+            shrink_to_fit_if_possible(map);
+            return;
+        }
+
+        mapping_type compacted;
+        reserve_if_possible(compacted, map.size());
+        for (auto& entry : map)
+        {
+            BasicNodeType key = entry.first;
+            if (key.is_string())
+            {
+                share_string(key);
+            }
+            else if (key.is_sequence() || key.is_mapping())
+            {
+                basic_node_compactor(m_interner).share_strings(key);
+            }
+            // keys are unique and in order already, so they can be simply appended.
+            append_mapping_entry(compacted, std::move(key), std::move(entry.second));
+        }
+        map = std::move(compacted);
+    }
+
+    /// @brief Let identical container subtrees in the node tree share one copy-on-write container.
+    /// @note
+    /// Containers are visited in post-order, so the children of a container have already been shared when the
+    /// container is looked up. Candidates are found by digests combined with the hash values of what digests ignore
+    /// (float number values and properties), and then checked with is_identical(). Mapping keys are not visited since
+    /// they cannot be modified in place. Replaced containers are destroyed at the end since their descendants may have
+    /// been registered as candidates.
+    /// @param root The root node of the node tree.
+    void share_subtrees(BasicNodeType& root)
+    {
+        if (!root.is_sequence() && !root.is_mapping())
+        {
+            return;
+        }
+
+        digest_memo_type digests;
+        digest_memo_type extra_hashes;
+        std::unordered_multimap<std::uint64_t, BasicNodeType*> candidates;
+        std::vector<BasicNodeType> replaced;
+
+        // a container is pushed again with the flag set after its children so that it's looked up after them.
+        std::vector<std::pair<BasicNodeType*, bool>> stack(1, std::make_pair(&root, false));
+        while (!stack.empty())
+        {
+            BasicNodeType& node = *stack.back().first;
+            if (!stack.back().second && is_modifiable(node))
+            {
+                stack.back().second = true;
+                push_container_children(node, stack);
+                continue;
+            }
+            stack.pop_back();
+
+            const std::uint64_t extra_hash = hash_extras(node, extra_hashes);
+            extra_hashes.emplace(&node, extra_hash);
+            const std::uint64_t key = hash_combine(node_hash<BasicNodeType>::digest(node, digests), extra_hash);
+
+            bool is_shared = false;
+            auto range = candidates.equal_range(key);
+            for (auto itr = range.first; itr != range.second; ++itr)
+            {
+                BasicNodeType& candidate = *itr->second;
+                if (is_identical(candidate, node))
+                {
+                    replaced.emplace_back();
+                    node.m_node_value.share_container_of(candidate.m_node_value, replaced.back().m_node_value);
+                    is_shared = true;
+                    break;
+                }
+            }
+
+            if (!is_shared)
+            {
+                candidates.emplace(key, &node);
+            }
+        }
+    }
+
+    /// @brief Push the children of the given container node which are containers to the stack.
+    /// @param node A container node.
+    /// @param stack A stack of the container nodes to be visited.
+    static void push_container_children(BasicNodeType& node, std::vector<std::pair<BasicNodeType*, bool>>& stack)
+    {
+        if (node.is_sequence())
+        {
+            for (BasicNodeType& elem : *node.m_node_value.p_sequence)
+            {
+                if (elem.is_sequence() || elem.is_mapping())
+                {
+                    stack.emplace_back(&elem, false);
+                }
+            }
+            return;
+        }
+
+        for (auto& entry : *node.m_node_value.p_mapping)
+        {
+            if (entry.second.is_sequence() || entry.second.is_mapping())
+            {
+                stack.emplace_back(&entry.second, false);
+            }
+        }
+    }
+
+    /// @brief Calculate the hash value of what digests ignore in the children of the given container node.
+    /// @param node A container node.
+    /// @param extra_hashes The hash values calculated for the container nodes visited so far.
+    /// @return The hash value of the float number values and the properties in the descendants.
+    static std::uint64_t hash_extras(const BasicNodeType& node, const digest_memo_type& extra_hashes)
+    {
+        std::uint64_t hash = static_cast<std::uint64_t>(node.type());
+        if (node.is_sequence())
+        {
+            for (const BasicNodeType& elem : *node.m_node_value.p_sequence)
+            {
+                hash = hash_combine(hash, hash_child_extras(elem, extra_hashes));
+            }
+            return hash;
+        }
+
+        // entries are combined independently of their order since mapping types might be unordered.
+        std::uint64_t sum = 0;
+        for (const auto& entry : *node.m_node_value.p_mapping)
+        {
+            sum += hash_mix(hash_combine(
+                hash_child_extras(entry.first, extra_hashes), hash_child_extras(entry.second, extra_hashes)));
+        }
+        return hash_combine(hash, sum);
+    }
+
+    /// @brief Calculate the hash value of what digests ignore in the given child node.
+    /// @param node A child node.
+    /// @param extra_hashes The hash values calculated for the container nodes visited so far.
+    /// @return The hash value of the float number value and the properties of the child node.
+    static std::uint64_t hash_child_extras(const BasicNodeType& node, const digest_memo_type& extra_hashes)
+    {
+        const auto& attrs = node.m_node_value.attrs;
+        std::uint64_t hash = hash_combine(
+            static_cast<std::uint64_t>(attrs.version()), static_cast<std::uint64_t>(attrs.anchor_status()));
+        // a property set without any names (e.g., kept only for a string copy) is hashed like a missing one.
+        if (node.m_prop && !node.m_prop->empty())
+        {
+            hash = hash_combine(hash, std::hash<std::string>()(node.m_prop->tag));
+            hash = hash_combine(hash, std::hash<std::string>()(node.m_prop->anchor));
+        }
+
+        switch (node.type())
+        {
+        case node_t::SEQUENCE:
+        case node_t::MAPPING: {
+            // containers which have not been visited (e.g., shared ones) are hashed consistently as 0.
+            auto itr = extra_hashes.find(&node);
+            return hash_combine(hash, (itr != extra_hashes.end()) ? itr->second : 0);
+        }
+        case node_t::FLOAT_NUMBER:
+            return hash_combine(hash, std::hash<float_number_type>()(node.m_node_value.float_val));
+        default:
+            return hash;
+        }
+    }
+
+    /// @brief Check whether the children of the given container nodes are identical, which is stricter than equality.
+    /// @note Unlike operator==, float number values must be exactly the same, and so must the properties (tags, anchor
+    /// names and YAML versions) of the descendants. The properties of the given nodes themselves are not compared since
+    /// they are not shared with their containers. Mapping entries are matched by key lookups, so this works with
+    /// unordered mapping types as well.
+    /// @param lhs A left-hand-side container node.
+    /// @param rhs A right-hand-side container node of the same type as `lhs`.
+    /// @return true if the children of the nodes are identical, false otherwise.
+    static bool is_identical(const BasicNodeType& lhs, const BasicNodeType& rhs)
+    {
+        std::vector<std::pair<const BasicNodeType*, const BasicNodeType*>> stack(1, std::make_pair(&lhs, &rhs));
+        bool is_root = true;
+
+        while (!stack.empty())
+        {
+            const BasicNodeType& l = *stack.back().first;
+            const BasicNodeType& r = *stack.back().second;
+            stack.pop_back();
+
+            if (is_root)
+            {
+                is_root = false;
+                if (l.type() != r.type())
+                {
+                    return false;
+                }
+            }
+            else if (!has_same_attributes(l, r))
+            {
+                return false;
+            }
+
+            const auto& lv = l.m_node_value;
+            const auto& rv = r.m_node_value;
+            switch (l.type())
+            {
+            case node_t::SEQUENCE: {
+                if (lv.p_sequence == rv.p_sequence)
+                {
+                    break;
+                }
+                const sequence_type& lseq = *lv.p_sequence;
+                const sequence_type& rseq = *rv.p_sequence;
+                if (lseq.size() != rseq.size())
+                {
+                    return false;
+                }
+                for (std::size_t i = 0; i < lseq.size(); i++)
+                {
+                    stack.emplace_back(&lseq[i], &rseq[i]);
+                }
+                break;
+            }
+            case node_t::MAPPING: {
+                if (lv.p_mapping == rv.p_mapping)
+                {
+                    break;
+                }
+                const mapping_type& lmap = *lv.p_mapping;
+                const mapping_type& rmap = *rv.p_mapping;
+                if (lmap.size() != rmap.size())
+                {
+                    return false;
+                }
+                for (const auto& entry : lmap)
+                {
+                    auto itr = rmap.find(entry.first);
+                    if (itr == rmap.end())
+                    {
+                        return false;
+                    }
+                    stack.emplace_back(&entry.first, &itr->first);
+                    stack.emplace_back(&entry.second, &itr->second);
+                }
+                break;
+            }
+            case node_t::NULL_OBJECT:
+                break;
+            case node_t::BOOLEAN:
+                if (lv.boolean != rv.boolean)
+                {
+                    return false;
+                }
+                break;
+            case node_t::INTEGER:
+                if (lv.integer != rv.integer)
+                {
+                    return false;
+                }
+                break;
+            case node_t::FLOAT_NUMBER:
+                // -0.0 and 0.0 are equal but not identical.
+                if (!(lv.float_val == rv.float_val) || std::signbit(lv.float_val) != std::signbit(rv.float_val))
+                {
+                    return false;
+                }
+                break;
+            case node_t::STRING: {
+                const std::size_t size = accessor_type::size(l);
+                if (size != accessor_type::size(r) ||
+                    std::char_traits<char_type>::compare(accessor_type::data(l), accessor_type::data(r), size) != 0)
+                {
+                    return false;
+                }
+                break;
+            }
+            }
+        }
+
+        return true;
+    }
+
+    /// @brief Check whether the given nodes have the same type, attributes and properties.
+    /// @param lhs A left-hand-side node.
+    /// @param rhs A right-hand-side node.
+    /// @return true if the nodes have the same type, attributes and properties, false otherwise.
+    static bool has_same_attributes(const BasicNodeType& lhs, const BasicNodeType& rhs)
+    {
+        const auto& lattrs = lhs.m_node_value.attrs;
+        const auto& rattrs = rhs.m_node_value.attrs;
+        if (lattrs.type() != rattrs.type() || lattrs.version() != rattrs.version() ||
+            lattrs.anchor_status() != rattrs.anchor_status())
+        {
+            return false;
+        }
+
+        const bool lhs_has_names = lhs.m_prop && !lhs.m_prop->empty();
+        const bool rhs_has_names = rhs.m_prop && !rhs.m_prop->empty();
+        if (!lhs_has_names || !rhs_has_names)
+        {
+            return !lhs_has_names && !rhs_has_names;
+        }
+        return lhs.m_prop->tag == rhs.m_prop->tag && lhs.m_prop->anchor == rhs.m_prop->anchor;
+    }
+
+private:
+    /// The pool of shared strings.
+    key_interner_type& m_interner;
+};
+
+} // namespace detail
+
+FK_YAML_NAMESPACE_END
+
+#endif /* FK_YAML_DETAIL_NODE_COMPACTOR_HPP_ */
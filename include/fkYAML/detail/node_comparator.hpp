@@ -0,0 +1,455 @@
+///  _______   __ __   __  _____   __  __  __
+/// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+/// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.2
+/// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+///
+/// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+/// SPDX-License-Identifier: MIT
+///
+/// @file
+
+#ifndef FK_YAML_DETAIL_NODE_COMPARATOR_HPP_
+#define FK_YAML_DETAIL_NODE_COMPARATOR_HPP_
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <fkYAML/detail/container_utils.hpp>
+#include <fkYAML/detail/macros/version_macros.hpp>
+#include <fkYAML/detail/meta/node_traits.hpp>
+#include <fkYAML/detail/node_lookup_key.hpp>
+#include <fkYAML/detail/node_string_accessor.hpp>
+#include <fkYAML/detail/types/node_t.hpp>
+
+/// @brief namespace for fkYAML library.
+FK_YAML_NAMESPACE_BEGIN
+
+/// @brief namespace for internal implementations of fkYAML library.
+namespace detail
+{
+
+/// @brief A class which compares basic_node objects without recursion.
+/// @note
+/// Node trees are traversed in pre-order with an explicit stack so that deeply nested nodes never overflow the call
+/// stack. The results are the same as element-wise comparisons of the container values, i.e., containers are compared
+/// lexicographically and mapping entries are compared by keys first and then by values.
+/// @tparam BasicNodeType A basic_node template instance type.
+template <typename BasicNodeType>
+class basic_node_comparator
+{
+    static_assert(is_basic_node<BasicNodeType>::value, "basic_node_comparator only accepts basic_node<...>");
+
+    /** A type for sequence node value containers. */
+    using sequence_type = typename BasicNodeType::sequence_type;
+    /** A type for mapping node value containers. */
+    using mapping_type = typename BasicNodeType::mapping_type;
+    /** A type for boolean node values. */
+    using boolean_type = typename BasicNodeType::boolean_type;
+    /** A type for integer node values. */
+    using integer_type = typename BasicNodeType::integer_type;
+    /** A type for float number node values. */
+    using float_number_type = typename BasicNodeType::float_number_type;
+    /** A type for string node values. */
+    using string_type = typename BasicNodeType::string_type;
+    /** A type for characters of string node values. */
+    using char_type = typename string_type::value_type;
+    /** A type for accessors to string node values. */
+    using accessor_type = node_string_accessor<BasicNodeType>;
+
+    /// @brief A pair of containers being compared and the positions of the next children to be compared.
+    class frame
+    {
+    public:
+        /// @brief Construct a new frame object with container nodes of the same type.
+        /// @param lhs A left-hand-side container node.
+        /// @param rhs A right-hand-side container node.
+        /// @param by_key Whether mapping entries are paired by keys instead of by their positions.
+        frame(const BasicNodeType& lhs, const BasicNodeType& rhs, bool by_key)
+            : m_is_mapping(lhs.is_mapping()),
+              m_by_key(by_key)
+        {
+            if (m_is_mapping)
+            {
+                const mapping_type& lhs_map = lhs.template get_value_ref<const mapping_type&>();
+                const mapping_type& rhs_map = rhs.template get_value_ref<const mapping_type&>();
+                m_lhs_map_itr = lhs_map.begin();
+                m_lhs_map_end = lhs_map.end();
+                m_rhs_map_itr = rhs_map.begin();
+                m_rhs_map_end = rhs_map.end();
+                mp_rhs_map = &rhs_map;
+            }
+            else
+            {
+                const sequence_type& lhs_seq = lhs.template get_value_ref<const sequence_type&>();
+                const sequence_type& rhs_seq = rhs.template get_value_ref<const sequence_type&>();
+                m_lhs_seq_itr = lhs_seq.begin();
+                m_lhs_seq_end = lhs_seq.end();
+                m_rhs_seq_itr = rhs_seq.begin();
+                m_rhs_seq_end = rhs_seq.end();
+            }
+        }
+
+        /// @brief Get the next pair of children to be compared.
+        /// @param p_lhs A storage for the next left-hand-side child. Set to nullptr if no children are left.
+        /// @param p_rhs A storage for the next right-hand-side child. Set to nullptr if no children are left.
+        /// @return -1 if only the left-hand-side children run out, 1 if only the right-hand-side ones do, 0 otherwise.
+        int next(const BasicNodeType*& p_lhs, const BasicNodeType*& p_rhs)
+        {
+            p_lhs = p_rhs = nullptr;
+
+            if (m_is_mapping)
+            {
+                if (m_is_value_next)
+                {
+                    p_lhs = &(m_lhs_map_itr++)->second;
+                    p_rhs = &(m_rhs_map_itr++)->second;
+                    m_is_value_next = false;
+                    return 0;
+                }
+
+                if (m_by_key)
+                {
+                    // the mappings are known to have the same size, so only the values of the left-hand-side keys
+                    // need to be compared with those of the right-hand-side ones.
+                    if (m_lhs_map_itr == m_lhs_map_end)
+                    {
+                        return 0;
+                    }
+                    auto rhs_itr = mp_rhs_map->find(m_lhs_map_itr->first);
+                    if (rhs_itr == m_rhs_map_end)
+                    {
+                        return 1;
+                    }
+                    p_lhs = &(m_lhs_map_itr++)->second;
+                    p_rhs = &rhs_itr->second;
+                    return 0;
+                }
+
+                const bool lhs_end = (m_lhs_map_itr == m_lhs_map_end);
+                const bool rhs_end = (m_rhs_map_itr == m_rhs_map_end);
+                if (lhs_end || rhs_end)
+                {
+                    return (lhs_end == rhs_end) ? 0 : (lhs_end ? -1 : 1);
+                }
+
+                p_lhs = &m_lhs_map_itr->first;
+                p_rhs = &m_rhs_map_itr->first;
+                m_is_value_next = true;
+                return 0;
+            }
+
+            const bool lhs_end = (m_lhs_seq_itr == m_lhs_seq_end);
+            const bool rhs_end = (m_rhs_seq_itr == m_rhs_seq_end);
+            if (lhs_end || rhs_end)
+            {
+                return (lhs_end == rhs_end) ? 0 : (lhs_end ? -1 : 1);
+            }
+
+            p_lhs = &*(m_lhs_seq_itr++);
+            p_rhs = &*(m_rhs_seq_itr++);
+            return 0;
+        }
+
+    private:
+        /// Whether the containers are mappings.
+        bool m_is_mapping;
+        /// Whether mapping entries are paired by keys.
+        bool m_by_key;
+        /// Whether the value of the current mapping entry is to be compared next.
+        bool m_is_value_next {false};
+        /// The next left-hand-side sequence element.
+        typename sequence_type::const_iterator m_lhs_seq_itr {};
+        /// The end of the left-hand-side sequence.
+        typename sequence_type::const_iterator m_lhs_seq_end {};
+        /// The next right-hand-side sequence element.
+        typename sequence_type::const_iterator m_rhs_seq_itr {};
+        /// The end of the right-hand-side sequence.
+        typename sequence_type::const_iterator m_rhs_seq_end {};
+        /// The next left-hand-side mapping entry.
+        typename mapping_type::const_iterator m_lhs_map_itr {};
+        /// The end of the left-hand-side mapping.
+        typename mapping_type::const_iterator m_lhs_map_end {};
+        /// The next right-hand-side mapping entry.
+        typename mapping_type::const_iterator m_rhs_map_itr {};
+        /// The end of the right-hand-side mapping.
+        typename mapping_type::const_iterator m_rhs_map_end {};
+        /// The right-hand-side mapping.
+        const mapping_type* mp_rhs_map {nullptr};
+    };
+
+public:
+    /// @brief Check whether the given nodes are equal.
+    /// @param lhs A left-hand-side node.
+    /// @param rhs A right-hand-side node.
+    /// @return true if both types and values are equal, false otherwise.
+    static bool equal(const BasicNodeType& lhs, const BasicNodeType& rhs)
+    {
+        return traverse(lhs, rhs, std::false_type {}) == 0;
+    }
+
+    /// @brief Compare the given nodes in the order of basic_node::operator<.
+    /// @param lhs A left-hand-side node.
+    /// @param rhs A right-hand-side node.
+    /// @return A negative value if `lhs` is less than `rhs`, a positive value if greater, 0 if they are equal.
+    static int compare(const BasicNodeType& lhs, const BasicNodeType& rhs)
+    {
+        return traverse(lhs, rhs, std::true_type {});
+    }
+
+    /// @brief Compare the given node with a string key as if the key were converted into a basic_node object.
+    /// @tparam KeyType A string key type.
+    /// @param node A node.
+    /// @param key A string key.
+    /// @return A negative value if `node` is less than `key`, a positive value if greater, 0 if they are equal.
+    template <typename KeyType, enable_if_t<is_string_lookup_key<BasicNodeType, KeyType>::value, int> = 0>
+    static int compare_key(const BasicNodeType& node, const KeyType& key)
+    {
+        if (!node.is_string())
+        {
+            return compare_types(node.type(), node_t::STRING);
+        }
+
+        const lookup_chars<char_type> chars = get_lookup_chars<char_type>(key);
+        return compare_chars(accessor_type::data(node), accessor_type::size(node), chars.p_begin, chars.size);
+    }
+
+    /// @brief Compare the given node with an integer key as if the key were converted into a basic_node object.
+    /// @tparam KeyType An integer key type.
+    /// @param node A node.
+    /// @param key An integer key.
+    /// @return A negative value if `node` is less than `key`, a positive value if greater, 0 if they are equal.
+    template <typename KeyType, enable_if_t<is_integer_lookup_key<BasicNodeType, KeyType>::value, int> = 0>
+    static int compare_key(const BasicNodeType& node, const KeyType& key)
+    {
+        if (!node.is_integer())
+        {
+            return compare_types(node.type(), node_t::INTEGER);
+        }
+
+        const integer_type lhs_int = node.template get_value_ref<const integer_type&>();
+        const integer_type rhs_int = static_cast<integer_type>(key);
+        return (lhs_int == rhs_int) ? 0 : ((lhs_int < rhs_int) ? -1 : 1);
+    }
+
+    /// @brief Check whether the given node is equal to a string key.
+    /// @tparam KeyType A string key type.
+    /// @param node A node.
+    /// @param key A string key.
+    /// @return true if `node` is a string node with the same characters as `key`, false otherwise.
+    template <typename KeyType, enable_if_t<is_string_lookup_key<BasicNodeType, KeyType>::value, int> = 0>
+    static bool equal_key(const BasicNodeType& node, const KeyType& key)
+    {
+        if (!node.is_string())
+        {
+            return false;
+        }
+
+        const lookup_chars<char_type> chars = get_lookup_chars<char_type>(key);
+        const std::size_t size = accessor_type::size(node);
+        return size == chars.size &&
+               std::char_traits<char_type>::compare(accessor_type::data(node), chars.p_begin, size) == 0;
+    }
+
+    /// @brief Check whether the given node is equal to an integer key.
+    /// @tparam KeyType An integer key type.
+    /// @param node A node.
+    /// @param key An integer key.
+    /// @return true if `node` is an integer node with the same value as `key`, false otherwise.
+    template <typename KeyType, enable_if_t<is_integer_lookup_key<BasicNodeType, KeyType>::value, int> = 0>
+    static bool equal_key(const BasicNodeType& node, const KeyType& key)
+    {
+        return node.is_integer() &&
+               node.template get_value_ref<const integer_type&>() == static_cast<integer_type>(key);
+    }
+
+private:
+    /// @brief Compare the given characters lexicographically.
+    /// @param p_lhs A left-hand-side first character.
+    /// @param lhs_size The number of left-hand-side characters.
+    /// @param p_rhs A right-hand-side first character.
+    /// @param rhs_size The number of right-hand-side characters.
+    /// @return A negative value if `lhs` is less than `rhs`, a positive value if greater, 0 if they are equal.
+    static int compare_chars(
+        const char_type* p_lhs, std::size_t lhs_size, const char_type* p_rhs, std::size_t rhs_size) noexcept
+    {
+        const int ret = std::char_traits<char_type>::compare(p_lhs, p_rhs, (lhs_size < rhs_size) ? lhs_size : rhs_size);
+        if (ret != 0)
+        {
+            return (ret < 0) ? -1 : 1;
+        }
+        return (lhs_size == rhs_size) ? 0 : ((lhs_size < rhs_size) ? -1 : 1);
+    }
+
+    /// @brief Compare the given node types.
+    /// @param lhs A left-hand-side node type.
+    /// @param rhs A right-hand-side node type, which must be different from `lhs`.
+    /// @return -1 if `lhs` comes before `rhs`, 1 otherwise.
+    static int compare_types(node_t lhs, node_t rhs) noexcept
+    {
+        return (static_cast<std::uint32_t>(lhs) < static_cast<std::uint32_t>(rhs)) ? -1 : 1;
+    }
+
+    /// @brief Compare the given node trees.
+    /// @tparam Ordered Whether the result must reflect the order of the nodes or just their equality.
+    /// @param lhs A left-hand-side node.
+    /// @param rhs A right-hand-side node.
+    /// @return 0 if the node trees are equal, non-zero otherwise. The sign shows the order only if `Ordered` is true.
+    template <bool Ordered>
+    static int traverse(const BasicNodeType& lhs, const BasicNodeType& rhs, std::integral_constant<bool, Ordered> tag)
+    {
+        int ret = compare_shallow(lhs, rhs, tag);
+        if (ret != 0 || !has_distinct_children(lhs, rhs))
+        {
+            return ret;
+        }
+
+        // the iteration order of hash-based mappings depends on the history of insertions, so their entries are
+        // paired by keys for equality checks. Orders are still based on the iteration order.
+        constexpr bool by_key = !Ordered && is_unordered_mapping<mapping_type>::value;
+
+        std::vector<frame> stack;
+        stack.emplace_back(lhs, rhs, by_key);
+
+        while (!stack.empty())
+        {
+            const BasicNodeType* p_lhs = nullptr;
+            const BasicNodeType* p_rhs = nullptr;
+            ret = stack.back().next(p_lhs, p_rhs);
+            if (ret != 0)
+            {
+                return ret;
+            }
+
+            if (!p_lhs)
+            {
+                stack.pop_back();
+                continue;
+            }
+
+            ret = compare_shallow(*p_lhs, *p_rhs, tag);
+            if (ret != 0)
+            {
+                return ret;
+            }
+
+            if (has_distinct_children(*p_lhs, *p_rhs))
+            {
+                stack.emplace_back(*p_lhs, *p_rhs, by_key);
+            }
+        }
+
+        return 0;
+    }
+
+    /// @brief Check whether the children of the given nodes of the same type need to be compared.
+    /// @param lhs A left-hand-side node.
+    /// @param rhs A right-hand-side node.
+    /// @return true if the nodes are containers which are not shared with each other, false otherwise.
+    static bool has_distinct_children(const BasicNodeType& lhs, const BasicNodeType& rhs)
+    {
+        // containers shared by copy-on-write copies are trivially equal.
+        switch (lhs.type())
+        {
+        case node_t::SEQUENCE:
+            return &lhs.template get_value_ref<const sequence_type&>() !=
+                   &rhs.template get_value_ref<const sequence_type&>();
+        case node_t::MAPPING:
+            return &lhs.template get_value_ref<const mapping_type&>() !=
+                   &rhs.template get_value_ref<const mapping_type&>();
+        default:
+            return false;
+        }
+    }
+
+    /// @brief Check whether the given containers are known to be different from their cached digests.
+    /// @note Digests are not calculated here since it would cost as much as comparing the children.
+    /// @param lhs A left-hand-side container node.
+    /// @param rhs A right-hand-side container node.
+    /// @return true if both digests are cached and different, false otherwise.
+    static bool have_different_digests(const BasicNodeType& lhs, const BasicNodeType& rhs) noexcept
+    {
+        const std::uint64_t lhs_digest = lhs.m_node_value.cached_digest();
+        const std::uint64_t rhs_digest = rhs.m_node_value.cached_digest();
+        return lhs_digest != 0 && rhs_digest != 0 && lhs_digest != rhs_digest;
+    }
+
+    /// @brief Compare the types and the scalar values of the given nodes. Children are not compared.
+    /// @tparam Ordered Whether the result must reflect the order of the nodes or just their equality.
+    /// @param lhs A left-hand-side node.
+    /// @param rhs A right-hand-side node.
+    /// @return 0 if the nodes may be equal, non-zero otherwise. The sign shows the order only if `Ordered` is true.
+    template <bool Ordered>
+    static int compare_shallow(
+        const BasicNodeType& lhs, const BasicNodeType& rhs, std::integral_constant<bool, Ordered> /*unused*/)
+    {
+        const node_t type = lhs.type();
+        if (type != rhs.type())
+        {
+            return compare_types(type, rhs.type());
+        }
+
+        switch (type)
+        {
+        case node_t::SEQUENCE:
+        case node_t::MAPPING:
+            // sizes and digests are compared in advance only for equality since the order is lexicographical.
+            return (!Ordered && (lhs.size() != rhs.size() || have_different_digests(lhs, rhs))) ? 1 : 0;
+        case node_t::NULL_OBJECT:
+            // Always equal for comparisons between null nodes.
+            return 0;
+        case node_t::BOOLEAN: {
+            // false < true
+            const boolean_type lhs_bool = lhs.template get_value_ref<const boolean_type&>();
+            const boolean_type rhs_bool = rhs.template get_value_ref<const boolean_type&>();
+            return (lhs_bool == rhs_bool) ? 0 : (lhs_bool ? 1 : -1);
+        }
+        case node_t::INTEGER: {
+            const integer_type lhs_int = lhs.template get_value_ref<const integer_type&>();
+            const integer_type rhs_int = rhs.template get_value_ref<const integer_type&>();
+            return (lhs_int == rhs_int) ? 0 : ((lhs_int < rhs_int) ? -1 : 1);
+        }
+        case node_t::FLOAT_NUMBER: {
+            const float_number_type lhs_float = lhs.template get_value_ref<const float_number_type&>();
+            const float_number_type rhs_float = rhs.template get_value_ref<const float_number_type&>();
+            if (std::abs(lhs_float - rhs_float) < std::numeric_limits<float_number_type>::epsilon())
+            {
+                return 0;
+            }
+            return (lhs_float < rhs_float) ? -1 : 1;
+        }
+        case node_t::STRING: {
+            const char_type* p_lhs_chars = accessor_type::data(lhs);
+            const char_type* p_rhs_chars = accessor_type::data(rhs);
+            const std::size_t lhs_size = accessor_type::size(lhs);
+            const std::size_t rhs_size = accessor_type::size(rhs);
+            // nodes sharing the same interned string are trivially equal.
+            if (p_lhs_chars == p_rhs_chars && lhs_size == rhs_size)
+            {
+                return 0;
+            }
+            if (!Ordered)
+            {
+                return (lhs_size == rhs_size &&
+                        std::char_traits<char_type>::compare(p_lhs_chars, p_rhs_chars, lhs_size) == 0)
+                           ? 0
+                           : 1;
+            }
+            // a single pass over the characters resolves the order.
+            return compare_chars(p_lhs_chars, lhs_size, p_rhs_chars, rhs_size);
+        }
+        }
+
+        return 0; // LCOV_EXCL_LINE
+    }
+};
+
+} // namespace detail
+
+FK_YAML_NAMESPACE_END
+
+#endif /* FK_YAML_DETAIL_NODE_COMPARATOR_HPP_ */
@@ -0,0 +1,317 @@
+///  _______   __ __   __  _____   __  __  __
+/// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+/// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.2
+/// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+///
+/// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+/// SPDX-License-Identifier: MIT
+///
+/// @file
+
+#ifndef FK_YAML_DETAIL_NODE_DIFFER_HPP_
+#define FK_YAML_DETAIL_NODE_DIFFER_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <fkYAML/detail/container_utils.hpp>
+#include <fkYAML/detail/macros/version_macros.hpp>
+#include <fkYAML/detail/meta/node_traits.hpp>
+#include <fkYAML/detail/types/edit_op_t.hpp>
+#include <fkYAML/detail/types/node_t.hpp>
+
+/// @brief namespace for fkYAML library.
+FK_YAML_NAMESPACE_BEGIN
+
+/// @brief namespace for internal implementations of fkYAML library.
+namespace detail
+{
+
+/// @brief A class which creates edit scripts between basic_node objects without recursion.
+/// @note
+/// Mapping entries are paired by their keys and sequence elements by their indices. Pairs of containers of the same
+/// type are compared element by element, and other pairs are replaced as a whole if they are not equal. Containers
+/// shared by copy-on-write copies are skipped without visiting their elements.
+/// @tparam BasicNodeType A basic_node template instance type.
+template <typename BasicNodeType>
+class basic_node_differ
+{
+    static_assert(is_basic_node<BasicNodeType>::value, "basic_node_differ only accepts basic_node<...>");
+
+    /** A type for sequence node value containers. */
+    using sequence_type = typename BasicNodeType::sequence_type;
+    /** A type for mapping node value containers. */
+    using mapping_type = typename BasicNodeType::mapping_type;
+    /** A type for integer node values. */
+    using integer_type = typename BasicNodeType::integer_type;
+
+    /// @brief A key in the path to the node pair being compared.
+    struct path_key
+    {
+        /// The mapping key, or nullptr for a sequence element.
+        const BasicNodeType* p_key;
+        /// The index of a sequence element.
+        std::size_t index;
+    };
+
+    /// @brief A pair of a source node and a target node to be compared.
+    /// @tparam TargetType The type of target nodes, which is const if the target values are copied.
+    template <typename TargetType>
+    struct node_pair
+    {
+        /// The source node.
+        const BasicNodeType* p_source;
+        /// The target node.
+        TargetType* p_target;
+        /// The number of keys in the path to the nodes.
+        std::size_t depth;
+        /// The last key in the path to the nodes.
+        path_key key;
+    };
+
+public:
+    /// @brief Append the edits which turn the source node into the target node to the given script.
+    /// @note The values in the edits are moved from the target node if it's not const, which leaves the target node in
+    /// a valid but unspecified state.
+    /// @tparam TargetType The type of the target node, which is const if the target values are copied.
+    /// @tparam EditType The type of edits which can be aggregate-initialized with an operation, a path and a value.
+    /// @param source A source node.
+    /// @param target A target node.
+    /// @param script An edit script to which the edits are appended.
+    template <typename TargetType, typename EditType>
+    static void diff(const BasicNodeType& source, TargetType& target, std::vector<EditType>& script)
+    {
+        std::vector<node_pair<TargetType>> stack;
+        std::vector<path_key> path;
+        stack.push_back({&source, &target, 0, {nullptr, 0}});
+
+        while (!stack.empty())
+        {
+            const node_pair<TargetType> pair = stack.back();
+            stack.pop_back();
+
+            // the keys of the ancestors are still in the path since the pairs are visited in depth-first order.
+            if (pair.depth > 0)
+            {
+                path.resize(pair.depth - 1);
+                path.push_back(pair.key);
+            }
+
+            const BasicNodeType& src = *pair.p_source;
+            TargetType& tgt = *pair.p_target;
+
+            if (src.type() != tgt.type())
+            {
+                script.push_back(EditType {edit_op_t::REPLACE, make_path(path), take(tgt)});
+                continue;
+            }
+
+            switch (src.type())
+            {
+            case node_t::SEQUENCE:
+                diff_sequences(src, tgt, path, stack, script);
+                break;
+            case node_t::MAPPING:
+                diff_mappings(src, tgt, path, stack, script);
+                break;
+            default:
+                if (src != tgt)
+                {
+                    script.push_back(EditType {edit_op_t::REPLACE, make_path(path), take(tgt)});
+                }
+                break;
+            }
+        }
+    }
+
+private:
+    /// @brief Compare the elements of the given sequences by their indices.
+    /// @note Surplus source elements are removed from the last one and surplus target elements are appended, so that
+    /// the indices of the common elements never change while the script is applied.
+    /// @tparam TargetType The type of the target node.
+    /// @tparam EditType The type of edits.
+    /// @param source A source sequence node.
+    /// @param target A target sequence node.
+    /// @param path The path to the sequences.
+    /// @param stack The node pairs to be compared, to which the pairs of common elements are pushed.
+    /// @param script An edit script to which the edits are appended.
+    template <typename TargetType, typename EditType>
+    static void diff_sequences(
+        const BasicNodeType& source, TargetType& target, const std::vector<path_key>& path,
+        std::vector<node_pair<TargetType>>& stack, std::vector<EditType>& script)
+    {
+        using target_sequence_type = typename std::conditional<
+            std::is_const<TargetType>::value, const sequence_type, sequence_type>::type;
+
+        const sequence_type& src_seq = source.template get_value_ref<const sequence_type&>();
+        if (&src_seq == &static_cast<const BasicNodeType&>(target).template get_value_ref<const sequence_type&>())
+        {
+            // a container shared by copy-on-write copies is trivially equal.
+            return;
+        }
+        target_sequence_type& tgt_seq = target.template get_value_ref<target_sequence_type&>();
+
+        const std::size_t common = std::min(src_seq.size(), tgt_seq.size());
+        for (std::size_t i = src_seq.size(); i > common; i--)
+        {
+            script.push_back(EditType {edit_op_t::REMOVE, make_path(path, {nullptr, i - 1}), BasicNodeType()});
+        }
+        for (std::size_t i = common; i < tgt_seq.size(); i++)
+        {
+            script.push_back(EditType {edit_op_t::ADD, make_path(path, {nullptr, i}), take(tgt_seq[i])});
+        }
+
+        // pushed in reverse so that the elements are visited in order.
+        for (std::size_t i = common; i > 0; i--)
+        {
+            stack.push_back({&src_seq[i - 1], &tgt_seq[i - 1], path.size() + 1, {nullptr, i - 1}});
+        }
+    }
+
+    /// @brief Compare the values of the given mappings by their keys.
+    /// @note Added entries are appended to mappings which keep the order of insertions. Entries of such mappings which
+    /// are out of the order of the target mapping are therefore removed and added again, so that the patched mapping
+    /// has the same order.
+    /// @tparam TargetType The type of the target node.
+    /// @tparam EditType The type of edits.
+    /// @param source A source mapping node.
+    /// @param target A target mapping node.
+    /// @param path The path to the mappings.
+    /// @param stack The node pairs to be compared, to which the pairs of values of common keys are pushed.
+    /// @param script An edit script to which the edits are appended.
+    template <typename TargetType, typename EditType>
+    static void diff_mappings(
+        const BasicNodeType& source, TargetType& target, const std::vector<path_key>& path,
+        std::vector<node_pair<TargetType>>& stack, std::vector<EditType>& script)
+    {
+        using target_mapping_type =
+            typename std::conditional<std::is_const<TargetType>::value, const mapping_type, mapping_type>::type;
+
+        const mapping_type& src_map = source.template get_value_ref<const mapping_type&>();
+        if (&src_map == &static_cast<const BasicNodeType&>(target).template get_value_ref<const mapping_type&>())
+        {
+            return;
+        }
+        target_mapping_type& tgt_map = target.template get_value_ref<target_mapping_type&>();
+        const std::size_t kept = count_kept_entries(src_map, tgt_map);
+
+        const std::size_t first = stack.size();
+        for (const auto& entry : src_map)
+        {
+            auto itr = tgt_map.find(entry.first);
+            if (itr == tgt_map.end() || (is_insertion_ordered_mapping<mapping_type>::value &&
+                                         static_cast<std::size_t>(std::distance(tgt_map.begin(), itr)) >= kept))
+            {
+                script.push_back(EditType {edit_op_t::REMOVE, make_path(path, {&entry.first, 0}), BasicNodeType()});
+            }
+            else
+            {
+                stack.push_back({&entry.second, &itr->second, path.size() + 1, {&entry.first, 0}});
+            }
+        }
+
+        std::size_t index = 0;
+        for (auto& entry : tgt_map)
+        {
+            if (index++ >= kept || src_map.find(entry.first) == src_map.end())
+            {
+                script.push_back(EditType {edit_op_t::ADD, make_path(path, {&entry.first, 0}), take(entry.second)});
+            }
+        }
+
+        std::reverse(stack.begin() + first, stack.end());
+    }
+
+    /// @brief Count the leading entries of the target mapping which can be kept where they are in the source mapping.
+    /// @tparam TargetMappingType The type of the target mapping.
+    /// @param source A source mapping.
+    /// @param target A target mapping.
+    /// @return The number of the leading target entries whose keys are in the source mapping in the same order.
+    template <typename TargetMappingType>
+    static std::size_t count_kept_entries(const mapping_type& source, TargetMappingType& target)
+    {
+        if (!is_insertion_ordered_mapping<mapping_type>::value)
+        {
+            // the order of entries is determined by the keys or the hash values.
+            return target.size();
+        }
+
+        std::size_t kept = 0;
+        std::ptrdiff_t last_pos = -1;
+        for (const auto& entry : target)
+        {
+            auto itr = source.find(entry.first);
+            if (itr == source.end())
+            {
+                break;
+            }
+            const std::ptrdiff_t pos = std::distance(source.begin(), itr);
+            if (pos < last_pos)
+            {
+                break;
+            }
+            last_pos = pos;
+            kept++;
+        }
+        return kept;
+    }
+
+    /// @brief Create the path of an edit from the keys of the path being compared.
+    /// @param path The keys of the path being compared.
+    /// @return The path of an edit.
+    static std::vector<BasicNodeType> make_path(const std::vector<path_key>& path)
+    {
+        std::vector<BasicNodeType> edit_path;
+        edit_path.reserve(path.size());
+        for (const path_key& key : path)
+        {
+            edit_path.push_back(to_node(key));
+        }
+        return edit_path;
+    }
+
+    /// @brief Create the path of an edit to a child of the node at the path being compared.
+    /// @param path The keys of the path being compared.
+    /// @param key The key of the child.
+    /// @return The path of an edit.
+    static std::vector<BasicNodeType> make_path(const std::vector<path_key>& path, const path_key& key)
+    {
+        std::vector<BasicNodeType> edit_path = make_path(path);
+        edit_path.push_back(to_node(key));
+        return edit_path;
+    }
+
+    /// @brief Convert a key in a path into a basic_node object.
+    /// @param key A key in a path.
+    /// @return A basic_node object of the mapping key or the sequence index.
+    static BasicNodeType to_node(const path_key& key)
+    {
+        return key.p_key ? *key.p_key : BasicNodeType(static_cast<integer_type>(key.index));
+    }
+
+    /// @brief Copy a value of the target node.
+    /// @param node A constant target node.
+    /// @return A copy of `node`.
+    static BasicNodeType take(const BasicNodeType& node)
+    {
+        return node;
+    }
+
+    /// @brief Move a value out of the target node.
+    /// @param node A non-const target node.
+    /// @return The value moved from `node`.
+    static BasicNodeType take(BasicNodeType& node)
+    {
+        return std::move(node);
+    }
+};
+
+} // namespace detail
+
+FK_YAML_NAMESPACE_END
+
+#endif /* FK_YAML_DETAIL_NODE_DIFFER_HPP_ */
@@ -0,0 +1,403 @@
+///  _______   __ __   __  _____   __  __  __
+/// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+/// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.2
+/// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+///
+/// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+/// SPDX-License-Identifier: MIT
+///
+/// @file
+
+#ifndef FK_YAML_DETAIL_NODE_HASH_HPP_
+#define FK_YAML_DETAIL_NODE_HASH_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include <fkYAML/detail/macros/version_macros.hpp>
+#include <fkYAML/detail/meta/node_traits.hpp>
+#include <fkYAML/detail/meta/stl_supplement.hpp>
+#include <fkYAML/detail/node_lookup_key.hpp>
+#include <fkYAML/detail/types/node_t.hpp>
+
+/// @brief namespace for fkYAML library.
+FK_YAML_NAMESPACE_BEGIN
+
+/// @brief namespace for internal implementations of fkYAML library.
+namespace detail
+{
+
+/// @brief Mix a hash value into a seed hash value.
+/// @param seed A seed hash value.
+/// @param value A hash value to be mixed into `seed`.
+/// @return The resulting hash value.
+inline std::uint64_t hash_combine(std::uint64_t seed, std::uint64_t value) noexcept
+{
+    return seed ^ (value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2));
+}
+
+/// @brief Scramble the bits of a hash value so that every input bit affects every output bit.
+/// @note This is the finalizer of splitmix64. Standard hash functions of integers are often the identity function,
+/// which makes poor hash values for hash tables with power-of-two sizes unless the bits are scrambled.
+/// @param value A hash value.
+/// @return The scrambled hash value.
+inline std::uint64_t hash_mix(std::uint64_t value) noexcept
+{
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+    return value ^ (value >> 31);
+}
+
+/// @brief Calculate the hash value of the given characters. (FNV-1a)
+/// @note String values are hashed with this function instead of std::hash so that string keys of other types (e.g.,
+/// const char*) have the same hash values as string nodes without being converted into them.
+/// @tparam CharType A character type.
+/// @param p_begin The first character.
+/// @param size The number of characters.
+/// @return The hash value of the characters.
+template <typename CharType>
+inline std::uint64_t hash_chars(const CharType* p_begin, std::size_t size) noexcept
+{
+    using uchar_type = typename std::make_unsigned<CharType>::type;
+    std::uint64_t hash = 0xcbf29ce484222325ULL;
+    for (std::size_t i = 0; i < size; i++)
+    {
+        hash = (hash ^ static_cast<std::uint64_t>(static_cast<uchar_type>(p_begin[i]))) * 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+/// @brief A function object which calculates hash values of basic_node objects without recursion.
+/// @note
+/// The hash values are consistent with the equality of basic_node objects, i.e., equal nodes always have the same
+/// hash value. Tags and anchors are therefore ignored as well as in comparisons. The hash values of shared (interned)
+/// strings are cached in the interned strings, so hashing the same compacted string node (e.g., a mapping key used for
+/// lookups) again is cheap. Other strings are hashed every time since they may be modified through references held by
+/// users.
+/// The 64-bit hash values (digests) of copy-on-write containers shared among nodes are cached in the containers as
+/// well. Since shared containers are copied before modification, only the modified paths are visited again when a
+/// modified copy is hashed. (like a Merkle tree)
+/// @tparam BasicNodeType A basic_node template instance type.
+template <typename BasicNodeType>
+struct node_hash
+{
+    static_assert(is_basic_node<BasicNodeType>::value, "node_hash only accepts basic_node<...>");
+
+private:
+    /** A type for sequence node value containers. */
+    using sequence_type = typename BasicNodeType::sequence_type;
+    /** A type for mapping node value containers. */
+    using mapping_type = typename BasicNodeType::mapping_type;
+    /** A type for boolean node values. */
+    using boolean_type = typename BasicNodeType::boolean_type;
+    /** A type for integer node values. */
+    using integer_type = typename BasicNodeType::integer_type;
+    /** A type for string node values. */
+    using string_type = typename BasicNodeType::string_type;
+    /** A type for characters of string node values. */
+    using char_type = typename string_type::value_type;
+
+public:
+    /** A type for maps from container nodes to their digests. */
+    using digest_memo_type = std::unordered_map<const BasicNodeType*, std::uint64_t>;
+
+private:
+
+    /// @brief A container node being hashed and the hash value of its children so far.
+    class frame
+    {
+    public:
+        /// @brief Construct a new frame object.
+        /// @param node A container node.
+        explicit frame(const BasicNodeType& node)
+            : mp_node(&node),
+              m_is_mapping(node.is_mapping()),
+              m_seed(static_cast<std::uint64_t>(node.type()))
+        {
+            if (m_is_mapping)
+            {
+                const mapping_type& map = node.template get_value_ref<const mapping_type&>();
+                m_map_itr = map.begin();
+                m_map_end = map.end();
+            }
+            else
+            {
+                const sequence_type& seq = node.template get_value_ref<const sequence_type&>();
+                m_seq_itr = seq.begin();
+                m_seq_end = seq.end();
+            }
+        }
+
+        /// @brief Get the next child to be hashed. Mapping keys and values are returned alternately.
+        /// @return The pointer to the next child, or nullptr if no children are left.
+        const BasicNodeType* next()
+        {
+            if (m_is_mapping)
+            {
+                if (m_is_value_next)
+                {
+                    m_is_value_next = false;
+                    return &(m_map_itr++)->second;
+                }
+                if (m_map_itr == m_map_end)
+                {
+                    return nullptr;
+                }
+                m_is_value_next = true;
+                return &m_map_itr->first;
+            }
+
+            return (m_seq_itr == m_seq_end) ? nullptr : &*(m_seq_itr++);
+        }
+
+        /// @brief Add the hash value of the child last returned by next().
+        /// @param hash The hash value of the child.
+        void add(std::uint64_t hash) noexcept
+        {
+            if (!m_is_mapping)
+            {
+                m_seed = hash_combine(m_seed, hash);
+            }
+            else if (m_is_value_next)
+            {
+                m_key_hash = hash;
+            }
+            else
+            {
+                // entries are combined independently of their order since mapping types might be unordered.
+                m_sum += hash_mix(hash_combine(m_key_hash, hash));
+            }
+        }
+
+        /// @brief Get the hash value of the container. Must be called after all the children are added.
+        /// @return The hash value of the container.
+        std::uint64_t result() const noexcept
+        {
+            const std::uint64_t hash = hash_mix(m_is_mapping ? hash_combine(m_seed, m_sum) : m_seed);
+            // 0 is reserved for "not calculated yet".
+            return (hash == 0) ? 1 : hash;
+        }
+
+        /// @brief Get the container node being hashed.
+        /// @return The container node.
+        const BasicNodeType& node() const noexcept
+        {
+            return *mp_node;
+        }
+
+    private:
+        /// The container node being hashed.
+        const BasicNodeType* mp_node;
+        /// Whether the container is a mapping.
+        bool m_is_mapping;
+        /// Whether the value of the current mapping entry is returned next.
+        bool m_is_value_next {false};
+        /// The hash value of the sequence elements so far, or of the type of the mapping.
+        std::uint64_t m_seed;
+        /// The sum of the hash values of the mapping entries so far.
+        std::uint64_t m_sum {0};
+        /// The hash value of the key of the current mapping entry.
+        std::uint64_t m_key_hash {0};
+        /// The next sequence element.
+        typename sequence_type::const_iterator m_seq_itr {};
+        /// The end of the sequence.
+        typename sequence_type::const_iterator m_seq_end {};
+        /// The next mapping entry.
+        typename mapping_type::const_iterator m_map_itr {};
+        /// The end of the mapping.
+        typename mapping_type::const_iterator m_map_end {};
+    };
+
+public:
+    /// @brief Calculate the hash value of the given node.
+    /// @param node A node to be hashed.
+    /// @return The hash value of `node`.
+    std::size_t operator()(const BasicNodeType& node) const
+    {
+        return static_cast<std::size_t>(digest(node));
+    }
+
+    /// @brief Calculate the 64-bit hash value of the given node, whose lower bits are the same as its hash value.
+    /// @note The digests of shared copy-on-write containers are cached in them and reused.
+    /// @param node A node to be hashed.
+    /// @return The 64-bit hash value of `node`.
+    static std::uint64_t digest(const BasicNodeType& node)
+    {
+        return digest_impl(node, nullptr);
+    }
+
+    /// @brief Calculate the 64-bit hash value of the given node, reusing the digests of containers recorded in a memo.
+    /// @note The digests of all the containers hashed in this call are recorded in the memo, so the digests of all the
+    /// containers in a node tree can be calculated in post-order with each node visited only once. The memo must be
+    /// discarded once any of the recorded containers is modified.
+    /// @param node A node to be hashed.
+    /// @param memo A map from container nodes to their digests.
+    /// @return The 64-bit hash value of `node`.
+    static std::uint64_t digest(const BasicNodeType& node, digest_memo_type& memo)
+    {
+        return digest_impl(node, &memo);
+    }
+
+    /// @brief Calculate the hash value of the given string key which is the same as that of the string node.
+    /// @tparam KeyType A string key type.
+    /// @param key A string key to be hashed.
+    /// @return The hash value of `key`.
+    template <typename KeyType, enable_if_t<is_string_lookup_key<BasicNodeType, KeyType>::value, int> = 0>
+    std::size_t operator()(const KeyType& key) const noexcept
+    {
+        const lookup_chars<char_type> chars = get_lookup_chars<char_type>(key);
+        return static_cast<std::size_t>(hash_mix(
+            hash_combine(static_cast<std::uint64_t>(node_t::STRING), fold_string_hash(chars.p_begin, chars.size))));
+    }
+
+    /// @brief Calculate the hash value of the given integer key which is the same as that of the integer node.
+    /// @tparam KeyType An integer key type.
+    /// @param key An integer key to be hashed.
+    /// @return The hash value of `key`.
+    template <typename KeyType, enable_if_t<is_integer_lookup_key<BasicNodeType, KeyType>::value, int> = 0>
+    std::size_t operator()(const KeyType& key) const noexcept
+    {
+        return static_cast<std::size_t>(hash_mix(hash_combine(
+            static_cast<std::uint64_t>(node_t::INTEGER), std::hash<integer_type>()(static_cast<integer_type>(key)))));
+    }
+
+private:
+    /// @brief Calculate the 64-bit hash value of the given node.
+    /// @param node A node to be hashed.
+    /// @param p_memo A map from container nodes to their digests, or nullptr if no memo is used.
+    /// @return The 64-bit hash value of `node`.
+    static std::uint64_t digest_impl(const BasicNodeType& node, digest_memo_type* p_memo)
+    {
+        if (!node.is_sequence() && !node.is_mapping())
+        {
+            return hash_scalar(node);
+        }
+
+        std::uint64_t hash = find_digest(node, p_memo);
+        if (hash != 0)
+        {
+            return hash;
+        }
+
+        std::vector<frame> stack;
+        stack.emplace_back(node);
+
+        for (;;)
+        {
+            const BasicNodeType* p_child = stack.back().next();
+            if (!p_child)
+            {
+                const BasicNodeType& container = stack.back().node();
+                hash = stack.back().result();
+                container.m_node_value.cache_digest(hash);
+                if (p_memo)
+                {
+                    p_memo->emplace(&container, hash);
+                }
+                stack.pop_back();
+                if (stack.empty())
+                {
+                    return hash;
+                }
+                stack.back().add(hash);
+            }
+            else if (!p_child->is_sequence() && !p_child->is_mapping())
+            {
+                stack.back().add(hash_scalar(*p_child));
+            }
+            else if ((hash = find_digest(*p_child, p_memo)) != 0)
+            {
+                stack.back().add(hash);
+            }
+            else
+            {
+                stack.emplace_back(*p_child);
+            }
+        }
+    }
+
+    /// @brief Find the digest of the given container node calculated before.
+    /// @param node A container node.
+    /// @param p_memo A map from container nodes to their digests, or nullptr if no memo is used.
+    /// @return The digest of `node`, or 0 if it's not found.
+    static std::uint64_t find_digest(const BasicNodeType& node, const digest_memo_type* p_memo)
+    {
+        const std::uint64_t hash = node.m_node_value.cached_digest();
+        if (hash != 0 || !p_memo)
+        {
+            return hash;
+        }
+
+        auto itr = p_memo->find(&node);
+        return (itr != p_memo->end()) ? itr->second : 0;
+    }
+
+    /// @brief Calculate the hash value of the given scalar node.
+    /// @param node A scalar node to be hashed.
+    /// @return The hash value of `node`.
+    static std::uint64_t hash_scalar(const BasicNodeType& node)
+    {
+        const std::uint64_t seed = static_cast<std::uint64_t>(node.type());
+
+        switch (node.type())
+        {
+        case node_t::BOOLEAN:
+            return hash_mix(hash_combine(
+                seed, std::hash<boolean_type>()(node.template get_value_ref<const boolean_type&>())));
+        case node_t::INTEGER:
+            return hash_mix(hash_combine(
+                seed, std::hash<integer_type>()(node.template get_value_ref<const integer_type&>())));
+        case node_t::STRING:
+            return hash_mix(hash_combine(seed, hash_string(node)));
+        default:
+            // float number values are compared with a tolerance, so only their type can be consistently hashed.
+            return hash_mix(seed);
+        }
+    }
+
+    /// @brief Get the hash value of the string value of the given node.
+    /// @note The hash value is cached only if the string is shared, i.e., immutable. It's cached in the interned string
+    /// object, so all the nodes sharing the string reuse it. A mutable string may be modified through a reference
+    /// obtained earlier, which a cache could never notice.
+    /// @param node A string node.
+    /// @return The hash value of the string value of `node`.
+    static std::uint32_t hash_string(const BasicNodeType& node)
+    {
+        const auto& value = node.m_node_value;
+        if (!value.attrs.is_shared())
+        {
+            return fold_string_hash(value.string_data(), value.string_size());
+        }
+
+        const auto* p_str = value.p_shared_str.get();
+        auto hash = static_cast<std::uint32_t>(p_str->cached_digest());
+        if (hash == 0)
+        {
+            hash = fold_string_hash(p_str->data(), p_str->size());
+            p_str->cache_digest(hash);
+        }
+        return hash;
+    }
+
+    /// @brief Calculate the 32-bit hash value of the given characters, which can be cached in string nodes.
+    /// @param p_begin The first character.
+    /// @param size The number of characters.
+    /// @return The non-zero hash value of the characters.
+    static std::uint32_t fold_string_hash(const char_type* p_begin, std::size_t size) noexcept
+    {
+        const std::uint64_t full = hash_mix(hash_chars(p_begin, size));
+        const auto hash = static_cast<std::uint32_t>(full ^ (full >> 32));
+        // 0 is reserved for "not calculated yet".
+        return (hash == 0) ? 1 : hash;
+    }
+};
+
+} // namespace detail
+
+FK_YAML_NAMESPACE_END
+
+#endif /* FK_YAML_DETAIL_NODE_HASH_HPP_ */
@@ -0,0 +1,151 @@
+///  _______   __ __   __  _____   __  __  __
+/// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+/// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.2
+/// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+///
+/// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+/// SPDX-License-Identifier: MIT
+///
+/// @file
+
+#ifndef FK_YAML_DETAIL_NODE_LOOKUP_KEY_HPP_
+#define FK_YAML_DETAIL_NODE_LOOKUP_KEY_HPP_
+
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <fkYAML/detail/macros/version_macros.hpp>
+#include <fkYAML/detail/meta/detect.hpp>
+#include <fkYAML/detail/meta/node_traits.hpp>
+#include <fkYAML/detail/meta/stl_supplement.hpp>
+#include <fkYAML/detail/meta/type_traits.hpp>
+
+/// @brief namespace for fkYAML library.
+FK_YAML_NAMESPACE_BEGIN
+
+/// @brief namespace for internal implementations of fkYAML library.
+namespace detail
+{
+
+/// @brief A view of the characters of a string key.
+/// @tparam CharType A character type.
+template <typename CharType>
+struct lookup_chars
+{
+    /// The first character.
+    const CharType* p_begin;
+    /// The number of characters.
+    std::size_t size;
+};
+
+/// @brief Get the characters of a null-terminated string key.
+/// @tparam CharType A character type.
+/// @param p_str A null-terminated string.
+/// @return The characters of `p_str`.
+template <typename CharType>
+inline lookup_chars<CharType> get_lookup_chars(const CharType* p_str) noexcept
+{
+    return {p_str, std::char_traits<CharType>::length(p_str)};
+}
+
+/// @brief Get the characters of a string key which has contiguous characters. (e.g., std::string, std::string_view)
+/// @tparam CharType A character type.
+/// @tparam StringType A string type.
+/// @param str A string key.
+/// @return The characters of `str`.
+template <
+    typename CharType, typename StringType,
+    enable_if_t<std::is_same<decltype(std::declval<const StringType&>().data()), const CharType*>::value, int> = 0>
+inline lookup_chars<CharType> get_lookup_chars(const StringType& str) noexcept
+{
+    return {str.data(), static_cast<std::size_t>(str.size())};
+}
+
+/// @brief A type of the result of get_lookup_chars() calls.
+/// @tparam CharType A character type.
+/// @tparam KeyType A key type.
+template <typename CharType, typename KeyType>
+using get_lookup_chars_fn_t = decltype(get_lookup_chars<CharType>(std::declval<const KeyType&>()));
+
+/// @brief Check if KeyType is a string type whose characters can be compared with string node values directly.
+/// @tparam BasicNodeType A basic_node template instance type.
+/// @tparam KeyType A key type.
+template <typename BasicNodeType, typename KeyType>
+struct is_string_lookup_key
+    : conjunction<
+          negation<is_basic_node<remove_cvref_t<KeyType>>>, negation<is_null_pointer<remove_cvref_t<KeyType>>>,
+          is_detected<get_lookup_chars_fn_t, typename BasicNodeType::string_type::value_type, remove_cvref_t<KeyType>>>
+{
+};
+
+/// @brief Check if KeyType is an integer type whose values can be compared with integer node values directly.
+/// @tparam BasicNodeType A basic_node template instance type.
+/// @tparam KeyType A key type.
+template <typename BasicNodeType, typename KeyType>
+struct is_integer_lookup_key : is_non_bool_integral<remove_cvref_t<KeyType>>
+{
+};
+
+/// @brief Check if mapping keys can be looked up with KeyType objects without converting them into basic_node
+/// objects, i.e., if KeyType is a string type or an integer type.
+/// @tparam BasicNodeType A basic_node template instance type.
+/// @tparam KeyType A key type.
+template <typename BasicNodeType, typename KeyType>
+struct is_lookup_key
+    : disjunction<is_string_lookup_key<BasicNodeType, KeyType>, is_integer_lookup_key<BasicNodeType, KeyType>>
+{
+};
+
+/// @brief Check if KeyType objects can be compared with and hashed like ObjectKeyType objects without conversion with
+/// std::equal_to<ObjectKeyType> and std::hash<ObjectKeyType>.
+/// @tparam ObjectKeyType A key type of a mapping container.
+/// @tparam KeyType A key type to look up.
+template <typename ObjectKeyType, typename KeyType, typename = void>
+struct is_transparent_key : std::is_same<ObjectKeyType, remove_cvref_t<KeyType>>
+{
+};
+
+/// @brief A partial specialization of is_transparent_key if ObjectKeyType is a basic_node template instance type.
+/// @tparam ObjectKeyType A basic_node template instance type.
+/// @tparam KeyType A key type to look up.
+template <typename ObjectKeyType, typename KeyType>
+struct is_transparent_key<ObjectKeyType, KeyType, enable_if_t<is_basic_node<ObjectKeyType>::value>>
+    : disjunction<std::is_same<ObjectKeyType, remove_cvref_t<KeyType>>, is_lookup_key<ObjectKeyType, KeyType>>
+{
+};
+
+/// @brief Pass through a key which can be looked up without conversion.
+/// @tparam BasicNodeType A basic_node template instance type.
+/// @tparam KeyType A key type.
+/// @param key A key object.
+/// @return The given key object.
+template <
+    typename BasicNodeType, typename KeyType,
+    enable_if_t<
+        disjunction<is_basic_node<remove_cvref_t<KeyType>>, is_lookup_key<BasicNodeType, KeyType>>::value, int> = 0>
+inline KeyType&& to_lookup_key(KeyType&& key) noexcept
+{
+    return std::forward<KeyType>(key);
+}
+
+/// @brief Convert a key into a basic_node object if the key cannot be looked up without conversion.
+/// @tparam BasicNodeType A basic_node template instance type.
+/// @tparam KeyType A key type.
+/// @param key A key object.
+/// @return A basic_node object converted from the given key.
+template <
+    typename BasicNodeType, typename KeyType,
+    enable_if_t<
+        !disjunction<is_basic_node<remove_cvref_t<KeyType>>, is_lookup_key<BasicNodeType, KeyType>>::value, int> = 0>
+inline BasicNodeType to_lookup_key(KeyType&& key)
+{
+    return BasicNodeType(std::forward<KeyType>(key));
+}
+
+} // namespace detail
+
+FK_YAML_NAMESPACE_END
+
+#endif /* FK_YAML_DETAIL_NODE_LOOKUP_KEY_HPP_ */
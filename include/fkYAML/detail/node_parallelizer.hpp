@@ -0,0 +1,568 @@
+///  _______   __ __   __  _____   __  __  __
+/// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+/// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.2
+/// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+///
+/// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+/// SPDX-License-Identifier: MIT
+///
+/// @file
+
+#ifndef FK_YAML_DETAIL_NODE_PARALLELIZER_HPP_
+#define FK_YAML_DETAIL_NODE_PARALLELIZER_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include <fkYAML/detail/container_utils.hpp>
+#include <fkYAML/detail/macros/version_macros.hpp>
+#include <fkYAML/detail/meta/node_traits.hpp>
+#include <fkYAML/detail/meta/stl_supplement.hpp>
+#include <fkYAML/detail/meta/type_traits.hpp>
+#include <fkYAML/detail/node_comparator.hpp>
+#include <fkYAML/detail/parallel_runner.hpp>
+#include <fkYAML/detail/types/node_t.hpp>
+#include <fkYAML/exception.hpp>
+
+/// @brief namespace for fkYAML library.
+FK_YAML_NAMESPACE_BEGIN
+
+/// @brief namespace for internal implementations of fkYAML library.
+namespace detail
+{
+
+/// @brief Check if the given type is a std::vector type whose elements can be converted from sequence elements.
+/// @tparam BasicNodeType A basic_node template instance type.
+/// @tparam T A target type.
+template <typename BasicNodeType, typename T>
+struct is_parallel_convertible_vector : std::false_type
+{
+};
+
+/// @brief A partial specialization of is_parallel_convertible_vector for std::vector types.
+/// @tparam BasicNodeType A basic_node template instance type.
+/// @tparam ValueType The type of vector elements.
+/// @tparam Allocator The allocator type of the vector.
+template <typename BasicNodeType, typename ValueType, typename Allocator>
+struct is_parallel_convertible_vector<BasicNodeType, std::vector<ValueType, Allocator>>
+    : conjunction<
+          std::is_default_constructible<ValueType>,
+          disjunction<std::is_same<ValueType, BasicNodeType>, has_from_node<BasicNodeType, ValueType>>>
+{
+};
+
+/// @brief A class which copies, destroys, compares and converts large basic_node trees with multiple threads.
+/// @note
+/// The work on a tree is split by expanding its containers breadth-first on the calling thread until there are enough
+/// subtrees for the threads. Sequences with many elements are split into chunks of consecutive elements instead.
+/// The subtrees and the chunks are then handed out to the threads one by one, so that idle threads take the remaining
+/// ones. Trees which turn out to be small are processed while the work is being split, without any threads.
+/// @tparam BasicNodeType A basic_node template instance type.
+template <typename BasicNodeType>
+class basic_node_parallelizer
+{
+    static_assert(is_basic_node<BasicNodeType>::value, "basic_node_parallelizer only accepts basic_node<...>");
+
+    /** A type for sequence node value containers. */
+    using sequence_type = typename BasicNodeType::sequence_type;
+    /** A type for mapping node value containers. */
+    using mapping_type = typename BasicNodeType::mapping_type;
+    /** A type for comparators of basic_node objects. */
+    using comparator_type = basic_node_comparator<BasicNodeType>;
+
+    /// @brief A plan of the work on node trees, which is split into tasks run in parallel.
+    /// @tparam LhsType The type of nodes to work on, which is const for read-only work.
+    /// @tparam RhsType The type of nodes paired with them, e.g., the copies being made.
+    template <typename LhsType, typename RhsType>
+    class work_plan
+    {
+        /** A type for sequences of the nodes to work on. */
+        using lhs_sequence_type =
+            typename std::conditional<std::is_const<LhsType>::value, const sequence_type, sequence_type>::type;
+        /** A type for sequences of the paired nodes. */
+        using rhs_sequence_type =
+            typename std::conditional<std::is_const<RhsType>::value, const sequence_type, sequence_type>::type;
+
+        /// @brief A pair of container nodes whose subtrees are processed together.
+        struct node_pair
+        {
+            /// The node to work on.
+            LhsType* p_lhs;
+            /// The paired node.
+            RhsType* p_rhs;
+        };
+
+        /// @brief Consecutive elements of a pair of sequences which are processed by a task.
+        struct sequence_chunk
+        {
+            /// The sequence to work on.
+            lhs_sequence_type* p_lhs_seq;
+            /// The paired sequence.
+            rhs_sequence_type* p_rhs_seq;
+            /// The index of the first element.
+            std::size_t begin;
+            /// The index past the last element.
+            std::size_t end;
+        };
+
+    public:
+        /// @brief Construct a new work_plan object with a pair of root container nodes.
+        /// @param lhs A root node to work on.
+        /// @param rhs A paired root node.
+        work_plan(LhsType& lhs, RhsType& rhs)
+            : m_pairs(1, node_pair {&lhs, &rhs})
+        {
+        }
+
+        /// @brief Add a pair of container nodes to be expanded or processed by a task.
+        /// @param lhs A container node to work on.
+        /// @param rhs A paired node.
+        void add_pair(LhsType& lhs, RhsType& rhs)
+        {
+            m_pairs.push_back(node_pair {&lhs, &rhs});
+        }
+
+        /// @brief Add chunks of the elements of a pair of sequences with the same size.
+        /// @param lhs_seq A sequence to work on.
+        /// @param rhs_seq A paired sequence.
+        void add_chunks(lhs_sequence_type& lhs_seq, rhs_sequence_type& rhs_seq)
+        {
+            const std::size_t size = lhs_seq.size();
+            for (std::size_t begin = 0; begin < size; begin += s_chunk_size)
+            {
+                const std::size_t end = (size - begin > s_chunk_size) ? begin + s_chunk_size : size;
+                m_chunks.push_back(sequence_chunk {&lhs_seq, &rhs_seq, begin, end});
+            }
+        }
+
+        /// @brief Expand the added pairs breadth-first until there are enough tasks for the given number of threads.
+        /// @tparam ExpandType The type of a function which processes a pair of container nodes except their children
+        /// and adds the pairs of the children or the chunks of their elements to this plan.
+        /// @param num_threads The number of threads.
+        /// @param expand A function which expands a pair of container nodes. It returns false to stop the work.
+        /// @return false if the work has been stopped, true otherwise.
+        template <typename ExpandType>
+        bool split(std::size_t num_threads, ExpandType&& expand)
+        {
+            // the trees are expanded further while they look too small to be worth threads.
+            const std::size_t max_tasks = num_threads * s_tasks_per_thread;
+            while (m_next < m_pairs.size() &&
+                   (m_num_children < s_chunk_size || m_chunks.size() + m_pairs.size() - m_next < max_tasks))
+            {
+                const node_pair pair = m_pairs[m_next++];
+                m_num_children += pair.p_lhs->size();
+                if (!expand(*pair.p_lhs, *pair.p_rhs, *this))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /// @brief Process the chunks and the pairs which have not been expanded in parallel.
+        /// @tparam FuncType The type of a function which processes a pair of nodes. It returns false to stop the work.
+        /// @param num_threads The number of threads.
+        /// @param func A function which processes a pair of nodes.
+        /// @return false if the work has been stopped, true otherwise.
+        template <typename FuncType>
+        bool run(std::size_t num_threads, FuncType&& func) const
+        {
+            // the pairs are grouped so that the threads don't contend for the next one too often.
+            const std::size_t num_pairs = m_pairs.size() - m_next;
+            const std::size_t pairs_per_task = num_pairs / (num_threads * s_tasks_per_thread) + 1;
+            const std::size_t num_pair_tasks = (num_pairs + pairs_per_task - 1) / pairs_per_task;
+
+            std::atomic<bool> stopped {false};
+            run_parallel(m_chunks.size() + num_pair_tasks, num_threads, [&](std::size_t index) {
+                if (stopped.load(std::memory_order_relaxed))
+                {
+                    return;
+                }
+
+                bool proceeds = true;
+                if (index < m_chunks.size())
+                {
+                    const sequence_chunk& chunk = m_chunks[index];
+                    for (std::size_t i = chunk.begin; proceeds && i < chunk.end; i++)
+                    {
+                        proceeds = func((*chunk.p_lhs_seq)[i], (*chunk.p_rhs_seq)[i]);
+                    }
+                }
+                else
+                {
+                    const std::size_t begin = m_next + (index - m_chunks.size()) * pairs_per_task;
+                    const std::size_t end = (m_pairs.size() - begin > pairs_per_task) ? begin + pairs_per_task
+                                                                                      : m_pairs.size();
+                    for (std::size_t i = begin; proceeds && i < end; i++)
+                    {
+                        proceeds = func(*m_pairs[i].p_lhs, *m_pairs[i].p_rhs);
+                    }
+                }
+
+                if (!proceeds)
+                {
+                    stopped.store(true, std::memory_order_relaxed);
+                }
+            });
+            return !stopped.load(std::memory_order_relaxed);
+        }
+
+    private:
+        /// The pairs of container nodes. The ones before m_next have already been expanded.
+        std::vector<node_pair> m_pairs;
+        /// The index of the next pair to be expanded.
+        std::size_t m_next {0};
+        /// The chunks of sequence elements.
+        std::vector<sequence_chunk> m_chunks;
+        /// The total number of children of the expanded containers.
+        std::size_t m_num_children {0};
+    };
+
+public:
+    /// @brief Copy the given node.
+    /// @param node A node to be copied.
+    /// @param num_threads The number of threads. 0 means the number of hardware threads.
+    /// @return A copy of `node`, which is the same as the one made by the copy constructor.
+    static BasicNodeType clone(const BasicNodeType& node, std::size_t num_threads)
+    {
+        num_threads = resolve_num_threads(num_threads);
+        if (num_threads == 1 || !has_copied_children(node))
+        {
+            return node;
+        }
+
+        BasicNodeType copy {};
+        work_plan<const BasicNodeType, BasicNodeType> plan(node, copy);
+        plan.split(num_threads, &expand_copy);
+        plan.run(num_threads, [](const BasicNodeType& src, BasicNodeType& dst) {
+            dst = src;
+            return true;
+        });
+        return copy;
+    }
+
+    /// @brief Destroy the value of the given node, which is left as a null node.
+    /// @param node A node to be destroyed.
+    /// @param num_threads The number of threads. 0 means the number of hardware threads.
+    static void destroy(BasicNodeType& node, std::size_t num_threads)
+    {
+        num_threads = resolve_num_threads(num_threads);
+        if (num_threads > 1 && has_destroyed_children(node))
+        {
+            // the subtrees are destroyed in parallel, and then the containers left are destroyed.
+            // A node is paired with itself since the destruction doesn't need other nodes.
+            work_plan<BasicNodeType, BasicNodeType> plan(node, node);
+            plan.split(num_threads, &expand_destruction);
+            plan.run(num_threads, [](BasicNodeType& target, BasicNodeType& /*unused*/) {
+                target = BasicNodeType();
+                return true;
+            });
+        }
+        node = BasicNodeType();
+    }
+
+    /// @brief Check whether the given nodes are equal.
+    /// @param lhs A left-hand-side node.
+    /// @param rhs A right-hand-side node.
+    /// @param num_threads The number of threads. 0 means the number of hardware threads.
+    /// @return true if both types and values are equal, false otherwise, which is the same as operator==.
+    static bool equal(const BasicNodeType& lhs, const BasicNodeType& rhs, std::size_t num_threads)
+    {
+        num_threads = resolve_num_threads(num_threads);
+        if (num_threads == 1 || !has_distinct_children(lhs, rhs))
+        {
+            return comparator_type::equal(lhs, rhs);
+        }
+
+        work_plan<const BasicNodeType, const BasicNodeType> plan(lhs, rhs);
+        return plan.split(num_threads, &expand_comparison) &&
+               plan.run(num_threads, [](const BasicNodeType& lhs_node, const BasicNodeType& rhs_node) {
+                   return comparator_type::equal(lhs_node, rhs_node);
+               });
+    }
+
+    /// @brief Convert the elements of the given sequence node into the elements of the given vector.
+    /// @tparam ValueType The type of vector elements.
+    /// @tparam Allocator The allocator type of the vector.
+    /// @param node A sequence node.
+    /// @param values A vector to which the converted elements are appended.
+    /// @param num_threads The number of threads. 0 means the number of hardware threads.
+    /// @throw type_error `node` is not a sequence or any of its elements cannot be converted.
+    template <typename ValueType, typename Allocator>
+    static void convert(const BasicNodeType& node, std::vector<ValueType, Allocator>& values, std::size_t num_threads)
+    {
+        if (!node.is_sequence())
+        {
+            throw type_error("The target node value is not sequence type.", node.type());
+        }
+
+        const sequence_type& seq = node.template get_value_ref<const sequence_type&>();
+        const std::size_t offset = values.size();
+        values.resize(offset + seq.size());
+
+        if (std::is_same<ValueType, bool>::value)
+        {
+            // the elements of std::vector<bool> share bytes, so they must not be written concurrently.
+            num_threads = 1;
+        }
+
+        // elements are converted in order within a chunk, so the error from the first invalid element is rethrown.
+        const std::size_t num_chunks = (seq.size() + s_chunk_size - 1) / s_chunk_size;
+        run_parallel(num_chunks, num_threads, [&](std::size_t index) {
+            const std::size_t begin = index * s_chunk_size;
+            const std::size_t end = (seq.size() - begin > s_chunk_size) ? begin + s_chunk_size : seq.size();
+            for (std::size_t i = begin; i < end; i++)
+            {
+                values[offset + i] = convert_element<ValueType>(seq[i], std::is_same<ValueType, BasicNodeType> {});
+            }
+        });
+    }
+
+private:
+    /// @brief Check whether the children of the given node are copied when the node is copied.
+    /// @param node A node.
+    /// @return true if `node` is a non-empty container which is not shared with copy-on-write copies, false otherwise.
+    static bool has_copied_children(const BasicNodeType& node)
+    {
+        return (node.is_sequence() || node.is_mapping()) && !node.m_node_value.attrs.is_shared() && !node.empty();
+    }
+
+    /// @brief Check whether the children of the given node are destroyed when the node is destroyed.
+    /// @param node A node.
+    /// @return true if `node` is a non-empty container which is not shared with other nodes, false otherwise.
+    static bool has_destroyed_children(const BasicNodeType& node)
+    {
+        return (node.is_sequence() || node.is_mapping()) && node.m_node_value.is_exclusive() &&
+               !node.empty();
+    }
+
+    /// @brief Check whether the children of the given nodes need to be compared.
+    /// @param lhs A left-hand-side node.
+    /// @param rhs A right-hand-side node.
+    /// @return true if the nodes are containers of the same type which are not shared with each other.
+    static bool has_distinct_children(const BasicNodeType& lhs, const BasicNodeType& rhs)
+    {
+        if (lhs.type() != rhs.type())
+        {
+            return false;
+        }
+
+        switch (lhs.type())
+        {
+        case node_t::SEQUENCE:
+            return lhs.m_node_value.p_sequence != rhs.m_node_value.p_sequence;
+        case node_t::MAPPING:
+            return lhs.m_node_value.p_mapping != rhs.m_node_value.p_mapping;
+        default:
+            return false;
+        }
+    }
+
+    /// @brief Make a shallow copy of a container node and add the pairs of its children to the plan.
+    /// @param src A container node to be copied.
+    /// @param dst A null node which becomes the copy.
+    /// @param plan A plan of the copy.
+    /// @return Always true.
+    static bool expand_copy(
+        const BasicNodeType& src, BasicNodeType& dst, work_plan<const BasicNodeType, BasicNodeType>& plan)
+    {
+        dst = BasicNodeType(typename BasicNodeType::shallow_copy_tag {}, src);
+
+        if (src.is_sequence())
+        {
+            const sequence_type& src_seq = *src.m_node_value.p_sequence;
+            sequence_type& dst_seq = *dst.m_node_value.p_sequence;
+            dst_seq.resize(src_seq.size());
+
+            if (src_seq.size() >= s_chunk_size)
+            {
+                plan.add_chunks(src_seq, dst_seq);
+                return true;
+            }
+
+            for (std::size_t i = 0; i < src_seq.size(); i++)
+            {
+                if (has_copied_children(src_seq[i]))
+                {
+                    plan.add_pair(src_seq[i], dst_seq[i]);
+                }
+                else
+                {
+                    dst_seq[i] = src_seq[i];
+                }
+            }
+            return true;
+        }
+
+        const mapping_type& src_map = *src.m_node_value.p_mapping;
+        mapping_type& dst_map = *dst.m_node_value.p_mapping;
+        for (const auto& entry : src_map)
+        {
+            // the source keys are unique and in order, so they can be simply appended.
+            append_mapping_entry(
+                dst_map,
+                BasicNodeType(entry.first),
+                has_copied_children(entry.second) ? BasicNodeType() : BasicNodeType(entry.second));
+        }
+
+        auto dst_itr = dst_map.begin();
+        for (const auto& entry : src_map)
+        {
+            if (has_copied_children(entry.second))
+            {
+                // hash-based mappings may iterate the copied entries in a different order.
+                BasicNodeType& dst_value =
+                    is_unordered_mapping<mapping_type>::value ? dst_map.find(entry.first)->second : dst_itr->second;
+                plan.add_pair(entry.second, dst_value);
+            }
+            ++dst_itr;
+        }
+        return true;
+    }
+
+    /// @brief Add the children of a container node which own containers to the plan of destruction.
+    /// @param node A container node to be destroyed.
+    /// @param plan A plan of the destruction.
+    /// @return Always true.
+    static bool expand_destruction(
+        BasicNodeType& node, BasicNodeType& /*unused*/, work_plan<BasicNodeType, BasicNodeType>& plan)
+    {
+        if (node.is_sequence())
+        {
+            sequence_type& seq = *node.m_node_value.p_sequence;
+            if (seq.size() >= s_chunk_size)
+            {
+                plan.add_chunks(seq, seq);
+                return true;
+            }
+
+            for (BasicNodeType& elem : seq)
+            {
+                if (has_destroyed_children(elem))
+                {
+                    plan.add_pair(elem, elem);
+                }
+            }
+            return true;
+        }
+
+        for (auto& entry : *node.m_node_value.p_mapping)
+        {
+            if (has_destroyed_children(entry.second))
+            {
+                plan.add_pair(entry.second, entry.second);
+            }
+        }
+        return true;
+    }
+
+    /// @brief Compare the sizes of container nodes and add the pairs of their children to the plan.
+    /// @note Mapping entries are paired in the same way as basic_node_comparator::equal().
+    /// @param lhs A left-hand-side container node.
+    /// @param rhs A right-hand-side container node of the same type.
+    /// @param plan A plan of the comparison.
+    /// @return false if the nodes are found different, true otherwise.
+    static bool expand_comparison(
+        const BasicNodeType& lhs, const BasicNodeType& rhs, work_plan<const BasicNodeType, const BasicNodeType>& plan)
+    {
+        if (lhs.size() != rhs.size())
+        {
+            return false;
+        }
+
+        if (lhs.is_sequence())
+        {
+            const sequence_type& lhs_seq = *lhs.m_node_value.p_sequence;
+            const sequence_type& rhs_seq = *rhs.m_node_value.p_sequence;
+            if (lhs_seq.size() >= s_chunk_size)
+            {
+                plan.add_chunks(lhs_seq, rhs_seq);
+                return true;
+            }
+
+            for (std::size_t i = 0; i < lhs_seq.size(); i++)
+            {
+                if (!compare_or_add(lhs_seq[i], rhs_seq[i], plan))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        const mapping_type& lhs_map = *lhs.m_node_value.p_mapping;
+        const mapping_type& rhs_map = *rhs.m_node_value.p_mapping;
+        auto rhs_itr = rhs_map.begin();
+        for (const auto& entry : lhs_map)
+        {
+            if (is_unordered_mapping<mapping_type>::value)
+            {
+                // the iteration order of hash-based mappings depends on the history of insertions.
+                rhs_itr = rhs_map.find(entry.first);
+                if (rhs_itr == rhs_map.end())
+                {
+                    return false;
+                }
+            }
+            else if (!comparator_type::equal(entry.first, rhs_itr->first))
+            {
+                return false;
+            }
+
+            if (!compare_or_add(entry.second, rhs_itr->second, plan))
+            {
+                return false;
+            }
+            ++rhs_itr;
+        }
+        return true;
+    }
+
+    /// @brief Compare the given nodes, or add them to the plan if they have children to be compared.
+    /// @param lhs A left-hand-side node.
+    /// @param rhs A right-hand-side node.
+    /// @param plan A plan of the comparison.
+    /// @return false if the nodes are found different, true otherwise.
+    static bool compare_or_add(
+        const BasicNodeType& lhs, const BasicNodeType& rhs, work_plan<const BasicNodeType, const BasicNodeType>& plan)
+    {
+        if (has_distinct_children(lhs, rhs))
+        {
+            plan.add_pair(lhs, rhs);
+            return true;
+        }
+        return comparator_type::equal(lhs, rhs);
+    }
+
+    /// @brief Convert a sequence element into a vector element of the basic_node type.
+    /// @param node A sequence element.
+    /// @return The sequence element as it is.
+    template <typename ValueType>
+    static const BasicNodeType& convert_element(const BasicNodeType& node, std::true_type /*unused*/)
+    {
+        return node;
+    }
+
+    /// @brief Convert a sequence element into a vector element.
+    /// @param node A sequence element.
+    /// @return The value converted from `node`.
+    template <typename ValueType>
+    static ValueType convert_element(const BasicNodeType& node, std::false_type /*unused*/)
+    {
+        return node.template get_value<ValueType>();
+    }
+
+private:
+    /// The number of sequence elements processed by a task. Sequences with fewer elements are not split.
+    static constexpr std::size_t s_chunk_size = 1024;
+    /// The number of tasks per thread, which lets threads which have finished earlier take more tasks.
+    static constexpr std::size_t s_tasks_per_thread = 8;
+};
+
+} // namespace detail
+
+FK_YAML_NAMESPACE_END
+
+#endif /* FK_YAML_DETAIL_NODE_PARALLELIZER_HPP_ */
@@ -0,0 +1,196 @@
+///  _______   __ __   __  _____   __  __  __
+/// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+/// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.2
+/// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+///
+/// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+/// SPDX-License-Identifier: MIT
+///
+/// @file
+
+#ifndef FK_YAML_DETAIL_NODE_PATCHER_HPP_
+#define FK_YAML_DETAIL_NODE_PATCHER_HPP_
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <fkYAML/detail/macros/version_macros.hpp>
+#include <fkYAML/detail/meta/node_traits.hpp>
+#include <fkYAML/detail/types/edit_op_t.hpp>
+#include <fkYAML/exception.hpp>
+
+/// @brief namespace for fkYAML library.
+FK_YAML_NAMESPACE_BEGIN
+
+/// @brief namespace for internal implementations of fkYAML library.
+namespace detail
+{
+
+/// @brief A class which applies edits to basic_node objects in place.
+/// @tparam BasicNodeType A basic_node template instance type.
+template <typename BasicNodeType>
+class basic_node_patcher
+{
+    static_assert(is_basic_node<BasicNodeType>::value, "basic_node_patcher only accepts basic_node<...>");
+
+    /** A type for sequence node value containers. */
+    using sequence_type = typename BasicNodeType::sequence_type;
+    /** A type for mapping node value containers. */
+    using mapping_type = typename BasicNodeType::mapping_type;
+    /** A type for integer node values. */
+    using integer_type = typename BasicNodeType::integer_type;
+
+public:
+    /// @brief Apply an edit to the given node.
+    /// @tparam ValueType The type of the value, which is moved into the node if it's an rvalue.
+    /// @param root A node to be edited.
+    /// @param op An edit operation.
+    /// @param path The keys and indices from `root` to the node to be edited.
+    /// @param value A value to be added or to replace the existing one. Ignored for remove operations.
+    template <typename ValueType>
+    static void apply(BasicNodeType& root, edit_op_t op, const std::vector<BasicNodeType>& path, ValueType&& value)
+    {
+        if (path.empty())
+        {
+            if (op == edit_op_t::REMOVE)
+            {
+                throw fkyaml::exception("The root node cannot be removed.");
+            }
+            root = std::forward<ValueType>(value);
+            return;
+        }
+
+        BasicNodeType* p_parent = &root;
+        for (std::size_t i = 0; i + 1 < path.size(); i++)
+        {
+            p_parent = &child(*p_parent, path[i]);
+        }
+
+        const BasicNodeType& key = path.back();
+        if (p_parent->is_sequence())
+        {
+            apply_to_sequence(*p_parent, op, key, std::forward<ValueType>(value));
+        }
+        else if (p_parent->is_mapping())
+        {
+            apply_to_mapping(*p_parent, op, key, std::forward<ValueType>(value));
+        }
+        else
+        {
+            throw fkyaml::type_error("The parent of an edited node must be a sequence or a mapping.", p_parent->type());
+        }
+    }
+
+private:
+    /// @brief Get the existing child of the given node.
+    /// @param parent A parent node.
+    /// @param key The key or the index of the child.
+    /// @return Reference to the child.
+    static BasicNodeType& child(BasicNodeType& parent, const BasicNodeType& key)
+    {
+        if (parent.is_sequence())
+        {
+            sequence_type& seq = parent.template get_value_ref<sequence_type&>();
+            return seq[index_of(key, seq.size())];
+        }
+
+        if (parent.is_mapping())
+        {
+            mapping_type& map = parent.template get_value_ref<mapping_type&>();
+            auto itr = map.find(key);
+            if (itr == map.end())
+            {
+                throw fkyaml::exception("The path of an edit contains a missing key.");
+            }
+            return itr->second;
+        }
+
+        throw fkyaml::type_error("A node in the path of an edit must be a sequence or a mapping.", parent.type());
+    }
+
+    /// @brief Apply an edit to an element of the given sequence.
+    /// @tparam ValueType The type of the value.
+    /// @param parent A sequence node.
+    /// @param op An edit operation.
+    /// @param key The index of the element.
+    /// @param value A value to be inserted or to replace the existing one.
+    template <typename ValueType>
+    static void apply_to_sequence(BasicNodeType& parent, edit_op_t op, const BasicNodeType& key, ValueType&& value)
+    {
+        sequence_type& seq = parent.template get_value_ref<sequence_type&>();
+        switch (op)
+        {
+        case edit_op_t::ADD: {
+            // an element can be added right after the last one.
+            const std::size_t index = index_of(key, seq.size() + 1);
+            seq.insert(seq.begin() + static_cast<std::ptrdiff_t>(index), std::forward<ValueType>(value));
+            break;
+        }
+        case edit_op_t::REMOVE:
+            seq.erase(seq.begin() + static_cast<std::ptrdiff_t>(index_of(key, seq.size())));
+            break;
+        case edit_op_t::REPLACE:
+            seq[index_of(key, seq.size())] = std::forward<ValueType>(value);
+            break;
+        }
+    }
+
+    /// @brief Apply an edit to a value of the given mapping.
+    /// @tparam ValueType The type of the value.
+    /// @param parent A mapping node.
+    /// @param op An edit operation.
+    /// @param key The key of the value.
+    /// @param value A value to be added or to replace the existing one.
+    template <typename ValueType>
+    static void apply_to_mapping(BasicNodeType& parent, edit_op_t op, const BasicNodeType& key, ValueType&& value)
+    {
+        mapping_type& map = parent.template get_value_ref<mapping_type&>();
+        if (op == edit_op_t::ADD)
+        {
+            // an existing value is overwritten.
+            map[key] = std::forward<ValueType>(value);
+            return;
+        }
+
+        auto itr = map.find(key);
+        if (itr == map.end())
+        {
+            throw fkyaml::exception("The key of an edit is missing.");
+        }
+
+        if (op == edit_op_t::REMOVE)
+        {
+            map.erase(itr);
+        }
+        else
+        {
+            itr->second = std::forward<ValueType>(value);
+        }
+    }
+
+    /// @brief Get the index of a sequence element from the given key.
+    /// @param key A key which must be an integer.
+    /// @param limit The upper bound (exclusive) of the index.
+    /// @return The index of a sequence element.
+    static std::size_t index_of(const BasicNodeType& key, std::size_t limit)
+    {
+        if (!key.is_integer())
+        {
+            throw fkyaml::type_error("The key of a sequence element must be an integer.", key.type());
+        }
+
+        const integer_type index = key.template get_value_ref<const integer_type&>();
+        if (index < 0 || static_cast<std::size_t>(index) >= limit)
+        {
+            throw fkyaml::exception("The index of a sequence element is out of range.");
+        }
+        return static_cast<std::size_t>(index);
+    }
+};
+
+} // namespace detail
+
+FK_YAML_NAMESPACE_END
+
+#endif /* FK_YAML_DETAIL_NODE_PATCHER_HPP_ */
@@ -11,9 +11,15 @@
 #ifndef FK_YAML_DETAIL_NODE_PROPERTY_HPP_
 #define FK_YAML_DETAIL_NODE_PROPERTY_HPP_
 
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <string>
 
 #include <fkYAML/detail/macros/version_macros.hpp>
+#include <fkYAML/detail/types/node_t.hpp>
+#include <fkYAML/detail/types/yaml_version_t.hpp>
 
 /// @brief namespace for fkYAML library.
 FK_YAML_NAMESPACE_BEGIN
@@ -29,11 +35,265 @@ enum class anchor_status_t
     ALIAS,
 };
 
+/// @brief The optional properties of a node, which are allocated only for nodes having any of them.
+/// @note A heap copy of a string value stored in place in a node is also kept here once a constant reference to the
+/// string object is requested, since there's no string object to be referenced in the node itself.
+/// @tparam StringType A type for string node values.
+template <typename StringType>
 struct node_property
 {
+    /// @brief Construct a new node_property object with no properties.
+    node_property() = default;
+
+    /// @brief Copy constructor of the node_property class, which copies only the tag and anchor names.
+    /// @param rhs A node_property object to be copied with.
+    node_property(const node_property& rhs)
+        : tag(rhs.tag),
+          anchor(rhs.anchor)
+    {
+    }
+
+    /// @brief Destroy the node_property object together with the string copy if any.
+    ~node_property()
+    {
+        release_string_copy();
+    }
+
+    node_property& operator=(const node_property&) = delete;
+
+    /// @brief Check whether this object has neither a tag name nor an anchor name.
+    /// @return true if this object has no names, false otherwise.
+    bool empty() const noexcept
+    {
+        return tag.empty() && anchor.empty();
+    }
+
+    /// @brief Get the heap copy of the given string, creating it if not yet.
+    /// @note This function can be called from multiple threads at the same time.
+    /// @warning The characters must be the same as the ones given at the first call until release_string_copy().
+    /// @tparam CharType A type for characters.
+    /// @param p_chars The first character of a string.
+    /// @param size The number of characters.
+    /// @return Constant reference to the string copy.
+    template <typename CharType>
+    const StringType& get_string_copy(const CharType* p_chars, std::size_t size)
+    {
+        const StringType* p_copy = p_string_copy.load(std::memory_order_acquire);
+        if (p_copy == nullptr)
+        {
+            std::unique_ptr<StringType> p_created(new StringType(p_chars, size));
+            if (p_string_copy.compare_exchange_strong(
+                    p_copy, p_created.get(), std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                p_copy = p_created.release();
+            }
+            // otherwise, the copy created by another thread has been loaded into p_copy.
+        }
+        return *p_copy;
+    }
+
+    /// @brief Release the string copy if any.
+    /// @warning Make sure no constant reference to the copy is used after calling this function.
+    void release_string_copy() noexcept
+    {
+        delete p_string_copy.exchange(nullptr, std::memory_order_acq_rel);
+    }
+
+    /// The tag name.
     std::string tag {};
-    anchor_status_t anchor_status {anchor_status_t::NONE};
+    /// The anchor name.
     std::string anchor {};
+    /// The heap copy of a string value stored in place.
+    std::atomic<const StringType*> p_string_copy {nullptr};
+};
+
+/// @brief An owning pointer to the optional properties of a node, which can be allocated from multiple threads.
+/// @note This is used instead of std::unique_ptr so that const nodes shared among threads can allocate their
+/// properties to keep string copies in them.
+/// @tparam PropertyType A node_property template instance type.
+template <typename PropertyType>
+class node_property_ptr
+{
+public:
+    /// @brief Construct a new node_property_ptr object which owns nothing.
+    node_property_ptr() = default;
+
+    /// @brief Construct a new node_property_ptr object which owns the given object.
+    /// @param p_prop A pointer to the object to be owned, or nullptr.
+    explicit node_property_ptr(PropertyType* p_prop) noexcept
+        : m_ptr(p_prop)
+    {
+    }
+
+    /// @brief Move constructor of the node_property_ptr class.
+    /// @param rhs A node_property_ptr object to be moved from, which will own nothing.
+    node_property_ptr(node_property_ptr&& rhs) noexcept
+        : m_ptr(rhs.m_ptr.exchange(nullptr, std::memory_order_acq_rel))
+    {
+    }
+
+    node_property_ptr(const node_property_ptr&) = delete;
+    node_property_ptr& operator=(const node_property_ptr&) = delete;
+    node_property_ptr& operator=(node_property_ptr&&) = delete;
+
+    /// @brief Destroy the node_property_ptr object together with the owned object.
+    ~node_property_ptr()
+    {
+        delete get();
+    }
+
+    /// @brief Get the owned object.
+    /// @return The pointer to the owned object, or nullptr if nothing is owned.
+    PropertyType* get() const noexcept
+    {
+        return m_ptr.load(std::memory_order_acquire);
+    }
+
+    /// @brief Check whether this object owns any object.
+    /// @return true if this object owns an object, false otherwise.
+    explicit operator bool() const noexcept
+    {
+        return get() != nullptr;
+    }
+
+    /// @brief Access the owned object.
+    /// @warning Make sure this object owns an object before calling this function.
+    /// @return The pointer to the owned object.
+    PropertyType* operator->() const noexcept
+    {
+        return get();
+    }
+
+    /// @brief Get the owned object, allocating it if not yet.
+    /// @note This function can be called from multiple threads at the same time.
+    /// @return Reference to the owned object.
+    PropertyType& get_or_create() const
+    {
+        PropertyType* p_prop = get();
+        if (p_prop == nullptr)
+        {
+            std::unique_ptr<PropertyType> p_created(new PropertyType());
+            if (m_ptr.compare_exchange_strong(
+                    p_prop, p_created.get(), std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                p_prop = p_created.release();
+            }
+            // otherwise, the object created by another thread has been loaded into p_prop.
+        }
+        return *p_prop;
+    }
+
+    /// @brief Swap the owned objects with the given node_property_ptr object.
+    /// @param rhs A node_property_ptr object to be swapped with.
+    void swap(node_property_ptr& rhs) noexcept
+    {
+        PropertyType* p_prop = m_ptr.load(std::memory_order_acquire);
+        m_ptr.store(rhs.m_ptr.load(std::memory_order_acquire), std::memory_order_release);
+        rhs.m_ptr.store(p_prop, std::memory_order_release);
+    }
+
+private:
+    /// The owned object. This is mutable so that const nodes can allocate their properties exactly once.
+    mutable std::atomic<PropertyType*> m_ptr {nullptr};
+};
+
+/// @brief The attributes of a node (its value type, YAML version, anchor status and whether its value is shared) packed
+/// into a single byte.
+class node_attrs
+{
+    /** The bit mask for the node value type. */
+    static constexpr std::uint8_t type_mask = 0x07u;
+    /** The bit offset of the YAML version. */
+    static constexpr std::uint8_t version_shift = 3u;
+    /** The bit mask for the YAML version. */
+    static constexpr std::uint8_t version_mask = 0x03u << version_shift;
+    /** The bit offset of the anchor status. */
+    static constexpr std::uint8_t anchor_status_shift = 5u;
+    /** The bit mask for the anchor status. */
+    static constexpr std::uint8_t anchor_status_mask = 0x03u << anchor_status_shift;
+    /** The bit flag for a value shared with other nodes. */
+    static constexpr std::uint8_t shared_bit = 0x80u;
+
+public:
+    /// @brief Construct a new node_attrs object for a null node.
+    constexpr node_attrs() noexcept
+        : node_attrs(node_t::NULL_OBJECT)
+    {
+    }
+
+    /// @brief Construct a new node_attrs object for a node of the given type.
+    /// @param type A node value type.
+    explicit constexpr node_attrs(node_t type) noexcept
+        : m_bits(static_cast<std::uint8_t>(
+              static_cast<std::uint8_t>(type) |
+              static_cast<std::uint8_t>(static_cast<std::uint8_t>(yaml_version_t::VER_1_2) << version_shift)))
+    {
+    }
+
+    /// @brief Get the node value type.
+    /// @return The node value type.
+    node_t type() const noexcept
+    {
+        return static_cast<node_t>(m_bits & type_mask);
+    }
+
+    /// @brief Set the node value type.
+    /// @note The shared flag is cleared as well since it describes the previous value.
+    /// @param type A node value type.
+    void set_type(node_t type) noexcept
+    {
+        m_bits = static_cast<std::uint8_t>(
+            (m_bits & ~(type_mask | shared_bit)) | static_cast<std::uint8_t>(type));
+    }
+
+    /// @brief Check whether the value is shared with other nodes.
+    /// @note A shared string is an immutable interned string, and a shared container is a copy-on-write one.
+    /// @return true if the value is shared, false otherwise.
+    bool is_shared() const noexcept
+    {
+        return (m_bits & shared_bit) != 0;
+    }
+
+    /// @brief Set whether the value is shared with other nodes.
+    /// @param is_shared Whether the value is shared.
+    void set_shared(bool is_shared) noexcept
+    {
+        m_bits = static_cast<std::uint8_t>(is_shared ? (m_bits | shared_bit) : (m_bits & ~shared_bit));
+    }
+
+    /// @brief Get the YAML version.
+    /// @return The YAML version.
+    yaml_version_t version() const noexcept
+    {
+        return static_cast<yaml_version_t>((m_bits & version_mask) >> version_shift);
+    }
+
+    /// @brief Set the YAML version.
+    /// @param version A YAML version.
+    void set_version(yaml_version_t version) noexcept
+    {
+        m_bits = static_cast<std::uint8_t>(
+            (m_bits & ~version_mask) | (static_cast<std::uint8_t>(version) << version_shift));
+    }
+
+    /// @brief Get the anchor status.
+    /// @return The anchor status.
+    anchor_status_t anchor_status() const noexcept
+    {
+        return static_cast<anchor_status_t>((m_bits & anchor_status_mask) >> anchor_status_shift);
+    }
+
+    /// @brief Set the anchor status.
+    /// @param status An anchor status.
+    void set_anchor_status(anchor_status_t status) noexcept
+    {
+        m_bits = static_cast<std::uint8_t>(
+            (m_bits & ~anchor_status_mask) | (static_cast<std::uint8_t>(status) << anchor_status_shift));
+    }
+
+private:
+    /// The packed attribute bits.
+    std::uint8_t m_bits;
 };
 
 } // namespace detail
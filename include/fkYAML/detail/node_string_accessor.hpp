@@ -0,0 +1,116 @@
+///  _______   __ __   __  _____   __  __  __
+/// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+/// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.2
+/// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+///
+/// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+/// SPDX-License-Identifier: MIT
+///
+/// @file
+
+#ifndef FK_YAML_DETAIL_NODE_STRING_ACCESSOR_HPP_
+#define FK_YAML_DETAIL_NODE_STRING_ACCESSOR_HPP_
+
+#include <cstddef>
+
+#include <fkYAML/detail/macros/version_macros.hpp>
+#include <fkYAML/detail/assert.hpp>
+#include <fkYAML/detail/meta/type_traits.hpp>
+
+/// @brief namespace for fkYAML library.
+FK_YAML_NAMESPACE_BEGIN
+
+/// @brief namespace for internal implementations of fkYAML library.
+namespace detail
+{
+
+/// @brief Accessors to string values of basic_node objects for internal use.
+/// @note Short strings are stored in place in basic_node objects, and basic_node::get_value_ref() moves them to the
+/// heap to return references to string objects. These accessors never do so, which keeps const basic_node objects
+/// untouched and safe to be read from multiple threads.
+/// @warning Make sure the given node is a string before calling any of these functions.
+/// @tparam BasicNodeType A basic_node template instance type.
+template <typename BasicNodeType>
+struct node_string_accessor
+{
+    /// @brief A type for string values.
+    using string_type = typename BasicNodeType::string_type;
+    /// @brief A type for characters of string values.
+    using char_type = string_char_type_t<string_type>;
+
+    /// @brief Gets the maximum number of characters of a string which is stored in place.
+    /// @return The maximum number of characters stored in place.
+    static constexpr std::size_t inline_capacity() noexcept
+    {
+        return BasicNodeType::node_value::small_capacity();
+    }
+
+    /// @brief Gets the first character of the string value of the given node.
+    /// @param n A string node.
+    /// @return The pointer to the first character.
+    static const char_type* data(const BasicNodeType& n) noexcept
+    {
+        FK_YAML_ASSERT(n.is_string());
+        return n.m_node_value.string_data();
+    }
+
+    /// @brief Gets the number of characters of the string value of the given node.
+    /// @param n A string node.
+    /// @return The number of characters.
+    static std::size_t size(const BasicNodeType& n) noexcept
+    {
+        FK_YAML_ASSERT(n.is_string());
+        return n.m_node_value.string_size();
+    }
+
+    /// @brief Checks whether the string value of the given node is stored in place.
+    /// @param n A string node.
+    /// @return true if the string value is stored in place, false otherwise.
+    static bool is_inline(const BasicNodeType& n) noexcept
+    {
+        FK_YAML_ASSERT(n.is_string());
+        return n.m_node_value.is_small_string();
+    }
+
+    /// @brief Gets the string value of the given node as a string object.
+    /// @param n A string node.
+    /// @param buffer A buffer which a string stored in place is copied to.
+    /// @return Reference to the string value of the node, or `buffer` if it's stored in place.
+    static const string_type& get(const BasicNodeType& n, string_type& buffer)
+    {
+        FK_YAML_ASSERT(n.is_string());
+        const auto& value = n.m_node_value;
+        if (value.attrs.is_shared())
+        {
+            return *(value.p_shared_str);
+        }
+        if (value.is_small_string())
+        {
+            buffer.assign(value.small_data(), value.small_size);
+            return buffer;
+        }
+        return *(value.p_string);
+    }
+
+    /// @brief Gets the string value of the given node as a string object which can be modified or moved from.
+    /// @param n A string node.
+    /// @param buffer A buffer which a string stored in place or a shared one is copied to.
+    /// @return Reference to the string value owned by the node, or `buffer` if it's not stored on the heap.
+    static string_type& get(BasicNodeType& n, string_type& buffer)
+    {
+        FK_YAML_ASSERT(n.is_string());
+        auto& value = n.m_node_value;
+        if (value.attrs.is_shared() || value.is_small_string())
+        {
+            buffer.assign(value.string_data(), value.string_size());
+            return buffer;
+        }
+        return *(value.p_string);
+    }
+};
+
+} // namespace detail
+
+FK_YAML_NAMESPACE_END
+
+#endif /* FK_YAML_DETAIL_NODE_STRING_ACCESSOR_HPP_ */
@@ -0,0 +1,83 @@
+///  _______   __ __   __  _____   __  __  __
+/// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+/// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.2
+/// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+///
+/// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+/// SPDX-License-Identifier: MIT
+///
+/// @file
+
+#ifndef FK_YAML_DETAIL_NODE_TAPE_HPP_
+#define FK_YAML_DETAIL_NODE_TAPE_HPP_
+
+#include <cstddef>
+#include <vector>
+
+#include <fkYAML/detail/macros/version_macros.hpp>
+#include <fkYAML/detail/types/node_t.hpp>
+#include <fkYAML/detail/types/yaml_version_t.hpp>
+
+/// @brief namespace for fkYAML library.
+FK_YAML_NAMESPACE_BEGIN
+
+/// @brief namespace for internal implementations of fkYAML library.
+namespace detail
+{
+
+/// @brief A flat representation of a deserialized YAML document.
+/// @note
+/// Nodes are stored in document order as fixed-size entries. The entries of the children of a container follow the
+/// container's entry, and the entries of a mapping alternate between keys and values. String values are stored in a
+/// single buffer so that no allocation is needed per node.
+/// @tparam BasicNodeType A basic_node template instance type which defines the types of scalar values.
+template <typename BasicNodeType>
+struct basic_node_tape
+{
+    /** A type for boolean node values. */
+    using boolean_type = typename BasicNodeType::boolean_type;
+    /** A type for integer node values. */
+    using integer_type = typename BasicNodeType::integer_type;
+    /** A type for float number node values. */
+    using float_number_type = typename BasicNodeType::float_number_type;
+    /** A type for string node values. */
+    using string_type = typename BasicNodeType::string_type;
+
+    /// @brief A node in the tape.
+    struct entry
+    {
+        /// The type of the node, or of the referenced node if this is an alias.
+        node_t type;
+        /// Whether this is an alias.
+        bool is_alias;
+        /// The index of the entry which follows this node and all its children.
+        std::size_t next;
+        /// The number of elements (sequence), key/value pairs (mapping) or characters (string).
+        std::size_t size;
+        /// The 1-based index of the anchor name in anchor_names, or 0 if the node has no anchor.
+        std::size_t anchor;
+        /// The scalar value, the offset of the string in strings, or the index of the referenced entry (alias).
+        union
+        {
+            boolean_type boolean;
+            integer_type integer;
+            float_number_type float_val;
+            std::size_t position;
+        } value;
+    };
+
+    /// The nodes in document order.
+    std::vector<entry> entries {};
+    /// The concatenated string values.
+    string_type strings {};
+    /// The anchor names which appear in the document.
+    std::vector<string_type> anchor_names {};
+    /// The YAML version of the document.
+    yaml_version_t version {yaml_version_t::VER_1_2};
+};
+
+} // namespace detail
+
+FK_YAML_NAMESPACE_END
+
+#endif /* FK_YAML_DETAIL_NODE_TAPE_HPP_ */
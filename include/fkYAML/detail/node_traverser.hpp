@@ -0,0 +1,175 @@
+///  _______   __ __   __  _____   __  __  __
+/// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+/// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.2
+/// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+///
+/// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+/// SPDX-License-Identifier: MIT
+///
+/// @file
+
+#ifndef FK_YAML_DETAIL_NODE_TRAVERSER_HPP_
+#define FK_YAML_DETAIL_NODE_TRAVERSER_HPP_
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <fkYAML/detail/macros/version_macros.hpp>
+#include <fkYAML/detail/meta/node_traits.hpp>
+#include <fkYAML/detail/meta/stl_supplement.hpp>
+#include <fkYAML/detail/node_string_accessor.hpp>
+#include <fkYAML/detail/types/node_t.hpp>
+
+/// @brief namespace for fkYAML library.
+FK_YAML_NAMESPACE_BEGIN
+
+/// @brief namespace for internal implementations of fkYAML library.
+namespace detail
+{
+
+/// @brief A class which traverses basic_node trees in depth-first order with an explicit stack.
+/// @tparam NodeType A basic_node template instance type, which is const for read-only traversals.
+template <typename NodeType>
+class basic_node_traverser
+{
+    /** A type for basic_node objects. */
+    using basic_node_type = remove_cv_t<NodeType>;
+
+    static_assert(is_basic_node<basic_node_type>::value, "basic_node_traverser only accepts basic_node<...>");
+
+    /** A type for sequence node value containers. */
+    using sequence_type = typename std::conditional<
+        std::is_const<NodeType>::value, const typename basic_node_type::sequence_type,
+        typename basic_node_type::sequence_type>::type;
+    /** A type for mapping node value containers. */
+    using mapping_type = typename std::conditional<
+        std::is_const<NodeType>::value, const typename basic_node_type::mapping_type,
+        typename basic_node_type::mapping_type>::type;
+    /** A type for iterators over mapping entries. */
+    using mapping_iterator = decltype(std::declval<mapping_type&>().begin());
+
+    /// @brief A container whose children are being visited.
+    struct frame
+    {
+        /// The container node.
+        NodeType* p_node;
+        /// The next mapping entry to be visited. Valid only for mappings.
+        mapping_iterator itr;
+        /// The end of the mapping entries. Valid only for mappings.
+        mapping_iterator end;
+        /// The index of the next sequence element to be visited. Valid only for sequences.
+        std::size_t index;
+    };
+
+public:
+    /// @brief Visit the given node and all the nodes in it in depth-first order.
+    /// @tparam VisitorType The type of the visitor, which has the member functions of basic_node_visitor.
+    /// @param root A root node.
+    /// @param visitor A visitor.
+    template <typename VisitorType>
+    static void traverse(NodeType& root, VisitorType& visitor)
+    {
+        std::vector<frame> stack;
+        enter(root, visitor, stack);
+
+        while (!stack.empty())
+        {
+            // the frame is not referred to after enter() since it may reallocate the stack.
+            frame& f = stack.back();
+            if (f.p_node->is_mapping())
+            {
+                if (f.itr == f.end)
+                {
+                    visitor.end_mapping(*f.p_node);
+                    stack.pop_back();
+                    continue;
+                }
+
+                auto& entry = *f.itr;
+                ++f.itr;
+                if (visitor.mapping_value(entry.first, entry.second))
+                {
+                    enter(entry.second, visitor, stack);
+                }
+                continue;
+            }
+
+            sequence_type& seq = f.p_node->template get_value_ref<sequence_type&>();
+            if (f.index == seq.size())
+            {
+                visitor.end_sequence(*f.p_node);
+                stack.pop_back();
+                continue;
+            }
+
+            const std::size_t index = f.index++;
+            if (visitor.sequence_element(index, seq[index]))
+            {
+                enter(seq[index], visitor, stack);
+            }
+        }
+    }
+
+private:
+    /// @brief Visit the given node, and push it to the stack if its children are to be visited.
+    /// @tparam VisitorType The type of the visitor.
+    /// @param node A node to be visited.
+    /// @param visitor A visitor.
+    /// @param stack The containers whose children are being visited.
+    template <typename VisitorType>
+    static void enter(NodeType& node, VisitorType& visitor, std::vector<frame>& stack)
+    {
+        switch (node.type())
+        {
+        case node_t::SEQUENCE:
+            if (visitor.start_sequence(node))
+            {
+                stack.push_back(frame {&node, mapping_iterator(), mapping_iterator(), 0});
+            }
+            else
+            {
+                visitor.end_sequence(node);
+            }
+            break;
+        case node_t::MAPPING:
+            if (visitor.start_mapping(node))
+            {
+                mapping_type& map = node.template get_value_ref<mapping_type&>();
+                stack.push_back(frame {&node, map.begin(), map.end(), 0});
+            }
+            else
+            {
+                visitor.end_mapping(node);
+            }
+            break;
+        case node_t::NULL_OBJECT:
+            visitor.null_scalar(node);
+            break;
+        case node_t::BOOLEAN:
+            visitor.boolean_scalar(
+                node, node.template get_value_ref<const typename basic_node_type::boolean_type&>());
+            break;
+        case node_t::INTEGER:
+            visitor.integer_scalar(
+                node, node.template get_value_ref<const typename basic_node_type::integer_type&>());
+            break;
+        case node_t::FLOAT_NUMBER:
+            visitor.float_number_scalar(
+                node, node.template get_value_ref<const typename basic_node_type::float_number_type&>());
+            break;
+        case node_t::STRING: {
+            typename basic_node_type::string_type buffer;
+            visitor.string_scalar(node, node_string_accessor<basic_node_type>::get(node, buffer));
+            break;
+        }
+        }
+    }
+};
+
+} // namespace detail
+
+FK_YAML_NAMESPACE_END
+
+#endif /* FK_YAML_DETAIL_NODE_TRAVERSER_HPP_ */
@@ -0,0 +1,512 @@
+///  _______   __ __   __  _____   __  __  __
+/// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+/// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.2
+/// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+///
+/// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+/// SPDX-License-Identifier: MIT
+///
+/// @file
+
+#ifndef FK_YAML_DETAIL_NODE_VIEW_BASE_HPP_
+#define FK_YAML_DETAIL_NODE_VIEW_BASE_HPP_
+
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <utility>
+
+#include <fkYAML/detail/macros/version_macros.hpp>
+#include <fkYAML/detail/meta/node_traits.hpp>
+#include <fkYAML/detail/meta/stl_supplement.hpp>
+#include <fkYAML/detail/node_lookup_key.hpp>
+#include <fkYAML/detail/node_string_accessor.hpp>
+#include <fkYAML/detail/types/node_t.hpp>
+#include <fkYAML/exception.hpp>
+
+/// @brief namespace for fkYAML library.
+FK_YAML_NAMESPACE_BEGIN
+
+/// @brief namespace for internal implementations of fkYAML library.
+namespace detail
+{
+
+/// @brief The common implementation of read-only views of nodes stored as flat arrays of entries.
+/// @note
+/// The storage must have `entries` and `strings` members. The entries of the children of a container follow the
+/// container's entry, and the entries of a mapping alternate between keys and values. Each entry has the `type`,
+/// `next`, `size` and `value` members. A view type derived from this class must provide the following functions:
+/// - `std::size_t resolve_index(std::size_t index) const`: the index of the entry which has the value of an entry.
+/// - `std::size_t element_index(std::size_t seq_index, std::size_t pos) const`: the index of an element entry.
+/// - `std::size_t find_value(std::size_t map_index, const KeyType& key) const`: the index of a value entry or 0.
+/// - `BasicNodeType materialize_entry(std::size_t index) const`: a basic_node object created from an entry.
+/// @tparam DerivedType A view type derived from this class.
+/// @tparam BasicNodeType A basic_node template instance type to be created from the storage.
+/// @tparam StorageType A type for the storage of the entries.
+template <typename DerivedType, typename BasicNodeType, typename StorageType>
+class node_view_base
+{
+    static_assert(is_basic_node<BasicNodeType>::value, "node_view_base only accepts basic_node<...>");
+
+protected:
+    /** A type for the entries in the storage. */
+    using entry_type = typename StorageType::entry;
+    /** A type for characters of string values. */
+    using char_type = typename BasicNodeType::string_type::value_type;
+
+public:
+    /** A type for node value types. */
+    using node_t = detail::node_t;
+    /** A type for sequence node values. */
+    using sequence_type = typename BasicNodeType::sequence_type;
+    /** A type for mapping node values. */
+    using mapping_type = typename BasicNodeType::mapping_type;
+    /** A type for boolean node values. */
+    using boolean_type = typename BasicNodeType::boolean_type;
+    /** A type for integer node values. */
+    using integer_type = typename BasicNodeType::integer_type;
+    /** A type for float number node values. */
+    using float_number_type = typename BasicNodeType::float_number_type;
+    /** A type for string node values. */
+    using string_type = typename BasicNodeType::string_type;
+
+    /// @brief An iterator over the elements of a sequence view or the key/value pairs of a mapping view.
+    class const_iterator
+    {
+    public:
+        /// A type for iterator categories.
+        using iterator_category = std::input_iterator_tag;
+        /// A type for the views referred to by iterators.
+        using value_type = DerivedType;
+        /// A type for differences between iterators.
+        using difference_type = std::ptrdiff_t;
+        /// A type for the pointer to the views. (unused)
+        using pointer = void;
+        /// A type for the views returned by dereferencing iterators. Views are returned by value.
+        using reference = DerivedType;
+
+        /// @brief Construct a new const_iterator object.
+        /// @param p_storage The storage of the iterated container.
+        /// @param index The index of the current element (or key) entry.
+        /// @param is_mapping Whether the iterated container is a mapping.
+        const_iterator(const std::shared_ptr<const StorageType>& p_storage, std::size_t index, bool is_mapping)
+            : mp_storage(p_storage),
+              m_index(index),
+              m_is_mapping(is_mapping)
+        {
+        }
+
+        /// @brief Get the view of the current element, or of the value if the iterated container is a mapping.
+        /// @return The view of the current element.
+        DerivedType operator*() const
+        {
+            return value();
+        }
+
+        /// @brief Move to the next element.
+        /// @return Reference to this iterator.
+        const_iterator& operator++()
+        {
+            m_index = mp_storage->entries[m_index].next;
+            if (m_is_mapping)
+            {
+                // skip the value as well.
+                m_index = mp_storage->entries[m_index].next;
+            }
+            return *this;
+        }
+
+        /// @brief Move to the next element.
+        /// @return An iterator to the element before moving.
+        const_iterator operator++(int)
+        {
+            const_iterator tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        /// @brief Check equality between iterators.
+        /// @param rhs An iterator to compare with.
+        /// @return true if both iterators point to the same element, false otherwise.
+        bool operator==(const const_iterator& rhs) const noexcept
+        {
+            return mp_storage == rhs.mp_storage && m_index == rhs.m_index;
+        }
+
+        /// @brief Check inequality between iterators.
+        /// @param rhs An iterator to compare with.
+        /// @return true if the iterators point to different elements, false otherwise.
+        bool operator!=(const const_iterator& rhs) const noexcept
+        {
+            return !operator==(rhs);
+        }
+
+        /// @brief Get the view of the current key.
+        /// @return The view of the current key.
+        DerivedType key() const
+        {
+            if (!m_is_mapping)
+            {
+                throw fkyaml::exception("Cannot retrieve key from non-mapping iterators.");
+            }
+            return DerivedType(mp_storage, m_index);
+        }
+
+        /// @brief Get the view of the current element, or of the value if the iterated container is a mapping.
+        /// @return The view of the current element.
+        DerivedType value() const
+        {
+            return DerivedType(mp_storage, m_is_mapping ? mp_storage->entries[m_index].next : m_index);
+        }
+
+    private:
+        /// The storage of the iterated container.
+        std::shared_ptr<const StorageType> mp_storage;
+        /// The index of the current element (or key) entry.
+        std::size_t m_index;
+        /// Whether the iterated container is a mapping.
+        bool m_is_mapping;
+    };
+
+protected:
+    /// @brief Construct a new node_view_base object which views a node in a storage.
+    /// @param p_storage A storage of entries.
+    /// @param index The index of the entry of the node.
+    node_view_base(std::shared_ptr<const StorageType> p_storage, std::size_t index)
+        : mp_storage(std::move(p_storage)),
+          m_index(index)
+    {
+    }
+
+public:
+    /// @brief Get the type of the viewed node.
+    /// @return The type of the viewed node.
+    node_t type() const noexcept
+    {
+        return entry().type;
+    }
+
+    /// @brief Test whether the viewed node is a sequence.
+    /// @return true if the viewed node is a sequence, false otherwise.
+    bool is_sequence() const noexcept
+    {
+        return type() == node_t::SEQUENCE;
+    }
+
+    /// @brief Test whether the viewed node is a mapping.
+    /// @return true if the viewed node is a mapping, false otherwise.
+    bool is_mapping() const noexcept
+    {
+        return type() == node_t::MAPPING;
+    }
+
+    /// @brief Test whether the viewed node is null.
+    /// @return true if the viewed node is null, false otherwise.
+    bool is_null() const noexcept
+    {
+        return type() == node_t::NULL_OBJECT;
+    }
+
+    /// @brief Test whether the viewed node is a boolean.
+    /// @return true if the viewed node is a boolean, false otherwise.
+    bool is_boolean() const noexcept
+    {
+        return type() == node_t::BOOLEAN;
+    }
+
+    /// @brief Test whether the viewed node is an integer.
+    /// @return true if the viewed node is an integer, false otherwise.
+    bool is_integer() const noexcept
+    {
+        return type() == node_t::INTEGER;
+    }
+
+    /// @brief Test whether the viewed node is a float number.
+    /// @return true if the viewed node is a float number, false otherwise.
+    bool is_float_number() const noexcept
+    {
+        return type() == node_t::FLOAT_NUMBER;
+    }
+
+    /// @brief Test whether the viewed node is a string.
+    /// @return true if the viewed node is a string, false otherwise.
+    bool is_string() const noexcept
+    {
+        return type() == node_t::STRING;
+    }
+
+    /// @brief Test whether the viewed node is a scalar.
+    /// @return true if the viewed node is a scalar, false otherwise.
+    bool is_scalar() const noexcept
+    {
+        return !is_sequence() && !is_mapping();
+    }
+
+    /// @brief Test whether the viewed container (sequence, mapping, string) is empty.
+    /// @return true if the viewed container is empty, false otherwise.
+    bool empty() const
+    {
+        return size() == 0;
+    }
+
+    /// @brief Get the size of the viewed container (sequence, mapping, string).
+    /// @return The number of elements, key/value pairs or characters.
+    std::size_t size() const
+    {
+        const entry_type& e = entry();
+        switch (e.type)
+        {
+        case node_t::SEQUENCE:
+        case node_t::MAPPING:
+        case node_t::STRING:
+            return e.size;
+        default:
+            throw fkyaml::type_error("The target node is not of a container type.", e.type);
+        }
+    }
+
+    /// @brief Check whether the viewed mapping has a given key.
+    /// @tparam KeyType A key type compatible with basic_node.
+    /// @param key A key to the target value.
+    /// @return true if the viewed node is a mapping and has the given key, false otherwise.
+    template <
+        typename KeyType, enable_if_t<
+                              disjunction<
+                                  is_basic_node<remove_cvref_t<KeyType>>,
+                                  is_node_compatible_type<BasicNodeType, remove_cvref_t<KeyType>>>::value,
+                              int> = 0>
+    bool contains(KeyType&& key) const
+    {
+        if (!is_mapping())
+        {
+            return false;
+        }
+        // string and integer keys are compared with the key entries without conversion into basic_node objects.
+        return derived().find_value(target_index(), to_lookup_key<BasicNodeType>(std::forward<KeyType>(key))) != 0;
+    }
+
+    /// @brief Get the view of an element in the viewed sequence or of a value in the viewed mapping.
+    /// @tparam KeyType A key type compatible with basic_node.
+    /// @param key An index of the target element, or a key of the target value.
+    /// @return The view of the target node.
+    template <
+        typename KeyType, enable_if_t<
+                              disjunction<
+                                  is_basic_node<remove_cvref_t<KeyType>>,
+                                  is_node_compatible_type<BasicNodeType, remove_cvref_t<KeyType>>>::value,
+                              int> = 0>
+    DerivedType operator[](KeyType&& key) const
+    {
+        const entry_type& e = entry();
+        if (e.type != node_t::SEQUENCE && e.type != node_t::MAPPING)
+        {
+            throw fkyaml::type_error("operator[] is unavailable for a scalar node.", e.type);
+        }
+
+        const auto& lookup_key = to_lookup_key<BasicNodeType>(std::forward<KeyType>(key));
+
+        if (e.type == node_t::SEQUENCE)
+        {
+            const integer_type n = to_sequence_index(lookup_key);
+            if (n < 0 || static_cast<std::size_t>(n) >= e.size)
+            {
+                throw fkyaml::exception("index out of range.");
+            }
+            return DerivedType(mp_storage, derived().element_index(target_index(), static_cast<std::size_t>(n)));
+        }
+
+        const std::size_t index = derived().find_value(target_index(), lookup_key);
+        if (index == 0)
+        {
+            throw fkyaml::exception("key not found.");
+        }
+        return DerivedType(mp_storage, index);
+    }
+
+    /// @brief Get an iterator to the first element (or key/value pair) of the viewed container.
+    /// @return An iterator to the first element.
+    const_iterator begin() const
+    {
+        const entry_type& e = entry();
+        if (e.type != node_t::SEQUENCE && e.type != node_t::MAPPING)
+        {
+            throw fkyaml::type_error("The target node is neither of sequence nor mapping types.", e.type);
+        }
+        return const_iterator(mp_storage, target_index() + 1, e.type == node_t::MAPPING);
+    }
+
+    /// @brief Get an iterator to the past-the-last element (or key/value pair) of the viewed container.
+    /// @return An iterator to the past-the-last element.
+    const_iterator end() const
+    {
+        const entry_type& e = entry();
+        if (e.type != node_t::SEQUENCE && e.type != node_t::MAPPING)
+        {
+            throw fkyaml::type_error("The target node is neither of sequence nor mapping types.", e.type);
+        }
+        return const_iterator(mp_storage, e.next, e.type == node_t::MAPPING);
+    }
+
+    /// @brief Create a basic_node object from the viewed node and convert it into a compatible value.
+    /// @tparam T A compatible value type.
+    /// @return A compatible value converted from the viewed node.
+    template <typename T>
+    T get_value() const
+    {
+        return materialize().template get_value<T>();
+    }
+
+    /// @brief Create a basic_node object from the viewed node, including all the nodes in it.
+    /// @return A basic_node object created from the viewed node.
+    BasicNodeType materialize() const
+    {
+        return derived().materialize_entry(m_index);
+    }
+
+protected:
+    /// @brief Get the derived view object.
+    /// @return Constant reference to the derived view object.
+    const DerivedType& derived() const noexcept
+    {
+        return static_cast<const DerivedType&>(*this);
+    }
+
+    /// @brief Get the index of the entry which has the value of the viewed node.
+    /// @return The index of the entry which has the value of the viewed node.
+    std::size_t target_index() const noexcept
+    {
+        return derived().resolve_index(m_index);
+    }
+
+    /// @brief Get the entry which has the value of the viewed node.
+    /// @return The entry which has the value of the viewed node.
+    const entry_type& entry() const noexcept
+    {
+        return mp_storage->entries[target_index()];
+    }
+
+    /// @brief Get the index of an element from a basic_node key.
+    /// @param key A key which must be an integer node.
+    /// @return The index of the target element.
+    integer_type to_sequence_index(const BasicNodeType& key) const
+    {
+        if (!key.is_integer())
+        {
+            throw fkyaml::type_error("An argument of operator[] for sequence nodes must be an integer.", type());
+        }
+        return key.template get_value_ref<const integer_type&>();
+    }
+
+    /// @brief Get the index of an element from an integer key.
+    /// @tparam KeyType An integer key type.
+    /// @param key An integer key.
+    /// @return The index of the target element.
+    template <typename KeyType, enable_if_t<is_integer_lookup_key<BasicNodeType, KeyType>::value, int> = 0>
+    integer_type to_sequence_index(const KeyType& key) const noexcept
+    {
+        return static_cast<integer_type>(key);
+    }
+
+    /// @brief Reject a string key as an index of an element.
+    /// @tparam KeyType A string key type.
+    /// @return Never returns.
+    template <typename KeyType, enable_if_t<is_string_lookup_key<BasicNodeType, KeyType>::value, int> = 0>
+    integer_type to_sequence_index(const KeyType& /*unused*/) const
+    {
+        throw fkyaml::type_error("An argument of operator[] for sequence nodes must be an integer.", type());
+    }
+
+    /// @brief Find the value associated with a key in a mapping by comparing the key with every key entry.
+    /// @tparam KeyType A basic_node, string or integer key type.
+    /// @param map_index The index of the mapping entry.
+    /// @param key A key to the target value.
+    /// @return The index of the value entry, or 0 if the key is not found.
+    template <typename KeyType>
+    std::size_t find_value_linear(std::size_t map_index, const KeyType& key) const
+    {
+        const std::size_t end = mp_storage->entries[map_index].next;
+        for (std::size_t index = map_index + 1; index != end;)
+        {
+            const std::size_t value_index = mp_storage->entries[index].next;
+            if (key_equals(index, key))
+            {
+                return value_index;
+            }
+            index = mp_storage->entries[value_index].next;
+        }
+        return 0;
+    }
+
+    /// @brief Check whether a key entry is equal to a key without creating a basic_node object if possible.
+    /// @param index The index of the key entry.
+    /// @param key A key to compare with.
+    /// @return true if the key entry is equal to the key, false otherwise.
+    bool key_equals(std::size_t index, const BasicNodeType& key) const
+    {
+        const entry_type& e = mp_storage->entries[derived().resolve_index(index)];
+        if (e.type != key.type())
+        {
+            return false;
+        }
+
+        switch (e.type)
+        {
+        case node_t::NULL_OBJECT:
+            return true;
+        case node_t::BOOLEAN:
+            return e.value.boolean == key.template get_value_ref<const boolean_type&>();
+        case node_t::INTEGER:
+            return e.value.integer == key.template get_value_ref<const integer_type&>();
+        case node_t::FLOAT_NUMBER:
+            return std::abs(e.value.float_val - key.template get_value_ref<const float_number_type&>()) <
+                   std::numeric_limits<float_number_type>::epsilon();
+        case node_t::STRING: {
+            using accessor_type = node_string_accessor<BasicNodeType>;
+            const std::size_t size = accessor_type::size(key);
+            return e.size == size &&
+                   mp_storage->strings.compare(e.value.position, e.size, accessor_type::data(key), size) == 0;
+        }
+        default:
+            return derived().materialize_entry(index) == key;
+        }
+    }
+
+    /// @brief Check whether a key entry is equal to a string key.
+    /// @tparam KeyType A string key type.
+    /// @param index The index of the key entry.
+    /// @param key A string key to compare with.
+    /// @return true if the key entry is a string with the same characters as the key, false otherwise.
+    template <typename KeyType, enable_if_t<is_string_lookup_key<BasicNodeType, KeyType>::value, int> = 0>
+    bool key_equals(std::size_t index, const KeyType& key) const
+    {
+        const entry_type& e = mp_storage->entries[derived().resolve_index(index)];
+        const lookup_chars<char_type> chars = get_lookup_chars<char_type>(key);
+        return e.type == node_t::STRING && e.size == chars.size &&
+               mp_storage->strings.compare(e.value.position, e.size, chars.p_begin, chars.size) == 0;
+    }
+
+    /// @brief Check whether a key entry is equal to an integer key.
+    /// @tparam KeyType An integer key type.
+    /// @param index The index of the key entry.
+    /// @param key An integer key to compare with.
+    /// @return true if the key entry is an integer with the same value as the key, false otherwise.
+    template <typename KeyType, enable_if_t<is_integer_lookup_key<BasicNodeType, KeyType>::value, int> = 0>
+    bool key_equals(std::size_t index, const KeyType& key) const
+    {
+        const entry_type& e = mp_storage->entries[derived().resolve_index(index)];
+        return e.type == node_t::INTEGER && e.value.integer == static_cast<integer_type>(key);
+    }
+
+    /// The storage which the viewed node belongs to.
+    std::shared_ptr<const StorageType> mp_storage;
+    /// The index of the entry of the viewed node.
+    std::size_t m_index;
+};
+
+} // namespace detail
+
+FK_YAML_NAMESPACE_END
+
+#endif /* FK_YAML_DETAIL_NODE_VIEW_BASE_HPP_ */
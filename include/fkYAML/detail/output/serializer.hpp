@@ -20,6 +20,7 @@
 #include <fkYAML/detail/input/input_adapter.hpp>
 #include <fkYAML/detail/input/lexical_analyzer.hpp>
 #include <fkYAML/detail/meta/node_traits.hpp>
+#include <fkYAML/detail/node_string_accessor.hpp>
 #include <fkYAML/detail/types/node_t.hpp>
 #include <fkYAML/exception.hpp>
 
@@ -155,7 +156,8 @@ private:
             using string_type = typename BasicNodeType::string_type;
 
             // Check if the string value contains a character needed to be escaped on output.
-            const string_type& s = node.template get_value_ref<const string_type&>();
+            string_type buffer;
+            const string_type& s = node_string_accessor<BasicNodeType>::get(node, buffer);
             string_type escaped;
             bool has_escape = false;
             size_t size = s.size();
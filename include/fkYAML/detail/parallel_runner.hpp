@@ -0,0 +1,129 @@
+///  _______   __ __   __  _____   __  __  __
+/// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+/// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.2
+/// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+///
+/// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+/// SPDX-License-Identifier: MIT
+///
+/// @file
+
+#ifndef FK_YAML_DETAIL_PARALLEL_RUNNER_HPP_
+#define FK_YAML_DETAIL_PARALLEL_RUNNER_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include <fkYAML/detail/macros/version_macros.hpp>
+
+/// @brief namespace for fkYAML library.
+FK_YAML_NAMESPACE_BEGIN
+
+/// @brief namespace for internal implementations of fkYAML library.
+namespace detail
+{
+
+/// @brief Resolve the number of threads requested by users.
+/// @param num_threads The number of threads. 0 means the number of hardware threads.
+/// @return The number of threads to be used, which is at least 1.
+inline std::size_t resolve_num_threads(std::size_t num_threads) noexcept
+{
+    if (num_threads == 0)
+    {
+        num_threads = std::thread::hardware_concurrency();
+    }
+    return (num_threads == 0) ? 1 : num_threads;
+}
+
+/// @brief Run tasks on the calling thread and worker threads, each of which takes the next task whenever it's idle.
+/// @note
+/// Task indices are handed out in ascending order, so every task preceding a failed one is always run. This makes the
+/// rethrown exception the one from the first failed task regardless of thread scheduling. Tasks after a failed one may
+/// or may not be run.
+/// @tparam TaskType The type of a function which runs the task of a given index.
+/// @param num_tasks The number of tasks.
+/// @param num_threads The number of threads including the calling thread. 0 means the number of hardware threads.
+/// @param task A function which runs the task of a given index.
+template <typename TaskType>
+inline void run_parallel(std::size_t num_tasks, std::size_t num_threads, TaskType&& task)
+{
+    num_threads = resolve_num_threads(num_threads);
+    if (num_threads > num_tasks)
+    {
+        num_threads = num_tasks;
+    }
+
+    std::vector<std::exception_ptr> errors(num_tasks);
+    std::atomic<std::size_t> next_index {0};
+    std::atomic<std::size_t> first_error_index {num_tasks};
+    auto worker = [&]() {
+        while (true)
+        {
+            std::size_t index = next_index.fetch_add(1, std::memory_order_relaxed);
+            if (index >= first_error_index.load(std::memory_order_relaxed))
+            {
+                break;
+            }
+
+            try
+            {
+                task(index);
+            }
+            catch (...)
+            {
+                errors[index] = std::current_exception();
+
+                std::size_t expected = first_error_index.load(std::memory_order_relaxed);
+                while (index < expected && !first_error_index.compare_exchange_weak(expected, index))
+                {
+                }
+            }
+        }
+    };
+
+    if (num_threads <= 1)
+    {
+        worker();
+    }
+    else
+    {
+        // the calling thread works as one of the workers.
+        std::vector<std::thread> threads;
+        threads.reserve(num_threads - 1);
+        for (std::size_t i = 1; i < num_threads; i++)
+        {
+            try
+            {
+                threads.emplace_back(worker);
+            }
+            catch (const std::system_error& /*unused*/)
+            {
+                // continue with the threads which have successfully been started.
+                break;
+            }
+        }
+        worker();
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    for (auto& error : errors)
+    {
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+} // namespace detail
+
+FK_YAML_NAMESPACE_END
+
+#endif /* FK_YAML_DETAIL_PARALLEL_RUNNER_HPP_ */
@@ -0,0 +1,52 @@
+///  _______   __ __   __  _____   __  __  __
+/// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+/// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.2
+/// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+///
+/// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+/// SPDX-License-Identifier: MIT
+///
+/// @file
+
+#ifndef FK_YAML_DETAIL_TYPES_EDIT_OP_T_HPP_
+#define FK_YAML_DETAIL_TYPES_EDIT_OP_T_HPP_
+
+#include <cstdint>
+
+#include <fkYAML/detail/macros/version_macros.hpp>
+
+/// @brief namespace for fkYAML library.
+FK_YAML_NAMESPACE_BEGIN
+
+/// @brief namespace for internal implementations of fkYAML library.
+namespace detail
+{
+
+/// @brief Definition of edit operations in node patches.
+enum class edit_op_t : std::uint8_t
+{
+    ADD,     //!< add a value at a path
+    REMOVE,  //!< remove the value at a path
+    REPLACE, //!< replace the value at a path
+};
+
+inline const char* to_string(edit_op_t t) noexcept
+{
+    switch (t)
+    {
+    case edit_op_t::ADD:
+        return "add";
+    case edit_op_t::REMOVE:
+        return "remove";
+    case edit_op_t::REPLACE:
+        return "replace";
+    default:       // LCOV_EXCL_LINE
+        return ""; // LCOV_EXCL_LINE
+    }
+}
+
+} // namespace detail
+
+FK_YAML_NAMESPACE_END
+
+#endif /* FK_YAML_DETAIL_TYPES_EDIT_OP_T_HPP_ */
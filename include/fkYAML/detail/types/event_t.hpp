@@ -0,0 +1,70 @@
+///  _______   __ __   __  _____   __  __  __
+/// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+/// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.2
+/// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+///
+/// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+/// SPDX-License-Identifier: MIT
+///
+/// @file
+
+#ifndef FK_YAML_DETAIL_TYPES_EVENT_T_HPP_
+#define FK_YAML_DETAIL_TYPES_EVENT_T_HPP_
+
+#include <cstdint>
+
+#include <fkYAML/detail/macros/version_macros.hpp>
+
+/// @brief namespace for fkYAML library.
+FK_YAML_NAMESPACE_BEGIN
+
+/// @brief namespace for internal implementations of fkYAML library.
+namespace detail
+{
+
+/// @brief Definition of parse event types.
+enum class event_t : std::uint8_t
+{
+    START_DOCUMENT, //!< the beginning of a document
+    END_DOCUMENT,   //!< the end of a document
+    START_MAPPING,  //!< the beginning of a mapping
+    END_MAPPING,    //!< the end of a mapping
+    START_SEQUENCE, //!< the beginning of a sequence
+    END_SEQUENCE,   //!< the end of a sequence
+    SCALAR,         //!< a scalar
+    ALIAS,          //!< an alias
+    END_OF_STREAM,  //!< no more events
+};
+
+inline const char* to_string(event_t t) noexcept
+{
+    switch (t)
+    {
+    case event_t::START_DOCUMENT:
+        return "start_document";
+    case event_t::END_DOCUMENT:
+        return "end_document";
+    case event_t::START_MAPPING:
+        return "start_mapping";
+    case event_t::END_MAPPING:
+        return "end_mapping";
+    case event_t::START_SEQUENCE:
+        return "start_sequence";
+    case event_t::END_SEQUENCE:
+        return "end_sequence";
+    case event_t::SCALAR:
+        return "scalar";
+    case event_t::ALIAS:
+        return "alias";
+    case event_t::END_OF_STREAM:
+        return "end_of_stream";
+    default:       // LCOV_EXCL_LINE
+        return ""; // LCOV_EXCL_LINE
+    }
+}
+
+} // namespace detail
+
+FK_YAML_NAMESPACE_END
+
+#endif /* FK_YAML_DETAIL_TYPES_EVENT_T_HPP_ */
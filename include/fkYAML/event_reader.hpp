@@ -0,0 +1,424 @@
+///  _______   __ __   __  _____   __  __  __
+/// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+/// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.2
+/// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+///
+/// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+/// SPDX-License-Identifier: MIT
+///
+/// @file
+
+#ifndef FK_YAML_EVENT_READER_HPP_
+#define FK_YAML_EVENT_READER_HPP_
+
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <fkYAML/detail/macros/version_macros.hpp>
+#include <fkYAML/detail/conversions/from_string.hpp>
+#include <fkYAML/detail/input/input_adapter.hpp>
+#include <fkYAML/detail/input/sax_parser.hpp>
+#include <fkYAML/detail/meta/stl_supplement.hpp>
+#include <fkYAML/detail/types/event_t.hpp>
+#include <fkYAML/detail/types/node_t.hpp>
+#include <fkYAML/detail/types/yaml_version_t.hpp>
+
+/// @brief namespace for fkYAML library.
+FK_YAML_NAMESPACE_BEGIN
+
+/// @brief A pull parser which reads parse events of a YAML document one by one.
+/// @note
+/// The input is parsed only as far as needed to return the requested events, so reading can stop at any point without
+/// parsing the rest of the input. Scalars are not converted into values until requested with event::value(), and the
+/// scalars in skipped nodes are never even copied.
+/// @tparam BasicNodeType A basic_node template instance type which defines the types of scalar values.
+/// @sa https://fktn-k.github.io/fkYAML/api/event_reader/
+template <typename BasicNodeType>
+class basic_event_reader
+{
+public:
+    /// @brief Definition of parse event types.
+    using event_t = detail::event_t;
+    /// @brief A type for YAML specification versions.
+    using yaml_version_t = detail::yaml_version_t;
+    /// @brief A type for node value types.
+    using node_t = detail::node_t;
+
+    /// @brief A parse event.
+    struct event
+    {
+        /// The type of the event.
+        event_t type;
+        /// Whether the node which begins with this event is a mapping key.
+        bool is_key;
+        /// The type of the scalar value if the type is SCALAR, or NULL_OBJECT otherwise.
+        node_t scalar_type;
+        /// The text of the scalar if the type is SCALAR, or an empty string otherwise.
+        std::string text;
+        /// The anchor name attached to the scalar if the type is SCALAR, or the referenced one if ALIAS.
+        std::string anchor;
+        /// The YAML version of the document if the type is START_DOCUMENT.
+        yaml_version_t version;
+        /// The line of the token which caused the event.
+        std::size_t line;
+        /// The position in the line of the token which caused the event.
+        std::size_t indent;
+
+        /// @brief Convert the text of the scalar into a value.
+        /// @return The scalar value if the type is SCALAR, or null otherwise.
+        BasicNodeType value() const
+        {
+            using boolean_type = typename BasicNodeType::boolean_type;
+            using integer_type = typename BasicNodeType::integer_type;
+            using float_number_type = typename BasicNodeType::float_number_type;
+
+            switch (scalar_type)
+            {
+            case node_t::BOOLEAN:
+                return BasicNodeType(detail::from_string(text, detail::type_tag<boolean_type> {}));
+            case node_t::INTEGER:
+                return BasicNodeType(detail::from_string(text, detail::type_tag<integer_type> {}));
+            case node_t::FLOAT_NUMBER:
+                return BasicNodeType(detail::from_string(text, detail::type_tag<float_number_type> {}));
+            case node_t::STRING:
+                return BasicNodeType(text);
+            default:
+                return BasicNodeType();
+            }
+        }
+    };
+
+private:
+    /// @brief An event handler which stores events in a queue.
+    class event_queue
+    {
+    public:
+        /// @brief A type for the parser which reports events to this object.
+        using parser_type = detail::basic_sax_parser<BasicNodeType, event_queue>;
+        /// @brief A type for string scalar values.
+        using string_type = typename BasicNodeType::string_type;
+
+        /// @brief Handle the beginning of a document.
+        /// @param version The YAML version of the document.
+        /// @return true to continue parsing.
+        bool start_document(yaml_version_t version)
+        {
+            push(event_t::START_DOCUMENT).version = version;
+            return true;
+        }
+
+        /// @brief Handle the end of a document.
+        /// @return true to continue parsing.
+        bool end_document()
+        {
+            push(event_t::END_DOCUMENT);
+            return true;
+        }
+
+        /// @brief Handle the beginning of a mapping.
+        /// @return true to continue parsing.
+        bool start_mapping()
+        {
+            return start_container(event_t::START_MAPPING);
+        }
+
+        /// @brief Handle the end of a mapping.
+        /// @return true to continue parsing.
+        bool end_mapping()
+        {
+            return end_container(event_t::END_MAPPING);
+        }
+
+        /// @brief Handle the beginning of a sequence.
+        /// @return true to continue parsing.
+        bool start_sequence()
+        {
+            return start_container(event_t::START_SEQUENCE);
+        }
+
+        /// @brief Handle the end of a sequence.
+        /// @return true to continue parsing.
+        bool end_sequence()
+        {
+            return end_container(event_t::END_SEQUENCE);
+        }
+
+        /// @brief Handle the beginning of a mapping key.
+        /// @return true to continue parsing.
+        bool key()
+        {
+            if (skip_depth == 0)
+            {
+                is_key_pending = true;
+            }
+            return true;
+        }
+
+        /// @brief Handle a scalar whose text has not been converted into a value.
+        /// @param type The type of the scalar value.
+        /// @param text The text of the scalar, which is taken over by the event unless it's skipped.
+        /// @return true to continue parsing.
+        bool raw_scalar(node_t type, string_type& text)
+        {
+            if (skip_depth == 0)
+            {
+                // the text is taken over since the parser doesn't need it any longer.
+                event& e = push(event_t::SCALAR);
+                e.scalar_type = type;
+                e.text.swap(text);
+            }
+            return true;
+        }
+
+        /// @brief Handle an anchor name attached to the next node.
+        /// @param name An anchor name.
+        /// @return true to continue parsing.
+        bool anchor(const string_type& name)
+        {
+            if (skip_depth == 0)
+            {
+                anchor_name = name;
+            }
+            return true;
+        }
+
+        /// @brief Handle an alias to an anchored node.
+        /// @param name The referenced anchor name.
+        /// @return true to continue parsing.
+        bool alias(const string_type& name)
+        {
+            if (skip_depth == 0)
+            {
+                push(event_t::ALIAS).anchor = name;
+            }
+            return true;
+        }
+
+    private:
+        /// @brief Push an event which begins a container unless it's being skipped.
+        /// @param type START_MAPPING or START_SEQUENCE.
+        /// @return true to continue parsing.
+        bool start_container(event_t type)
+        {
+            if (skip_depth > 0)
+            {
+                ++skip_depth;
+                return true;
+            }
+            push(type);
+            return true;
+        }
+
+        /// @brief Push an event which ends a container unless it's being skipped.
+        /// @param type END_MAPPING or END_SEQUENCE.
+        /// @return true to continue parsing.
+        bool end_container(event_t type)
+        {
+            if (skip_depth > 0)
+            {
+                --skip_depth;
+                return true;
+            }
+            push(type);
+            return true;
+        }
+
+        /// @brief Push a new event with the pending key flag and anchor name.
+        /// @param type The type of the event.
+        /// @return Reference to the pushed event.
+        event& push(event_t type)
+        {
+            events.push_back(
+                {type,
+                 is_key_pending,
+                 node_t::NULL_OBJECT,
+                 std::string(),
+                 std::move(anchor_name),
+                 yaml_version_t::VER_1_2,
+                 p_parser->get_last_event_line(),
+                 p_parser->get_last_event_indent()});
+            is_key_pending = false;
+            anchor_name.clear();
+            return events.back();
+        }
+
+    public:
+        /// The events which have been parsed but not read yet.
+        std::deque<event> events {};
+        /// The depth of containers being skipped.
+        std::size_t skip_depth {0};
+        /// Whether the next event begins a mapping key.
+        bool is_key_pending {false};
+        /// The anchor name to be attached to the next scalar.
+        std::string anchor_name {};
+        /// The parser which reports events to this object.
+        const parser_type* p_parser {nullptr};
+    };
+
+    /// @brief A set of the event queue and the parser which fills it.
+    struct reader_state
+    {
+        /// @brief Construct a new reader_state object.
+        reader_state()
+            : parser(queue)
+        {
+            queue.p_parser = &parser;
+        }
+
+        /// The event queue.
+        event_queue queue;
+        /// The parser.
+        typename event_queue::parser_type parser;
+    };
+
+public:
+    /// @brief Construct a new basic_event_reader object for an input source.
+    /// @tparam InputType Type of a compatible input.
+    /// @param input An input source in the YAML format.
+    template <
+        typename InputType,
+        detail::enable_if_t<!std::is_same<detail::remove_cvref_t<InputType>, basic_event_reader>::value, int> = 0>
+    explicit basic_event_reader(InputType&& input)
+        : m_state(new reader_state())
+    {
+        m_state->parser.start(detail::input_adapter(std::forward<InputType>(input)));
+    }
+
+    /// @brief Construct a new basic_event_reader object for input iterators.
+    /// @tparam ItrType Type of a compatible iterator.
+    /// @param begin An iterator to the first element of an input sequence.
+    /// @param end An iterator to the past-the-last element of an input sequence.
+    template <typename ItrType>
+    basic_event_reader(ItrType&& begin, ItrType&& end)
+        : m_state(new reader_state())
+    {
+        m_state->parser.start(detail::input_adapter(std::forward<ItrType>(begin), std::forward<ItrType>(end)));
+    }
+
+public:
+    /// @brief Read the next event.
+    /// @return The next event, or an END_OF_STREAM event if the whole input has been read.
+    event next()
+    {
+        if (!fill())
+        {
+            return end_of_stream();
+        }
+
+        event e = std::move(m_state->queue.events.front());
+        m_state->queue.events.pop_front();
+        return e;
+    }
+
+    /// @brief Get the next event without reading it.
+    /// @return The next event, or an END_OF_STREAM event if the whole input has been read.
+    const event& peek()
+    {
+        if (!fill())
+        {
+            m_end_of_stream = end_of_stream();
+            return m_end_of_stream;
+        }
+        return m_state->queue.events.front();
+    }
+
+    /// @brief Skip the next node, including all the nodes in it if it's a container.
+    /// @note The contents of a skipped container are parsed but never stored as events.
+    /// @return true if a node has been skipped, false if the next event does not begin a node.
+    bool skip_value()
+    {
+        if (!fill())
+        {
+            return false;
+        }
+
+        std::deque<event>& events = m_state->queue.events;
+        switch (events.front().type)
+        {
+        case event_t::SCALAR:
+        case event_t::ALIAS:
+            events.pop_front();
+            return true;
+        case event_t::START_MAPPING:
+        case event_t::START_SEQUENCE:
+            break;
+        default:
+            return false;
+        }
+
+        // skip the events which have already been parsed first.
+        std::size_t depth = 0;
+        do
+        {
+            switch (events.front().type)
+            {
+            case event_t::START_MAPPING:
+            case event_t::START_SEQUENCE:
+                ++depth;
+                break;
+            case event_t::END_MAPPING:
+            case event_t::END_SEQUENCE:
+                --depth;
+                break;
+            default:
+                break;
+            }
+            events.pop_front();
+        } while (depth > 0 && !events.empty());
+
+        // then parse the rest of the container without storing its events.
+        m_state->queue.skip_depth = depth;
+        while (m_state->queue.skip_depth > 0 && m_state->parser.step())
+        {
+        }
+        return true;
+    }
+
+private:
+    /// @brief Parse the input until some event is available.
+    /// @return true if some event is available, false if the whole input has been read.
+    bool fill()
+    {
+        while (m_state->queue.events.empty() && m_state->parser.step())
+        {
+        }
+        return !m_state->queue.events.empty();
+    }
+
+    /// @brief Create an END_OF_STREAM event.
+    /// @return An END_OF_STREAM event.
+    event end_of_stream() const
+    {
+        return {
+            event_t::END_OF_STREAM,
+            false,
+            node_t::NULL_OBJECT,
+            std::string(),
+            std::string(),
+            yaml_version_t::VER_1_2,
+            m_state->parser.get_last_event_line(),
+            m_state->parser.get_last_event_indent()};
+    }
+
+private:
+    /// The parse states which must not be moved in memory.
+    std::unique_ptr<reader_state> m_state;
+    /// The END_OF_STREAM event returned from peek().
+    event m_end_of_stream {
+        event_t::END_OF_STREAM,
+        false,
+        node_t::NULL_OBJECT,
+        std::string(),
+        std::string(),
+        yaml_version_t::VER_1_2,
+        0,
+        0};
+};
+
+FK_YAML_NAMESPACE_END
+
+#endif /* FK_YAML_EVENT_READER_HPP_ */
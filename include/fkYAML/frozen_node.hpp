@@ -0,0 +1,308 @@
+///  _______   __ __   __  _____   __  __  __
+/// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+/// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.2
+/// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+///
+/// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+/// SPDX-License-Identifier: MIT
+///
+/// @file
+
+#ifndef FK_YAML_FROZEN_NODE_HPP_
+#define FK_YAML_FROZEN_NODE_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <fkYAML/detail/container_utils.hpp>
+#include <fkYAML/detail/frozen_document.hpp>
+#include <fkYAML/detail/frozen_document_builder.hpp>
+#include <fkYAML/detail/macros/version_macros.hpp>
+#include <fkYAML/detail/meta/stl_supplement.hpp>
+#include <fkYAML/detail/node_lookup_key.hpp>
+#include <fkYAML/detail/node_string_accessor.hpp>
+#include <fkYAML/detail/node_view_base.hpp>
+#include <fkYAML/detail/types/node_t.hpp>
+
+/// @brief namespace for fkYAML library.
+FK_YAML_NAMESPACE_BEGIN
+
+/// @brief A read-only view of a node in a frozen YAML document, which is stored in a few contiguous arrays.
+/// @note
+/// A frozen document keeps all the nodes in depth-first order in a single array, all the string values in a single
+/// buffer, and a minimal perfect hash index for each mapping. Looking up a key or an element therefore takes constant
+/// time without chasing pointers. All the views over a document share it, so a view stays valid even after the view
+/// it has been created from is destroyed. Tags and anchor names are not kept in frozen documents.
+/// @tparam BasicNodeType A basic_node template instance type to be created from the document.
+/// @sa https://fktn-k.github.io/fkYAML/api/frozen_node/
+template <typename BasicNodeType>
+class basic_frozen_node
+    : public detail::node_view_base<
+          basic_frozen_node<BasicNodeType>, BasicNodeType, detail::basic_frozen_document<BasicNodeType>>
+{
+    /** A type for frozen documents. */
+    using document_type = detail::basic_frozen_document<BasicNodeType>;
+    /** A type for the common implementation of views. */
+    using base_type = detail::node_view_base<basic_frozen_node, BasicNodeType, document_type>;
+    /** A type for document entries. */
+    using entry_type = typename document_type::entry;
+    /** A type for characters of string values. */
+    using typename base_type::char_type;
+
+    // the common implementation creates views and calls the document specific functions below.
+    friend base_type;
+
+public:
+    /** A type for node value types. */
+    using typename base_type::node_t;
+    /** A type for sequence node values. */
+    using typename base_type::sequence_type;
+    /** A type for mapping node values. */
+    using typename base_type::mapping_type;
+    /** A type for boolean node values. */
+    using typename base_type::boolean_type;
+    /** A type for integer node values. */
+    using typename base_type::integer_type;
+    /** A type for string node values. */
+    using typename base_type::string_type;
+
+    /// @brief Construct a new basic_frozen_node object which views the root of a frozen copy of the given node.
+    /// @param node A node to be frozen, including all the nodes in it.
+    explicit basic_frozen_node(const BasicNodeType& node)
+        : basic_frozen_node(detail::basic_frozen_document_builder<BasicNodeType>::build(node), 0)
+    {
+    }
+
+private:
+    /// @brief Construct a new basic_frozen_node object which views a node in a frozen document.
+    /// @param p_doc A frozen document.
+    /// @param index The index of the entry of the node.
+    basic_frozen_node(std::shared_ptr<const document_type> p_doc, std::size_t index)
+        : base_type(std::move(p_doc), index)
+    {
+    }
+
+    /// @brief Get the index of the entry which has the value of an entry. Frozen documents have no aliases.
+    /// @param index The index of an entry.
+    /// @return The given index.
+    std::size_t resolve_index(std::size_t index) const noexcept
+    {
+        return index;
+    }
+
+    /// @brief Get the index of an element in a sequence in constant time.
+    /// @param seq_index The index of the sequence entry.
+    /// @param pos The position of the target element, which must be less than the size of the sequence.
+    /// @return The index of the element entry.
+    std::size_t element_index(std::size_t seq_index, std::size_t pos) const noexcept
+    {
+        const std::size_t table = this->mp_storage->entries[seq_index].table;
+        if (table == document_type::npos)
+        {
+            // all the elements are scalars, which occupy a single entry each.
+            return seq_index + 1 + pos;
+        }
+        return this->mp_storage->elements[table + pos];
+    }
+
+    /// @brief Find the value associated with a key in a mapping in the document.
+    /// @tparam KeyType A basic_node, string or integer key type.
+    /// @param map_index The index of the mapping entry.
+    /// @param key A key to the target value.
+    /// @return The index of the value entry, or 0 if the key is not found.
+    template <typename KeyType>
+    std::size_t find_value(std::size_t map_index, const KeyType& key) const
+    {
+        const entry_type& e = this->mp_storage->entries[map_index];
+
+        if (e.table == document_type::npos)
+        {
+            // the keys of this mapping have not been indexed.
+            return this->find_value_linear(map_index, key);
+        }
+
+        const std::uint64_t hash = hash_key(key);
+        const std::ptrdiff_t displacement = this->mp_storage->displacements[e.table + hash % e.size];
+        if (displacement == 0)
+        {
+            return 0;
+        }
+
+        const std::size_t slot = (displacement < 0) ? static_cast<std::size_t>(-displacement - 1)
+                                                    : document_type::displaced_slot(hash, displacement, e.size);
+        const std::size_t key_index = this->mp_storage->slots[e.table + slot];
+        return this->key_equals(key_index, key) ? this->mp_storage->entries[key_index].next : 0;
+    }
+
+    /// @brief Calculate the hash value of a key in the same way as the keys in the document.
+    /// @param key A key to be hashed.
+    /// @return The hash value of the key.
+    static std::uint64_t hash_key(const BasicNodeType& key)
+    {
+        const node_t type = key.type();
+        switch (type)
+        {
+        case node_t::BOOLEAN:
+            return document_type::hash_key(type, key.template get_value_ref<const boolean_type&>() ? 1 : 0, nullptr, 0);
+        case node_t::INTEGER:
+            return document_type::hash_key(
+                type, static_cast<std::uint64_t>(key.template get_value_ref<const integer_type&>()), nullptr, 0);
+        case node_t::STRING: {
+            using accessor_type = detail::node_string_accessor<BasicNodeType>;
+            return document_type::hash_key(type, 0, accessor_type::data(key), accessor_type::size(key));
+        }
+        default:
+            return document_type::hash_key(type, 0, nullptr, 0);
+        }
+    }
+
+    /// @brief Calculate the hash value of a string key as if it were converted into a basic_node object.
+    /// @tparam KeyType A string key type.
+    /// @param key A string key to be hashed.
+    /// @return The hash value of the key.
+    template <
+        typename KeyType,
+        detail::enable_if_t<detail::is_string_lookup_key<BasicNodeType, KeyType>::value, int> = 0>
+    static std::uint64_t hash_key(const KeyType& key)
+    {
+        const detail::lookup_chars<char_type> chars = detail::get_lookup_chars<char_type>(key);
+        return document_type::hash_key(node_t::STRING, 0, chars.p_begin, chars.size);
+    }
+
+    /// @brief Calculate the hash value of an integer key as if it were converted into a basic_node object.
+    /// @tparam KeyType An integer key type.
+    /// @param key An integer key to be hashed.
+    /// @return The hash value of the key.
+    template <
+        typename KeyType,
+        detail::enable_if_t<detail::is_integer_lookup_key<BasicNodeType, KeyType>::value, int> = 0>
+    static std::uint64_t hash_key(const KeyType& key)
+    {
+        return document_type::hash_key(
+            node_t::INTEGER, static_cast<std::uint64_t>(static_cast<integer_type>(key)), nullptr, 0);
+    }
+
+    /// @brief Create a basic_node object from an entry. Children are not created.
+    /// @param index The index of the entry.
+    /// @return The created basic_node object.
+    BasicNodeType create_shallow(std::size_t index) const
+    {
+        const entry_type& e = this->mp_storage->entries[index];
+
+        BasicNodeType node;
+        switch (e.type)
+        {
+        case node_t::SEQUENCE:
+            node = BasicNodeType::sequence();
+            detail::reserve_if_possible(node.template get_value_ref<sequence_type&>(), e.size);
+            break;
+        case node_t::MAPPING:
+            node = BasicNodeType::mapping();
+            detail::reserve_if_possible(node.template get_value_ref<mapping_type&>(), e.size);
+            break;
+        case node_t::NULL_OBJECT:
+            break;
+        case node_t::BOOLEAN:
+            node = BasicNodeType(e.value.boolean);
+            break;
+        case node_t::INTEGER:
+            node = BasicNodeType(e.value.integer);
+            break;
+        case node_t::FLOAT_NUMBER:
+            node = BasicNodeType(e.value.float_val);
+            break;
+        case node_t::STRING:
+            node = BasicNodeType(string_type(this->mp_storage->strings, e.value.position, e.size));
+            break;
+        }
+
+        node.set_yaml_version(this->mp_storage->version);
+        return node;
+    }
+
+    /// @brief Create a basic_node object from an entry, including all the nodes in it, without recursion.
+    /// @note Keys which are containers are created with separate calls of this function.
+    /// @param index The index of the entry.
+    /// @return The created basic_node object.
+    BasicNodeType materialize_entry(std::size_t index) const
+    {
+        BasicNodeType root = create_shallow(index);
+        if (root.is_scalar())
+        {
+            return root;
+        }
+
+        std::vector<std::pair<std::size_t, BasicNodeType*>> stack;
+        stack.emplace_back(index, &root);
+
+        while (!stack.empty())
+        {
+            const std::size_t container_index = stack.back().first;
+            BasicNodeType& container = *stack.back().second;
+            stack.pop_back();
+
+            const std::size_t end = this->mp_storage->entries[container_index].next;
+            if (container.is_sequence())
+            {
+                sequence_type& seq = container.template get_value_ref<sequence_type&>();
+                for (std::size_t i = container_index + 1; i != end; i = this->mp_storage->entries[i].next)
+                {
+                    seq.push_back(create_shallow(i));
+                }
+
+                // the elements are never moved from here on.
+                auto itr = seq.begin();
+                for (std::size_t i = container_index + 1; i != end; i = this->mp_storage->entries[i].next, ++itr)
+                {
+                    if (!itr->is_scalar())
+                    {
+                        stack.emplace_back(i, &*itr);
+                    }
+                }
+                continue;
+            }
+
+            // the keys are unique and in the iteration order of the mapping the document has been frozen from.
+            mapping_type& map = container.template get_value_ref<mapping_type&>();
+            for (std::size_t i = container_index + 1; i != end;)
+            {
+                const std::size_t value_index = this->mp_storage->entries[i].next;
+                detail::append_mapping_entry(map, materialize_entry(i), create_shallow(value_index));
+                i = this->mp_storage->entries[value_index].next;
+            }
+
+            if (detail::is_unordered_mapping<mapping_type>::value)
+            {
+                // hash-based mappings may iterate the entries in a different order.
+                for (auto& map_entry : map)
+                {
+                    if (!map_entry.second.is_scalar())
+                    {
+                        stack.emplace_back(find_value(container_index, map_entry.first), &map_entry.second);
+                    }
+                }
+                continue;
+            }
+
+            auto itr = map.begin();
+            for (std::size_t i = container_index + 1; i != end; ++itr)
+            {
+                const std::size_t value_index = this->mp_storage->entries[i].next;
+                if (!itr->second.is_scalar())
+                {
+                    stack.emplace_back(value_index, &itr->second);
+                }
+                i = this->mp_storage->entries[value_index].next;
+            }
+        }
+
+        return root;
+    }
+};
+
+FK_YAML_NAMESPACE_END
+
+#endif /* FK_YAML_FROZEN_NODE_HPP_ */
@@ -0,0 +1,122 @@
+///  _______   __ __   __  _____   __  __  __
+/// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+/// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.2
+/// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+///
+/// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+/// SPDX-License-Identifier: MIT
+///
+/// @file
+
+#ifndef FK_YAML_KEY_INTERNER_HPP_
+#define FK_YAML_KEY_INTERNER_HPP_
+
+#include <cstddef>
+#include <functional>
+#include <unordered_map>
+#include <utility>
+
+#include <fkYAML/detail/macros/version_macros.hpp>
+#include <fkYAML/detail/cow_container.hpp>
+
+/// @brief namespace for fkYAML library.
+FK_YAML_NAMESPACE_BEGIN
+
+/// @brief A pool of mapping key strings which lets equal keys share one immutable string object.
+/// @note
+/// The interned strings are reference-counted, so nodes created with an interner stay valid after the interner is
+/// cleared or destroyed. An interner can be shared across deserializations, but not across threads.
+/// @tparam StringType A type for strings to be interned.
+/// @sa https://fktn-k.github.io/fkYAML/api/key_interner/
+template <typename StringType>
+class basic_key_interner
+{
+public:
+    /// A type for interned strings.
+    using string_type = StringType;
+    /// A type for shared pointers to interned strings.
+    using pointer = detail::cow_pointer<string_type>;
+
+private:
+    /// @brief A hash function object for strings referenced by pointers.
+    struct deref_hash
+    {
+        std::size_t operator()(const string_type* p_str) const
+        {
+            return std::hash<string_type>()(*p_str);
+        }
+    };
+
+    /// @brief An equality function object for strings referenced by pointers.
+    struct deref_equal
+    {
+        bool operator()(const string_type* lhs, const string_type* rhs) const
+        {
+            return *lhs == *rhs;
+        }
+    };
+
+public:
+    /// @brief Get the interned string equal to the given one, registering it if not yet.
+    /// @param str A string to be interned. It is moved from only if it is registered as a new one.
+    /// @return The shared pointer to the interned string.
+    pointer intern(string_type&& str)
+    {
+        auto itr = m_strings.find(&str);
+        if (itr != m_strings.end())
+        {
+            return itr->second;
+        }
+
+        pointer p_str = pointer::create(std::move(str));
+        m_strings.emplace(p_str.get(), p_str);
+        return p_str;
+    }
+
+    /// @brief Get the interned string equal to the given one, registering a copy of it if not yet.
+    /// @param str A string to be interned.
+    /// @return The shared pointer to the interned string.
+    pointer intern(const string_type& str)
+    {
+        auto itr = m_strings.find(&str);
+        if (itr != m_strings.end())
+        {
+            return itr->second;
+        }
+
+        pointer p_str = pointer::create(str);
+        m_strings.emplace(p_str.get(), p_str);
+        return p_str;
+    }
+
+    /// @brief Find the interned string equal to the given one without registering it.
+    /// @param str A string to be searched for.
+    /// @return The shared pointer to the interned string if found, nullptr otherwise.
+    pointer find(const string_type& str) const
+    {
+        auto itr = m_strings.find(&str);
+        return (itr != m_strings.end()) ? itr->second : nullptr;
+    }
+
+    /// @brief Get the number of the interned strings.
+    /// @return The number of the interned strings.
+    std::size_t size() const noexcept
+    {
+        return m_strings.size();
+    }
+
+    /// @brief Release all the interned strings held by this interner.
+    /// @note Nodes which have been created with the interned strings are not affected.
+    void clear() noexcept
+    {
+        m_strings.clear();
+    }
+
+private:
+    /// The interned strings, indexed by their contents.
+    std::unordered_map<const string_type*, pointer, deref_hash, deref_equal> m_strings {};
+};
+
+FK_YAML_NAMESPACE_END
+
+#endif /* FK_YAML_KEY_INTERNER_HPP_ */
@@ -0,0 +1,179 @@
+///  _______   __ __   __  _____   __  __  __
+/// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+/// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.2
+/// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+///
+/// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+/// SPDX-License-Identifier: MIT
+///
+/// @file
+
+#ifndef FK_YAML_LAZY_NODE_HPP_
+#define FK_YAML_LAZY_NODE_HPP_
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+#include <fkYAML/detail/macros/version_macros.hpp>
+#include <fkYAML/detail/node_tape.hpp>
+#include <fkYAML/detail/node_view_base.hpp>
+#include <fkYAML/detail/types/node_t.hpp>
+
+/// @brief namespace for fkYAML library.
+FK_YAML_NAMESPACE_BEGIN
+
+/// @brief A read-only view of a node in a deserialized YAML document, which creates basic_node objects on demand.
+/// @note
+/// A deserialized document is kept as a flat tape of fixed-size entries, and no basic_node objects are created until
+/// a value is requested with get_value() or materialize(). All the views over a document share its tape, so a view
+/// stays valid even after the view it has been created from is destroyed. Aliases are viewed as the anchored nodes.
+/// @tparam BasicNodeType A basic_node template instance type to be created from the tape.
+/// @sa https://fktn-k.github.io/fkYAML/api/lazy_node/
+template <typename BasicNodeType>
+class basic_lazy_node
+    : public detail::node_view_base<
+          basic_lazy_node<BasicNodeType>, BasicNodeType, detail::basic_node_tape<BasicNodeType>>
+{
+    /** A type for node tapes. */
+    using tape_type = detail::basic_node_tape<BasicNodeType>;
+    /** A type for the common implementation of views. */
+    using base_type = detail::node_view_base<basic_lazy_node, BasicNodeType, tape_type>;
+    /** A type for tape entries. */
+    using entry_type = typename tape_type::entry;
+
+    // the common implementation creates views and calls the tape specific functions below.
+    friend base_type;
+
+public:
+    /** A type for node value types. */
+    using typename base_type::node_t;
+    /** A type for sequence node values. */
+    using typename base_type::sequence_type;
+    /** A type for mapping node values. */
+    using typename base_type::mapping_type;
+    /** A type for string node values. */
+    using typename base_type::string_type;
+
+    /// @brief Construct a new basic_lazy_node object which views the root node of a tape.
+    /// @param p_tape A tape of a deserialized YAML document.
+    explicit basic_lazy_node(std::shared_ptr<const tape_type> p_tape)
+        : basic_lazy_node(std::move(p_tape), 0)
+    {
+    }
+
+private:
+    /// @brief Construct a new basic_lazy_node object which views a node in a tape.
+    /// @param p_tape A tape of a deserialized YAML document.
+    /// @param index The index of the entry of the node.
+    basic_lazy_node(std::shared_ptr<const tape_type> p_tape, std::size_t index)
+        : base_type(std::move(p_tape), index)
+    {
+    }
+
+public:
+    /// @brief Test whether the viewed node is an alias.
+    /// @return true if the viewed node is an alias, false otherwise.
+    bool is_alias() const noexcept
+    {
+        return this->mp_storage->entries[this->m_index].is_alias;
+    }
+
+private:
+    /// @brief Get the index of the entry which has the value of an entry, i.e., the anchored one for an alias.
+    /// @param index The index of an entry.
+    /// @return The index of the entry which has the value of the entry.
+    std::size_t resolve_index(std::size_t index) const noexcept
+    {
+        const entry_type& e = this->mp_storage->entries[index];
+        return e.is_alias ? e.value.position : index;
+    }
+
+    /// @brief Get the index of an element in a sequence by walking through the preceding elements.
+    /// @param seq_index The index of the sequence entry.
+    /// @param pos The position of the target element, which must be less than the size of the sequence.
+    /// @return The index of the element entry.
+    std::size_t element_index(std::size_t seq_index, std::size_t pos) const noexcept
+    {
+        std::size_t index = seq_index + 1;
+        for (std::size_t i = 0; i < pos; i++)
+        {
+            index = this->mp_storage->entries[index].next;
+        }
+        return index;
+    }
+
+    /// @brief Find the value associated with a key in a mapping in the tape.
+    /// @tparam KeyType A basic_node, string or integer key type.
+    /// @param map_index The index of the mapping entry.
+    /// @param key A key to the target value.
+    /// @return The index of the value entry, or 0 if the key is not found.
+    template <typename KeyType>
+    std::size_t find_value(std::size_t map_index, const KeyType& key) const
+    {
+        return this->find_value_linear(map_index, key);
+    }
+
+    /// @brief Create a basic_node object from an entry, including all the nodes in it.
+    /// @param index The index of the entry.
+    /// @return The created basic_node object.
+    BasicNodeType materialize_entry(std::size_t index) const
+    {
+        const entry_type& e = this->mp_storage->entries[index];
+        if (e.is_alias)
+        {
+            return BasicNodeType::alias_of(materialize_entry(e.value.position));
+        }
+
+        BasicNodeType node;
+        switch (e.type)
+        {
+        case node_t::SEQUENCE: {
+            node = BasicNodeType::sequence();
+            sequence_type& seq = node.template get_value_ref<sequence_type&>();
+            seq.reserve(e.size);
+            for (std::size_t i = index + 1; i != e.next; i = this->mp_storage->entries[i].next)
+            {
+                seq.emplace_back(materialize_entry(i));
+            }
+            break;
+        }
+        case node_t::MAPPING: {
+            node = BasicNodeType::mapping();
+            mapping_type& map = node.template get_value_ref<mapping_type&>();
+            for (std::size_t i = index + 1; i != e.next;)
+            {
+                std::size_t value_index = this->mp_storage->entries[i].next;
+                map.emplace(materialize_entry(i), materialize_entry(value_index));
+                i = this->mp_storage->entries[value_index].next;
+            }
+            break;
+        }
+        case node_t::NULL_OBJECT:
+            break;
+        case node_t::BOOLEAN:
+            node = BasicNodeType(e.value.boolean);
+            break;
+        case node_t::INTEGER:
+            node = BasicNodeType(e.value.integer);
+            break;
+        case node_t::FLOAT_NUMBER:
+            node = BasicNodeType(e.value.float_val);
+            break;
+        case node_t::STRING:
+            node = BasicNodeType(string_type(this->mp_storage->strings, e.value.position, e.size));
+            break;
+        }
+
+        if (e.anchor != 0)
+        {
+            node.add_anchor_name(this->mp_storage->anchor_names[e.anchor - 1]);
+        }
+        node.set_yaml_version(this->mp_storage->version);
+        return node;
+    }
+};
+
+FK_YAML_NAMESPACE_END
+
+#endif /* FK_YAML_LAZY_NODE_HPP_ */
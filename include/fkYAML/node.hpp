@@ -12,6 +12,7 @@
 #define FK_YAML_NODE_HPP_
 
 #include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <initializer_list>
@@ -19,24 +20,45 @@
 #include <memory>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
 #include <vector>
 
 #include <fkYAML/detail/macros/version_macros.hpp>
 #include <fkYAML/detail/assert.hpp>
+#include <fkYAML/detail/container_utils.hpp>
+#include <fkYAML/detail/cow_container.hpp>
 #include <fkYAML/detail/input/deserializer.hpp>
 #include <fkYAML/detail/input/input_adapter.hpp>
+#include <fkYAML/detail/input/parallel_deserializer.hpp>
+#include <fkYAML/detail/input/sax_handler.hpp>
+#include <fkYAML/detail/input/sax_parser.hpp>
 #include <fkYAML/detail/iterator.hpp>
 #include <fkYAML/detail/meta/node_traits.hpp>
 #include <fkYAML/detail/meta/stl_supplement.hpp>
 #include <fkYAML/detail/meta/type_traits.hpp>
+#include <fkYAML/detail/node_compactor.hpp>
+#include <fkYAML/detail/node_comparator.hpp>
+#include <fkYAML/detail/node_hash.hpp>
+#include <fkYAML/detail/node_lookup_key.hpp>
+#include <fkYAML/detail/node_parallelizer.hpp>
 #include <fkYAML/detail/node_property.hpp>
 #include <fkYAML/detail/node_ref_storage.hpp>
+#include <fkYAML/detail/node_string_accessor.hpp>
 #include <fkYAML/detail/output/serializer.hpp>
 #include <fkYAML/detail/types/node_t.hpp>
 #include <fkYAML/detail/types/yaml_version_t.hpp>
+#include <fkYAML/event_reader.hpp>
 #include <fkYAML/exception.hpp>
+#include <fkYAML/frozen_node.hpp>
+#include <fkYAML/key_interner.hpp>
+#include <fkYAML/lazy_node.hpp>
+#include <fkYAML/node_patch.hpp>
+#include <fkYAML/node_path.hpp>
+#include <fkYAML/node_reclaimer.hpp>
+#include <fkYAML/node_visitor.hpp>
 #include <fkYAML/node_value_converter.hpp>
 #include <fkYAML/ordered_map.hpp>
+#include <fkYAML/parser.hpp>
 
 /// @brief namespace for fkYAML library.
 FK_YAML_NAMESPACE_BEGIN
@@ -64,7 +86,8 @@ public:
     using sequence_type = SequenceType<basic_node, std::allocator<basic_node>>;
 
     /// @brief A type for mapping basic_node values.
-    /// @note std::unordered_map is not supported since it does not allow incomplete types.
+    /// @note Hash-based mappings like std::unordered_map are supported with the std::hash specialization for
+    /// basic_node.
     /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/mapping_type/
     using mapping_type = MappingType<basic_node, basic_node>;
 
@@ -97,30 +120,79 @@ public:
     /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/yaml_version_t/
     using yaml_version_t = detail::yaml_version_t;
 
+    /// @brief An interface of handlers for parse events.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/sax_handler_type/
+    using sax_handler_type = detail::basic_sax_handler<basic_node>;
+
+    /// @brief A type for pools of mapping key strings shared by nodes.
+    /// @sa https://fktn-k.github.io/fkYAML/api/key_interner/
+    using key_interner_type = basic_key_interner<string_type>;
+
 private:
     template <node_t>
     friend struct fkyaml::detail::external_node_constructor;
 
+    template <typename>
+    friend struct fkyaml::detail::node_hash;
+
+    template <typename>
+    friend class fkyaml::detail::basic_node_comparator;
+
+    template <typename>
+    friend class fkyaml::detail::basic_node_parallelizer;
+
+    template <typename>
+    friend struct fkyaml::detail::node_string_accessor;
+
+    template <typename>
+    friend class fkyaml::detail::basic_node_compactor;
+
     /// @brief A type for YAML docs deserializers.
     using deserializer_type = detail::basic_deserializer<basic_node>;
+    /// @brief A type for shared pointers to interned strings.
+    using shared_string_pointer = typename key_interner_type::pointer;
+    /// @brief A type for characters of string node values.
+    using char_type = detail::string_char_type_t<string_type>;
+    /// @brief A type for copy-on-write sequence containers.
+    using cow_sequence_type = detail::cow_container<sequence_type>;
+    /// @brief A type for copy-on-write mapping containers.
+    using cow_mapping_type = detail::cow_container<mapping_type>;
+    /// @brief A type for deserializers of multiple YAML docs in parallel.
+    using parallel_deserializer_type = detail::basic_parallel_deserializer<basic_node>;
     /// @brief A type for YAML docs serializers.
     using serializer_type = detail::basic_serializer<basic_node>;
+    /// @brief A type for the optional properties of nodes.
+    using property_type = detail::node_property<string_type>;
     /// @brief A helper type alias for std::initializer_list.
     using initializer_list_t = std::initializer_list<detail::node_ref_storage<basic_node>>;
 
-    /// @brief The actual storage for a YAML node value of the @ref basic_node class.
-    /// @details This union combines the different sotrage types for the YAML value types defined in @ref node_t.
-    /// @note Container types are stored as pointers so that the size of this union will not exceed 64 bits by
-    /// default.
-    union node_value
+    /// @brief The actual storage for a YAML node value and the attributes of the @ref basic_node class.
+    /// @details The anonymous union combines the different storage types for the YAML value types defined in @ref
+    /// node_t.
+    /// @note Container types and long strings are stored as pointers so that the size of the union will not exceed 64
+    /// bits by default. A short string is stored in place instead, in the bytes from the beginning of this object up
+    /// to the size of the string, so that it can be stored without any heap allocation. A string interned with a key
+    /// interner is shared with other nodes. Containers can also be shared as copy-on-write ones, which are pointed to
+    /// by the same pointers. This object takes 16 bytes with 64-bit values.
+    struct node_value
     {
         /// @brief Constructs a new basic_node Value object for null types.
-        node_value() = default;
+        node_value() noexcept
+            : p_mapping(nullptr)
+        {
+        }
+
+        /// @brief Destroys the node_value object. The actual value must be destroyed with destroy() beforehand.
+        ~node_value() noexcept
+        {
+        }
 
         /// @brief Constructs a new basic_node value object with a node type. The default value for the specified
         /// type will be assigned.
         /// @param[in] type A node type.
         explicit node_value(node_t type)
+            : p_mapping(nullptr),
+              attrs(type)
         {
             switch (type)
             {
@@ -131,7 +203,6 @@ private:
                 p_mapping = create_object<mapping_type>();
                 break;
             case node_t::NULL_OBJECT:
-                p_mapping = nullptr;
                 break;
             case node_t::BOOLEAN:
                 boolean = static_cast<boolean_type>(false);
@@ -143,89 +214,481 @@ private:
                 float_val = static_cast<float_number_type>(0.0);
                 break;
             case node_t::STRING:
+                // the default value is constructed with the default constructor of string_type, which may throw.
                 p_string = create_object<string_type>();
+                small_size = heap_string;
                 break;
             }
         }
 
-        /// @brief Destroys the existing Node value. This process is recursive if the specified node type is for
-        /// containers.
-        /// @param[in] type A Node type to determine the value to be destroyed.
-        void destroy(node_t type)
+        /// @brief Gets the maximum number of characters of a string which can be stored in place.
+        /// @return The maximum number of characters stored in place.
+        static constexpr std::size_t small_capacity() noexcept
         {
-            if (type == node_t::SEQUENCE || type == node_t::MAPPING)
+            return offsetof(node_value, small_size) / sizeof(char_type);
+        }
+
+        /// @brief Constructs a string value with the given characters, which is stored in place if it's short enough.
+        /// @param[in] p_chars The first character.
+        /// @param[in] size The number of characters.
+        void construct_string(const char_type* p_chars, std::size_t size)
+        {
+            if (size <= small_capacity())
+            {
+                std::char_traits<char_type>::copy(small_data(), p_chars, size);
+                small_size = static_cast<std::uint8_t>(size);
+            }
+            else
+            {
+                p_string = create_object<string_type>(p_chars, size);
+                small_size = heap_string;
+            }
+        }
+
+        /// @brief Constructs a string value with the given string, which is stored in place if it's short enough.
+        /// @param[in] str A string.
+        void construct_string(const string_type& str)
+        {
+            construct_string(str.data(), str.size());
+        }
+
+        /// @brief Constructs a string value with the given string, which is stored in place if it's short enough.
+        /// @param[in] str A string to be moved from if it's stored on the heap.
+        void construct_string(string_type&& str)
+        {
+            if (str.size() <= small_capacity())
+            {
+                construct_string(str.data(), str.size());
+            }
+            else
+            {
+                p_string = create_object<string_type>(std::move(str));
+                small_size = heap_string;
+            }
+        }
+
+        /// @brief Constructs a shared string value in place.
+        /// @param[in] p_str A shared pointer to an interned string.
+        void construct_shared_string(shared_string_pointer&& p_str) noexcept
+        {
+            ::new (static_cast<void*>(std::addressof(p_shared_str))) shared_string_pointer(std::move(p_str));
+        }
+
+        /// @brief Checks whether the string value is stored in place.
+        /// @warning Make sure the value is a string before calling this function.
+        /// @return true if the string value is stored in place, false otherwise.
+        bool is_small_string() const noexcept
+        {
+            return !attrs.is_shared() && small_size != heap_string;
+        }
+
+        /// @brief Gets the first character of the string value.
+        /// @warning Make sure the value is a string before calling this function.
+        /// @return The pointer to the first character of the string value.
+        const char_type* string_data() const noexcept
+        {
+            if (attrs.is_shared())
+            {
+                return p_shared_str->data();
+            }
+            return (small_size == heap_string) ? p_string->data() : small_data();
+        }
+
+        /// @brief Gets the number of characters of the string value.
+        /// @warning Make sure the value is a string before calling this function.
+        /// @return The number of characters of the string value.
+        std::size_t string_size() const noexcept
+        {
+            if (attrs.is_shared())
+            {
+                return p_shared_str->size();
+            }
+            return (small_size == heap_string) ? p_string->size() : small_size;
+        }
+
+        /// @brief Gets the string value as a string object which is owned by this value and can be modified.
+        /// @note A shared string is copied and a string stored in place is moved to the heap for the first time.
+        /// @warning Make sure the value is a string before calling this function.
+        /// @return Reference to the string value.
+        string_type& get_owned_string()
+        {
+            if (attrs.is_shared())
+            {
+                // the shared string must not be modified, so a copy of it is stored in this value instead.
+                string_type* p_copied = create_object<string_type>(*p_shared_str);
+                p_shared_str.~shared_string_pointer();
+                p_string = p_copied;
+                attrs.set_shared(false);
+                small_size = heap_string;
+            }
+            else if (small_size != heap_string)
             {
-                std::vector<basic_node> stack;
+                // the characters stored in place are overwritten with the pointer.
+                string_type* p_moved = create_object<string_type>(small_data(), small_size);
+                p_string = p_moved;
+                small_size = heap_string;
+            }
+            return *p_string;
+        }
+
+        /// @brief Moves a value from another node_value object, which will be a null value.
+        /// @param[in] rhs A node_value object to be moved from.
+        void move_from(node_value& rhs) noexcept
+        {
+            attrs = rhs.attrs;
+            small_size = rhs.small_size;
 
-                if (type == node_t::SEQUENCE)
+            switch (attrs.type())
+            {
+            case node_t::SEQUENCE:
+                FK_YAML_ASSERT(rhs.p_sequence != nullptr);
+                p_sequence = rhs.p_sequence;
+                break;
+            case node_t::MAPPING:
+                FK_YAML_ASSERT(rhs.p_mapping != nullptr);
+                p_mapping = rhs.p_mapping;
+                break;
+            case node_t::NULL_OBJECT:
+                FK_YAML_ASSERT(rhs.p_mapping == nullptr);
+                p_mapping = nullptr;
+                break;
+            case node_t::BOOLEAN:
+                boolean = rhs.boolean;
+                break;
+            case node_t::INTEGER:
+                integer = rhs.integer;
+                break;
+            case node_t::FLOAT_NUMBER:
+                float_val = rhs.float_val;
+                break;
+            case node_t::STRING:
+                if (attrs.is_shared())
+                {
+                    construct_shared_string(std::move(rhs.p_shared_str));
+                    rhs.p_shared_str.~shared_string_pointer();
+                }
+                else if (small_size == heap_string)
                 {
-                    stack.reserve(p_sequence->size());
-                    std::move(p_sequence->begin(), p_sequence->end(), std::back_inserter(stack));
+                    p_string = rhs.p_string;
                 }
                 else
                 {
-                    stack.reserve(p_mapping->size());
-                    for (auto&& it : *p_mapping)
-                    {
-                        stack.push_back(std::move(it.second));
-                    }
+                    std::char_traits<char_type>::copy(small_data(), rhs.small_data(), small_size);
                 }
+                break;
+            }
 
-                while (!stack.empty())
-                {
-                    basic_node current_node(std::move(stack.back()));
-                    stack.pop_back();
+            rhs.p_mapping = nullptr;
+            rhs.small_size = 0;
+            rhs.attrs = detail::node_attrs();
+        }
 
-                    if (current_node.is_sequence())
-                    {
-                        std::move(
-                            current_node.m_node_value.p_sequence->begin(),
-                            current_node.m_node_value.p_sequence->end(),
-                            std::back_inserter(stack));
-                        current_node.m_node_value.p_sequence->clear();
-                    }
-                    else if (current_node.is_mapping())
-                    {
-                        for (auto&& it : *current_node.m_node_value.p_mapping)
-                        {
-                            stack.push_back(std::move(it.second));
-                        }
-                        current_node.m_node_value.p_mapping->clear();
-                    }
+        /// @brief Destroys the existing Node value. Nested containers are destroyed without recursion.
+        /// @note The attributes are left as they are.
+        void destroy()
+        {
+            node_t type = attrs.type();
+            if ((type == node_t::SEQUENCE || type == node_t::MAPPING) && attrs.is_shared() && !release())
+            {
+                // the container is still referenced by other nodes.
+                p_mapping = nullptr;
+                return;
+            }
+
+            if (type == node_t::SEQUENCE || type == node_t::MAPPING)
+            {
+                // the containers owned by the children are detached and chained through their own elements, so that
+                // every container is flat by the time it's destroyed. Nothing is allocated for the chain.
+                basic_node pending;
+                move_nested_containers(*this, type, pending);
+
+                while (!pending.is_null())
+                {
+                    basic_node current_node(std::move(pending));
+                    node_value& current_value = current_node.m_node_value;
+                    pending = std::move(chain_slot(current_value));
+                    move_nested_containers(current_value, current_value.attrs.type(), pending);
                 }
             }
 
             switch (type)
             {
             case node_t::SEQUENCE:
-                destroy_object<sequence_type>(p_sequence);
+                if (attrs.is_shared())
+                {
+                    destroy_object<cow_sequence_type>(static_cast<cow_sequence_type*>(p_sequence));
+                }
+                else
+                {
+                    destroy_object<sequence_type>(p_sequence);
+                }
                 p_sequence = nullptr;
                 break;
             case node_t::MAPPING:
-                destroy_object<mapping_type>(p_mapping);
+                if (attrs.is_shared())
+                {
+                    destroy_object<cow_mapping_type>(static_cast<cow_mapping_type*>(p_mapping));
+                }
+                else
+                {
+                    destroy_object<mapping_type>(p_mapping);
+                }
                 p_mapping = nullptr;
                 break;
             case node_t::STRING:
-                destroy_object<string_type>(p_string);
-                p_string = nullptr;
+                if (attrs.is_shared())
+                {
+                    p_shared_str.~shared_string_pointer();
+                }
+                else if (small_size == heap_string)
+                {
+                    destroy_object<string_type>(p_string);
+                }
+                p_mapping = nullptr;
+                small_size = 0;
+                break;
+            default:
+                break;
+            }
+        }
+
+        /// @brief Adds a reference to the copy-on-write container.
+        /// @warning Make sure the value is a copy-on-write container before calling this function.
+        void add_ref() noexcept
+        {
+            if (attrs.type() == node_t::SEQUENCE)
+            {
+                static_cast<cow_sequence_type*>(p_sequence)->add_ref();
+            }
+            else
+            {
+                static_cast<cow_mapping_type*>(p_mapping)->add_ref();
+            }
+        }
+
+        /// @brief Releases a reference to the copy-on-write container.
+        /// @warning Make sure the value is a copy-on-write container before calling this function.
+        /// @return true if the released reference was the last one, false otherwise.
+        bool release() noexcept
+        {
+            return (attrs.type() == node_t::SEQUENCE) ? static_cast<cow_sequence_type*>(p_sequence)->release()
+                                                      : static_cast<cow_mapping_type*>(p_mapping)->release();
+        }
+
+        /// @brief Checks whether the container is referenced only by the node which has it.
+        /// @return true if the value is a container not shared with other nodes, false otherwise.
+        bool is_exclusive() const noexcept
+        {
+            switch (attrs.type())
+            {
+            case node_t::SEQUENCE:
+                return !attrs.is_shared() || static_cast<const cow_sequence_type*>(p_sequence)->is_unique();
+            case node_t::MAPPING:
+                return !attrs.is_shared() || static_cast<const cow_mapping_type*>(p_mapping)->is_unique();
+            default:
+                return false;
+            }
+        }
+
+        /// @brief Checks whether the node owns a non-empty container, which is destroyed recursively by default.
+        /// @param[in] node A node to be checked.
+        /// @return true if the node owns a non-empty container, false otherwise.
+        static bool owns_nested_container(const basic_node& node) noexcept
+        {
+            if (!node.m_node_value.is_exclusive())
+            {
+                // a copy-on-write container referenced by other nodes must be left as it is.
+                return false;
+            }
+            return node.is_sequence() ? !node.m_node_value.p_sequence->empty()
+                                      : !node.m_node_value.p_mapping->empty();
+        }
+
+        /// @brief Gets the element of a non-empty container value which links it to the next one to be destroyed.
+        /// @param[in] value A non-empty container value.
+        /// @return Reference to the last element of a sequence, or to the first value of a mapping.
+        static basic_node& chain_slot(node_value& value) noexcept
+        {
+            return (value.attrs.type() == node_t::SEQUENCE) ? value.p_sequence->back()
+                                                            : value.p_mapping->begin()->second;
+        }
+
+        /// @brief Detaches a non-empty container from a child and pushes it to the chain of containers to be destroyed.
+        /// @note The child takes over the element used as the link to the rest of the chain, which may own a non-empty
+        /// container as well. Every call detaches one container, so calls for a child end up with a flat one.
+        /// @param[in,out] child A child which owns a non-empty container.
+        /// @param[in,out] pending The first node of the chain, which is null if the chain is empty.
+        static void push_nested_container(basic_node& child, basic_node& pending) noexcept
+        {
+            basic_node nested(std::move(child));
+            basic_node& slot = chain_slot(nested.m_node_value);
+            child = std::move(slot);
+            slot = std::move(pending);
+            pending = std::move(nested);
+        }
+
+        /// @brief Moves the non-empty containers owned by the children of the given container value to a chain.
+        /// @param[in] value A container value to be destroyed.
+        /// @param[in] type The type of the value. Nothing is moved for scalars.
+        /// @param[in,out] pending The first node of the chain of containers to be destroyed.
+        static void move_nested_containers(node_value& value, node_t type, basic_node& pending) noexcept
+        {
+            if (type == node_t::MAPPING)
+            {
+                for (auto&& entry : *value.p_mapping)
+                {
+                    while (owns_nested_container(entry.second))
+                    {
+                        push_nested_container(entry.second, pending);
+                    }
+                }
+            }
+            else if (type == node_t::SEQUENCE)
+            {
+                for (auto&& element : *value.p_sequence)
+                {
+                    while (owns_nested_container(element))
+                    {
+                        push_nested_container(element, pending);
+                    }
+                }
+            }
+        }
+
+        /// @brief Gets the cached digest of the copy-on-write container.
+        /// @return The cached digest, or 0 if the value is not a copy-on-write container or it has not been calculated.
+        std::uint64_t cached_digest() const noexcept
+        {
+            if (!attrs.is_shared())
+            {
+                return 0;
+            }
+
+            switch (attrs.type())
+            {
+            case node_t::SEQUENCE:
+                return static_cast<const cow_sequence_type*>(p_sequence)->cached_digest();
+            case node_t::MAPPING:
+                return static_cast<const cow_mapping_type*>(p_mapping)->cached_digest();
+            default:
+                return 0;
+            }
+        }
+
+        /// @brief Caches the digest of the copy-on-write container if it is shared with other nodes. Does nothing for
+        /// other values.
+        /// @note Only shared containers are cached since they are never modified in place. A container referenced
+        /// only by this node might be modified through a reference to one of its descendants obtained before.
+        /// @param[in] digest A non-zero digest of the value.
+        void cache_digest(std::uint64_t digest) const noexcept
+        {
+            if (!attrs.is_shared() || is_exclusive())
+            {
+                return;
+            }
+
+            switch (attrs.type())
+            {
+            case node_t::SEQUENCE:
+                static_cast<const cow_sequence_type*>(p_sequence)->cache_digest(digest);
+                break;
+            case node_t::MAPPING:
+                static_cast<const cow_mapping_type*>(p_mapping)->cache_digest(digest);
                 break;
             default:
                 break;
             }
         }
 
-        /// A pointer to the value of sequence type.
-        sequence_type* p_sequence;
-        /// A pointer to the value of mapping type. This pointer is also used when node type is null.
-        mapping_type* p_mapping {nullptr};
-        /// A value of boolean type.
-        boolean_type boolean;
-        /// A value of integer type.
-        integer_type integer;
-        /// A value of float number type.
-        float_number_type float_val;
-        /// A pointer to the value of string type.
-        string_type* p_string;
+        /// @brief Turns the container into a copy-on-write one which can be shared with other nodes if it's not yet.
+        /// @note The container is moved, so references to its elements stay valid with standard container types.
+        /// @warning Make sure the value is a container before calling this function.
+        void make_shared_container()
+        {
+            if (attrs.is_shared())
+            {
+                return;
+            }
+
+            if (attrs.type() == node_t::SEQUENCE)
+            {
+                sequence_type* p_seq = p_sequence;
+                p_sequence = create_object<cow_sequence_type>(std::move(*p_seq));
+                destroy_object<sequence_type>(p_seq);
+            }
+            else
+            {
+                mapping_type* p_map = p_mapping;
+                p_mapping = create_object<cow_mapping_type>(std::move(*p_map));
+                destroy_object<mapping_type>(p_map);
+            }
+            attrs.set_shared(true);
+        }
+
+        /// @brief Shares the container of another value as a copy-on-write one instead of the current value.
+        /// @note The YAML version and the anchor status are left as they are.
+        /// @warning Make sure `rhs` is a container of the same type as the current value.
+        /// @param[in,out] rhs A container value to be shared, which becomes a copy-on-write one if it's not yet.
+        /// @param[out] replaced A null value which the current value is moved to.
+        void share_container_of(node_value& rhs, node_value& replaced)
+        {
+            rhs.make_shared_container();
+            rhs.add_ref();
+            replaced.move_from(*this);
+
+            attrs = replaced.attrs;
+            attrs.set_type(rhs.attrs.type());
+            attrs.set_shared(true);
+            if (attrs.type() == node_t::SEQUENCE)
+            {
+                p_sequence = rhs.p_sequence;
+            }
+            else
+            {
+                p_mapping = rhs.p_mapping;
+            }
+        }
+
+        /// @brief Gets the first character of the string value stored in place.
+        /// @return The pointer to the first character of the string value stored in place.
+        char_type* small_data() noexcept
+        {
+            return reinterpret_cast<char_type*>(this);
+        }
+
+        /// @brief Gets the first character of the string value stored in place.
+        /// @return The pointer to the first character of the string value stored in place.
+        const char_type* small_data() const noexcept
+        {
+            return reinterpret_cast<const char_type*>(this);
+        }
+
+        /// The value of `small_size` for a string stored on the heap.
+        static constexpr std::uint8_t heap_string = 0xFFu;
+
+        union
+        {
+            /// A pointer to the value of sequence type.
+            sequence_type* p_sequence;
+            /// A pointer to the value of mapping type. This pointer is also used when node type is null.
+            mapping_type* p_mapping;
+            /// A value of boolean type.
+            boolean_type boolean;
+            /// A value of integer type.
+            integer_type integer;
+            /// A value of float number type.
+            float_number_type float_val;
+            /// A pointer to the value of string type which is too long to be stored in place.
+            string_type* p_string;
+            /// A shared pointer to the interned value of string type.
+            shared_string_pointer p_shared_str;
+        };
+        /// The rest of the bytes for a string stored in place, which begins with the anonymous union.
+        std::uint8_t small_tail[6];
+        /// The number of the characters of a string stored in place, or `heap_string` for a string on the heap.
+        std::uint8_t small_size {0};
+        /// The packed attributes (the value type, the YAML version and the anchor status) of the node.
+        detail::node_attrs attrs {};
     };
 
 private:
@@ -266,37 +729,43 @@ private:
         std::allocator_traits<decltype(alloc)>::deallocate(alloc, obj, 1);
     }
 
-public:
-    /// @brief Constructs a new basic_node object of null type.
-    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/constructor/
-    basic_node() = default;
-
-    /// @brief Constructs a new basic_node object with a specified type.
-    /// @param[in] type A YAML node type.
-    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/constructor/
-    explicit basic_node(const node_t type)
-        : m_node_type(type),
-          m_node_value(type)
+    /// @brief A tag type to construct a basic_node object without copying its children.
+    struct shallow_copy_tag
     {
-    }
+    };
 
-    /// @brief Copy constructor of the basic_node class.
+    /// @brief Constructs a copy of a basic_node object except for its children.
+    /// @note Container values are left empty with their capacities reserved for the children if possible, while
+    /// copy-on-write containers are shared with `rhs` as they are.
     /// @param[in] rhs A basic_node object to be copied with.
-    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/constructor/
-    basic_node(const basic_node& rhs)
-        : m_node_type(rhs.m_node_type),
-          m_yaml_version_type(rhs.m_yaml_version_type),
-          m_prop(rhs.m_prop)
+    basic_node(shallow_copy_tag /*unused*/, const basic_node& rhs)
+        : m_prop((rhs.m_prop && !rhs.m_prop->empty()) ? new property_type(*rhs.m_prop.get()) : nullptr)
     {
-        switch (m_node_type)
+        m_node_value.attrs = rhs.m_node_value.attrs;
+        switch (m_node_value.attrs.type())
         {
         case node_t::SEQUENCE:
-            m_node_value.p_sequence = create_object<sequence_type>(*(rhs.m_node_value.p_sequence));
+            if (m_node_value.attrs.is_shared())
+            {
+                // a copy-on-write container is just shared.
+                m_node_value.p_sequence = rhs.m_node_value.p_sequence;
+                m_node_value.add_ref();
+                break;
+            }
+            m_node_value.p_sequence = create_object<sequence_type>();
             FK_YAML_ASSERT(m_node_value.p_sequence != nullptr);
+            detail::reserve_if_possible(*m_node_value.p_sequence, rhs.m_node_value.p_sequence->size());
             break;
         case node_t::MAPPING:
-            m_node_value.p_mapping = create_object<mapping_type>(*(rhs.m_node_value.p_mapping));
+            if (m_node_value.attrs.is_shared())
+            {
+                m_node_value.p_mapping = rhs.m_node_value.p_mapping;
+                m_node_value.add_ref();
+                break;
+            }
+            m_node_value.p_mapping = create_object<mapping_type>();
             FK_YAML_ASSERT(m_node_value.p_mapping != nullptr);
+            detail::reserve_if_possible(*m_node_value.p_mapping, rhs.m_node_value.p_mapping->size());
             break;
         case node_t::NULL_OBJECT:
             m_node_value.p_mapping = nullptr;
@@ -311,59 +780,210 @@ public:
             m_node_value.float_val = rhs.m_node_value.float_val;
             break;
         case node_t::STRING:
-            m_node_value.p_string = create_object<string_type>(*(rhs.m_node_value.p_string));
-            FK_YAML_ASSERT(m_node_value.p_string != nullptr);
+            if (m_node_value.attrs.is_shared())
+            {
+                m_node_value.construct_shared_string(shared_string_pointer(rhs.m_node_value.p_shared_str));
+            }
+            else
+            {
+                m_node_value.construct_string(rhs.m_node_value.string_data(), rhs.m_node_value.string_size());
+            }
             break;
         }
     }
 
-    /// @brief Move constructor of the basic_node class.
-    /// @param[in] rhs A basic_node object to be moved from.
+    /// @brief Copies the descendants of the given container node into this node without recursion.
+    /// @note This node must be a shallow copy of `rhs`. Mapping keys are copied as a whole.
+    /// @param[in] rhs A container node to be copied from.
+    void copy_children(const basic_node& rhs)
+    {
+        std::vector<std::pair<const basic_node*, basic_node*>> stack(1, {&rhs, this});
+
+        while (!stack.empty())
+        {
+            const basic_node& src = *stack.back().first;
+            basic_node& dst = *stack.back().second;
+            stack.pop_back();
+
+            if (src.is_sequence())
+            {
+                const sequence_type& src_seq = *src.m_node_value.p_sequence;
+                sequence_type& dst_seq = *dst.m_node_value.p_sequence;
+                for (const basic_node& elem : src_seq)
+                {
+                    dst_seq.push_back(basic_node(shallow_copy_tag {}, elem));
+                }
+
+                auto dst_itr = dst_seq.begin();
+                for (const basic_node& elem : src_seq)
+                {
+                    if ((elem.is_sequence() || elem.is_mapping()) && !elem.m_node_value.attrs.is_shared())
+                    {
+                        stack.emplace_back(&elem, &*dst_itr);
+                    }
+                    ++dst_itr;
+                }
+            }
+            else
+            {
+                const mapping_type& src_map = *src.m_node_value.p_mapping;
+                mapping_type& dst_map = *dst.m_node_value.p_mapping;
+                for (const auto& entry : src_map)
+                {
+                    // the source keys are unique and in order, so they can be simply appended.
+                    detail::append_mapping_entry(
+                        dst_map, basic_node(entry.first), basic_node(shallow_copy_tag {}, entry.second));
+                }
+
+                auto dst_itr = dst_map.begin();
+                for (const auto& entry : src_map)
+                {
+                    const basic_node& value = entry.second;
+                    if ((value.is_sequence() || value.is_mapping()) && !value.m_node_value.attrs.is_shared())
+                    {
+                        // hash-based mappings may iterate the copied entries in a different order.
+                        basic_node& dst_value = detail::is_unordered_mapping<mapping_type>::value
+                                                    ? dst_map.find(entry.first)->second
+                                                    : dst_itr->second;
+                        stack.emplace_back(&value, &dst_value);
+                    }
+                    ++dst_itr;
+                }
+            }
+        }
+    }
+
+    /// @brief Gives this node its own copy of the copy-on-write container if it is shared with other nodes.
+    /// @note The copy is still a copy-on-write container, and its elements are shared with the original ones if they
+    /// are copy-on-write containers as well. So only the path to a modified node is copied.
+    void unshare_container()
+    {
+        const node_t node_type = m_node_value.attrs.type();
+        if (!m_node_value.attrs.is_shared() || (node_type != node_t::SEQUENCE && node_type != node_t::MAPPING))
+        {
+            // shared strings are immutable and never accessed for modification through this function.
+            return;
+        }
+
+        if (m_node_value.is_exclusive())
+        {
+            // the container may be modified in place, so its cached digest cannot be trusted any longer.
+            if (m_node_value.attrs.type() == node_t::SEQUENCE)
+            {
+                static_cast<cow_sequence_type*>(m_node_value.p_sequence)->clear_digest();
+            }
+            else
+            {
+                static_cast<cow_mapping_type*>(m_node_value.p_mapping)->clear_digest();
+            }
+            return;
+        }
+
+        // the reference to the original container is released by the destructor of this temporary node.
+        basic_node original {};
+        original.m_node_value.attrs.set_type(m_node_value.attrs.type());
+        original.m_node_value.attrs.set_shared(true);
+
+        if (m_node_value.attrs.type() == node_t::SEQUENCE)
+        {
+            sequence_type* p_copy = create_object<cow_sequence_type>(*m_node_value.p_sequence);
+            original.m_node_value.p_sequence = m_node_value.p_sequence;
+            m_node_value.p_sequence = p_copy;
+        }
+        else
+        {
+            mapping_type* p_copy = create_object<cow_mapping_type>(*m_node_value.p_mapping);
+            original.m_node_value.p_mapping = m_node_value.p_mapping;
+            m_node_value.p_mapping = p_copy;
+        }
+    }
+
+    /// @brief Gets the value associated with the given key in the mapping of this node, inserting the key if missing.
+    /// @note Existing keys are looked up without conversion if the mapping type supports heterogeneous lookups, so that
+    /// reading a value with a string or integer key never allocates memory.
+    /// @tparam KeyType A key type which is a kind of the basic_node template class, or a string or integer type.
+    /// @param[in] map A mapping to look up.
+    /// @param[in] key A key to the target value.
+    /// @return Reference to the value associated with the given key.
+    template <typename KeyType>
+    static basic_node& mapping_value(mapping_type& map, KeyType&& key)
+    {
+        auto itr = map.find(key);
+        if (itr != map.end())
+        {
+            return itr->second;
+        }
+        return map[std::forward<KeyType>(key)];
+    }
+
+    /// @brief Gets the value associated with the given key in the mapping of this node.
+    /// @note A missing key is never inserted since const nodes may be read from multiple threads or share their
+    /// mappings with copy-on-write copies. A null node is returned for a missing key instead.
+    /// @tparam KeyType A key type which is a kind of the basic_node template class, or a string or integer type.
+    /// @param[in] key A key to the target value.
+    /// @return Constant reference to the value associated with the given key, or a null node if it's missing.
+    template <typename KeyType>
+    const basic_node& const_mapping_value(const KeyType& key) const
+    {
+        FK_YAML_ASSERT(m_node_value.p_mapping != nullptr);
+
+        static const basic_node null_node {};
+        const mapping_type& map = *m_node_value.p_mapping;
+        auto itr = map.find(key);
+        return (itr != map.end()) ? itr->second : null_node;
+    }
+
+    /// @brief Get the property set of this node, allocating it if not yet.
+    /// @return Reference to the property set of this node.
+    property_type& get_property()
+    {
+        return m_prop.get_or_create();
+    }
+
+    /// @brief Destroy the current value of this node together with the string copy kept for it if any.
+    /// @note This must be called before a new value is constructed in place, since the string copy would be stale.
+    void destroy_value() noexcept
+    {
+        m_node_value.destroy();
+        if (m_prop)
+        {
+            m_prop->release_string_copy();
+        }
+    }
+
+public:
+    /// @brief Constructs a new basic_node object of null type.
     /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/constructor/
-    basic_node(basic_node&& rhs) noexcept
-        : m_node_type(rhs.m_node_type),
-          m_yaml_version_type(rhs.m_yaml_version_type),
-          m_prop(std::move(rhs.m_prop))
+    basic_node() = default;
+
+    /// @brief Constructs a new basic_node object with a specified type.
+    /// @param[in] type A YAML node type.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/constructor/
+    explicit basic_node(const node_t type)
+        : m_node_value(type)
+    {
+    }
+
+    /// @brief Copy constructor of the basic_node class.
+    /// @param[in] rhs A basic_node object to be copied with.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/constructor/
+    basic_node(const basic_node& rhs)
+        : basic_node(shallow_copy_tag {}, rhs)
     {
-        switch (m_node_type)
+        const node_t node_type = m_node_value.attrs.type();
+        if ((node_type == node_t::SEQUENCE || node_type == node_t::MAPPING) && !m_node_value.attrs.is_shared())
         {
-        case node_t::SEQUENCE:
-            FK_YAML_ASSERT(rhs.m_node_value.p_sequence != nullptr);
-            m_node_value.p_sequence = rhs.m_node_value.p_sequence;
-            rhs.m_node_value.p_sequence = nullptr;
-            break;
-        case node_t::MAPPING:
-            FK_YAML_ASSERT(rhs.m_node_value.p_mapping != nullptr);
-            m_node_value.p_mapping = rhs.m_node_value.p_mapping;
-            rhs.m_node_value.p_mapping = nullptr;
-            break;
-        case node_t::NULL_OBJECT:
-            FK_YAML_ASSERT(rhs.m_node_value.p_mapping == nullptr);
-            m_node_value.p_mapping = rhs.m_node_value.p_mapping;
-            break;
-        case node_t::BOOLEAN:
-            m_node_value.boolean = rhs.m_node_value.boolean;
-            rhs.m_node_value.boolean = static_cast<boolean_type>(false);
-            break;
-        case node_t::INTEGER:
-            m_node_value.integer = rhs.m_node_value.integer;
-            rhs.m_node_value.integer = static_cast<integer_type>(0);
-            break;
-        case node_t::FLOAT_NUMBER:
-            m_node_value.float_val = rhs.m_node_value.float_val;
-            rhs.m_node_value.float_val = static_cast<float_number_type>(0.0);
-            break;
-        case node_t::STRING:
-            FK_YAML_ASSERT(rhs.m_node_value.p_string != nullptr);
-            m_node_value.p_string = rhs.m_node_value.p_string;
-            rhs.m_node_value.p_string = nullptr;
-            break;
+            copy_children(rhs);
         }
+    }
 
-        rhs.m_node_type = node_t::NULL_OBJECT;
-        rhs.m_yaml_version_type = yaml_version_t::VER_1_2;
-        rhs.m_node_value.p_mapping = nullptr;
-        rhs.m_prop.anchor_status = detail::anchor_status_t::NONE;
+    /// @brief Move constructor of the basic_node class.
+    /// @param[in] rhs A basic_node object to be moved from.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/constructor/
+    basic_node(basic_node&& rhs) noexcept
+        : m_prop(std::move(rhs.m_prop))
+    {
+        m_node_value.move_from(rhs.m_node_value);
     }
 
     /// @brief Construct a new basic_node object from a value of compatible types.
@@ -381,80 +1001,238 @@ public:
     basic_node(CompatibleType&& val) noexcept(
         noexcept(ConverterType<U>::to_node(std::declval<basic_node&>(), std::declval<CompatibleType>())))
     {
-        ConverterType<U>::to_node(*this, std::forward<CompatibleType>(val));
+        ConverterType<U>::to_node(*this, std::forward<CompatibleType>(val));
+    }
+
+    /// @brief Construct a new basic node object with a node_ref_storage object.
+    /// @tparam NodeRefStorageType Type of basic_node with reference.
+    /// @param[in] node_ref_storage A node_ref_storage template class object.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/constructor/
+    template <
+        typename NodeRefStorageType,
+        detail::enable_if_t<detail::is_node_ref_storage<NodeRefStorageType>::value, int> = 0>
+    basic_node(const NodeRefStorageType& node_ref_storage) noexcept
+        : basic_node(node_ref_storage.release())
+    {
+    }
+
+    /// @brief Construct a new basic node object with std::initializer_list.
+    /// @param[in] init A initializer list of basic_node objects.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/constructor/
+    basic_node(initializer_list_t init)
+    {
+        bool is_mapping =
+            std::all_of(init.begin(), init.end(), [](const detail::node_ref_storage<basic_node>& node_ref) {
+                return node_ref->is_sequence() && node_ref->size() == 2;
+            });
+
+        if (is_mapping)
+        {
+            m_node_value.attrs.set_type(node_t::MAPPING);
+            m_node_value.p_mapping = create_object<mapping_type>();
+
+            for (auto& elem_ref : init)
+            {
+                auto elem = elem_ref.release();
+                m_node_value.p_mapping->emplace(
+                    std::move((*(elem.m_node_value.p_sequence))[0]), std::move((*(elem.m_node_value.p_sequence))[1]));
+            }
+        }
+        else
+        {
+            m_node_value.attrs.set_type(node_t::SEQUENCE);
+            m_node_value.p_sequence = create_object<sequence_type>(init.begin(), init.end());
+        }
+    }
+
+    /// @brief Destroy the basic_node object and its value storage.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/destructor/
+    ~basic_node() noexcept // NOLINT(bugprone-exception-escape)
+    {
+        m_node_value.destroy();
+        m_node_value.attrs.set_type(node_t::NULL_OBJECT);
+    }
+
+public:
+    /// @brief Deserialize an input source into a basic_node object.
+    /// @tparam InputType Type of a compatible input.
+    /// @param[in] input An input source in the YAML format.
+    /// @return The resulting basic_node object deserialized from the input source.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/deserialize/
+    template <typename InputType>
+    static basic_node deserialize(InputType&& input)
+    {
+        return deserializer_type().deserialize(detail::input_adapter(std::forward<InputType>(input)));
+    }
+
+    /// @brief Deserialize input iterators into a basic_node object.
+    /// @tparam ItrType Type of a compatible iterator.
+    /// @param[in] begin An iterator to the first element of an input sequence.
+    /// @param[in] end An iterator to the past-the-last element of an input sequence.
+    /// @return The resulting basic_node object deserialized from the pair of iterators.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/deserialize/
+    template <typename ItrType>
+    static basic_node deserialize(ItrType&& begin, ItrType&& end)
+    {
+        return deserializer_type().deserialize(
+            detail::input_adapter(std::forward<ItrType>(begin), std::forward<ItrType>(end)));
+    }
+
+    /// @brief Deserialize only the nodes on the given key paths in an input source into a basic_node object.
+    /// @tparam InputType Type of a compatible input.
+    /// @param[in] input An input source in the YAML format.
+    /// @param[in] select_paths Key paths like `spec.containers[*].image` of the nodes to be deserialized.
+    /// @return The resulting basic_node object which contains only the nodes on the key paths.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/deserialize/
+    template <typename InputType>
+    static basic_node deserialize(InputType&& input, const std::vector<std::string>& select_paths)
+    {
+        return deserializer_type().deserialize(detail::input_adapter(std::forward<InputType>(input)), select_paths);
+    }
+
+    /// @brief Deserialize only the nodes on the given key paths in input iterators into a basic_node object.
+    /// @tparam ItrType Type of a compatible iterator.
+    /// @param[in] begin An iterator to the first element of an input sequence.
+    /// @param[in] end An iterator to the past-the-last element of an input sequence.
+    /// @param[in] select_paths Key paths like `spec.containers[*].image` of the nodes to be deserialized.
+    /// @return The resulting basic_node object which contains only the nodes on the key paths.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/deserialize/
+    template <typename ItrType>
+    static basic_node deserialize(ItrType&& begin, ItrType&& end, const std::vector<std::string>& select_paths)
+    {
+        return deserializer_type().deserialize(
+            detail::input_adapter(std::forward<ItrType>(begin), std::forward<ItrType>(end)), select_paths);
+    }
+
+    /// @brief Deserialize an input source into a basic_node object, letting equal string mapping keys share one string.
+    /// @tparam InputType Type of a compatible input.
+    /// @param[in] input An input source in the YAML format.
+    /// @param[in,out] key_interner A pool of mapping key strings, which can be shared across deserializations.
+    /// @return The resulting basic_node object deserialized from the input source.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/deserialize/
+    template <typename InputType>
+    static basic_node deserialize(InputType&& input, key_interner_type& key_interner)
+    {
+        return deserializer_type().deserialize(detail::input_adapter(std::forward<InputType>(input)), key_interner);
+    }
+
+    /// @brief Deserialize input iterators into a basic_node object, letting equal string mapping keys share one string.
+    /// @tparam ItrType Type of a compatible iterator.
+    /// @param[in] begin An iterator to the first element of an input sequence.
+    /// @param[in] end An iterator to the past-the-last element of an input sequence.
+    /// @param[in,out] key_interner A pool of mapping key strings, which can be shared across deserializations.
+    /// @return The resulting basic_node object deserialized from the pair of iterators.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/deserialize/
+    template <typename ItrType>
+    static basic_node deserialize(ItrType&& begin, ItrType&& end, key_interner_type& key_interner)
+    {
+        return deserializer_type().deserialize(
+            detail::input_adapter(std::forward<ItrType>(begin), std::forward<ItrType>(end)), key_interner);
+    }
+
+    /// @brief Deserialize an input source into an existing basic_node object, reusing its nodes where possible.
+    /// @tparam InputType Type of a compatible input.
+    /// @param[in] input An input source in the YAML format.
+    /// @param[in,out] target A basic_node object to be updated with the deserialized contents.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/deserialize_into/
+    template <typename InputType>
+    static void deserialize_into(InputType&& input, basic_node& target)
+    {
+        deserializer_type().deserialize_into(detail::input_adapter(std::forward<InputType>(input)), target);
+    }
+
+    /// @brief Deserialize input iterators into an existing basic_node object, reusing its nodes where possible.
+    /// @tparam ItrType Type of a compatible iterator.
+    /// @param[in] begin An iterator to the first element of an input sequence.
+    /// @param[in] end An iterator to the past-the-last element of an input sequence.
+    /// @param[in,out] target A basic_node object to be updated with the deserialized contents.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/deserialize_into/
+    template <typename ItrType>
+    static void deserialize_into(ItrType&& begin, ItrType&& end, basic_node& target)
+    {
+        deserializer_type().deserialize_into(
+            detail::input_adapter(std::forward<ItrType>(begin), std::forward<ItrType>(end)), target);
     }
 
-    /// @brief Construct a new basic node object with a node_ref_storage object.
-    /// @tparam NodeRefStorageType Type of basic_node with reference.
-    /// @param[in] node_ref_storage A node_ref_storage template class object.
-    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/constructor/
-    template <
-        typename NodeRefStorageType,
-        detail::enable_if_t<detail::is_node_ref_storage<NodeRefStorageType>::value, int> = 0>
-    basic_node(const NodeRefStorageType& node_ref_storage) noexcept
-        : basic_node(node_ref_storage.release())
+    /// @brief Deserialize an input source into a lazy view which creates basic_node objects only when accessed.
+    /// @tparam InputType Type of a compatible input.
+    /// @param[in] input An input source in the YAML format.
+    /// @return The view of the root node deserialized from the input source.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/deserialize_lazy/
+    template <typename InputType>
+    static basic_lazy_node<basic_node> deserialize_lazy(InputType&& input)
     {
+        return basic_lazy_node<basic_node>(
+            deserializer_type().deserialize_tape(detail::input_adapter(std::forward<InputType>(input))));
     }
 
-    /// @brief Construct a new basic node object with std::initializer_list.
-    /// @param[in] init A initializer list of basic_node objects.
-    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/constructor/
-    basic_node(initializer_list_t init)
+    /// @brief Deserialize input iterators into a lazy view which creates basic_node objects only when accessed.
+    /// @tparam ItrType Type of a compatible iterator.
+    /// @param[in] begin An iterator to the first element of an input sequence.
+    /// @param[in] end An iterator to the past-the-last element of an input sequence.
+    /// @return The view of the root node deserialized from the pair of iterators.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/deserialize_lazy/
+    template <typename ItrType>
+    static basic_lazy_node<basic_node> deserialize_lazy(ItrType&& begin, ItrType&& end)
     {
-        bool is_mapping =
-            std::all_of(init.begin(), init.end(), [](const detail::node_ref_storage<basic_node>& node_ref) {
-                return node_ref->is_sequence() && node_ref->size() == 2;
-            });
-
-        if (is_mapping)
-        {
-            m_node_type = node_t::MAPPING;
-            m_node_value.p_mapping = create_object<mapping_type>();
+        return basic_lazy_node<basic_node>(deserializer_type().deserialize_tape(
+            detail::input_adapter(std::forward<ItrType>(begin), std::forward<ItrType>(end))));
+    }
 
-            for (auto& elem_ref : init)
-            {
-                auto elem = elem_ref.release();
-                m_node_value.p_mapping->emplace(
-                    std::move((*(elem.m_node_value.p_sequence))[0]), std::move((*(elem.m_node_value.p_sequence))[1]));
-            }
-        }
-        else
-        {
-            m_node_type = node_t::SEQUENCE;
-            m_node_value.p_sequence = create_object<sequence_type>(init.begin(), init.end());
-        }
+    /// @brief Deserialize all the documents in an input source into basic_node objects in parallel.
+    /// @tparam InputType Type of a compatible input.
+    /// @param[in] input An input source in the YAML format.
+    /// @param[in] num_threads The number of threads to be used. 0 means the number of hardware threads.
+    /// @return The resulting basic_node objects deserialized from the documents in the order of appearance.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/deserialize_docs_parallel/
+    template <typename InputType>
+    static std::vector<basic_node> deserialize_docs_parallel(InputType&& input, std::size_t num_threads = 0)
+    {
+        return parallel_deserializer_type().deserialize_docs(
+            detail::input_adapter(std::forward<InputType>(input)), num_threads);
     }
 
-    /// @brief Destroy the basic_node object and its value storage.
-    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/destructor/
-    ~basic_node() noexcept // NOLINT(bugprone-exception-escape)
+    /// @brief Deserialize all the documents in input iterators into basic_node objects in parallel.
+    /// @tparam ItrType Type of a compatible iterator.
+    /// @param[in] begin An iterator to the first element of an input sequence.
+    /// @param[in] end An iterator to the past-the-last element of an input sequence.
+    /// @param[in] num_threads The number of threads to be used. 0 means the number of hardware threads.
+    /// @return The resulting basic_node objects deserialized from the documents in the order of appearance.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/deserialize_docs_parallel/
+    template <typename ItrType>
+    static std::vector<basic_node> deserialize_docs_parallel(
+        ItrType&& begin, ItrType&& end, std::size_t num_threads = 0)
     {
-        m_node_value.destroy(m_node_type);
-        m_node_type = node_t::NULL_OBJECT;
+        return parallel_deserializer_type().deserialize_docs(
+            detail::input_adapter(std::forward<ItrType>(begin), std::forward<ItrType>(end)), num_threads);
     }
 
-public:
-    /// @brief Deserialize an input source into a basic_node object.
+    /// @brief Parse an input source and report parse events to a handler without building basic_node objects.
     /// @tparam InputType Type of a compatible input.
+    /// @tparam SaxHandlerType Type of an event handler.
     /// @param[in] input An input source in the YAML format.
-    /// @return The resulting basic_node object deserialized from the input source.
-    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/deserialize/
-    template <typename InputType>
-    static basic_node deserialize(InputType&& input)
+    /// @param[in] handler An event handler which has the same member functions as sax_handler_type.
+    /// @return true if the whole input has been parsed, false if the handler stopped parsing.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/sax_parse/
+    template <typename InputType, typename SaxHandlerType>
+    static bool sax_parse(InputType&& input, SaxHandlerType& handler)
     {
-        return deserializer_type().deserialize(detail::input_adapter(std::forward<InputType>(input)));
+        return detail::basic_sax_parser<basic_node, SaxHandlerType>(handler).parse(
+            detail::input_adapter(std::forward<InputType>(input)));
     }
 
-    /// @brief Deserialize input iterators into a basic_node object.
+    /// @brief Parse input iterators and report parse events to a handler without building basic_node objects.
     /// @tparam ItrType Type of a compatible iterator.
+    /// @tparam SaxHandlerType Type of an event handler.
     /// @param[in] begin An iterator to the first element of an input sequence.
     /// @param[in] end An iterator to the past-the-last element of an input sequence.
-    /// @return The resulting basic_node object deserialized from the pair of iterators.
-    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/deserialize/
-    template <typename ItrType>
-    static basic_node deserialize(ItrType&& begin, ItrType&& end)
+    /// @param[in] handler An event handler which has the same member functions as sax_handler_type.
+    /// @return true if the whole input has been parsed, false if the handler stopped parsing.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/sax_parse/
+    template <typename ItrType, typename SaxHandlerType>
+    static bool sax_parse(ItrType&& begin, ItrType&& end, SaxHandlerType& handler)
     {
-        return deserializer_type().deserialize(
+        return detail::basic_sax_parser<basic_node, SaxHandlerType>(handler).parse(
             detail::input_adapter(std::forward<ItrType>(begin), std::forward<ItrType>(end)));
     }
 
@@ -473,7 +1251,7 @@ public:
     static basic_node sequence()
     {
         basic_node node;
-        node.m_node_type = node_t::SEQUENCE;
+        node.m_node_value.attrs.set_type(node_t::SEQUENCE);
         node.m_node_value.p_sequence = create_object<sequence_type>();
         FK_YAML_ASSERT(node.m_node_value.p_sequence != nullptr);
         return node;
@@ -486,7 +1264,7 @@ public:
     static basic_node sequence(const sequence_type& seq)
     {
         basic_node node;
-        node.m_node_type = node_t::SEQUENCE;
+        node.m_node_value.attrs.set_type(node_t::SEQUENCE);
         node.m_node_value.p_sequence = create_object<sequence_type>(seq);
         FK_YAML_ASSERT(node.m_node_value.p_sequence != nullptr);
         return node;
@@ -499,7 +1277,7 @@ public:
     static basic_node sequence(sequence_type&& seq)
     {
         basic_node node;
-        node.m_node_type = node_t::SEQUENCE;
+        node.m_node_value.attrs.set_type(node_t::SEQUENCE);
         node.m_node_value.p_sequence = create_object<sequence_type>(std::move(seq));
         FK_YAML_ASSERT(node.m_node_value.p_sequence != nullptr);
         return node;
@@ -511,7 +1289,7 @@ public:
     static basic_node mapping()
     {
         basic_node node;
-        node.m_node_type = node_t::MAPPING;
+        node.m_node_value.attrs.set_type(node_t::MAPPING);
         node.m_node_value.p_mapping = create_object<mapping_type>();
         FK_YAML_ASSERT(node.m_node_value.p_mapping != nullptr);
         return node;
@@ -524,7 +1302,7 @@ public:
     static basic_node mapping(const mapping_type& map)
     {
         basic_node node;
-        node.m_node_type = node_t::MAPPING;
+        node.m_node_value.attrs.set_type(node_t::MAPPING);
         node.m_node_value.p_mapping = create_object<mapping_type>(map);
         FK_YAML_ASSERT(node.m_node_value.p_mapping != nullptr);
         return node;
@@ -537,7 +1315,7 @@ public:
     static basic_node mapping(mapping_type&& map)
     {
         basic_node node;
-        node.m_node_type = node_t::MAPPING;
+        node.m_node_value.attrs.set_type(node_t::MAPPING);
         node.m_node_value.p_mapping = create_object<mapping_type>(std::move(map));
         FK_YAML_ASSERT(node.m_node_value.p_mapping != nullptr);
         return node;
@@ -550,14 +1328,14 @@ public:
     /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/alias_of/
     static basic_node alias_of(const basic_node& anchor_node)
     {
-        if (!anchor_node.has_anchor_name() || anchor_node.m_prop.anchor_status != detail::anchor_status_t::ANCHOR)
+        if (!anchor_node.has_anchor_name() ||
+            anchor_node.m_node_value.attrs.anchor_status() != detail::anchor_status_t::ANCHOR)
         {
             throw fkyaml::exception("Cannot create an alias without anchor name.");
         }
 
         basic_node node = anchor_node;
-        node.m_prop.anchor_status = detail::anchor_status_t::ALIAS;
-        node.m_prop.anchor = anchor_node.m_prop.anchor;
+        node.m_node_value.attrs.set_anchor_status(detail::anchor_status_t::ALIAS);
         return node;
     } // LCOV_EXCL_LINE
 
@@ -597,24 +1375,25 @@ public:
     {
         if (is_scalar())
         {
-            throw fkyaml::type_error("operator[] is unavailable for a scalar node.", m_node_type);
+            throw fkyaml::type_error("operator[] is unavailable for a scalar node.", m_node_value.attrs.type());
         }
 
-        basic_node n = std::forward<KeyType>(key);
+        unshare_container();
 
         if (is_sequence())
         {
+            basic_node n = std::forward<KeyType>(key);
             if (!n.is_integer())
             {
                 throw fkyaml::type_error(
-                    "An argument of operator[] for sequence nodes must be an integer.", m_node_type);
+                    "An argument of operator[] for sequence nodes must be an integer.", m_node_value.attrs.type());
             }
             FK_YAML_ASSERT(m_node_value.p_sequence != nullptr);
             return m_node_value.p_sequence->operator[](n.get_value<int>());
         }
 
         FK_YAML_ASSERT(m_node_value.p_mapping != nullptr);
-        return m_node_value.p_mapping->operator[](std::move(n));
+        return mapping_value(*m_node_value.p_mapping, detail::to_lookup_key<basic_node>(std::forward<KeyType>(key)));
     }
 
     /// @brief A subscript operator of the basic_node class with a key of a compatible type with basic_node.
@@ -632,24 +1411,22 @@ public:
     {
         if (is_scalar())
         {
-            throw fkyaml::type_error("operator[] is unavailable for a scalar node.", m_node_type);
+            throw fkyaml::type_error("operator[] is unavailable for a scalar node.", m_node_value.attrs.type());
         }
 
-        basic_node node_key = std::forward<KeyType>(key);
-
         if (is_sequence())
         {
+            basic_node node_key = std::forward<KeyType>(key);
             if (!node_key.is_integer())
             {
                 throw fkyaml::type_error(
-                    "An argument of operator[] for sequence nodes must be an integer.", m_node_type);
+                    "An argument of operator[] for sequence nodes must be an integer.", m_node_value.attrs.type());
             }
             FK_YAML_ASSERT(m_node_value.p_sequence != nullptr);
             return m_node_value.p_sequence->operator[](node_key.get_value<int>());
         }
 
-        FK_YAML_ASSERT(m_node_value.p_mapping != nullptr);
-        return m_node_value.p_mapping->operator[](std::move(node_key));
+        return const_mapping_value(detail::to_lookup_key<basic_node>(std::forward<KeyType>(key)));
     }
 
     /// @brief A subscript operator of the basic_node class with a basic_node key object.
@@ -663,15 +1440,17 @@ public:
     {
         if (is_scalar())
         {
-            throw fkyaml::type_error("operator[] is unavailable for a scalar node.", m_node_type);
+            throw fkyaml::type_error("operator[] is unavailable for a scalar node.", m_node_value.attrs.type());
         }
 
+        unshare_container();
+
         if (is_sequence())
         {
             if (!key.is_integer())
             {
                 throw fkyaml::type_error(
-                    "An argument of operator[] for sequence nodes must be an integer.", m_node_type);
+                    "An argument of operator[] for sequence nodes must be an integer.", m_node_value.attrs.type());
             }
             FK_YAML_ASSERT(m_node_value.p_sequence != nullptr);
             return m_node_value.p_sequence->operator[](key.template get_value<int>());
@@ -692,7 +1471,7 @@ public:
     {
         if (is_scalar())
         {
-            throw fkyaml::type_error("operator[] is unavailable for a scalar node.", m_node_type);
+            throw fkyaml::type_error("operator[] is unavailable for a scalar node.", m_node_value.attrs.type());
         }
 
         if (is_sequence())
@@ -700,14 +1479,13 @@ public:
             if (!key.is_integer())
             {
                 throw fkyaml::type_error(
-                    "An argument of operator[] for sequence nodes must be an integer.", m_node_type);
+                    "An argument of operator[] for sequence nodes must be an integer.", m_node_value.attrs.type());
             }
             FK_YAML_ASSERT(m_node_value.p_sequence != nullptr);
             return m_node_value.p_sequence->operator[](key.template get_value<int>());
         }
 
-        FK_YAML_ASSERT(m_node_value.p_mapping != nullptr);
-        return m_node_value.p_mapping->operator[](std::forward<KeyType>(key));
+        return const_mapping_value(std::forward<KeyType>(key));
     }
 
     /// @brief An equal-to operator of the basic_node class.
@@ -716,41 +1494,7 @@ public:
     /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/operator_eq/
     bool operator==(const basic_node& rhs) const noexcept
     {
-        if (m_node_type != rhs.m_node_type)
-        {
-            return false;
-        }
-
-        bool ret = false;
-        switch (m_node_type)
-        {
-        case node_t::SEQUENCE:
-            ret = (*(m_node_value.p_sequence) == *(rhs.m_node_value.p_sequence));
-            break;
-        case node_t::MAPPING:
-            ret = (*(m_node_value.p_mapping) == *(rhs.m_node_value.p_mapping));
-            break;
-        case node_t::NULL_OBJECT:
-            // Always true for comparisons between null nodes.
-            ret = true;
-            break;
-        case node_t::BOOLEAN:
-            ret = (m_node_value.boolean == rhs.m_node_value.boolean);
-            break;
-        case node_t::INTEGER:
-            ret = (m_node_value.integer == rhs.m_node_value.integer);
-            break;
-        case node_t::FLOAT_NUMBER:
-            ret =
-                (std::abs(m_node_value.float_val - rhs.m_node_value.float_val) <
-                 std::numeric_limits<float_number_type>::epsilon());
-            break;
-        case node_t::STRING:
-            ret = (*(m_node_value.p_string) == *(rhs.m_node_value.p_string));
-            break;
-        }
-
-        return ret;
+        return detail::basic_node_comparator<basic_node>::equal(*this, rhs);
     }
 
     /// @brief A not-equal-to operator of the basic_node class.
@@ -768,49 +1512,7 @@ public:
     /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/operator_lt/
     bool operator<(const basic_node& rhs) const noexcept
     {
-        if (operator==(rhs))
-        {
-            return false;
-        }
-
-        if (uint32_t(m_node_type) < uint32_t(rhs.m_node_type))
-        {
-            return true;
-        }
-
-        if (m_node_type != rhs.m_node_type)
-        {
-            return false;
-        }
-
-        bool ret = false;
-        switch (m_node_type)
-        {
-        case node_t::SEQUENCE:
-            ret = (*(m_node_value.p_sequence) < *(rhs.m_node_value.p_sequence));
-            break;
-        case node_t::MAPPING:
-            ret = (*(m_node_value.p_mapping) < *(rhs.m_node_value.p_mapping));
-            break;
-        case node_t::NULL_OBJECT: // LCOV_EXCL_LINE
-            // Will not come here since null nodes are alyways the same.
-            break; // LCOV_EXCL_LINE
-        case node_t::BOOLEAN:
-            // false < true
-            ret = (!m_node_value.boolean && rhs.m_node_value.boolean);
-            break;
-        case node_t::INTEGER:
-            ret = (m_node_value.integer < rhs.m_node_value.integer);
-            break;
-        case node_t::FLOAT_NUMBER:
-            ret = (m_node_value.float_val < rhs.m_node_value.float_val);
-            break;
-        case node_t::STRING:
-            ret = (*(m_node_value.p_string) < *(rhs.m_node_value.p_string));
-            break;
-        }
-
-        return ret;
+        return compare(rhs) < 0;
     }
 
     /// @brief A less-than-or-equal-to operator of the basic_node class.
@@ -819,7 +1521,7 @@ public:
     /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/operator_le/
     bool operator<=(const basic_node& rhs) const noexcept
     {
-        return !rhs.operator<(*this);
+        return compare(rhs) <= 0;
     }
 
     /// @brief A greater-than operator of the basic_node class.
@@ -828,7 +1530,7 @@ public:
     /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/operator_gt/
     bool operator>(const basic_node& rhs) const noexcept
     {
-        return !operator<=(rhs);
+        return compare(rhs) > 0;
     }
 
     /// @brief A greater-than-or-equal-to operator of the basic_node class.
@@ -837,7 +1539,26 @@ public:
     /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/operator_ge/
     bool operator>=(const basic_node& rhs) const noexcept
     {
-        return !operator<(rhs);
+        return compare(rhs) >= 0;
+    }
+
+    /// @brief Compares this basic_node object with another in a single pass. (three-way comparison)
+    /// @param rhs A basic_node object to be compared with this basic_node object.
+    /// @return A negative value if this basic_node object is less than `rhs`, a positive value if greater, 0 otherwise.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/compare/
+    int compare(const basic_node& rhs) const noexcept
+    {
+        return detail::basic_node_comparator<basic_node>::compare(*this, rhs);
+    }
+
+    /// @brief Checks if this basic_node object is equal to another, comparing large trees with multiple threads.
+    /// @param rhs A basic_node object to be compared with this basic_node object.
+    /// @param num_threads The number of threads to be used. 0 means the number of hardware threads.
+    /// @return true if both types and values are equal, false otherwise, just as operator== returns.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/equal_parallel/
+    bool equal_parallel(const basic_node& rhs, std::size_t num_threads = 0) const
+    {
+        return detail::basic_node_parallelizer<basic_node>::equal(*this, rhs, num_threads);
     }
 
 public:
@@ -846,7 +1567,7 @@ public:
     /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/type/
     node_t type() const noexcept
     {
-        return m_node_type;
+        return m_node_value.attrs.type();
     }
 
     /// @brief Tests whether the current basic_node value is of sequence type.
@@ -854,7 +1575,7 @@ public:
     /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/is_sequence/
     bool is_sequence() const noexcept
     {
-        return m_node_type == node_t::SEQUENCE;
+        return m_node_value.attrs.type() == node_t::SEQUENCE;
     }
 
     /// @brief Tests whether the current basic_node value is of mapping type.
@@ -862,7 +1583,7 @@ public:
     /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/is_mapping/
     bool is_mapping() const noexcept
     {
-        return m_node_type == node_t::MAPPING;
+        return m_node_value.attrs.type() == node_t::MAPPING;
     }
 
     /// @brief Tests whether the current basic_node value is of null type.
@@ -870,7 +1591,7 @@ public:
     /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/is_null/
     bool is_null() const noexcept
     {
-        return m_node_type == node_t::NULL_OBJECT;
+        return m_node_value.attrs.type() == node_t::NULL_OBJECT;
     }
 
     /// @brief Tests whether the current basic_node value is of boolean type.
@@ -878,7 +1599,7 @@ public:
     /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/is_boolean/
     bool is_boolean() const noexcept
     {
-        return m_node_type == node_t::BOOLEAN;
+        return m_node_value.attrs.type() == node_t::BOOLEAN;
     }
 
     /// @brief Tests whether the current basic_node value is of integer type.
@@ -886,7 +1607,7 @@ public:
     /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/is_integer/
     bool is_integer() const noexcept
     {
-        return m_node_type == node_t::INTEGER;
+        return m_node_value.attrs.type() == node_t::INTEGER;
     }
 
     /// @brief Tests whether the current basic_node value is of float number type.
@@ -894,7 +1615,7 @@ public:
     /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/is_float_number/
     bool is_float_number() const noexcept
     {
-        return m_node_type == node_t::FLOAT_NUMBER;
+        return m_node_value.attrs.type() == node_t::FLOAT_NUMBER;
     }
 
     /// @brief Tests whether the current basic_node value is of string type.
@@ -902,7 +1623,7 @@ public:
     /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/is_string/
     bool is_string() const noexcept
     {
-        return m_node_type == node_t::STRING;
+        return m_node_value.attrs.type() == node_t::STRING;
     }
 
     /// @brief Tests whether the current basic_node value is of scalar types.
@@ -918,7 +1639,7 @@ public:
     /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/is_anchor/
     bool is_anchor() const noexcept
     {
-        return m_prop.anchor_status == detail::anchor_status_t::ANCHOR;
+        return m_node_value.attrs.anchor_status() == detail::anchor_status_t::ANCHOR;
     }
 
     /// @brief Tests whether the current basic_node is an alias node.
@@ -926,7 +1647,7 @@ public:
     /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/is_alias/
     bool is_alias() const noexcept
     {
-        return m_prop.anchor_status == detail::anchor_status_t::ALIAS;
+        return m_node_value.attrs.anchor_status() == detail::anchor_status_t::ALIAS;
     }
 
     /// @brief Tests whether the current basic_node value (sequence, mapping, string) is empty.
@@ -934,7 +1655,7 @@ public:
     /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/empty/
     bool empty() const
     {
-        switch (m_node_type)
+        switch (m_node_value.attrs.type())
         {
         case node_t::SEQUENCE:
             FK_YAML_ASSERT(m_node_value.p_sequence != nullptr);
@@ -943,10 +1664,9 @@ public:
             FK_YAML_ASSERT(m_node_value.p_mapping != nullptr);
             return m_node_value.p_mapping->empty();
         case node_t::STRING:
-            FK_YAML_ASSERT(m_node_value.p_string != nullptr);
-            return m_node_value.p_string->empty();
+            return m_node_value.string_size() == 0;
         default:
-            throw fkyaml::type_error("The target node is not of a container type.", m_node_type);
+            throw fkyaml::type_error("The target node is not of a container type.", m_node_value.attrs.type());
         }
     }
 
@@ -955,7 +1675,7 @@ public:
     /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/size/
     std::size_t size() const
     {
-        switch (m_node_type)
+        switch (m_node_value.attrs.type())
         {
         case node_t::SEQUENCE:
             FK_YAML_ASSERT(m_node_value.p_sequence != nullptr);
@@ -964,10 +1684,9 @@ public:
             FK_YAML_ASSERT(m_node_value.p_mapping != nullptr);
             return m_node_value.p_mapping->size();
         case node_t::STRING:
-            FK_YAML_ASSERT(m_node_value.p_string != nullptr);
-            return m_node_value.p_string->size();
+            return m_node_value.string_size();
         default:
-            throw fkyaml::type_error("The target node is not of a container type.", m_node_type);
+            throw fkyaml::type_error("The target node is not of a container type.", m_node_value.attrs.type());
         }
     }
 
@@ -984,13 +1703,12 @@ public:
                               int> = 0>
     bool contains(KeyType&& key) const
     {
-        switch (m_node_type)
+        switch (m_node_value.attrs.type())
         {
         case node_t::MAPPING: {
             FK_YAML_ASSERT(m_node_value.p_mapping != nullptr);
-            mapping_type& map = *m_node_value.p_mapping;
-            basic_node node_key = std::forward<KeyType>(key);
-            return map.find(node_key) != map.end();
+            const mapping_type& map = *m_node_value.p_mapping;
+            return map.find(detail::to_lookup_key<basic_node>(std::forward<KeyType>(key))) != map.end();
         }
         default:
             return false;
@@ -1006,11 +1724,11 @@ public:
         typename KeyType, detail::enable_if_t<detail::is_basic_node<detail::remove_cvref_t<KeyType>>::value, int> = 0>
     bool contains(KeyType&& key) const
     {
-        switch (m_node_type)
+        switch (m_node_value.attrs.type())
         {
         case node_t::MAPPING: {
             FK_YAML_ASSERT(m_node_value.p_mapping != nullptr);
-            mapping_type& map = *m_node_value.p_mapping;
+            const mapping_type& map = *m_node_value.p_mapping;
             return map.find(std::forward<KeyType>(key)) != map.end();
         }
         default:
@@ -1023,7 +1741,7 @@ public:
     /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/get_yaml_version/
     yaml_version_t get_yaml_version() const noexcept
     {
-        return m_yaml_version_type;
+        return m_node_value.attrs.version();
     }
 
     /// @brief Set the YAML version specification for this basic_node object.
@@ -1031,7 +1749,7 @@ public:
     /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/set_yaml_version/
     void set_yaml_version(const yaml_version_t version) noexcept
     {
-        m_yaml_version_type = version;
+        m_node_value.attrs.set_version(version);
     }
 
     /// @brief Check whether or not this basic_node object has already had any anchor name.
@@ -1039,7 +1757,7 @@ public:
     /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/has_anchor_name/
     bool has_anchor_name() const noexcept
     {
-        return m_prop.anchor_status != detail::anchor_status_t::NONE && !m_prop.anchor.empty();
+        return m_node_value.attrs.anchor_status() != detail::anchor_status_t::NONE && !m_prop->anchor.empty();
     }
 
     /// @brief Get the anchor name associated to this basic_node object.
@@ -1053,7 +1771,7 @@ public:
         {
             throw fkyaml::exception("No anchor name has been set.");
         }
-        return m_prop.anchor;
+        return m_prop->anchor;
     }
 
     /// @brief Add an anchor name to this basic_node object.
@@ -1061,8 +1779,8 @@ public:
     /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/add_anchor_name/
     void add_anchor_name(const std::string& anchor_name)
     {
-        m_prop.anchor_status = detail::anchor_status_t::ANCHOR;
-        m_prop.anchor = anchor_name;
+        get_property().anchor = anchor_name;
+        m_node_value.attrs.set_anchor_status(detail::anchor_status_t::ANCHOR);
     }
 
     /// @brief Add an anchor name to this basic_node object.
@@ -1071,8 +1789,8 @@ public:
     /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/add_anchor_name/
     void add_anchor_name(std::string&& anchor_name)
     {
-        m_prop.anchor_status = detail::anchor_status_t::ANCHOR;
-        m_prop.anchor = std::move(anchor_name);
+        get_property().anchor = std::move(anchor_name);
+        m_node_value.attrs.set_anchor_status(detail::anchor_status_t::ANCHOR);
     }
 
     /// @brief Get the node value object converted into a given type.
@@ -1095,6 +1813,22 @@ public:
         return ret;
     }
 
+    /// @brief Get the node value converted into a std::vector object, converting the elements with multiple threads.
+    /// @tparam T A std::vector type whose elements are compatible with the sequence elements.
+    /// @tparam ValueType The std::vector type without cv-qualifiers and reference.
+    /// @param num_threads The number of threads to be used. 0 means the number of hardware threads.
+    /// @return A std::vector object converted from the sequence node, which is the same as get_value() returns.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/get_value_parallel/
+    template <
+        typename T, typename ValueType = detail::remove_cvref_t<T>,
+        detail::enable_if_t<detail::is_parallel_convertible_vector<basic_node, ValueType>::value, int> = 0>
+    T get_value_parallel(std::size_t num_threads = 0) const
+    {
+        auto ret = ValueType();
+        detail::basic_node_parallelizer<basic_node>::convert(*this, ret, num_threads);
+        return ret;
+    }
+
     /// @brief Explicit reference access to the internally stored YAML node value.
     /// @tparam ReferenceType Reference type to the target YAML node value.
     /// @return Reference to the internally stored YAML node value.
@@ -1125,18 +1859,158 @@ public:
     /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/swap/
     void swap(basic_node& rhs) noexcept
     {
-        using std::swap;
-        swap(m_node_type, rhs.m_node_type);
-        swap(m_yaml_version_type, rhs.m_yaml_version_type);
+        if (this == &rhs)
+        {
+            // moving the value out of itself would leave nothing to be moved back.
+            return;
+        }
 
+        // the attributes are moved together with the values.
         node_value tmp {};
-        std::memcpy(&tmp, &m_node_value, sizeof(node_value));
-        std::memcpy(&m_node_value, &rhs.m_node_value, sizeof(node_value));
-        std::memcpy(&rhs.m_node_value, &tmp, sizeof(node_value));
+        tmp.move_from(m_node_value);
+        m_node_value.move_from(rhs.m_node_value);
+        rhs.m_node_value.move_from(tmp);
+
+        m_prop.swap(rhs.m_prop);
+    }
+
+    /// @brief Reduces the memory used by this basic_node object and its descendants.
+    /// @note Container capacities are shrunk, and long strings and identical container subtrees which appear more than
+    /// once are shared.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/compact/
+    void compact()
+    {
+        key_interner_type key_interner {};
+        compact(key_interner);
+    }
+
+    /// @brief Reduces the memory used by this basic_node object and its descendants with the given key interner.
+    /// @note Long strings which have already been interned in `key_interner` are shared as well.
+    /// @param[in,out] key_interner A pool of strings to be shared among node trees.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/compact/
+    void compact(key_interner_type& key_interner)
+    {
+        detail::basic_node_compactor<basic_node>(key_interner).compact(*this);
+    }
+
+    /// @brief Deserializes an input source into a compacted basic_node object.
+    /// @note Equal string mapping keys share one string while being deserialized, and then the node tree is compacted.
+    /// @tparam InputType Type of a compatible input.
+    /// @param[in] input An input source in the YAML format.
+    /// @return The resulting compacted basic_node object.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/compact_document/
+    template <typename InputType>
+    static basic_node compact_document(InputType&& input)
+    {
+        key_interner_type key_interner {};
+        return compact_document(std::forward<InputType>(input), key_interner);
+    }
+
+    /// @brief Deserializes an input source into a compacted basic_node object with the given key interner.
+    /// @tparam InputType Type of a compatible input.
+    /// @param[in] input An input source in the YAML format.
+    /// @param[in,out] key_interner A pool of strings to be shared among node trees.
+    /// @return The resulting compacted basic_node object.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/compact_document/
+    template <typename InputType>
+    static basic_node compact_document(InputType&& input, key_interner_type& key_interner)
+    {
+        basic_node node = deserialize(std::forward<InputType>(input), key_interner);
+        node.compact(key_interner);
+        return node;
+    }
+
+    /// @brief Makes this basic_node object and its descendants share their values with their copies.
+    /// @note Containers become copy-on-write ones and long strings become immutable shared ones, so copying them takes
+    /// constant time. A copy-on-write container is copied only when it is accessed for modification.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/make_copy_on_write/
+    void make_copy_on_write()
+    {
+        std::vector<basic_node*> stack(1, this);
+
+        while (!stack.empty())
+        {
+            basic_node& node = *stack.back();
+            stack.pop_back();
+
+            switch (node.m_node_value.attrs.type())
+            {
+            case node_t::SEQUENCE:
+                if (!node.m_node_value.is_exclusive())
+                {
+                    // the elements of a shared container must not be modified.
+                    break;
+                }
+                node.m_node_value.make_shared_container();
+                for (basic_node& elem : *node.m_node_value.p_sequence)
+                {
+                    stack.push_back(&elem);
+                }
+                break;
+            case node_t::MAPPING:
+                if (!node.m_node_value.is_exclusive())
+                {
+                    break;
+                }
+                node.m_node_value.make_shared_container();
+                for (auto& entry : *node.m_node_value.p_mapping)
+                {
+                    stack.push_back(&entry.second);
+                }
+                break;
+            case node_t::STRING:
+                // strings stored in place can be copied without heap allocation.
+                if (!node.m_node_value.attrs.is_shared() && !node.m_node_value.is_small_string())
+                {
+                    shared_string_pointer p_str = shared_string_pointer::create(std::move(*node.m_node_value.p_string));
+                    destroy_object<string_type>(node.m_node_value.p_string);
+                    node.m_node_value.construct_shared_string(std::move(p_str));
+                    node.m_node_value.attrs.set_shared(true);
+                }
+                break;
+            default:
+                break;
+            }
+        }
+    }
+
+    /// @brief Calculates the 64-bit structural digest of this basic_node object and its descendants.
+    /// @note Equal nodes always have the same digest, and std::hash of a node is derived from its digest. Digests of
+    /// copy-on-write containers shared with other nodes are cached in them, so calculating the digest again visits only
+    /// the containers modified (and therefore copied) since the last calculation.
+    /// @return The digest of this basic_node object.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/digest/
+    std::uint64_t digest() const
+    {
+        return detail::node_hash<basic_node>::digest(*this);
+    }
+
+    /// @brief Creates a frozen, read-only copy of this basic_node object and its descendants.
+    /// @note The frozen copy is stored in a few contiguous arrays and looks up keys with minimal perfect hashing.
+    /// @return The view of the root of the frozen copy.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/freeze/
+    basic_frozen_node<basic_node> freeze() const
+    {
+        return basic_frozen_node<basic_node>(*this);
+    }
 
-        swap(m_prop.tag, rhs.m_prop.tag);
-        swap(m_prop.anchor_status, rhs.m_prop.anchor_status);
-        swap(m_prop.anchor, rhs.m_prop.anchor);
+    /// @brief Creates a copy of this basic_node object, copying large trees with multiple threads.
+    /// @note The copy is the same as the one created by the copy constructor.
+    /// @param num_threads The number of threads to be used. 0 means the number of hardware threads.
+    /// @return A copy of this basic_node object.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/clone_parallel/
+    basic_node clone_parallel(std::size_t num_threads = 0) const
+    {
+        return detail::basic_node_parallelizer<basic_node>::clone(*this, num_threads);
+    }
+
+    /// @brief Destroys the value of this basic_node object, destroying large trees with multiple threads.
+    /// @note This basic_node object is left as a null node without any anchor name or tag name.
+    /// @param num_threads The number of threads to be used. 0 means the number of hardware threads.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/destroy_parallel/
+    void destroy_parallel(std::size_t num_threads = 0)
+    {
+        detail::basic_node_parallelizer<basic_node>::destroy(*this, num_threads);
     }
 
     /// @brief Returns the first iterator of basic_node values of container types (sequence or mapping) from a non-const
@@ -1145,7 +2019,9 @@ public:
     /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/begin/
     iterator begin()
     {
-        switch (m_node_type)
+        unshare_container();
+
+        switch (m_node_value.attrs.type())
         {
         case node_t::SEQUENCE:
             FK_YAML_ASSERT(m_node_value.p_sequence != nullptr);
@@ -1154,7 +2030,8 @@ public:
             FK_YAML_ASSERT(m_node_value.p_mapping != nullptr);
             return {detail::mapping_iterator_tag(), m_node_value.p_mapping->begin()};
         default:
-            throw fkyaml::type_error("The target node is neither of sequence nor mapping types.", m_node_type);
+            throw fkyaml::type_error(
+                "The target node is neither of sequence nor mapping types.", m_node_value.attrs.type());
         }
     }
 
@@ -1164,7 +2041,7 @@ public:
     /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/begin/
     const_iterator begin() const
     {
-        switch (m_node_type)
+        switch (m_node_value.attrs.type())
         {
         case node_t::SEQUENCE:
             FK_YAML_ASSERT(m_node_value.p_sequence != nullptr);
@@ -1173,7 +2050,8 @@ public:
             FK_YAML_ASSERT(m_node_value.p_mapping != nullptr);
             return {detail::mapping_iterator_tag(), m_node_value.p_mapping->begin()};
         default:
-            throw fkyaml::type_error("The target node is neither of sequence nor mapping types.", m_node_type);
+            throw fkyaml::type_error(
+                "The target node is neither of sequence nor mapping types.", m_node_value.attrs.type());
         }
     }
 
@@ -1183,7 +2061,9 @@ public:
     /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/end/
     iterator end()
     {
-        switch (m_node_type)
+        unshare_container();
+
+        switch (m_node_value.attrs.type())
         {
         case node_t::SEQUENCE:
             FK_YAML_ASSERT(m_node_value.p_sequence != nullptr);
@@ -1192,7 +2072,8 @@ public:
             FK_YAML_ASSERT(m_node_value.p_mapping != nullptr);
             return {detail::mapping_iterator_tag(), m_node_value.p_mapping->end()};
         default:
-            throw fkyaml::type_error("The target node is neither of sequence nor mapping types.", m_node_type);
+            throw fkyaml::type_error(
+                "The target node is neither of sequence nor mapping types.", m_node_value.attrs.type());
         }
     }
 
@@ -1202,7 +2083,7 @@ public:
     /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/end/
     const_iterator end() const
     {
-        switch (m_node_type)
+        switch (m_node_value.attrs.type())
         {
         case node_t::SEQUENCE:
             FK_YAML_ASSERT(m_node_value.p_sequence != nullptr);
@@ -1211,7 +2092,8 @@ public:
             FK_YAML_ASSERT(m_node_value.p_mapping != nullptr);
             return {detail::mapping_iterator_tag(), m_node_value.p_mapping->end()};
         default:
-            throw fkyaml::type_error("The target node is neither of sequence nor mapping types.", m_node_type);
+            throw fkyaml::type_error(
+                "The target node is neither of sequence nor mapping types.", m_node_value.attrs.type());
         }
     }
 
@@ -1223,8 +2105,9 @@ private:
     {
         if (!is_sequence())
         {
-            throw fkyaml::type_error("The node value is not a sequence.", m_node_type);
+            throw fkyaml::type_error("The node value is not a sequence.", m_node_value.attrs.type());
         }
+        unshare_container();
         return *(m_node_value.p_sequence);
     }
 
@@ -1235,7 +2118,7 @@ private:
     {
         if (!is_sequence())
         {
-            throw fkyaml::type_error("The node value is not a sequence.", m_node_type);
+            throw fkyaml::type_error("The node value is not a sequence.", m_node_value.attrs.type());
         }
         return *(m_node_value.p_sequence);
     }
@@ -1247,8 +2130,9 @@ private:
     {
         if (!is_mapping())
         {
-            throw fkyaml::type_error("The node value is not a mapping.", m_node_type);
+            throw fkyaml::type_error("The node value is not a mapping.", m_node_value.attrs.type());
         }
+        unshare_container();
         return *(m_node_value.p_mapping);
     }
 
@@ -1259,7 +2143,7 @@ private:
     {
         if (!is_mapping())
         {
-            throw fkyaml::type_error("The node value is not a mapping.", m_node_type);
+            throw fkyaml::type_error("The node value is not a mapping.", m_node_value.attrs.type());
         }
         return *(m_node_value.p_mapping);
     }
@@ -1271,7 +2155,7 @@ private:
     {
         if (!is_boolean())
         {
-            throw fkyaml::type_error("The node value is not a boolean.", m_node_type);
+            throw fkyaml::type_error("The node value is not a boolean.", m_node_value.attrs.type());
         }
         return m_node_value.boolean;
     }
@@ -1283,7 +2167,7 @@ private:
     {
         if (!is_boolean())
         {
-            throw fkyaml::type_error("The node value is not a boolean.", m_node_type);
+            throw fkyaml::type_error("The node value is not a boolean.", m_node_value.attrs.type());
         }
         return m_node_value.boolean;
     }
@@ -1295,7 +2179,7 @@ private:
     {
         if (!is_integer())
         {
-            throw fkyaml::type_error("The node value is not an integer.", m_node_type);
+            throw fkyaml::type_error("The node value is not an integer.", m_node_value.attrs.type());
         }
         return m_node_value.integer;
     }
@@ -1307,7 +2191,7 @@ private:
     {
         if (!is_integer())
         {
-            throw fkyaml::type_error("The node value is not an integer.", m_node_type);
+            throw fkyaml::type_error("The node value is not an integer.", m_node_value.attrs.type());
         }
         return m_node_value.integer;
     }
@@ -1319,7 +2203,7 @@ private:
     {
         if (!is_float_number())
         {
-            throw fkyaml::type_error("The node value is not a floating point number.", m_node_type);
+            throw fkyaml::type_error("The node value is not a floating point number.", m_node_value.attrs.type());
         }
         return m_node_value.float_val;
     }
@@ -1331,43 +2215,60 @@ private:
     {
         if (!is_float_number())
         {
-            throw fkyaml::type_error("The node value is not a floating point number.", m_node_type);
+            throw fkyaml::type_error("The node value is not a floating point number.", m_node_value.attrs.type());
         }
         return m_node_value.float_val;
     }
 
     /// @brief Returns reference to the string node value.
+    /// @note A shared string is copied and a string stored in place is moved to the heap for the first time.
     /// @throw fkyaml::exception The node value is not a string.
     /// @return Reference to the string node value.
     string_type& get_value_ref_impl(string_type* /*unused*/)
     {
         if (!is_string())
         {
-            throw fkyaml::type_error("The node value is not a string.", m_node_type);
+            throw fkyaml::type_error("The node value is not a string.", m_node_value.attrs.type());
         }
-        return *(m_node_value.p_string);
+        return m_node_value.get_owned_string();
     }
 
     /// @brief Returns reference to the string node value.
+    /// @note The node value is never modified, so this can be called from multiple threads at the same time.
+    /// Since there's no string object to be referenced for a string stored in place, a copy of it is kept instead.
     /// @throw fkyaml::exception The node value is not a string.
     /// @return Constant reference to the string node value.
     const string_type& get_value_ref_impl(const string_type* /*unused*/) const
     {
         if (!is_string())
         {
-            throw fkyaml::type_error("The node value is not a string.", m_node_type);
+            throw fkyaml::type_error("The node value is not a string.", m_node_value.attrs.type());
+        }
+        if (m_node_value.attrs.is_shared())
+        {
+            return *(m_node_value.p_shared_str);
         }
-        return *(m_node_value.p_string);
+        if (m_node_value.small_size == node_value::heap_string)
+        {
+            return *(m_node_value.p_string);
+        }
+        return m_prop.get_or_create().get_string_copy(m_node_value.small_data(), m_node_value.small_size);
+    }
+
+    /// @brief Check whether this node and the given one share the same interned string.
+    /// @warning Make sure both nodes are of string type before calling this function.
+    /// @param[in] rhs A basic_node object to be compared with.
+    /// @return true if both nodes share the same interned string, false otherwise.
+    bool is_same_shared_string(const basic_node& rhs) const noexcept
+    {
+        return m_node_value.attrs.is_shared() && rhs.m_node_value.attrs.is_shared() &&
+               m_node_value.p_shared_str == rhs.m_node_value.p_shared_str;
     }
 
-    /// The current node value type.
-    node_t m_node_type {node_t::NULL_OBJECT};
-    /// The YAML version specification.
-    yaml_version_t m_yaml_version_type {yaml_version_t::VER_1_2};
-    /// The current node value.
+    /// The current node value and the attributes of this node.
     node_value m_node_value {};
-    /// The property set of this node.
-    detail::node_property m_prop {};
+    /// The property set of this node, which is allocated only when the node has a tag, an anchor name or a string copy.
+    detail::node_property_ptr<property_type> m_prop {};
 };
 
 /// @brief Swap function for basic_node objects.
@@ -1428,6 +2329,76 @@ inline std::istream& operator>>(
 /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/node/
 using node = basic_node<>;
 
+/// @brief YAML node value container whose mappings are hash tables.
+/// @sa https://fktn-k.github.io/fkYAML/api/basic_node/unordered_node/
+using unordered_node = basic_node<std::vector, std::unordered_map>;
+
+/// @brief default pull parser which reads parse events of a YAML document.
+/// @sa https://fktn-k.github.io/fkYAML/api/event_reader/
+using event_reader = basic_event_reader<node>;
+
+/// @brief default read-only view of a frozen YAML node.
+/// @sa https://fktn-k.github.io/fkYAML/api/frozen_node/
+using frozen_node = basic_frozen_node<node>;
+
+/// @brief default read-only view of a lazily deserialized YAML node.
+/// @sa https://fktn-k.github.io/fkYAML/api/lazy_node/
+using lazy_node = basic_lazy_node<node>;
+
+/// @brief default edit of a YAML node tree.
+/// @sa https://fktn-k.github.io/fkYAML/api/node_patch/
+using node_edit = basic_node_edit<node>;
+
+/// @brief default edit script of a YAML node tree.
+/// @sa https://fktn-k.github.io/fkYAML/api/node_patch/
+using node_patch = basic_node_patch<node>;
+
+/// @brief default compiled path to a YAML node.
+/// @sa https://fktn-k.github.io/fkYAML/api/node_path/
+using path = basic_node_path<node>;
+
+/// @brief default base class of YAML node visitors.
+/// @sa https://fktn-k.github.io/fkYAML/api/node_visitor/
+using node_visitor = basic_node_visitor<node>;
+
+/// @brief default reclaimer which destroys retired YAML nodes later.
+/// @sa https://fktn-k.github.io/fkYAML/api/node_reclaimer/
+using node_reclaimer = basic_node_reclaimer<node>;
+
+/// @brief default reusable parser which deserializes YAML documents into YAML nodes.
+/// @sa https://fktn-k.github.io/fkYAML/api/parser/
+using parser = basic_parser<node>;
+
+/// @brief default pool of mapping key strings shared by nodes.
+/// @sa https://fktn-k.github.io/fkYAML/api/key_interner/
+using key_interner = node::key_interner_type;
+
+/// @brief Deserialize an input source directly into a value without creating intermediate node objects.
+/// @tparam T Type of the value.
+/// @tparam InputType Type of a compatible input.
+/// @param[in] input An input source in the YAML format.
+/// @param[out] value A value which the deserialized contents are written into.
+/// @sa https://fktn-k.github.io/fkYAML/api/deserialize_into/
+template <typename T, typename InputType>
+inline void deserialize_into(InputType&& input, T& value)
+{
+    detail::basic_deserializer<node>().deserialize_into(detail::input_adapter(std::forward<InputType>(input)), value);
+}
+
+/// @brief Deserialize input iterators directly into a value without creating intermediate node objects.
+/// @tparam T Type of the value.
+/// @tparam ItrType Type of a compatible iterator.
+/// @param[in] begin An iterator to the first element of an input sequence.
+/// @param[in] end An iterator to the past-the-last element of an input sequence.
+/// @param[out] value A value which the deserialized contents are written into.
+/// @sa https://fktn-k.github.io/fkYAML/api/deserialize_into/
+template <typename T, typename ItrType>
+inline void deserialize_into(ItrType&& begin, ItrType&& end, T& value)
+{
+    detail::basic_deserializer<node>().deserialize_into(
+        detail::input_adapter(std::forward<ItrType>(begin), std::forward<ItrType>(end)), value);
+}
+
 /// @brief namespace for user-defined literals for the fkYAML library.
 inline namespace literals
 {
@@ -1481,4 +2452,156 @@ inline fkyaml::node operator"" _yaml(const char8_t* s, std::size_t n)
 
 FK_YAML_NAMESPACE_END
 
+namespace std
+{
+
+/// @brief A partial specialization of std::hash for basic_node template class.
+/// @note This is transparent for string and integer keys which are hashed without conversion into basic_node objects.
+/// @sa https://fktn-k.github.io/fkYAML/api/basic_node/std_hash/
+template <
+    template <typename, typename...> class SequenceType, template <typename, typename, typename...> class MappingType,
+    typename BooleanType, typename IntegerType, typename FloatNumberType, typename StringType,
+    template <typename, typename = void> class ConverterType>
+struct hash<fkyaml::basic_node<
+    SequenceType, MappingType, BooleanType, IntegerType, FloatNumberType, StringType, ConverterType>>
+{
+    /** A type for the basic_node objects to be hashed. */
+    using node_type = fkyaml::basic_node<
+        SequenceType, MappingType, BooleanType, IntegerType, FloatNumberType, StringType, ConverterType>;
+    /** A tag to enable heterogeneous lookups in hash-based containers. */
+    using is_transparent = void;
+
+    /// @brief Calculate the hash value of the given basic_node object.
+    /// @param n A basic_node object to be hashed.
+    /// @return The hash value of `n`.
+    std::size_t operator()(const node_type& n) const
+    {
+        return fkyaml::detail::node_hash<node_type>()(n);
+    }
+
+    /// @brief Calculate the hash value of the given key as if it were converted into a basic_node object.
+    /// @tparam KeyType A string or integer key type.
+    /// @param key A key to be hashed.
+    /// @return The hash value of `key`.
+    template <
+        typename KeyType,
+        fkyaml::detail::enable_if_t<fkyaml::detail::is_lookup_key<node_type, KeyType>::value, int> = 0>
+    std::size_t operator()(const KeyType& key) const noexcept
+    {
+        return fkyaml::detail::node_hash<node_type>()(key);
+    }
+};
+
+/// @brief A partial specialization of std::equal_to for basic_node template class.
+/// @note This is transparent for string and integer keys which are compared without conversion into basic_node
+/// objects.
+/// @sa https://fktn-k.github.io/fkYAML/api/basic_node/std_hash/
+template <
+    template <typename, typename...> class SequenceType, template <typename, typename, typename...> class MappingType,
+    typename BooleanType, typename IntegerType, typename FloatNumberType, typename StringType,
+    template <typename, typename = void> class ConverterType>
+struct equal_to<fkyaml::basic_node<
+    SequenceType, MappingType, BooleanType, IntegerType, FloatNumberType, StringType, ConverterType>>
+{
+    /** A type for the basic_node objects to be compared. */
+    using node_type = fkyaml::basic_node<
+        SequenceType, MappingType, BooleanType, IntegerType, FloatNumberType, StringType, ConverterType>;
+    /** A type for the comparisons with keys. */
+    using comparator_type = fkyaml::detail::basic_node_comparator<node_type>;
+    /** A tag to enable heterogeneous lookups in hash-based containers. */
+    using is_transparent = void;
+
+    /// @brief Check whether the given basic_node objects are equal.
+    /// @param lhs A left-hand-side basic_node object.
+    /// @param rhs A right-hand-side basic_node object.
+    /// @return true if both are equal, false otherwise.
+    bool operator()(const node_type& lhs, const node_type& rhs) const
+    {
+        return lhs == rhs;
+    }
+
+    /// @brief Check whether the given basic_node object is equal to the given key.
+    /// @tparam KeyType A string or integer key type.
+    /// @param lhs A left-hand-side basic_node object.
+    /// @param rhs A right-hand-side key.
+    /// @return true if both are equal, false otherwise.
+    template <
+        typename KeyType,
+        fkyaml::detail::enable_if_t<fkyaml::detail::is_lookup_key<node_type, KeyType>::value, int> = 0>
+    bool operator()(const node_type& lhs, const KeyType& rhs) const
+    {
+        return comparator_type::equal_key(lhs, rhs);
+    }
+
+    /// @brief Check whether the given key is equal to the given basic_node object.
+    /// @tparam KeyType A string or integer key type.
+    /// @param lhs A left-hand-side key.
+    /// @param rhs A right-hand-side basic_node object.
+    /// @return true if both are equal, false otherwise.
+    template <
+        typename KeyType,
+        fkyaml::detail::enable_if_t<fkyaml::detail::is_lookup_key<node_type, KeyType>::value, int> = 0>
+    bool operator()(const KeyType& lhs, const node_type& rhs) const
+    {
+        return comparator_type::equal_key(rhs, lhs);
+    }
+};
+
+/// @brief A partial specialization of std::less for basic_node template class.
+/// @note This is transparent for string and integer keys which are compared without conversion into basic_node
+/// objects, which enables heterogeneous lookups in std::map since C++14.
+/// @sa https://fktn-k.github.io/fkYAML/api/basic_node/operator_lt/
+template <
+    template <typename, typename...> class SequenceType, template <typename, typename, typename...> class MappingType,
+    typename BooleanType, typename IntegerType, typename FloatNumberType, typename StringType,
+    template <typename, typename = void> class ConverterType>
+struct less<fkyaml::basic_node<
+    SequenceType, MappingType, BooleanType, IntegerType, FloatNumberType, StringType, ConverterType>>
+{
+    /** A type for the basic_node objects to be compared. */
+    using node_type = fkyaml::basic_node<
+        SequenceType, MappingType, BooleanType, IntegerType, FloatNumberType, StringType, ConverterType>;
+    /** A type for the comparisons with keys. */
+    using comparator_type = fkyaml::detail::basic_node_comparator<node_type>;
+    /** A tag to enable heterogeneous lookups in sorted associative containers. */
+    using is_transparent = void;
+
+    /// @brief Check whether the given basic_node object is less than the other.
+    /// @param lhs A left-hand-side basic_node object.
+    /// @param rhs A right-hand-side basic_node object.
+    /// @return true if `lhs` is less than `rhs`, false otherwise.
+    bool operator()(const node_type& lhs, const node_type& rhs) const
+    {
+        return lhs < rhs;
+    }
+
+    /// @brief Check whether the given basic_node object is less than the given key.
+    /// @tparam KeyType A string or integer key type.
+    /// @param lhs A left-hand-side basic_node object.
+    /// @param rhs A right-hand-side key.
+    /// @return true if `lhs` is less than `rhs`, false otherwise.
+    template <
+        typename KeyType,
+        fkyaml::detail::enable_if_t<fkyaml::detail::is_lookup_key<node_type, KeyType>::value, int> = 0>
+    bool operator()(const node_type& lhs, const KeyType& rhs) const
+    {
+        return comparator_type::compare_key(lhs, rhs) < 0;
+    }
+
+    /// @brief Check whether the given key is less than the given basic_node object.
+    /// @tparam KeyType A string or integer key type.
+    /// @param lhs A left-hand-side key.
+    /// @param rhs A right-hand-side basic_node object.
+    /// @return true if `lhs` is less than `rhs`, false otherwise.
+    template <
+        typename KeyType,
+        fkyaml::detail::enable_if_t<fkyaml::detail::is_lookup_key<node_type, KeyType>::value, int> = 0>
+    bool operator()(const KeyType& lhs, const node_type& rhs) const
+    {
+        return comparator_type::compare_key(rhs, lhs) > 0;
+    }
+};
+
+} // namespace std
+
 #endif /* FK_YAML_NODE_HPP_ */
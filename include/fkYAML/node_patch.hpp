@@ -0,0 +1,110 @@
+///  _______   __ __   __  _____   __  __  __
+/// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+/// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.2
+/// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+///
+/// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+/// SPDX-License-Identifier: MIT
+///
+/// @file
+
+#ifndef FK_YAML_NODE_PATCH_HPP_
+#define FK_YAML_NODE_PATCH_HPP_
+
+#include <utility>
+#include <vector>
+
+#include <fkYAML/detail/macros/version_macros.hpp>
+#include <fkYAML/detail/meta/node_traits.hpp>
+#include <fkYAML/detail/meta/stl_supplement.hpp>
+#include <fkYAML/detail/node_differ.hpp>
+#include <fkYAML/detail/node_patcher.hpp>
+#include <fkYAML/detail/types/edit_op_t.hpp>
+
+/// @brief namespace for fkYAML library.
+FK_YAML_NAMESPACE_BEGIN
+
+/// @brief An edit of a basic_node tree at a path.
+/// @tparam BasicNodeType A basic_node template instance type.
+/// @sa https://fktn-k.github.io/fkYAML/api/node_patch/
+template <typename BasicNodeType>
+struct basic_node_edit
+{
+    static_assert(detail::is_basic_node<BasicNodeType>::value, "basic_node_edit only accepts basic_node<...>");
+
+    /** A type for edit operations. */
+    using op_t = detail::edit_op_t;
+
+    /// The edit operation.
+    op_t op;
+    /// The mapping keys and sequence indices from the root to the edited node.
+    std::vector<BasicNodeType> path;
+    /// The value to be added or to replace the existing one. A null node for remove operations.
+    BasicNodeType value;
+};
+
+/// @brief An edit script which is applied to a basic_node tree in order.
+/// @tparam BasicNodeType A basic_node template instance type.
+/// @sa https://fktn-k.github.io/fkYAML/api/node_patch/
+template <typename BasicNodeType>
+using basic_node_patch = std::vector<basic_node_edit<BasicNodeType>>;
+
+/// @brief Create the edit script which turns the source node into the target node.
+/// @tparam BasicNodeType A basic_node template instance type.
+/// @param[in] source A source node.
+/// @param[in] target A target node.
+/// @return The edit script. Applying it to `source` with patch() makes `source` equal to `target`.
+/// @sa https://fktn-k.github.io/fkYAML/api/node_patch/diff/
+template <typename BasicNodeType, detail::enable_if_t<detail::is_basic_node<BasicNodeType>::value, int> = 0>
+inline basic_node_patch<BasicNodeType> diff(const BasicNodeType& source, const BasicNodeType& target)
+{
+    basic_node_patch<BasicNodeType> script;
+    detail::basic_node_differ<BasicNodeType>::diff(source, target, script);
+    return script;
+}
+
+/// @brief Create the edit script which turns the source node into the target node, moving the values from the target.
+/// @tparam BasicNodeType A basic_node template instance type.
+/// @param[in] source A source node.
+/// @param[in] target A target node, which is left in a valid but unspecified state.
+/// @return The edit script. Applying it to `source` with patch() makes `source` equal to the original `target`.
+/// @sa https://fktn-k.github.io/fkYAML/api/node_patch/diff/
+template <typename BasicNodeType, detail::enable_if_t<detail::is_basic_node<BasicNodeType>::value, int> = 0>
+inline basic_node_patch<BasicNodeType> diff(const BasicNodeType& source, BasicNodeType&& target)
+{
+    basic_node_patch<BasicNodeType> script;
+    detail::basic_node_differ<BasicNodeType>::diff(source, target, script);
+    return script;
+}
+
+/// @brief Apply the edits in the given script to the node in order.
+/// @tparam BasicNodeType A basic_node template instance type.
+/// @param[in,out] node A node to be edited.
+/// @param[in] script An edit script.
+/// @sa https://fktn-k.github.io/fkYAML/api/node_patch/patch/
+template <typename BasicNodeType>
+inline void patch(BasicNodeType& node, const basic_node_patch<BasicNodeType>& script)
+{
+    for (const basic_node_edit<BasicNodeType>& edit : script)
+    {
+        detail::basic_node_patcher<BasicNodeType>::apply(node, edit.op, edit.path, edit.value);
+    }
+}
+
+/// @brief Apply the edits in the given script to the node in order, moving the values from the script.
+/// @tparam BasicNodeType A basic_node template instance type.
+/// @param[in,out] node A node to be edited.
+/// @param[in] script An edit script, whose values are left in valid but unspecified states.
+/// @sa https://fktn-k.github.io/fkYAML/api/node_patch/patch/
+template <typename BasicNodeType>
+inline void patch(BasicNodeType& node, basic_node_patch<BasicNodeType>&& script)
+{
+    for (basic_node_edit<BasicNodeType>& edit : script)
+    {
+        detail::basic_node_patcher<BasicNodeType>::apply(node, edit.op, edit.path, std::move(edit.value));
+    }
+}
+
+FK_YAML_NAMESPACE_END
+
+#endif /* FK_YAML_NODE_PATCH_HPP_ */
@@ -0,0 +1,300 @@
+///  _______   __ __   __  _____   __  __  __
+/// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+/// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.2
+/// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+///
+/// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+/// SPDX-License-Identifier: MIT
+///
+/// @file
+
+#ifndef FK_YAML_NODE_PATH_HPP_
+#define FK_YAML_NODE_PATH_HPP_
+
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <fkYAML/detail/macros/version_macros.hpp>
+#include <fkYAML/detail/meta/node_traits.hpp>
+#include <fkYAML/exception.hpp>
+
+/// @brief namespace for fkYAML library.
+FK_YAML_NAMESPACE_BEGIN
+
+/// @brief A path to a node in basic_node trees, which is compiled once and evaluated without allocations.
+/// @note
+/// A path expression consists of mapping keys separated by dots and sequence indices in brackets, e.g.,
+/// `spec.containers[0].image`. A key which contains dots or brackets can be quoted in brackets, e.g., `["a.b"]`.
+/// The key nodes are created when a path is compiled, so evaluations only look up the existing keys and elements.
+/// @tparam BasicNodeType A basic_node template instance type.
+/// @sa https://fktn-k.github.io/fkYAML/api/node_path/
+template <typename BasicNodeType>
+class basic_node_path
+{
+    static_assert(detail::is_basic_node<BasicNodeType>::value, "basic_node_path only accepts basic_node<...>");
+
+    /** A type for sequence node values. */
+    using sequence_type = typename BasicNodeType::sequence_type;
+    /** A type for mapping node values. */
+    using mapping_type = typename BasicNodeType::mapping_type;
+    /** A type for integer node values. */
+    using integer_type = typename BasicNodeType::integer_type;
+
+    /// @brief A step of a path from a node to one of its children.
+    struct segment
+    {
+        /// The key node, which is an integer node for a sequence index.
+        BasicNodeType key;
+        /// Whether the key has been written as a sequence index.
+        bool is_index;
+        /// The sequence index. Valid only if `is_index` is true.
+        std::size_t index;
+    };
+
+public:
+    /** A type for string node values, in which path expressions are written. */
+    using string_type = typename BasicNodeType::string_type;
+
+public:
+    /// @brief Construct a new basic_node_path object which refers to the root node.
+    basic_node_path() = default;
+
+    /// @brief Construct a new basic_node_path object by compiling the given path expression.
+    /// @param expression A path expression. An empty expression refers to the root node.
+    /// @throw fkyaml::exception The path expression is malformed.
+    /// @sa https://fktn-k.github.io/fkYAML/api/node_path/constructor/
+    explicit basic_node_path(const string_type& expression)
+    {
+        compile(expression);
+    }
+
+    /// @brief Get the number of steps in this path.
+    /// @return The number of mapping keys and sequence indices in this path.
+    std::size_t size() const noexcept
+    {
+        return m_segments.size();
+    }
+
+    /// @brief Check if this path refers to the root node.
+    /// @return true if this path has no steps, false otherwise.
+    bool empty() const noexcept
+    {
+        return m_segments.empty();
+    }
+
+    /// @brief Find the node at this path from the given root node.
+    /// @param root A root node.
+    /// @return Pointer to the node at this path, or nullptr if the path does not exist in `root`.
+    /// @sa https://fktn-k.github.io/fkYAML/api/node_path/find/
+    const BasicNodeType* find(const BasicNodeType& root) const
+    {
+        const BasicNodeType* p_node = &root;
+        for (const segment& seg : m_segments)
+        {
+            p_node = find_child(*p_node, seg);
+            if (p_node == nullptr)
+            {
+                break;
+            }
+        }
+        return p_node;
+    }
+
+    /// @brief Find the node at this path from the given root node for modifications.
+    /// @note The containers on this path are unshared from their copy-on-write copies.
+    /// @param root A root node.
+    /// @return Pointer to the node at this path, or nullptr if the path does not exist in `root`.
+    /// @sa https://fktn-k.github.io/fkYAML/api/node_path/find/
+    BasicNodeType* find(BasicNodeType& root) const
+    {
+        if (!contains(root))
+        {
+            // nothing is unshared for a missing path.
+            return nullptr;
+        }
+
+        BasicNodeType* p_node = &root;
+        for (const segment& seg : m_segments)
+        {
+            p_node = find_child(*p_node, seg);
+        }
+        return p_node;
+    }
+
+    /// @brief Get the node at this path from the given root node.
+    /// @param root A root node.
+    /// @return Constant reference to the node at this path.
+    /// @throw fkyaml::exception The path does not exist in `root`.
+    /// @sa https://fktn-k.github.io/fkYAML/api/node_path/at/
+    const BasicNodeType& at(const BasicNodeType& root) const
+    {
+        const BasicNodeType* p_node = find(root);
+        if (p_node == nullptr)
+        {
+            throw fkyaml::exception("The path does not exist in the node.");
+        }
+        return *p_node;
+    }
+
+    /// @brief Get the node at this path from the given root node for modifications.
+    /// @param root A root node.
+    /// @return Reference to the node at this path.
+    /// @throw fkyaml::exception The path does not exist in `root`.
+    /// @sa https://fktn-k.github.io/fkYAML/api/node_path/at/
+    BasicNodeType& at(BasicNodeType& root) const
+    {
+        BasicNodeType* p_node = find(root);
+        if (p_node == nullptr)
+        {
+            throw fkyaml::exception("The path does not exist in the node.");
+        }
+        return *p_node;
+    }
+
+    /// @brief Check if this path exists in the given root node.
+    /// @param root A root node.
+    /// @return true if this path exists in `root`, false otherwise.
+    /// @sa https://fktn-k.github.io/fkYAML/api/node_path/contains/
+    bool contains(const BasicNodeType& root) const
+    {
+        return find(root) != nullptr;
+    }
+
+private:
+    /// @brief Find the child of the given node at the given step.
+    /// @tparam NodeType The type of the parent node, which may be const.
+    /// @param parent A parent node.
+    /// @param seg A step to the child.
+    /// @return Pointer to the child, or nullptr if the child does not exist.
+    template <typename NodeType>
+    static NodeType* find_child(NodeType& parent, const segment& seg)
+    {
+        using target_sequence_type =
+            typename std::conditional<std::is_const<NodeType>::value, const sequence_type, sequence_type>::type;
+        using target_mapping_type =
+            typename std::conditional<std::is_const<NodeType>::value, const mapping_type, mapping_type>::type;
+
+        if (parent.is_mapping())
+        {
+            target_mapping_type& map = parent.template get_value_ref<target_mapping_type&>();
+            auto itr = map.find(seg.key);
+            return itr != map.end() ? &itr->second : nullptr;
+        }
+
+        if (parent.is_sequence() && seg.is_index)
+        {
+            target_sequence_type& seq = parent.template get_value_ref<target_sequence_type&>();
+            return seg.index < seq.size() ? &seq[seg.index] : nullptr;
+        }
+
+        return nullptr;
+    }
+
+    /// @brief Compile the given path expression into the steps of this path.
+    /// @param expression A path expression.
+    void compile(const string_type& expression)
+    {
+        using char_type = typename string_type::value_type;
+
+        const std::size_t size = expression.size();
+        std::size_t pos = 0;
+        while (pos < size)
+        {
+            const char_type c = expression[pos];
+            if (c == char_type('['))
+            {
+                pos = compile_bracket(expression, pos + 1);
+                continue;
+            }
+
+            if (c == char_type('.'))
+            {
+                if (m_segments.empty())
+                {
+                    throw fkyaml::exception("A path expression must not begin with a dot.");
+                }
+                ++pos;
+            }
+            else if (!m_segments.empty())
+            {
+                throw fkyaml::exception("Keys in a path expression must be separated by dots.");
+            }
+
+            const std::size_t begin = pos;
+            while (pos < size && expression[pos] != char_type('.') && expression[pos] != char_type('['))
+            {
+                ++pos;
+            }
+            if (pos == begin)
+            {
+                throw fkyaml::exception("A path expression contains an empty key.");
+            }
+            add_key(expression.substr(begin, pos - begin));
+        }
+    }
+
+    /// @brief Compile a sequence index or a quoted key in brackets.
+    /// @param expression A path expression.
+    /// @param pos The position right after the opening bracket.
+    /// @return The position right after the closing bracket.
+    std::size_t compile_bracket(const string_type& expression, std::size_t pos)
+    {
+        using char_type = typename string_type::value_type;
+
+        const std::size_t size = expression.size();
+        if (pos < size && (expression[pos] == char_type('"') || expression[pos] == char_type('\'')))
+        {
+            const char_type quote = expression[pos];
+            const std::size_t begin = ++pos;
+            while (pos < size && expression[pos] != quote)
+            {
+                ++pos;
+            }
+            if (pos + 1 >= size || expression[pos + 1] != char_type(']'))
+            {
+                throw fkyaml::exception("A quoted key in a path expression is not closed.");
+            }
+            add_key(expression.substr(begin, pos - begin));
+            return pos + 2;
+        }
+
+        std::size_t index = 0;
+        const std::size_t begin = pos;
+        while (pos < size && expression[pos] >= char_type('0') && expression[pos] <= char_type('9'))
+        {
+            const auto digit = static_cast<std::size_t>(expression[pos] - char_type('0'));
+            if (index > (static_cast<std::size_t>(std::numeric_limits<integer_type>::max()) - digit) / 10)
+            {
+                throw fkyaml::exception("An index in a path expression is too large.");
+            }
+            index = index * 10 + digit;
+            ++pos;
+        }
+        if (pos == begin || pos >= size || expression[pos] != char_type(']'))
+        {
+            throw fkyaml::exception("An index in a path expression must be a non-negative integer in brackets.");
+        }
+
+        // an index is also looked up as an integer key in mappings.
+        m_segments.push_back(segment {BasicNodeType(static_cast<integer_type>(index)), true, index});
+        return pos + 1;
+    }
+
+    /// @brief Add a step to a mapping value with the given key.
+    /// @param key A mapping key.
+    void add_key(string_type&& key)
+    {
+        m_segments.push_back(segment {BasicNodeType(std::move(key)), false, 0});
+    }
+
+private:
+    /// The steps from the root node.
+    std::vector<segment> m_segments;
+};
+
+FK_YAML_NAMESPACE_END
+
+#endif /* FK_YAML_NODE_PATH_HPP_ */
@@ -0,0 +1,176 @@
+///  _______   __ __   __  _____   __  __  __
+/// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+/// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.2
+/// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+///
+/// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+/// SPDX-License-Identifier: MIT
+///
+/// @file
+
+#ifndef FK_YAML_NODE_RECLAIMER_HPP_
+#define FK_YAML_NODE_RECLAIMER_HPP_
+
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <fkYAML/detail/macros/version_macros.hpp>
+#include <fkYAML/detail/meta/node_traits.hpp>
+
+/// @brief namespace for fkYAML library.
+FK_YAML_NAMESPACE_BEGIN
+
+/// @brief A class which destroys retired basic_node trees later, on a background thread or at the caller's request.
+/// @note
+/// Retiring a node only moves its root into a queue, so the thread which drops a large tree doesn't pay for
+/// destroying it. The queued nodes are destroyed in batches by a background thread, or by reclaim() calls if the
+/// background thread is disabled (e.g., to reclaim memory at quiescent points of an event loop).
+/// @tparam BasicNodeType A basic_node template instance type.
+/// @sa https://fktn-k.github.io/fkYAML/api/node_reclaimer/
+template <typename BasicNodeType>
+class basic_node_reclaimer
+{
+    static_assert(detail::is_basic_node<BasicNodeType>::value, "basic_node_reclaimer only accepts basic_node<...>");
+
+public:
+    /// @brief Construct a new basic_node_reclaimer object.
+    /// @param background Whether to destroy retired nodes on a background thread. If the thread cannot be started,
+    /// retired nodes are destroyed by reclaim() calls or the destructor.
+    /// @sa https://fktn-k.github.io/fkYAML/api/node_reclaimer/constructor/
+    explicit basic_node_reclaimer(bool background = true)
+    {
+        if (background)
+        {
+            try
+            {
+                m_thread = std::thread(&basic_node_reclaimer::run, this);
+            }
+            catch (const std::system_error& /*unused*/)
+            {
+                // fall back to reclaim() calls.
+            }
+        }
+    }
+
+    // a reclaimer is referred to by its background thread.
+    basic_node_reclaimer(const basic_node_reclaimer&) = delete;
+    basic_node_reclaimer& operator=(const basic_node_reclaimer&) = delete;
+
+    /// @brief Destroy the basic_node_reclaimer object after destroying all the retired nodes.
+    /// @sa https://fktn-k.github.io/fkYAML/api/node_reclaimer/destructor/
+    ~basic_node_reclaimer()
+    {
+        if (m_thread.joinable())
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_stopping = true;
+            }
+            m_retired.notify_one();
+            m_thread.join();
+        }
+        reclaim();
+    }
+
+    /// @brief Hand over the given node to be destroyed later.
+    /// @param node A node to be destroyed, which is left as a null node.
+    /// @sa https://fktn-k.github.io/fkYAML/api/node_reclaimer/retire/
+    void retire(BasicNodeType&& node)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_queue.push_back(std::move(node));
+        }
+        m_retired.notify_one();
+    }
+
+    /// @brief Destroy the retired nodes on the calling thread.
+    /// @sa https://fktn-k.github.io/fkYAML/api/node_reclaimer/reclaim/
+    void reclaim()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        destroy_batch(lock);
+    }
+
+    /// @brief Wait until all the nodes retired so far are destroyed.
+    /// @note Without the background thread, this is the same as reclaim().
+    /// @sa https://fktn-k.github.io/fkYAML/api/node_reclaimer/wait/
+    void wait()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (!m_thread.joinable())
+        {
+            destroy_batch(lock);
+            return;
+        }
+        m_reclaimed.wait(lock, [this] { return m_queue.empty() && m_num_busy == 0; });
+    }
+
+private:
+    /// @brief Destroy retired nodes until the reclaimer is destroyed. Run by the background thread.
+    void run()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while (true)
+        {
+            m_retired.wait(lock, [this] { return m_stopping || !m_queue.empty(); });
+            if (m_queue.empty())
+            {
+                // stopping without any retired nodes left.
+                break;
+            }
+            destroy_batch(lock);
+        }
+    }
+
+    /// @brief Destroy the queued nodes without holding the lock.
+    /// @param lock The lock of the mutex, which is held before and after calls.
+    void destroy_batch(std::unique_lock<std::mutex>& lock)
+    {
+        if (m_queue.empty())
+        {
+            return;
+        }
+
+        // the buffers are swapped back and forth, so retire() calls seldom allocate memory.
+        std::vector<BasicNodeType> batch;
+        batch.swap(m_queue);
+        ++m_num_busy;
+
+        lock.unlock();
+        batch.clear();
+        lock.lock();
+
+        if (m_queue.empty() && m_queue.capacity() < batch.capacity())
+        {
+            m_queue.swap(batch);
+        }
+        --m_num_busy;
+        m_reclaimed.notify_all();
+    }
+
+private:
+    /// The mutex which guards the members below.
+    std::mutex m_mutex;
+    /// The condition variable notified when nodes are retired or the reclaimer is being destroyed.
+    std::condition_variable m_retired;
+    /// The condition variable notified when a batch of retired nodes are destroyed.
+    std::condition_variable m_reclaimed;
+    /// The retired nodes to be destroyed.
+    std::vector<BasicNodeType> m_queue;
+    /// The number of batches being destroyed.
+    std::size_t m_num_busy {0};
+    /// Whether the reclaimer is being destroyed.
+    bool m_stopping {false};
+    /// The background thread, which is not joinable if it's disabled.
+    std::thread m_thread;
+};
+
+FK_YAML_NAMESPACE_END
+
+#endif /* FK_YAML_NODE_RECLAIMER_HPP_ */
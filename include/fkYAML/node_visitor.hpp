@@ -0,0 +1,223 @@
+///  _______   __ __   __  _____   __  __  __
+/// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+/// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.2
+/// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+///
+/// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+/// SPDX-License-Identifier: MIT
+///
+/// @file
+
+#ifndef FK_YAML_NODE_VISITOR_HPP_
+#define FK_YAML_NODE_VISITOR_HPP_
+
+#include <cstddef>
+#include <type_traits>
+
+#include <fkYAML/detail/macros/version_macros.hpp>
+#include <fkYAML/detail/meta/node_traits.hpp>
+#include <fkYAML/detail/meta/stl_supplement.hpp>
+#include <fkYAML/detail/node_traverser.hpp>
+
+/// @brief namespace for fkYAML library.
+FK_YAML_NAMESPACE_BEGIN
+
+/// @brief A base class of visitors which receive typed callbacks from visit().
+/// @note
+/// All the member functions do nothing, and the container callbacks return true to visit all the nodes. A derived
+/// visitor only has to define the member functions it needs, which hide the ones of this class. The callbacks receive
+/// const nodes in read-only traversals and non-const nodes otherwise, so they're defined as templates here.
+/// @tparam BasicNodeType A basic_node template instance type.
+/// @sa https://fktn-k.github.io/fkYAML/api/node_visitor/
+template <typename BasicNodeType>
+struct basic_node_visitor
+{
+    static_assert(detail::is_basic_node<BasicNodeType>::value, "basic_node_visitor only accepts basic_node<...>");
+
+    /** A type for boolean node values. */
+    using boolean_type = typename BasicNodeType::boolean_type;
+    /** A type for integer node values. */
+    using integer_type = typename BasicNodeType::integer_type;
+    /** A type for float number node values. */
+    using float_number_type = typename BasicNodeType::float_number_type;
+    /** A type for string node values. */
+    using string_type = typename BasicNodeType::string_type;
+
+    /// @brief Called when a mapping node is visited.
+    /// @return true to visit the entries of the mapping, false to skip them.
+    template <typename NodeType>
+    bool start_mapping(NodeType& /*unused*/)
+    {
+        return true;
+    }
+
+    /// @brief Called after the entries of a mapping node are visited or skipped.
+    template <typename NodeType>
+    void end_mapping(NodeType& /*unused*/)
+    {
+    }
+
+    /// @brief Called when a sequence node is visited.
+    /// @return true to visit the elements of the sequence, false to skip them.
+    template <typename NodeType>
+    bool start_sequence(NodeType& /*unused*/)
+    {
+        return true;
+    }
+
+    /// @brief Called after the elements of a sequence node are visited or skipped.
+    template <typename NodeType>
+    void end_sequence(NodeType& /*unused*/)
+    {
+    }
+
+    /// @brief Called for each entry of a mapping node before its value is visited.
+    /// @return true to visit the value, false to skip it.
+    template <typename NodeType>
+    bool mapping_value(const BasicNodeType& /*unused*/, NodeType& /*unused*/)
+    {
+        return true;
+    }
+
+    /// @brief Called for each element of a sequence node before it's visited.
+    /// @return true to visit the element, false to skip it.
+    template <typename NodeType>
+    bool sequence_element(std::size_t /*unused*/, NodeType& /*unused*/)
+    {
+        return true;
+    }
+
+    /// @brief Called when a null node is visited.
+    template <typename NodeType>
+    void null_scalar(NodeType& /*unused*/)
+    {
+    }
+
+    /// @brief Called when a boolean node is visited.
+    template <typename NodeType>
+    void boolean_scalar(NodeType& /*unused*/, boolean_type /*unused*/)
+    {
+    }
+
+    /// @brief Called when an integer node is visited.
+    template <typename NodeType>
+    void integer_scalar(NodeType& /*unused*/, integer_type /*unused*/)
+    {
+    }
+
+    /// @brief Called when a float number node is visited.
+    template <typename NodeType>
+    void float_number_scalar(NodeType& /*unused*/, float_number_type /*unused*/)
+    {
+    }
+
+    /// @brief Called when a string node is visited.
+    template <typename NodeType>
+    void string_scalar(NodeType& /*unused*/, const string_type& /*unused*/)
+    {
+    }
+};
+
+/// @brief Visit the given node and all the nodes in it in depth-first order with an explicit stack.
+/// @note
+/// If `node` is not const, the callbacks may modify the visited nodes, e.g., replace scalar values, but must not add
+/// or remove entries or elements of the containers being visited. The visited containers are unshared from their
+/// copy-on-write copies, so pass a const node for read-only traversals.
+/// @tparam NodeType A basic_node template instance type, which may be const.
+/// @tparam VisitorType The type of the visitor, which is usually derived from basic_node_visitor.
+/// @param[in,out] node A root node.
+/// @param[in,out] visitor A visitor.
+/// @sa https://fktn-k.github.io/fkYAML/api/node_visitor/visit/
+template <
+    typename NodeType, typename VisitorType,
+    detail::enable_if_t<detail::is_basic_node<detail::remove_cv_t<NodeType>>::value, int> = 0>
+inline void visit(NodeType& node, VisitorType&& visitor)
+{
+    detail::basic_node_traverser<NodeType>::traverse(node, visitor);
+}
+
+namespace detail
+{
+
+/// @brief A visitor which calls a function for each visited node.
+/// @tparam BasicNodeType A basic_node template instance type.
+/// @tparam FuncType The type of the function.
+template <typename BasicNodeType, typename FuncType>
+struct node_walk_visitor : basic_node_visitor<BasicNodeType>
+{
+    /// @brief Construct a new node_walk_visitor object.
+    /// @param f A function called for each visited node.
+    explicit node_walk_visitor(FuncType& f) noexcept
+        : func(f)
+    {
+    }
+
+    template <typename NodeType>
+    bool start_mapping(NodeType& node)
+    {
+        return func(node);
+    }
+
+    template <typename NodeType>
+    bool start_sequence(NodeType& node)
+    {
+        return func(node);
+    }
+
+    template <typename NodeType>
+    void null_scalar(NodeType& node)
+    {
+        func(node);
+    }
+
+    template <typename NodeType, typename ValueType>
+    void boolean_scalar(NodeType& node, ValueType /*unused*/)
+    {
+        func(node);
+    }
+
+    template <typename NodeType, typename ValueType>
+    void integer_scalar(NodeType& node, ValueType /*unused*/)
+    {
+        func(node);
+    }
+
+    template <typename NodeType, typename ValueType>
+    void float_number_scalar(NodeType& node, ValueType /*unused*/)
+    {
+        func(node);
+    }
+
+    template <typename NodeType, typename ValueType>
+    void string_scalar(NodeType& node, const ValueType& /*unused*/)
+    {
+        func(node);
+    }
+
+    /// The function called for each visited node.
+    FuncType& func;
+};
+
+} // namespace detail
+
+/// @brief Call the given function for the given node and all the nodes in it in depth-first pre-order.
+/// @note The same restrictions on modifications as visit() apply.
+/// @tparam NodeType A basic_node template instance type, which may be const.
+/// @tparam FuncType The type of the function, which is called with a (const) reference to each node. For containers,
+/// it must return a value convertible to bool, which is true to visit the children or false to skip them.
+/// @param[in,out] node A root node.
+/// @param[in] func A function called for each node.
+/// @sa https://fktn-k.github.io/fkYAML/api/node_visitor/walk/
+template <
+    typename NodeType, typename FuncType,
+    detail::enable_if_t<detail::is_basic_node<detail::remove_cv_t<NodeType>>::value, int> = 0>
+inline void walk(NodeType& node, FuncType&& func)
+{
+    using func_type = typename std::remove_reference<FuncType>::type;
+    detail::node_walk_visitor<detail::remove_cv_t<NodeType>, func_type> visitor(func);
+    detail::basic_node_traverser<NodeType>::traverse(node, visitor);
+}
+
+FK_YAML_NAMESPACE_END
+
+#endif /* FK_YAML_NODE_VISITOR_HPP_ */
@@ -11,20 +11,28 @@
 #ifndef FK_YAML_ORDERED_MAP_HPP_
 #define FK_YAML_ORDERED_MAP_HPP_
 
+#include <cstddef>
 #include <functional>
 #include <initializer_list>
+#include <iterator>
 #include <memory>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include <fkYAML/detail/macros/version_macros.hpp>
 #include <fkYAML/detail/meta/type_traits.hpp>
+#include <fkYAML/detail/node_lookup_key.hpp>
 #include <fkYAML/exception.hpp>
 
 /// @brief namespace for fkYAML library.
 FK_YAML_NAMESPACE_BEGIN
 
 /// @brief A minimal map-like container which preserves insertion order.
+/// @note
+/// Once the number of key-value pairs reaches a threshold, key lookups are accelerated with a hash index if keys can be
+/// hashed with std::hash. The index follows modifications made through this class, but key-value pairs must not be
+/// modified through references to the base std::vector type other than appending ones.
 /// @tparam Key A type for keys.
 /// @tparam Value A type for values.
 /// @tparam IgnoredCompare A placeholder for key comparison. This will be ignored.
@@ -50,6 +58,8 @@ public:
     using const_iterator = typename Container::const_iterator;
     /// A type for size parameters used in this class.
     using size_type = typename Container::size_type;
+    /// A type for the distance between iterators.
+    using difference_type = typename Container::difference_type;
     /// A type for comparison between keys.
     using key_compare = std::equal_to<Key>;
 
@@ -69,7 +79,45 @@ public:
     {
     }
 
+    /// @brief Copy constructor of the ordered_map class.
+    /// @param other An ordered_map object to be copied with.
+    ordered_map(const ordered_map& other) = default;
+
+    /// @brief Move constructor of the ordered_map class.
+    /// @param other An ordered_map object to be moved from.
+    ordered_map(ordered_map&& other) noexcept(std::is_nothrow_move_constructible<Container>::value)
+        : Container(std::move(other)),
+          m_index(std::move(other.m_index)),
+          m_indexed_size(other.m_indexed_size)
+    {
+        other.reset_index();
+    }
+
+    /// @brief Destroy the ordered_map object.
+    /// @sa https://fktn-k.github.io/fkYAML/api/ordered_map/destructor/
+    ~ordered_map() = default;
+
 public:
+    /// @brief A copy assignment operator of the ordered_map class.
+    /// @param rhs An ordered_map object to be copied with.
+    /// @return Reference to this ordered_map object.
+    ordered_map& operator=(const ordered_map& rhs) = default;
+
+    /// @brief A move assignment operator of the ordered_map class.
+    /// @param rhs An ordered_map object to be moved from.
+    /// @return Reference to this ordered_map object.
+    ordered_map& operator=(ordered_map&& rhs) noexcept(std::is_nothrow_move_assignable<Container>::value)
+    {
+        if (this != &rhs)
+        {
+            Container::operator=(std::move(rhs));
+            m_index = std::move(rhs.m_index);
+            m_indexed_size = rhs.m_indexed_size;
+            rhs.reset_index();
+        }
+        return *this;
+    }
+
     /// @brief A subscript operator for ordered_map objects.
     /// @tparam KeyType A type for the input key.
     /// @param key A key to the target value.
@@ -78,7 +126,7 @@ public:
     template <
         typename KeyType,
         detail::enable_if_t<detail::is_usable_as_key_type<key_compare, key_type, KeyType>::value, int> = 0>
-    mapped_type& operator[](KeyType&& key) noexcept
+    mapped_type& operator[](KeyType&& key)
     {
         return emplace(std::forward<KeyType>(key), mapped_type()).first->second;
     }
@@ -93,17 +141,9 @@ public:
     template <
         typename KeyType,
         detail::enable_if_t<detail::is_usable_as_key_type<key_compare, key_type, KeyType>::value, int> = 0>
-    std::pair<iterator, bool> emplace(KeyType&& key, const mapped_type& value) noexcept
+    std::pair<iterator, bool> emplace(KeyType&& key, const mapped_type& value)
     {
-        for (auto itr = this->begin(); itr != this->end(); ++itr)
-        {
-            if (m_compare(itr->first, key))
-            {
-                return {itr, false};
-            }
-        }
-        this->emplace_back(key, value);
-        return {std::prev(this->end()), true};
+        return emplace_impl(std::forward<KeyType>(key), value, detail::is_transparent_key<key_type, KeyType> {});
     }
 
     /// @brief Find a value associated to the given key. Throws an exception if the search fails.
@@ -116,14 +156,14 @@ public:
         detail::enable_if_t<detail::is_usable_as_key_type<key_compare, key_type, KeyType>::value, int> = 0>
     mapped_type& at(KeyType&& key)
     {
-        for (auto itr = this->begin(); itr != this->end(); ++itr)
+        const auto& k = lookup_key(key, detail::is_transparent_key<key_type, KeyType> {});
+        update_index();
+        size_type pos = find_pos(k);
+        if (pos == this->size())
         {
-            if (m_compare(itr->first, key))
-            {
-                return itr->second;
-            }
+            throw fkyaml::exception("key not found.");
         }
-        throw fkyaml::exception("key not found.");
+        return Container::operator[](pos).second;
     }
 
     /// @brief Find a value associated to the given key. Throws an exception if the search fails.
@@ -136,14 +176,13 @@ public:
         detail::enable_if_t<detail::is_usable_as_key_type<key_compare, key_type, KeyType>::value, int> = 0>
     const mapped_type& at(KeyType&& key) const
     {
-        for (auto itr = this->begin(); itr != this->end(); ++itr)
+        const auto& k = lookup_key(key, detail::is_transparent_key<key_type, KeyType> {});
+        size_type pos = find_pos(k);
+        if (pos == this->size())
         {
-            if (m_compare(itr->first, key))
-            {
-                return itr->second;
-            }
+            throw fkyaml::exception("key not found.");
         }
-        throw fkyaml::exception("key not found.");
+        return Container::operator[](pos).second;
     }
 
     /// @brief Find a value with the given key.
@@ -154,16 +193,11 @@ public:
     template <
         typename KeyType,
         detail::enable_if_t<detail::is_usable_as_key_type<key_compare, key_type, KeyType>::value, int> = 0>
-    iterator find(KeyType&& key) noexcept
+    iterator find(KeyType&& key)
     {
-        for (auto itr = this->begin(); itr != this->end(); ++itr)
-        {
-            if (m_compare(itr->first, key))
-            {
-                return itr;
-            }
-        }
-        return this->end();
+        const auto& k = lookup_key(key, detail::is_transparent_key<key_type, KeyType> {});
+        update_index();
+        return std::next(this->begin(), static_cast<difference_type>(find_pos(k)));
     }
 
     /// @brief Find a value with the given key.
@@ -176,19 +210,317 @@ public:
         detail::enable_if_t<detail::is_usable_as_key_type<key_compare, key_type, KeyType>::value, int> = 0>
     const_iterator find(KeyType&& key) const noexcept
     {
-        for (auto itr = this->begin(); itr != this->end(); ++itr)
+        const auto& k = lookup_key(key, detail::is_transparent_key<key_type, KeyType> {});
+        return std::next(this->begin(), static_cast<difference_type>(find_pos(k)));
+    }
+
+    /// @brief Erase a key-value pair from this ordered_map object.
+    /// @param pos The iterator to the key-value pair to be erased.
+    /// @return iterator The iterator following the erased key-value pair.
+    iterator erase(iterator pos)
+    {
+        return erase(const_iterator(pos), const_iterator(pos) + 1);
+    }
+
+    /// @brief Erase a key-value pair from this ordered_map object.
+    /// @param pos The iterator to the key-value pair to be erased.
+    /// @return iterator The iterator following the erased key-value pair.
+    iterator erase(const_iterator pos)
+    {
+        return erase(pos, pos + 1);
+    }
+
+    /// @brief Erase the key-value pairs in the given range from this ordered_map object.
+    /// @param first The iterator to the first key-value pair to be erased.
+    /// @param last The iterator following the last key-value pair to be erased.
+    /// @return iterator The iterator following the last erased key-value pair.
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        reset_index();
+
+        const difference_type offset = first - this->cbegin();
+        const difference_type count = last - first;
+        if (count > 0)
+        {
+            // key-value pairs cannot be move-assigned since their keys are const, so the following pairs are
+            // reconstructed in place instead.
+            auto itr = this->begin() + offset;
+            for (auto next = itr + count; next != this->end(); ++itr, ++next)
+            {
+                itr->~value_type();
+                ::new (static_cast<void*>(std::addressof(*itr))) value_type(std::move(*next));
+            }
+            for (difference_type i = 0; i < count; i++)
+            {
+                Container::pop_back();
+            }
+        }
+
+        return this->begin() + offset;
+    }
+
+    /// @brief Insert key-value pairs to this ordered_map object. See std::vector::insert for the arguments.
+    /// @note Unlike emplace(), this function does not check key duplication.
+    /// @tparam Args Types of arguments passed to std::vector::insert.
+    /// @param args Arguments passed to std::vector::insert.
+    /// @return iterator The iterator pointing to the first inserted key-value pair.
+    template <typename... Args>
+    iterator insert(Args&&... args)
+    {
+        reset_index();
+        return Container::insert(std::forward<Args>(args)...);
+    }
+
+    /// @brief Replace the contents of this ordered_map object. See std::vector::assign for the arguments.
+    /// @tparam Args Types of arguments passed to std::vector::assign.
+    /// @param args Arguments passed to std::vector::assign.
+    template <typename... Args>
+    void assign(Args&&... args)
+    {
+        reset_index();
+        Container::assign(std::forward<Args>(args)...);
+    }
+
+    /// @brief Resize this ordered_map object. See std::vector::resize for the arguments.
+    /// @tparam Args Types of arguments passed to std::vector::resize.
+    /// @param args Arguments passed to std::vector::resize.
+    template <typename... Args>
+    void resize(Args&&... args)
+    {
+        reset_index();
+        Container::resize(std::forward<Args>(args)...);
+    }
+
+    /// @brief Remove the last key-value pair from this ordered_map object.
+    void pop_back()
+    {
+        reset_index();
+        Container::pop_back();
+    }
+
+    /// @brief Remove all the key-value pairs from this ordered_map object.
+    void clear() noexcept
+    {
+        reset_index();
+        Container::clear();
+    }
+
+    /// @brief Swap the contents of this ordered_map object with those of another.
+    /// @param other An ordered_map object to be swapped with.
+    void swap(ordered_map& other) noexcept
+    {
+        Container::swap(other);
+        m_index.swap(other.m_index);
+        std::swap(m_indexed_size, other.m_indexed_size);
+    }
+
+private:
+    /// A type for the buckets of the hash index. (hash value, position + 1) 0 position means an empty bucket.
+    using bucket_type = std::pair<std::size_t, size_type>;
+
+    /// @brief Emplace a new key-value pair if the new key does not exist.
+    /// @note The key is converted into key_type only if it's actually emplaced.
+    /// @tparam KeyType A type for the input key which can be compared with keys without conversion.
+    /// @param key A key to be emplaced to this ordered_map object.
+    /// @param value A value to be emplaced to this ordered_map object.
+    /// @return std::pair<iterator, bool> A result of emplacement of the new key-value pair.
+    template <typename KeyType>
+    std::pair<iterator, bool> emplace_impl(KeyType&& key, const mapped_type& value, std::true_type /*unused*/)
+    {
+        update_index();
+        size_type pos = find_pos(key);
+        if (pos != this->size())
+        {
+            return {std::next(this->begin(), static_cast<difference_type>(pos)), false};
+        }
+
+        this->emplace_back(std::forward<KeyType>(key), value);
+        update_index();
+        return {std::prev(this->end()), true};
+    }
+
+    /// @brief Emplace a new key-value pair after converting the new key into key_type for comparisons.
+    /// @tparam KeyType A type for the input key.
+    /// @param key A key to be emplaced to this ordered_map object.
+    /// @param value A value to be emplaced to this ordered_map object.
+    /// @return std::pair<iterator, bool> A result of emplacement of the new key-value pair.
+    template <typename KeyType>
+    std::pair<iterator, bool> emplace_impl(KeyType&& key, const mapped_type& value, std::false_type /*unused*/)
+    {
+        return emplace_impl(key_type(std::forward<KeyType>(key)), value, std::true_type {});
+    }
+
+    /// @brief Find the position of the key-value pair with the given key.
+    /// @note The hash index is used only if it covers all the key-value pairs since this function must not modify the
+    /// index so that concurrent lookups on a const ordered_map object are safe.
+    /// @tparam KeyType A type for the input key which can be compared with keys without conversion.
+    /// @param key A key to find a key-value pair with.
+    /// @return The position of the found key-value pair, or size() if not found.
+    template <typename KeyType>
+    size_type find_pos(const KeyType& key) const
+    {
+        const size_type size = this->size();
+        if (m_index.empty() || m_indexed_size != size)
+        {
+            for (size_type i = 0; i < size; i++)
+            {
+                if (m_compare(Container::operator[](i).first, key))
+                {
+                    return i;
+                }
+            }
+            return size;
+        }
+
+        const std::size_t hash = hash_key(key, detail::is_hashable<key_type> {});
+        const size_type mask = m_index.size() - 1;
+        for (size_type i = hash & mask; m_index[i].second != 0; i = (i + 1) & mask)
+        {
+            if (m_index[i].first == hash && m_compare(Container::operator[](m_index[i].second - 1).first, key))
+            {
+                return m_index[i].second - 1;
+            }
+        }
+        return size;
+    }
+
+    /// @brief Update the hash index so that it covers all the key-value pairs if the index is in use.
+    void update_index()
+    {
+        update_index(detail::is_hashable<key_type> {});
+    }
+
+    /// @brief Update the hash index so that it covers all the key-value pairs if the index is in use.
+    void update_index(std::true_type /*unused*/)
+    {
+        const size_type size = this->size();
+        if (size < s_index_threshold || m_indexed_size == size)
+        {
+            return;
+        }
+
+        if (m_indexed_size > size)
+        {
+            // some key-value pairs have been removed through the base container.
+            reset_index();
+        }
+
+        // keep the load factor not greater than 0.5 for short probe sequences.
+        size_type capacity = m_index.size();
+        if (capacity < size * 2)
+        {
+            capacity = (capacity == 0) ? s_index_threshold * 2 : capacity;
+            while (capacity < size * 2)
+            {
+                capacity *= 2;
+            }
+
+            std::vector<bucket_type> old_index(capacity);
+            m_index.swap(old_index);
+            for (const bucket_type& bucket : old_index)
+            {
+                if (bucket.second != 0)
+                {
+                    insert_bucket(bucket);
+                }
+            }
+        }
+
+        for (; m_indexed_size < size; ++m_indexed_size)
         {
-            if (m_compare(itr->first, key))
+            const key_type& key = Container::operator[](m_indexed_size).first;
+            const std::size_t hash = hash_key(key, std::true_type {});
+
+            // only the first one of duplicate keys is indexed as a linear search finds.
+            const size_type mask = m_index.size() - 1;
+            size_type i = hash & mask;
+            for (; m_index[i].second != 0; i = (i + 1) & mask)
+            {
+                if (m_index[i].first == hash && m_compare(Container::operator[](m_index[i].second - 1).first, key))
+                {
+                    break;
+                }
+            }
+            if (m_index[i].second == 0)
             {
-                return itr;
+                m_index[i] = bucket_type(hash, m_indexed_size + 1);
             }
         }
-        return this->end();
+    }
+
+    /// @brief Do nothing since keys cannot be hashed.
+    void update_index(std::false_type /*unused*/) noexcept
+    {
+    }
+
+    /// @brief Insert a bucket into the hash index, assuming no buckets with the same key exist.
+    /// @param bucket A bucket to be inserted.
+    void insert_bucket(const bucket_type& bucket) noexcept
+    {
+        const size_type mask = m_index.size() - 1;
+        size_type i = bucket.first & mask;
+        while (m_index[i].second != 0)
+        {
+            i = (i + 1) & mask;
+        }
+        m_index[i] = bucket;
+    }
+
+    /// @brief Clear the hash index. It will be built again on demand.
+    void reset_index() noexcept
+    {
+        m_index.clear();
+        m_indexed_size = 0;
+    }
+
+    /// @brief Pass through a key which can be compared with keys without conversion.
+    /// @tparam KeyType A type for the input key.
+    /// @param key A key to find a key-value pair with.
+    /// @return The given key.
+    template <typename KeyType>
+    static const KeyType& lookup_key(const KeyType& key, std::true_type /*unused*/) noexcept
+    {
+        return key;
+    }
+
+    /// @brief Convert a key into key_type for comparisons with keys.
+    /// @tparam KeyType A type for the input key.
+    /// @param key A key to find a key-value pair with.
+    /// @return The converted key.
+    template <typename KeyType>
+    static key_type lookup_key(const KeyType& key, std::false_type /*unused*/)
+    {
+        return key;
+    }
+
+    /// @brief Calculate the hash value of the given key.
+    /// @tparam KeyType A type for the input key which can be hashed without conversion.
+    /// @param key A key to be hashed.
+    /// @return The hash value of `key`.
+    template <typename KeyType>
+    static std::size_t hash_key(const KeyType& key, std::true_type /*unused*/)
+    {
+        return std::hash<key_type>()(key);
+    }
+
+    /// @brief Never be called since the hash index is not built if keys cannot be hashed.
+    /// @return 0
+    template <typename KeyType>
+    static std::size_t hash_key(const KeyType& /*unused*/, std::false_type /*unused*/) noexcept
+    {
+        return 0; // LCOV_EXCL_LINE
     }
 
 private:
+    /// The minimum number of key-value pairs for building the hash index.
+    static constexpr size_type s_index_threshold = 16;
+
     /// The object for comparing keys.
     key_compare m_compare {};
+    /// The hash index of key-value pairs which is built lazily with open addressing. Its size is a power of 2.
+    std::vector<bucket_type> m_index {};
+    /// The number of key-value pairs covered by the hash index.
+    size_type m_indexed_size {0};
 };
 
 FK_YAML_NAMESPACE_END
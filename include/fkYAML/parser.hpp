@@ -0,0 +1,111 @@
+///  _______   __ __   __  _____   __  __  __
+/// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+/// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.2
+/// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+///
+/// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+/// SPDX-License-Identifier: MIT
+///
+/// @file
+
+#ifndef FK_YAML_PARSER_HPP_
+#define FK_YAML_PARSER_HPP_
+
+#include <memory>
+#include <utility>
+
+#include <fkYAML/detail/macros/version_macros.hpp>
+#include <fkYAML/detail/input/input_adapter.hpp>
+#include <fkYAML/detail/input/node_builder.hpp>
+#include <fkYAML/detail/input/sax_parser.hpp>
+#include <fkYAML/exception.hpp>
+
+/// @brief namespace for fkYAML library.
+FK_YAML_NAMESPACE_BEGIN
+
+/// @brief A reusable parser which deserializes YAML documents into YAML nodes.
+/// @note
+/// The internal buffers (the input buffer, the token buffer and the stacks of the parser and the node builder) are
+/// kept across parse() calls, so parsing many inputs with the same object avoids allocating them again for every input.
+/// @tparam BasicNodeType A basic_node template instance type.
+/// @sa https://fktn-k.github.io/fkYAML/api/parser/
+template <typename BasicNodeType>
+class basic_parser
+{
+    /** A type for the node builder. */
+    using builder_type = detail::basic_node_builder<BasicNodeType>;
+    /** A type for the SAX parser which reports parse events to the node builder. */
+    using sax_parser_type = detail::basic_sax_parser<BasicNodeType, builder_type>;
+
+    /// @brief A set of the node builder and the parser which reports events to it.
+    struct parser_state
+    {
+        parser_state()
+            : parser(builder)
+        {
+        }
+
+        /// The node builder.
+        builder_type builder;
+        /// The parser.
+        sax_parser_type parser;
+    };
+
+public:
+    /// @brief Construct a new basic_parser object.
+    basic_parser()
+        : m_state(new parser_state())
+    {
+    }
+
+public:
+    /// @brief Deserialize an input source into a YAML node.
+    /// @tparam InputType Type of a compatible input.
+    /// @param input An input source in the YAML format.
+    /// @return The resulting basic_node object deserialized from the input source.
+    template <typename InputType>
+    BasicNodeType parse(InputType&& input)
+    {
+        return parse_impl(detail::input_adapter(std::forward<InputType>(input)));
+    }
+
+    /// @brief Deserialize input iterators into a YAML node.
+    /// @tparam ItrType Type of a compatible iterator.
+    /// @param begin An iterator to the first element of an input sequence.
+    /// @param end An iterator to the past-the-last element of an input sequence.
+    /// @return The resulting basic_node object deserialized from the pair of the iterators.
+    template <typename ItrType>
+    BasicNodeType parse(ItrType&& begin, ItrType&& end)
+    {
+        return parse_impl(detail::input_adapter(std::forward<ItrType>(begin), std::forward<ItrType>(end)));
+    }
+
+private:
+    /// @brief Deserialize an input with the internal parser.
+    /// @param input_adapter An input adapter object for the input source.
+    /// @return The resulting basic_node object deserialized from the input source.
+    template <typename InputAdapterType>
+    BasicNodeType parse_impl(InputAdapterType&& input_adapter)
+    {
+        builder_type& builder = m_state->builder;
+        sax_parser_type& parser = m_state->parser;
+
+        builder.reset();
+        bool is_completed = parser.parse(std::forward<InputAdapterType>(input_adapter));
+        if (!is_completed)
+        {
+            throw parse_error(
+                builder.get_error_message().c_str(), parser.get_last_event_line(), parser.get_last_event_indent());
+        }
+
+        return std::move(builder.get_root());
+    }
+
+private:
+    /// The parse states which must not be moved in memory.
+    std::unique_ptr<parser_state> m_state;
+};
+
+FK_YAML_NAMESPACE_END
+
+#endif /* FK_YAML_PARSER_HPP_ */
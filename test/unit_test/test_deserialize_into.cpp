@@ -0,0 +1,230 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.2
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <fkYAML/node.hpp>
+
+namespace test
+{
+
+struct port
+{
+    std::string name;
+    int number = 0;
+    std::vector<std::string> tags;
+};
+
+template <typename BinderType>
+void bind_fields(BinderType& binder, port& p)
+{
+    binder("name", p.name);
+    binder("number", p.number);
+    binder("tags", p.tags);
+}
+
+struct server
+{
+    std::string host;
+    std::int64_t workers = 0;
+    double ratio = 0.0;
+    bool debug = false;
+    unsigned short backlog = 0;
+    std::vector<port> ports;
+    std::map<std::string, std::string> labels;
+    std::unordered_map<std::string, int> limits;
+    fkyaml::node extra;
+};
+
+template <typename BinderType>
+void bind_fields(BinderType& binder, server& s)
+{
+    binder("host", s.host);
+    binder("workers", s.workers);
+    binder("ratio", s.ratio);
+    binder("debug", s.debug);
+    binder("backlog", s.backlog);
+    binder("ports", s.ports);
+    binder("labels", s.labels);
+    binder("limits", s.limits);
+    binder("extra", s.extra);
+}
+
+struct book
+{
+    std::string title;
+    int year = 0;
+};
+
+// no bind_fields() for this type, so deserialize_into() falls back to from_node().
+void from_node(const fkyaml::node& node, book& n)
+{
+    n.title = node["title"].get_value<std::string>();
+    n.year = node["year"].get_value<int>();
+}
+
+struct library
+{
+    std::vector<book> books;
+};
+
+template <typename BinderType>
+void bind_fields(BinderType& binder, library& l)
+{
+    binder("books", l.books);
+}
+
+} // namespace test
+
+TEST_CASE("DeserializeIntoTest_UserDefinedTypeTest", "[DeserializeIntoTest]")
+{
+    std::string input = "host: localhost\n"
+                        "workers: 8\n"
+                        "ratio: 0.75\n"
+                        "debug: true\n"
+                        "backlog: 128\n"
+                        "ports:\n"
+                        "  - name: http\n"
+                        "    number: 80\n"
+                        "    tags: [web, public]\n"
+                        "  - name: admin\n"
+                        "    number: 8080\n"
+                        "labels:\n"
+                        "  env: prod\n"
+                        "  zone: a\n"
+                        "limits: {cpu: 4, memory: 512}\n"
+                        "extra:\n"
+                        "  foo: [1, 2]\n";
+
+    test::server s;
+    fkyaml::deserialize_into(input, s);
+
+    REQUIRE(s.host == "localhost");
+    REQUIRE(s.workers == 8);
+    REQUIRE(s.ratio == Approx(0.75));
+    REQUIRE(s.debug == true);
+    REQUIRE(s.backlog == 128);
+    REQUIRE(s.ports.size() == 2);
+    REQUIRE(s.ports[0].name == "http");
+    REQUIRE(s.ports[0].number == 80);
+    REQUIRE(s.ports[0].tags == std::vector<std::string> {"web", "public"});
+    REQUIRE(s.ports[1].name == "admin");
+    REQUIRE(s.ports[1].number == 8080);
+    REQUIRE(s.ports[1].tags.empty());
+    REQUIRE(s.labels.size() == 2);
+    REQUIRE(s.labels.at("env") == "prod");
+    REQUIRE(s.labels.at("zone") == "a");
+    REQUIRE(s.limits.size() == 2);
+    REQUIRE(s.limits.at("cpu") == 4);
+    REQUIRE(s.limits.at("memory") == 512);
+    REQUIRE(s.extra.is_mapping());
+    REQUIRE(s.extra["foo"][1].get_value<int>() == 2);
+}
+
+TEST_CASE("DeserializeIntoTest_ResultMatchesDeserializeTest", "[DeserializeIntoTest]")
+{
+    auto input = GENERATE(
+        std::string("foo: bar\nbaz: [1, 2.5, true, null]\nqux:\n  - a: 1\n    b: 2\n  - c"),
+        std::string("foo: &a bar\nbaz: *a"),
+        std::string("? a: b\n: 1\n? c\n: d"),
+        std::string(""));
+
+    fkyaml::node expected = fkyaml::node::deserialize(input);
+    fkyaml::node actual;
+    fkyaml::deserialize_into(input, actual);
+    REQUIRE(actual == expected);
+}
+
+TEST_CASE("DeserializeIntoTest_FallbackToFromNodeTest", "[DeserializeIntoTest]")
+{
+    std::string input = "books:\n"
+                        "  - title: Robinson Crusoe\n"
+                        "    year: 1678\n"
+                        "  - title: Frankenstein\n"
+                        "    year: 1818\n";
+
+    test::library l;
+    fkyaml::deserialize_into(input, l);
+    REQUIRE(l.books.size() == 2);
+    REQUIRE(l.books[0].title == "Robinson Crusoe");
+    REQUIRE(l.books[0].year == 1678);
+    REQUIRE(l.books[1].title == "Frankenstein");
+    REQUIRE(l.books[1].year == 1818);
+
+    std::map<std::string, int> m;
+    fkyaml::deserialize_into(std::string("foo: 1\nbar: 2"), m);
+    REQUIRE(m.size() == 2);
+    REQUIRE(m.at("foo") == 1);
+    REQUIRE(m.at("bar") == 2);
+}
+
+TEST_CASE("DeserializeIntoTest_UnknownAndMissingKeysTest", "[DeserializeIntoTest]")
+{
+    test::server s;
+    s.host = "example.com";
+    s.workers = 4;
+    fkyaml::deserialize_into(
+        std::string("host: localhost\nunknown:\n  nested: [1, 2]\n  other: {a: b}\n123: ignored\ndebug: true"), s);
+
+    REQUIRE(s.host == "localhost");
+    REQUIRE(s.workers == 4);
+    REQUIRE(s.debug == true);
+}
+
+TEST_CASE("DeserializeIntoTest_AnchorAndAliasTest", "[DeserializeIntoTest]")
+{
+    test::server s;
+    fkyaml::deserialize_into(std::string("host: &h localhost\nlabels:\n  origin: *h\nextra: *h"), s);
+
+    REQUIRE(s.host == "localhost");
+    REQUIRE(s.labels.at("origin") == "localhost");
+    REQUIRE(s.extra.get_value<std::string>() == "localhost");
+
+    REQUIRE_THROWS_AS(fkyaml::deserialize_into(std::string("host: *h"), s), fkyaml::parse_error);
+}
+
+TEST_CASE("DeserializeIntoTest_ErrorTest", "[DeserializeIntoTest]")
+{
+    test::server s;
+
+    SECTION("type mismatch")
+    {
+        REQUIRE_THROWS_AS(fkyaml::deserialize_into(std::string("workers: foo"), s), fkyaml::type_error);
+        REQUIRE_THROWS_AS(fkyaml::deserialize_into(std::string("host: [1, 2]"), s), fkyaml::type_error);
+        REQUIRE_THROWS_AS(fkyaml::deserialize_into(std::string("ports: {a: b}"), s), fkyaml::type_error);
+        REQUIRE_THROWS_AS(fkyaml::deserialize_into(std::string("labels: [a, b]"), s), fkyaml::type_error);
+        REQUIRE_THROWS_AS(fkyaml::deserialize_into(std::string("debug: 1"), s), fkyaml::type_error);
+    }
+
+    SECTION("integer overflow")
+    {
+        REQUIRE_THROWS_AS(fkyaml::deserialize_into(std::string("backlog: 70000"), s), fkyaml::exception);
+    }
+
+    SECTION("duplicate keys")
+    {
+        REQUIRE_THROWS_AS(fkyaml::deserialize_into(std::string("host: a\nhost: b"), s), fkyaml::parse_error);
+        REQUIRE_THROWS_AS(
+            fkyaml::deserialize_into(std::string("labels:\n  foo: a\n  foo: b"), s), fkyaml::parse_error);
+    }
+}
+
+TEST_CASE("DeserializeIntoTest_IteratorInputTest", "[DeserializeIntoTest]")
+{
+    std::string input = "host: localhost\nworkers: 2";
+    test::server s;
+    fkyaml::deserialize_into(input.begin(), input.end(), s);
+    REQUIRE(s.host == "localhost");
+    REQUIRE(s.workers == 2);
+}
@@ -6,6 +6,9 @@
 // SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
 // SPDX-License-Identifier: MIT
 
+#include <string>
+#include <vector>
+
 #include <catch2/catch.hpp>
 
 #ifndef FK_YAML_TEST_USE_SINGLE_HEADER
@@ -198,6 +201,45 @@ TEST_CASE("DeserializerClassTest_DeserializeDuplicateKeys", "[DeserializerClassT
 
     REQUIRE_THROWS_AS(
         root = deserializer.deserialize(fkyaml::detail::input_adapter("foo: bar\nfoo: baz")), fkyaml::parse_error);
+    REQUIRE_THROWS_AS(
+        root = deserializer.deserialize(fkyaml::detail::input_adapter("? foo\n: bar\n? foo\n: baz")),
+        fkyaml::parse_error);
+    REQUIRE_THROWS_AS(
+        root = deserializer.deserialize(fkyaml::detail::input_adapter("? - foo\n: bar\n? - foo\n: baz")),
+        fkyaml::parse_error);
+}
+
+TEST_CASE("DeserializerClassTest_DeserializeManyKeys", "[DeserializerClassTest]")
+{
+    using ordered_node = fkyaml::basic_node<std::vector, fkyaml::ordered_map>;
+    fkyaml::detail::basic_deserializer<ordered_node> deserializer;
+    ordered_node root;
+
+    std::string input;
+    for (int i = 0; i < 1000; i++)
+    {
+        input += "key" + std::to_string(i) + ": " + std::to_string(i) + "\n";
+    }
+
+    SECTION("unique keys")
+    {
+        REQUIRE_NOTHROW(root = deserializer.deserialize(fkyaml::detail::input_adapter(input)));
+        REQUIRE(root.is_mapping());
+        REQUIRE(root.size() == 1000);
+        int i = 0;
+        for (const auto& pair : root.get_value_ref<ordered_node::mapping_type&>())
+        {
+            REQUIRE(pair.first.get_value_ref<const std::string&>() == "key" + std::to_string(i));
+            REQUIRE(pair.second.get_value<int>() == i);
+            i++;
+        }
+    }
+
+    SECTION("duplicate keys")
+    {
+        input += "key500: 0\n";
+        REQUIRE_THROWS_AS(root = deserializer.deserialize(fkyaml::detail::input_adapter(input)), fkyaml::parse_error);
+    }
 }
 
 TEST_CASE("DeserializerClassTest_DeserializeBlockSequenceTest", "[DeserializerClassTest]")
@@ -1120,6 +1162,97 @@ TEST_CASE("DeserializerClassTest_DeserializeFlowSequenceTest", "[DeserializerCla
     {
         REQUIRE_THROWS_AS(deserializer.deserialize(fkyaml::detail::input_adapter("test: ]")), fkyaml::parse_error);
     }
+
+    SECTION("flow mappings as elements")
+    {
+        REQUIRE_NOTHROW(root = deserializer.deserialize(fkyaml::detail::input_adapter("test: [1, {x: y}, {}]")));
+
+        REQUIRE(root.is_mapping());
+        REQUIRE(root.size() == 1);
+        fkyaml::node& test_node = root["test"];
+        REQUIRE(test_node.is_sequence());
+        REQUIRE(test_node.size() == 3);
+        REQUIRE(test_node[0].get_value<int>() == 1);
+        REQUIRE(test_node[1].is_mapping());
+        REQUIRE(test_node[1].size() == 1);
+        REQUIRE(test_node[1]["x"].get_value<std::string>() == "y");
+        REQUIRE(test_node[2].is_mapping());
+        REQUIRE(test_node[2].empty());
+    }
+
+    SECTION("flow sequences as elements")
+    {
+        REQUIRE_NOTHROW(root = deserializer.deserialize(fkyaml::detail::input_adapter("test: [[1, 2], [], 3]")));
+
+        fkyaml::node& test_node = root["test"];
+        REQUIRE(test_node.is_sequence());
+        REQUIRE(test_node.size() == 3);
+        REQUIRE(test_node[0].is_sequence());
+        REQUIRE(test_node[0].size() == 2);
+        REQUIRE(test_node[0][1].get_value<int>() == 2);
+        REQUIRE(test_node[1].is_sequence());
+        REQUIRE(test_node[1].empty());
+        REQUIRE(test_node[2].get_value<int>() == 3);
+    }
+
+    SECTION("nested flow containers followed by a sibling")
+    {
+        REQUIRE_NOTHROW(
+            root = deserializer.deserialize(
+                fkyaml::detail::input_adapter("test: [{x: {p: [q, {r: s}]}}, {y: z}]\nsibling: [1]")));
+
+        REQUIRE(root.size() == 2);
+        fkyaml::node& test_node = root["test"];
+        REQUIRE(test_node.size() == 2);
+        fkyaml::node& p_node = test_node[0]["x"]["p"];
+        REQUIRE(p_node.is_sequence());
+        REQUIRE(p_node.size() == 2);
+        REQUIRE(p_node[0].get_value<std::string>() == "q");
+        REQUIRE(p_node[1]["r"].get_value<std::string>() == "s");
+        REQUIRE(test_node[1]["y"].get_value<std::string>() == "z");
+        REQUIRE(root["sibling"].size() == 1);
+    }
+
+    SECTION("flow mappings in a flow sequence at the root")
+    {
+        REQUIRE_NOTHROW(root = deserializer.deserialize(fkyaml::detail::input_adapter("[{x: y}, 1]")));
+
+        REQUIRE(root.is_sequence());
+        REQUIRE(root.size() == 2);
+        REQUIRE(root[0]["x"].get_value<std::string>() == "y");
+        REQUIRE(root[1].get_value<int>() == 1);
+    }
+
+    SECTION("flow containers in a flow mapping at the root")
+    {
+        REQUIRE_NOTHROW(
+            root = deserializer.deserialize(fkyaml::detail::input_adapter("{a: [1, {x: y}], b: [2], c: 3}")));
+
+        REQUIRE(root.is_mapping());
+        REQUIRE(root.size() == 3);
+        REQUIRE(root["a"].size() == 2);
+        REQUIRE(root["a"][1]["x"].get_value<std::string>() == "y");
+        REQUIRE(root["b"][0].get_value<int>() == 2);
+        REQUIRE(root["c"].get_value<int>() == 3);
+    }
+
+    SECTION("flow containers in a block sequence")
+    {
+        REQUIRE_NOTHROW(
+            root = deserializer.deserialize(
+                fkyaml::detail::input_adapter("test:\n  - [1, {b: c}]\n  - {d: e}\n  - f\nsibling: g")));
+
+        REQUIRE(root.size() == 2);
+        fkyaml::node& test_node = root["test"];
+        REQUIRE(test_node.is_sequence());
+        REQUIRE(test_node.size() == 3);
+        REQUIRE(test_node[0].is_sequence());
+        REQUIRE(test_node[0].size() == 2);
+        REQUIRE(test_node[0][1]["b"].get_value<std::string>() == "c");
+        REQUIRE(test_node[1]["d"].get_value<std::string>() == "e");
+        REQUIRE(test_node[2].get_value<std::string>() == "f");
+        REQUIRE(root["sibling"].get_value<std::string>() == "g");
+    }
 }
 
 TEST_CASE("DeserializerClassTest_DeserializeFlowMappingTest", "[DeserializerClassTest]")
@@ -1193,6 +1326,12 @@ TEST_CASE("DeserializerClassTest_DeserializeFlowMappingTest", "[DeserializerClas
     {
         REQUIRE_THROWS_AS(deserializer.deserialize(fkyaml::detail::input_adapter("test: }")), fkyaml::parse_error);
     }
+
+    SECTION("unmatched end of a flow mapping")
+    {
+        REQUIRE_THROWS_AS(
+            deserializer.deserialize(fkyaml::detail::input_adapter("test: {foo: bar}}")), fkyaml::parse_error);
+    }
 }
 
 TEST_CASE("DeserializerClassTest_DeserializeInputWithCommentTest", "[DeserializerClassTest]")
@@ -0,0 +1,128 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.2
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#ifdef FK_YAML_TEST_USE_SINGLE_HEADER
+    #include <fkYAML/node.hpp>
+#else
+    #include <fkYAML/detail/input/document_scanner.hpp>
+#endif
+
+static std::vector<std::string> split_documents(const std::string& input)
+{
+    std::vector<std::string> docs;
+    for (const auto& range : fkyaml::detail::document_scanner::scan(input))
+    {
+        docs.push_back(input.substr(range.begin, range.end - range.begin));
+    }
+    return docs;
+}
+
+TEST_CASE("DocumentScannerClassTest_EmptyInputTest", "[DocumentScannerClassTest]")
+{
+    auto input = GENERATE(std::string(""), std::string("  \n\n"), std::string("# comment\n"));
+    REQUIRE(split_documents(input).empty());
+}
+
+TEST_CASE("DocumentScannerClassTest_BareDocumentTest", "[DocumentScannerClassTest]")
+{
+    auto docs = split_documents("foo: bar\nbaz: 123\n");
+    REQUIRE(docs.size() == 1);
+    REQUIRE(docs[0] == "foo: bar\nbaz: 123\n");
+}
+
+TEST_CASE("DocumentScannerClassTest_DirectivesEndMarkerTest", "[DocumentScannerClassTest]")
+{
+    SECTION("bare document followed by explicit documents")
+    {
+        auto docs = split_documents("foo: 1\n---\nbar: 2\n--- baz: 3\n");
+        REQUIRE(docs.size() == 3);
+        REQUIRE(docs[0] == "foo: 1\n");
+        REQUIRE(docs[1] == "---\nbar: 2\n");
+        REQUIRE(docs[2] == "--- baz: 3\n");
+    }
+
+    SECTION("leading comments are not a document")
+    {
+        auto docs = split_documents("# comment\n---\nfoo: 1\n");
+        REQUIRE(docs.size() == 1);
+        REQUIRE(docs[0] == "---\nfoo: 1\n");
+    }
+
+    SECTION("empty explicit documents")
+    {
+        auto docs = split_documents("---\n---\n");
+        REQUIRE(docs.size() == 2);
+        REQUIRE(docs[0] == "---\n");
+        REQUIRE(docs[1] == "---\n");
+    }
+
+    SECTION("not a marker")
+    {
+        auto input = GENERATE(std::string("foo: 1\n---bar: 2\n"), std::string("foo: 1\n  ---\n"));
+        REQUIRE(split_documents(input).size() == 1);
+    }
+}
+
+TEST_CASE("DocumentScannerClassTest_DocumentEndMarkerTest", "[DocumentScannerClassTest]")
+{
+    auto docs = split_documents("foo: 1\n...\n%YAML 1.1\n---\nbar: 2\n...\n");
+    REQUIRE(docs.size() == 2);
+    REQUIRE(docs[0] == "foo: 1\n...\n");
+    REQUIRE(docs[1] == "%YAML 1.1\n---\nbar: 2\n...\n");
+}
+
+TEST_CASE("DocumentScannerClassTest_QuotedScalarTest", "[DocumentScannerClassTest]")
+{
+    SECTION("multi-line quoted scalars")
+    {
+        auto input = GENERATE(
+            std::string("foo: \"bar\n---\nbaz\"\n"),
+            std::string("foo: 'bar\n---\nbaz'\n"),
+            std::string("foo: \"bar\\\"\n---\nbaz\"\n"),
+            std::string("foo: 'bar''\n---\nbaz'\n"));
+        REQUIRE(split_documents(input).size() == 1);
+    }
+
+    SECTION("quotes which do not begin quoted scalars")
+    {
+        auto input = GENERATE(std::string("foo: it's\n---\nbar: 1\n"), std::string("foo: 1 # it's\n---\nbar: 1\n"));
+        REQUIRE(split_documents(input).size() == 2);
+    }
+}
+
+TEST_CASE("DocumentScannerClassTest_BlockScalarTest", "[DocumentScannerClassTest]")
+{
+    SECTION("quotes in block scalars")
+    {
+        auto docs = split_documents("a: 1\n---\nscript: |\n  echo \"hello\n---\nnext: 1\n");
+        REQUIRE(docs.size() == 3);
+        REQUIRE(docs[0] == "a: 1\n");
+        REQUIRE(docs[1] == "---\nscript: |\n  echo \"hello\n");
+        REQUIRE(docs[2] == "---\nnext: 1\n");
+    }
+
+    SECTION("block scalars with headers and blank lines")
+    {
+        auto input = GENERATE(
+            std::string("foo: >-\n  it's \"\n\n  bar '\n---\nbaz: 1\n"),
+            std::string("- |2+ # comment\n   'x\n---\nbaz: 1\n"),
+            std::string("--- |\n  \"x\n---\nbaz: 1\n"));
+        REQUIRE(split_documents(input).size() == 2);
+    }
+
+    SECTION("quote tracking resumes after block scalars")
+    {
+        auto docs = split_documents("foo: |\n  'x\nbar: \"baz\n---\nqux\"\n");
+        REQUIRE(docs.size() == 1);
+    }
+}
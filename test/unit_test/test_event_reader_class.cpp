@@ -0,0 +1,289 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.2
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <fkYAML/node.hpp>
+
+using event_t = fkyaml::event_reader::event_t;
+
+// reads all the remaining events and returns their types.
+static std::vector<event_t> read_types(fkyaml::event_reader& reader)
+{
+    std::vector<event_t> types;
+    for (auto e = reader.next(); e.type != event_t::END_OF_STREAM; e = reader.next())
+    {
+        types.push_back(e.type);
+    }
+    return types;
+}
+
+TEST_CASE("EventReaderClassTest_NextTest", "[EventReaderClassTest]")
+{
+    SECTION("empty input")
+    {
+        fkyaml::event_reader reader("");
+        std::vector<event_t> expected {
+            event_t::START_DOCUMENT, event_t::START_MAPPING, event_t::END_MAPPING, event_t::END_DOCUMENT};
+        REQUIRE(read_types(reader) == expected);
+    }
+
+    SECTION("scalar values")
+    {
+        fkyaml::event_reader reader("foo: bar\nbaz: [123, true]\nqux: ~");
+
+        auto e = reader.next();
+        REQUIRE(e.type == event_t::START_DOCUMENT);
+        REQUIRE(e.version == fkyaml::node::yaml_version_t::VER_1_2);
+        REQUIRE(reader.next().type == event_t::START_MAPPING);
+
+        e = reader.next();
+        REQUIRE(e.type == event_t::SCALAR);
+        REQUIRE(e.is_key);
+        REQUIRE(e.value().get_value<std::string>() == "foo");
+        REQUIRE(e.line == 0);
+        REQUIRE(e.indent == 0);
+
+        e = reader.next();
+        REQUIRE(e.type == event_t::SCALAR);
+        REQUIRE_FALSE(e.is_key);
+        REQUIRE(e.value().get_value<std::string>() == "bar");
+
+        e = reader.next();
+        REQUIRE(e.is_key);
+        REQUIRE(e.value().get_value<std::string>() == "baz");
+        REQUIRE(e.line == 1);
+        REQUIRE(reader.next().type == event_t::START_SEQUENCE);
+        e = reader.next();
+        REQUIRE_FALSE(e.is_key);
+        REQUIRE(e.value().get_value<int>() == 123);
+        REQUIRE(reader.next().value().get_value<bool>() == true);
+        REQUIRE(reader.next().type == event_t::END_SEQUENCE);
+
+        e = reader.next();
+        REQUIRE(e.is_key);
+        REQUIRE(e.value().get_value<std::string>() == "qux");
+        REQUIRE(reader.next().value().is_null());
+
+        REQUIRE(reader.next().type == event_t::END_MAPPING);
+        REQUIRE(reader.next().type == event_t::END_DOCUMENT);
+        REQUIRE(reader.next().type == event_t::END_OF_STREAM);
+        REQUIRE(reader.next().type == event_t::END_OF_STREAM);
+    }
+
+    SECTION("scalar texts")
+    {
+        fkyaml::event_reader reader("foo: 'bar'\nbaz: 1.5\nqux: null");
+        reader.next();
+        REQUIRE(reader.next().scalar_type == fkyaml::node::node_t::NULL_OBJECT);
+
+        auto e = reader.next();
+        REQUIRE(e.scalar_type == fkyaml::node::node_t::STRING);
+        REQUIRE(e.text == "foo");
+        e = reader.next();
+        REQUIRE(e.scalar_type == fkyaml::node::node_t::STRING);
+        REQUIRE(e.text == "bar");
+
+        reader.next();
+        e = reader.next();
+        REQUIRE(e.scalar_type == fkyaml::node::node_t::FLOAT_NUMBER);
+        REQUIRE(e.text == "1.5");
+        REQUIRE(e.value().get_value<double>() == 1.5);
+
+        reader.next();
+        e = reader.next();
+        REQUIRE(e.scalar_type == fkyaml::node::node_t::NULL_OBJECT);
+        REQUIRE(e.text == "null");
+        REQUIRE(e.value().is_null());
+    }
+
+    SECTION("scalar converted on demand")
+    {
+        fkyaml::event_reader reader("foo: 99999999999999999999999999");
+        reader.next();
+        reader.next();
+        reader.next();
+
+        auto e = reader.next();
+        REQUIRE(e.type == event_t::SCALAR);
+        REQUIRE(e.scalar_type == fkyaml::node::node_t::INTEGER);
+        REQUIRE(e.text == "99999999999999999999999999");
+        REQUIRE_THROWS_AS(e.value(), fkyaml::exception);
+    }
+
+    SECTION("mapping key")
+    {
+        fkyaml::event_reader reader("? a: b\n: 1");
+        reader.next();
+        reader.next();
+
+        auto e = reader.next();
+        REQUIRE(e.type == event_t::START_MAPPING);
+        REQUIRE(e.is_key);
+        e = reader.next();
+        REQUIRE(e.is_key);
+        REQUIRE(e.value().get_value<std::string>() == "a");
+        REQUIRE_FALSE(reader.next().is_key);
+        REQUIRE(reader.next().type == event_t::END_MAPPING);
+        e = reader.next();
+        REQUIRE_FALSE(e.is_key);
+        REQUIRE(e.value().get_value<int>() == 1);
+    }
+
+    SECTION("anchor and alias")
+    {
+        fkyaml::event_reader reader("foo: &anchor 1\nbar: *anchor");
+        reader.next();
+        reader.next();
+        reader.next();
+
+        auto e = reader.next();
+        REQUIRE(e.type == event_t::SCALAR);
+        REQUIRE(e.anchor == "anchor");
+        REQUIRE(e.value().get_value<int>() == 1);
+
+        e = reader.next();
+        REQUIRE(e.anchor.empty());
+        e = reader.next();
+        REQUIRE(e.type == event_t::ALIAS);
+        REQUIRE(e.anchor == "anchor");
+        REQUIRE(e.value().is_null());
+    }
+
+    SECTION("YAML version")
+    {
+        fkyaml::event_reader reader("%YAML 1.1\n---\nfoo: bar");
+        auto e = reader.next();
+        REQUIRE(e.type == event_t::START_DOCUMENT);
+        REQUIRE(e.version == fkyaml::node::yaml_version_t::VER_1_1);
+    }
+
+    SECTION("invalid input")
+    {
+        fkyaml::event_reader reader("foo: *anchor");
+        reader.next();
+        reader.next();
+        reader.next();
+        REQUIRE_THROWS_AS(reader.next(), fkyaml::parse_error);
+    }
+}
+
+TEST_CASE("EventReaderClassTest_PeekTest", "[EventReaderClassTest]")
+{
+    fkyaml::event_reader reader("foo: bar");
+    REQUIRE(reader.peek().type == event_t::START_DOCUMENT);
+    REQUIRE(reader.peek().type == event_t::START_DOCUMENT);
+    REQUIRE(reader.next().type == event_t::START_DOCUMENT);
+    REQUIRE(reader.peek().type == event_t::START_MAPPING);
+    REQUIRE(reader.next().type == event_t::START_MAPPING);
+    REQUIRE(reader.peek().value().get_value<std::string>() == "foo");
+
+    std::vector<event_t> expected {event_t::SCALAR, event_t::SCALAR, event_t::END_MAPPING, event_t::END_DOCUMENT};
+    REQUIRE(read_types(reader) == expected);
+    REQUIRE(reader.peek().type == event_t::END_OF_STREAM);
+}
+
+TEST_CASE("EventReaderClassTest_SkipValueTest", "[EventReaderClassTest]")
+{
+    SECTION("scalar")
+    {
+        fkyaml::event_reader reader("foo: bar\nbaz: 123");
+        reader.next();
+        reader.next();
+        reader.next();
+        REQUIRE(reader.skip_value());
+        REQUIRE(reader.next().value().get_value<std::string>() == "baz");
+    }
+
+    SECTION("mapping")
+    {
+        fkyaml::event_reader reader("foo:\n  bar:\n    baz: [1, 2]\n  qux: 1\nx: y");
+        reader.next();
+        reader.next();
+        REQUIRE(reader.next().value().get_value<std::string>() == "foo");
+        REQUIRE(reader.skip_value());
+
+        auto e = reader.next();
+        REQUIRE(e.is_key);
+        REQUIRE(e.value().get_value<std::string>() == "x");
+        REQUIRE(reader.next().value().get_value<std::string>() == "y");
+        REQUIRE(reader.next().type == event_t::END_MAPPING);
+    }
+
+    SECTION("sequence")
+    {
+        fkyaml::event_reader reader("foo:\n  - a: 1\n  - [2, 3]\nbar: baz");
+        reader.next();
+        reader.next();
+        reader.next();
+        REQUIRE(reader.peek().type == event_t::START_SEQUENCE);
+        REQUIRE(reader.skip_value());
+        REQUIRE(reader.next().value().get_value<std::string>() == "bar");
+    }
+
+    SECTION("scalars which cannot be converted")
+    {
+        fkyaml::event_reader reader("foo: [99999999999999999999999999, 1]\nbar: baz");
+        reader.next();
+        reader.next();
+        reader.next();
+        REQUIRE(reader.skip_value());
+        REQUIRE(reader.next().text == "bar");
+    }
+
+    SECTION("already peeked container")
+    {
+        fkyaml::event_reader reader("foo: [1, 2, 3]\nbar: baz");
+        reader.next();
+        reader.next();
+        reader.next();
+        REQUIRE(reader.peek().type == event_t::START_SEQUENCE);
+        REQUIRE(reader.skip_value());
+        REQUIRE(reader.next().value().get_value<std::string>() == "bar");
+    }
+
+    SECTION("no node to skip")
+    {
+        fkyaml::event_reader reader("foo: bar");
+        REQUIRE_FALSE(reader.skip_value());
+        REQUIRE(reader.next().type == event_t::START_DOCUMENT);
+        REQUIRE(reader.skip_value());
+        REQUIRE_FALSE(reader.skip_value());
+        REQUIRE(reader.next().type == event_t::END_DOCUMENT);
+        REQUIRE_FALSE(reader.skip_value());
+    }
+}
+
+TEST_CASE("EventReaderClassTest_IteratorInputTest", "[EventReaderClassTest]")
+{
+    std::string input = "foo: bar";
+    fkyaml::event_reader reader(input.begin(), input.end());
+    std::vector<event_t> expected {
+        event_t::START_DOCUMENT,
+        event_t::START_MAPPING,
+        event_t::SCALAR,
+        event_t::SCALAR,
+        event_t::END_MAPPING,
+        event_t::END_DOCUMENT};
+    REQUIRE(read_types(reader) == expected);
+}
+
+TEST_CASE("EventReaderClassTest_MoveConstructorTest", "[EventReaderClassTest]")
+{
+    fkyaml::event_reader reader(std::string("foo: bar"));
+    reader.next();
+    reader.next();
+
+    fkyaml::event_reader moved(std::move(reader));
+    REQUIRE(moved.next().value().get_value<std::string>() == "foo");
+    REQUIRE(moved.next().value().get_value<std::string>() == "bar");
+}
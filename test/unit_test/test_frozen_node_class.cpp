@@ -0,0 +1,279 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.2
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <fkYAML/node.hpp>
+
+TEST_CASE("FrozenNodeClassTest_TypeTest", "[FrozenNodeClassTest]")
+{
+    fkyaml::frozen_node root =
+        fkyaml::node::deserialize("seq: [1, 2]\nmap:\n  foo: bar\nnull: ~\nbool: true\nint: 123\nfloat: 1.5\nstr: foo")
+            .freeze();
+
+    REQUIRE(root.type() == fkyaml::node::node_t::MAPPING);
+    REQUIRE(root.is_mapping());
+    REQUIRE(root["seq"].is_sequence());
+    REQUIRE(root["map"].is_mapping());
+    REQUIRE(root[nullptr].is_null());
+    REQUIRE(root["bool"].is_boolean());
+    REQUIRE(root["int"].is_integer());
+    REQUIRE(root["float"].is_float_number());
+    REQUIRE(root["str"].is_string());
+    REQUIRE(root["str"].is_scalar());
+    REQUIRE_FALSE(root["seq"].is_scalar());
+}
+
+TEST_CASE("FrozenNodeClassTest_SizeTest", "[FrozenNodeClassTest]")
+{
+    fkyaml::frozen_node root = fkyaml::node::deserialize("seq: [1, 2, 3]\nmap: {}\nstr: foo\nint: 1").freeze();
+
+    REQUIRE(root.size() == 4);
+    REQUIRE(root["seq"].size() == 3);
+    REQUIRE(root["map"].size() == 0);
+    REQUIRE(root["map"].empty());
+    REQUIRE(root["str"].size() == 3);
+    REQUIRE_FALSE(root["str"].empty());
+    REQUIRE_THROWS_AS(root["int"].size(), fkyaml::type_error);
+    REQUIRE_THROWS_AS(root["int"].empty(), fkyaml::type_error);
+}
+
+TEST_CASE("FrozenNodeClassTest_SubscriptOperatorTest", "[FrozenNodeClassTest]")
+{
+    fkyaml::frozen_node root = fkyaml::node::deserialize("foo:\n  - 3\n  - bar: baz\n  - qux:\n      - 1\n      - 2\n  - 4\n"
+                                                         "123: true\n1.5: x\ntrue: y\n")
+                                   .freeze();
+
+    SECTION("sequence")
+    {
+        fkyaml::frozen_node seq = root["foo"];
+        REQUIRE(seq[0].get_value<int>() == 3);
+        REQUIRE(seq[1]["bar"].get_value<std::string>() == "baz");
+        REQUIRE(seq[2]["qux"][0].get_value<int>() == 1);
+        REQUIRE(seq[2]["qux"][1].get_value<int>() == 2);
+        REQUIRE(seq[3].get_value<int>() == 4);
+        REQUIRE_THROWS_AS(seq[4], fkyaml::exception);
+        REQUIRE_THROWS_AS(seq[-1], fkyaml::exception);
+        REQUIRE_THROWS_AS(seq["bar"], fkyaml::type_error);
+    }
+
+    SECTION("mapping")
+    {
+        REQUIRE(root[123].get_value<bool>() == true);
+        REQUIRE(root[1.5].get_value<std::string>() == "x");
+        REQUIRE(root[true].get_value<std::string>() == "y");
+        REQUIRE(root[fkyaml::node("foo")].is_sequence());
+        REQUIRE_THROWS_AS(root["bar"], fkyaml::exception);
+        REQUIRE_THROWS_AS(root[124], fkyaml::exception);
+        REQUIRE_THROWS_AS(root[false], fkyaml::exception);
+        REQUIRE_THROWS_AS(root[nullptr], fkyaml::exception);
+    }
+
+    SECTION("scalar")
+    {
+        REQUIRE_THROWS_AS(root[123][0], fkyaml::type_error);
+        REQUIRE_THROWS_AS(root[123]["foo"], fkyaml::type_error);
+    }
+
+    SECTION("mapping key")
+    {
+        fkyaml::frozen_node map = fkyaml::node::deserialize("? foo: bar\n: baz\n? qux\n: 1").freeze();
+        fkyaml::node key = {{"foo", "bar"}};
+        REQUIRE(map[key].get_value<std::string>() == "baz");
+        REQUIRE(map["qux"].get_value<int>() == 1);
+        fkyaml::node other_key = {{"foo", "qux"}};
+        REQUIRE_FALSE(map.contains(other_key));
+    }
+}
+
+TEST_CASE("FrozenNodeClassTest_ContainsTest", "[FrozenNodeClassTest]")
+{
+    fkyaml::frozen_node root = fkyaml::node::deserialize("foo: bar\n123: [1]").freeze();
+    REQUIRE(root.contains("foo"));
+    REQUIRE(root.contains(123));
+    REQUIRE(root.contains(fkyaml::node("foo")));
+    REQUIRE_FALSE(root.contains("bar"));
+    REQUIRE_FALSE(root.contains(""));
+    REQUIRE_FALSE(root["foo"].contains("bar"));
+    REQUIRE_FALSE(root[123].contains(0));
+    REQUIRE_FALSE(fkyaml::node::mapping().freeze().contains("foo"));
+}
+
+TEST_CASE("FrozenNodeClassTest_LargeMappingTest", "[FrozenNodeClassTest]")
+{
+    fkyaml::node node = fkyaml::node::mapping();
+    for (int i = 0; i < 1000; i++)
+    {
+        node["key" + std::to_string(i)] = i;
+        node[i] = "value" + std::to_string(i);
+    }
+
+    fkyaml::frozen_node root = node.freeze();
+    REQUIRE(root.size() == 2000);
+    for (int i = 0; i < 1000; i++)
+    {
+        REQUIRE(root["key" + std::to_string(i)].get_value<int>() == i);
+        REQUIRE(root[i].get_value<std::string>() == "value" + std::to_string(i));
+    }
+    for (int i = 1000; i < 2000; i++)
+    {
+        REQUIRE_FALSE(root.contains("key" + std::to_string(i)));
+        REQUIRE_FALSE(root.contains(i));
+    }
+}
+
+TEST_CASE("FrozenNodeClassTest_LookupKeyTest", "[FrozenNodeClassTest]")
+{
+    fkyaml::frozen_node root = fkyaml::node::deserialize("a key which is too long to be stored in place: 1\n"
+                                                         "short: 2\n"
+                                                         "-5: [x, y]\n"
+                                                         "true: 3")
+                                   .freeze();
+
+    SECTION("string keys")
+    {
+        const std::string long_key = "a key which is too long to be stored in place";
+        REQUIRE(root[long_key].get_value<int>() == 1);
+        REQUIRE(root[long_key.c_str()].get_value<int>() == 1);
+        REQUIRE(root["short"].get_value<int>() == 2);
+        REQUIRE(root.contains(long_key));
+        REQUIRE_FALSE(root.contains(std::string("a key which is too long to be stored")));
+        REQUIRE_FALSE(root.contains("-5"));
+        REQUIRE_FALSE(root.contains("true"));
+    }
+
+    SECTION("integer keys")
+    {
+        REQUIRE(root[-5][1].get_value<std::string>() == "y");
+        REQUIRE(root[static_cast<long long>(-5)][1u].get_value<std::string>() == "y");
+        REQUIRE(root[-5][static_cast<std::size_t>(0)].get_value<std::string>() == "x");
+        REQUIRE(root.contains(static_cast<short>(-5)));
+        REQUIRE_FALSE(root.contains(5));
+        REQUIRE_FALSE(root.contains(1));
+        REQUIRE(root.contains(true));
+    }
+
+    SECTION("string keys for sequences")
+    {
+        REQUIRE_THROWS_AS(root[-5]["x"], fkyaml::type_error);
+        REQUIRE_THROWS_AS(root[-5][std::string("x")], fkyaml::type_error);
+    }
+
+    SECTION("mappings without hash indices")
+    {
+        fkyaml::frozen_node unhashable = fkyaml::node::deserialize("1.5: a\n2.5: b\n7: c\nfoo: d").freeze();
+        REQUIRE(unhashable[std::string("foo")].get_value<std::string>() == "d");
+        REQUIRE(unhashable[7u].get_value<std::string>() == "c");
+        REQUIRE_FALSE(unhashable.contains(std::string("bar")));
+        REQUIRE_FALSE(unhashable.contains(8));
+    }
+}
+
+TEST_CASE("FrozenNodeClassTest_UnhashableKeysTest", "[FrozenNodeClassTest]")
+{
+    // float number keys are hashed only by their types, so the mapping falls back to linear search.
+    fkyaml::frozen_node root = fkyaml::node::deserialize("1.5: a\n2.5: b\n3.5: c\nfoo: d").freeze();
+    REQUIRE(root[1.5].get_value<std::string>() == "a");
+    REQUIRE(root[2.5].get_value<std::string>() == "b");
+    REQUIRE(root[3.5].get_value<std::string>() == "c");
+    REQUIRE(root["foo"].get_value<std::string>() == "d");
+    REQUIRE_FALSE(root.contains(4.5));
+    REQUIRE_FALSE(root.contains("bar"));
+}
+
+TEST_CASE("FrozenNodeClassTest_IteratorTest", "[FrozenNodeClassTest]")
+{
+    using ordered_node_t = fkyaml::basic_node<std::vector, fkyaml::ordered_map>;
+    fkyaml::basic_frozen_node<ordered_node_t> root =
+        ordered_node_t::deserialize("foo: [1, 2.5, bar]\nbar: {x: y}\nbaz: ~").freeze();
+
+    std::vector<std::string> keys;
+    for (auto itr = root.begin(); itr != root.end(); ++itr)
+    {
+        keys.push_back(itr.key().get_value<std::string>());
+    }
+    std::vector<std::string> expected_keys {"foo", "bar", "baz"};
+    REQUIRE(keys == expected_keys);
+
+    std::vector<fkyaml::node::node_t> types;
+    for (const auto& elem : root["foo"])
+    {
+        types.push_back(elem.type());
+    }
+    std::vector<fkyaml::node::node_t> expected_types {
+        fkyaml::node::node_t::INTEGER, fkyaml::node::node_t::FLOAT_NUMBER, fkyaml::node::node_t::STRING};
+    REQUIRE(types == expected_types);
+
+    auto itr = root.begin();
+    REQUIRE((*itr).is_sequence());
+    REQUIRE(itr.value().is_sequence());
+    itr++;
+    REQUIRE(itr.value().is_mapping());
+    REQUIRE(root["foo"].begin() != root["foo"].end());
+    REQUIRE_THROWS_AS(root["foo"].begin().key(), fkyaml::exception);
+    REQUIRE_THROWS_AS(root["baz"].begin(), fkyaml::type_error);
+    REQUIRE_THROWS_AS(root["baz"].end(), fkyaml::type_error);
+}
+
+TEST_CASE("FrozenNodeClassTest_MaterializeTest", "[FrozenNodeClassTest]")
+{
+    auto input = GENERATE(
+        std::string("foo: bar\nbaz: [1, 2.5, true, null]\nqux:\n  - a: 1\n    b: 2\n  - c"),
+        std::string("%YAML 1.1\n---\nfoo: &a bar\nbaz: *a"),
+        std::string("? a: b\n: 1\n? c\n: d"),
+        std::string("foo:\n  - a: [1, 2]\n  - {}\n  - b"),
+        std::string(""));
+
+    fkyaml::node expected = fkyaml::node::deserialize(input);
+    fkyaml::node actual = expected.freeze().materialize();
+    REQUIRE(actual == expected);
+    REQUIRE(actual.get_yaml_version() == expected.get_yaml_version());
+
+    using ordered_node_t = fkyaml::basic_node<std::vector, fkyaml::ordered_map>;
+    ordered_node_t ordered_expected = ordered_node_t::deserialize(input);
+    ordered_node_t ordered_actual = ordered_expected.freeze().materialize();
+    REQUIRE(ordered_actual == ordered_expected);
+}
+
+TEST_CASE("FrozenNodeClassTest_DeeplyNestedNodeTest", "[FrozenNodeClassTest]")
+{
+    const int depth = 100000;
+    fkyaml::node node = fkyaml::node::sequence();
+    fkyaml::node* p_node = &node;
+    for (int i = 0; i < depth; i++)
+    {
+        p_node->get_value_ref<fkyaml::node::sequence_type&>().emplace_back(fkyaml::node::mapping());
+        fkyaml::node& child = p_node->get_value_ref<fkyaml::node::sequence_type&>().back();
+        child["child"] = fkyaml::node::sequence();
+        p_node = &child["child"];
+    }
+
+    fkyaml::frozen_node root = node.freeze();
+    REQUIRE(root[0]["child"][0].is_mapping());
+    REQUIRE(root.materialize() == node);
+}
+
+TEST_CASE("FrozenNodeClassTest_LifetimeTest", "[FrozenNodeClassTest]")
+{
+    fkyaml::frozen_node child = fkyaml::node::deserialize("foo:\n  bar: baz").freeze()["foo"];
+    REQUIRE(child["bar"].get_value<std::string>() == "baz");
+
+    fkyaml::frozen_node copy = child;
+    child = fkyaml::node::deserialize("x: 1").freeze();
+    REQUIRE(copy["bar"].get_value<std::string>() == "baz");
+    REQUIRE(child["x"].get_value<int>() == 1);
+
+    // a frozen copy is independent of the original node.
+    fkyaml::node node = {{"foo", 1}};
+    fkyaml::frozen_node frozen = node.freeze();
+    node["foo"] = 2;
+    REQUIRE(frozen["foo"].get_value<int>() == 1);
+}
@@ -262,3 +262,27 @@ TEST_CASE("InputHandlerTest_TestMultipleLinesTest", "[InputHandlerTest]")
         REQUIRE(handler.get_lines_read() == 1);
     }
 }
+
+TEST_CASE("InputHandlerTest_ResetTest", "[InputHandlerTest]")
+{
+    char input[] = "foo\nbar";
+    fkyaml::detail::input_handler handler(fkyaml::detail::input_adapter(input));
+    handler.get_next();
+    handler.get_next();
+    handler.get_next();
+    handler.get_next();
+    REQUIRE(handler.get_current() == 'b');
+    REQUIRE(handler.get_lines_read() == 1);
+
+    char another[] = "baz";
+    handler.reset(fkyaml::detail::input_adapter(another));
+    REQUIRE(handler.get_current() == 'b');
+    REQUIRE(handler.get_cur_pos_in_line() == 0);
+    REQUIRE(handler.get_lines_read() == 0);
+    REQUIRE(handler.get_next() == 'a');
+    REQUIRE(handler.get_next() == 'z');
+    REQUIRE(handler.get_next() == std::char_traits<char>::eof());
+
+    fkyaml::detail::input_handler empty_handler;
+    REQUIRE(empty_handler.get_current() == std::char_traits<char>::eof());
+}
@@ -0,0 +1,74 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.2
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <string>
+#include <utility>
+
+#include <catch2/catch.hpp>
+
+#include <fkYAML/node.hpp>
+
+TEST_CASE("KeyInternerClassTest_InternTest", "[KeyInternerClassTest]")
+{
+    fkyaml::key_interner interner;
+    REQUIRE(interner.size() == 0);
+
+    SECTION("lvalue strings")
+    {
+        std::string foo = "foo";
+        fkyaml::key_interner::pointer p_foo = interner.intern(foo);
+        REQUIRE(*p_foo == "foo");
+        REQUIRE(foo == "foo");
+        REQUIRE(interner.intern(std::string("foo")) == p_foo);
+        REQUIRE(interner.size() == 1);
+
+        fkyaml::key_interner::pointer p_bar = interner.intern(std::string("bar"));
+        REQUIRE(*p_bar == "bar");
+        REQUIRE(p_bar != p_foo);
+        REQUIRE(interner.size() == 2);
+    }
+
+    SECTION("rvalue strings")
+    {
+        std::string foo = "foo";
+        fkyaml::key_interner::pointer p_foo = interner.intern(std::move(foo));
+        REQUIRE(*p_foo == "foo");
+
+        std::string another = "foo";
+        REQUIRE(interner.intern(std::move(another)) == p_foo);
+        // an already interned string is not moved from.
+        REQUIRE(another == "foo");
+        REQUIRE(interner.size() == 1);
+    }
+}
+
+TEST_CASE("KeyInternerClassTest_FindTest", "[KeyInternerClassTest]")
+{
+    fkyaml::key_interner interner;
+    REQUIRE(interner.find("foo") == nullptr);
+    // find() never registers strings.
+    REQUIRE(interner.size() == 0);
+
+    fkyaml::key_interner::pointer p_foo = interner.intern(std::string("foo"));
+    REQUIRE(interner.find("foo") == p_foo);
+    REQUIRE(interner.find("bar") == nullptr);
+}
+
+TEST_CASE("KeyInternerClassTest_ClearTest", "[KeyInternerClassTest]")
+{
+    fkyaml::key_interner interner;
+    fkyaml::key_interner::pointer p_foo = interner.intern(std::string("foo"));
+    interner.clear();
+    REQUIRE(interner.size() == 0);
+
+    // the interned string is still alive.
+    REQUIRE(*p_foo == "foo");
+    fkyaml::key_interner::pointer p_new_foo = interner.intern(std::string("foo"));
+    REQUIRE(p_new_foo != p_foo);
+    REQUIRE(*p_new_foo == *p_foo);
+}
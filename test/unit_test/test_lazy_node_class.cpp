@@ -0,0 +1,248 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.2
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <fkYAML/node.hpp>
+
+TEST_CASE("LazyNodeClassTest_TypeTest", "[LazyNodeClassTest]")
+{
+    fkyaml::lazy_node root =
+        fkyaml::node::deserialize_lazy("seq: [1, 2]\nmap:\n  foo: bar\nnull: ~\nbool: true\nint: 123\nfloat: 1.5\nstr: foo");
+
+    REQUIRE(root.type() == fkyaml::node::node_t::MAPPING);
+    REQUIRE(root.is_mapping());
+    REQUIRE(root["seq"].is_sequence());
+    REQUIRE(root["map"].is_mapping());
+    REQUIRE(root[nullptr].is_null());
+    REQUIRE(root["bool"].is_boolean());
+    REQUIRE(root["int"].is_integer());
+    REQUIRE(root["float"].is_float_number());
+    REQUIRE(root["str"].is_string());
+    REQUIRE(root["str"].is_scalar());
+    REQUIRE_FALSE(root["seq"].is_scalar());
+    REQUIRE_FALSE(root["str"].is_alias());
+}
+
+TEST_CASE("LazyNodeClassTest_SizeTest", "[LazyNodeClassTest]")
+{
+    fkyaml::lazy_node root = fkyaml::node::deserialize_lazy("seq: [1, 2, 3]\nmap: {}\nstr: foo\nint: 1");
+
+    REQUIRE(root.size() == 4);
+    REQUIRE(root["seq"].size() == 3);
+    REQUIRE(root["map"].size() == 0);
+    REQUIRE(root["map"].empty());
+    REQUIRE(root["str"].size() == 3);
+    REQUIRE_FALSE(root["str"].empty());
+    REQUIRE_THROWS_AS(root["int"].size(), fkyaml::type_error);
+    REQUIRE_THROWS_AS(root["int"].empty(), fkyaml::type_error);
+}
+
+TEST_CASE("LazyNodeClassTest_SubscriptOperatorTest", "[LazyNodeClassTest]")
+{
+    fkyaml::lazy_node root = fkyaml::node::deserialize_lazy("foo:\n  - 3\n  - bar: baz\n  - qux: [1, 2]\n123: true\n1.5: x");
+
+    SECTION("sequence")
+    {
+        fkyaml::lazy_node seq = root["foo"];
+        REQUIRE(seq[0].get_value<int>() == 3);
+        REQUIRE(seq[1]["bar"].get_value<std::string>() == "baz");
+        REQUIRE(seq[2]["qux"][1].get_value<int>() == 2);
+        REQUIRE_THROWS_AS(seq[3], fkyaml::exception);
+        REQUIRE_THROWS_AS(seq[-1], fkyaml::exception);
+        REQUIRE_THROWS_AS(seq["bar"], fkyaml::type_error);
+    }
+
+    SECTION("mapping")
+    {
+        REQUIRE(root[123].get_value<bool>() == true);
+        REQUIRE(root[1.5].get_value<std::string>() == "x");
+        REQUIRE(root[fkyaml::node("foo")].is_sequence());
+        REQUIRE_THROWS_AS(root["bar"], fkyaml::exception);
+        REQUIRE_THROWS_AS(root[124], fkyaml::exception);
+    }
+
+    SECTION("scalar")
+    {
+        REQUIRE_THROWS_AS(root[123][0], fkyaml::type_error);
+        REQUIRE_THROWS_AS(root[123]["foo"], fkyaml::type_error);
+    }
+
+    SECTION("mapping key")
+    {
+        fkyaml::lazy_node map = fkyaml::node::deserialize_lazy("? foo: bar\n: baz");
+        fkyaml::node key = {{"foo", "bar"}};
+        REQUIRE(map[key].get_value<std::string>() == "baz");
+    }
+}
+
+TEST_CASE("LazyNodeClassTest_ContainsTest", "[LazyNodeClassTest]")
+{
+    fkyaml::lazy_node root = fkyaml::node::deserialize_lazy("foo: bar\n123: [1]");
+    REQUIRE(root.contains("foo"));
+    REQUIRE(root.contains(123));
+    REQUIRE(root.contains(fkyaml::node("foo")));
+    REQUIRE_FALSE(root.contains("bar"));
+    REQUIRE_FALSE(root["foo"].contains("bar"));
+    REQUIRE_FALSE(root[123].contains(0));
+}
+
+TEST_CASE("LazyNodeClassTest_LookupKeyTest", "[LazyNodeClassTest]")
+{
+    fkyaml::lazy_node root = fkyaml::node::deserialize_lazy(
+        "a key which is too long to be stored in place: 1\n"
+        "short: &anchor alias\n"
+        "? *anchor\n"
+        ": 3\n"
+        "-5: [x, y]\n"
+        "true: 4");
+
+    SECTION("string keys")
+    {
+        const std::string long_key = "a key which is too long to be stored in place";
+        REQUIRE(root[long_key].get_value<int>() == 1);
+        REQUIRE(root[long_key.c_str()].get_value<int>() == 1);
+        REQUIRE(root["short"].get_value<std::string>() == "alias");
+        REQUIRE(root["alias"].get_value<int>() == 3);
+        REQUIRE(root.contains(std::string("alias")));
+        REQUIRE(root.contains(long_key));
+        REQUIRE_FALSE(root.contains(std::string("a key which is too long to be stored")));
+        REQUIRE_FALSE(root.contains("-5"));
+        REQUIRE_FALSE(root.contains("true"));
+    }
+
+    SECTION("integer keys")
+    {
+        REQUIRE(root[-5][1].get_value<std::string>() == "y");
+        REQUIRE(root[static_cast<long long>(-5)][1u].get_value<std::string>() == "y");
+        REQUIRE(root[-5][static_cast<std::size_t>(0)].get_value<std::string>() == "x");
+        REQUIRE(root.contains(static_cast<short>(-5)));
+        REQUIRE_FALSE(root.contains(5));
+        REQUIRE_FALSE(root.contains(1));
+        REQUIRE(root.contains(true));
+    }
+
+    SECTION("string keys for sequences")
+    {
+        REQUIRE_THROWS_AS(root[-5]["x"], fkyaml::type_error);
+        REQUIRE_THROWS_AS(root[-5][std::string("x")], fkyaml::type_error);
+    }
+}
+
+TEST_CASE("LazyNodeClassTest_IteratorTest", "[LazyNodeClassTest]")
+{
+    fkyaml::lazy_node root = fkyaml::node::deserialize_lazy("foo: [1, 2.5, bar]\nbar: {x: y}\nbaz: ~");
+
+    std::vector<std::string> keys;
+    for (auto itr = root.begin(); itr != root.end(); ++itr)
+    {
+        keys.push_back(itr.key().get_value<std::string>());
+    }
+    std::vector<std::string> expected_keys {"foo", "bar", "baz"};
+    REQUIRE(keys == expected_keys);
+
+    std::vector<fkyaml::node::node_t> types;
+    for (const auto& elem : root["foo"])
+    {
+        types.push_back(elem.type());
+    }
+    std::vector<fkyaml::node::node_t> expected_types {
+        fkyaml::node::node_t::INTEGER, fkyaml::node::node_t::FLOAT_NUMBER, fkyaml::node::node_t::STRING};
+    REQUIRE(types == expected_types);
+
+    auto itr = root.begin();
+    REQUIRE((*itr).is_sequence());
+    REQUIRE(itr.value().is_sequence());
+    itr++;
+    REQUIRE(itr.value().is_mapping());
+    REQUIRE(root["foo"].begin() != root["foo"].end());
+    REQUIRE_THROWS_AS(root["foo"].begin().key(), fkyaml::exception);
+    REQUIRE_THROWS_AS(root["baz"].begin(), fkyaml::type_error);
+    REQUIRE_THROWS_AS(root["baz"].end(), fkyaml::type_error);
+}
+
+TEST_CASE("LazyNodeClassTest_AnchorAndAliasTest", "[LazyNodeClassTest]")
+{
+    fkyaml::lazy_node root = fkyaml::node::deserialize_lazy("foo: &anchor 123\nbar: *anchor");
+
+    REQUIRE(root["bar"].is_alias());
+    REQUIRE(root["bar"].is_integer());
+    REQUIRE(root["bar"].get_value<int>() == 123);
+
+    fkyaml::node bar = root["bar"].materialize();
+    REQUIRE(bar.is_alias());
+    REQUIRE(bar.get_anchor_name() == "anchor");
+    fkyaml::node foo = root["foo"].materialize();
+    REQUIRE(foo.is_anchor());
+    REQUIRE(foo.get_anchor_name() == "anchor");
+
+    REQUIRE_THROWS_AS(fkyaml::node::deserialize_lazy("foo: *anchor"), fkyaml::parse_error);
+}
+
+TEST_CASE("LazyNodeClassTest_MaterializeTest", "[LazyNodeClassTest]")
+{
+    auto input = GENERATE(
+        std::string("foo: bar\nbaz: [1, 2.5, true, null]\nqux:\n  - a: 1\n    b: 2\n  - c"),
+        std::string("%YAML 1.1\n---\nfoo: &a bar\nbaz: *a"),
+        std::string("? a: b\n: 1\n? c\n: d"),
+        std::string("foo:\n  - a: [1, 2]\n  - {}\n  - b"),
+        std::string(""));
+
+    fkyaml::node expected = fkyaml::node::deserialize(input);
+    fkyaml::node actual = fkyaml::node::deserialize_lazy(input).materialize();
+    REQUIRE(actual == expected);
+    REQUIRE(actual.get_yaml_version() == expected.get_yaml_version());
+    REQUIRE(fkyaml::node::serialize(actual) == fkyaml::node::serialize(expected));
+}
+
+TEST_CASE("LazyNodeClassTest_DuplicateKeysTest", "[LazyNodeClassTest]")
+{
+    SECTION("small mapping")
+    {
+        REQUIRE_THROWS_AS(fkyaml::node::deserialize_lazy("foo: 1\nbar: 2\nfoo: 3"), fkyaml::parse_error);
+        REQUIRE_THROWS_AS(fkyaml::node::deserialize_lazy("1: a\n1: b"), fkyaml::parse_error);
+        REQUIRE_THROWS_AS(fkyaml::node::deserialize_lazy("? a: b\n: 1\n? a: b\n: 2"), fkyaml::parse_error);
+        REQUIRE_NOTHROW(fkyaml::node::deserialize_lazy("foo:\n  foo: 1\nbar:\n  foo: 2"));
+    }
+
+    SECTION("large mapping")
+    {
+        std::string input;
+        for (int i = 0; i < 100; i++)
+        {
+            input += "key" + std::to_string(i) + ": " + std::to_string(i) + "\n";
+        }
+        fkyaml::lazy_node root = fkyaml::node::deserialize_lazy(input);
+        REQUIRE(root.size() == 100);
+        REQUIRE(root["key99"].get_value<int>() == 99);
+
+        REQUIRE_THROWS_AS(fkyaml::node::deserialize_lazy(input + "key3: 3"), fkyaml::parse_error);
+        REQUIRE_THROWS_AS(fkyaml::node::deserialize_lazy(input + "key99: 3"), fkyaml::parse_error);
+    }
+}
+
+TEST_CASE("LazyNodeClassTest_IteratorInputTest", "[LazyNodeClassTest]")
+{
+    std::string input = "foo: bar";
+    fkyaml::lazy_node root = fkyaml::node::deserialize_lazy(input.begin(), input.end());
+    REQUIRE(root["foo"].get_value<std::string>() == "bar");
+}
+
+TEST_CASE("LazyNodeClassTest_LifetimeTest", "[LazyNodeClassTest]")
+{
+    fkyaml::lazy_node child = fkyaml::node::deserialize_lazy("foo:\n  bar: baz")["foo"];
+    REQUIRE(child["bar"].get_value<std::string>() == "baz");
+
+    fkyaml::lazy_node copy = child;
+    child = fkyaml::node::deserialize_lazy("x: 1");
+    REQUIRE(copy["bar"].get_value<std::string>() == "baz");
+    REQUIRE(child["x"].get_value<int>() == 1);
+}
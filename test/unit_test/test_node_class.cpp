@@ -8,14 +8,23 @@
 
 #include <cmath>
 #include <cfloat>
+#include <cstdint>
 #include <fstream>
 #include <sstream>
+#include <thread>
 #include <map>
+#include <string>
+#include <unordered_set>
+#include <vector>
 
 #include <catch2/catch.hpp>
 
 #include <fkYAML/node.hpp>
 
+#ifdef FK_YAML_HAS_CXX_17
+    #include <string_view>
+#endif
+
 // generated in test/unit_test/CMakeLists.txt
 #include <test_data.hpp>
 
@@ -29,6 +38,13 @@ TEST_CASE("NodeClassTest_DefaultCtorTest", "[NodeClassTest]")
     REQUIRE(node.is_null());
 }
 
+TEST_CASE("NodeClassTest_CompactLayoutTest", "[NodeClassTest]")
+{
+    // a pointer to the optional properties and a node value with the packed attributes, which stores short strings in
+    // place and the others on the heap.
+    REQUIRE(sizeof(fkyaml::node) <= sizeof(void*) + 16);
+}
+
 TEST_CASE("NodeClassTest_SequenceTypeCtorTest", "[NodeClassTest]")
 {
     fkyaml::node node(fkyaml::node::node_t::SEQUENCE);
@@ -248,6 +264,228 @@ TEST_CASE("NodeClassTest_AliasCopyCtorTest", "[NodeClassTest]")
     REQUIRE(alias.get_value_ref<fkyaml::node::boolean_type&>() == true);
 }
 
+TEST_CASE("NodeClassTest_AnchorCopyCtorTest", "[NodeClassTest]")
+{
+    fkyaml::node anchor = 123;
+    anchor.add_anchor_name("anchor_name");
+    anchor.set_yaml_version(fkyaml::node::yaml_version_t::VER_1_1);
+
+    fkyaml::node copied(anchor);
+    REQUIRE(copied.is_anchor());
+    REQUIRE(copied.get_anchor_name() == "anchor_name");
+    REQUIRE(copied.get_yaml_version() == fkyaml::node::yaml_version_t::VER_1_1);
+
+    // the anchor name of the copy is independent of the original one.
+    copied.add_anchor_name("another_name");
+    REQUIRE(anchor.get_anchor_name() == "anchor_name");
+    REQUIRE(copied.get_anchor_name() == "another_name");
+}
+
+TEST_CASE("NodeClassTest_NestedCopyCtorTest", "[NodeClassTest]")
+{
+    fkyaml::node copied = fkyaml::node::deserialize("foo:\n"
+                                                    "  - &anchor 123\n"
+                                                    "  - bar: [true, 3.14]\n"
+                                                    "    baz: null\n"
+                                                    "  - qux\n");
+    copied[fkyaml::node {1, 2}] = fkyaml::node::deserialize("nested: {key: value}");
+    copied["foo"].get_value_ref<fkyaml::node::sequence_type&>().reserve(16);
+
+    fkyaml::node node(copied);
+    REQUIRE(node == copied);
+    REQUIRE(node["foo"][0].is_anchor());
+    REQUIRE(node["foo"][0].get_anchor_name() == "anchor");
+
+    // destination containers are sized exactly.
+    REQUIRE(node["foo"].get_value_ref<fkyaml::node::sequence_type&>().capacity() == 3);
+
+    // the copy is independent of the original one.
+    node["foo"][1]["bar"][0] = false;
+    REQUIRE(copied["foo"][1]["bar"][0].get_value<bool>() == true);
+    REQUIRE(node != copied);
+}
+
+TEST_CASE("NodeClassTest_DeeplyNestedNodeTest", "[NodeClassTest]")
+{
+    // deep enough to overflow the call stack if nodes were copied or compared recursively.
+    const std::size_t depth = 100000;
+
+    fkyaml::node root = fkyaml::node::sequence();
+    fkyaml::node* p_leaf = &root;
+    for (std::size_t i = 0; i < depth; i++)
+    {
+        if (i % 2 == 0)
+        {
+            p_leaf->get_value_ref<fkyaml::node::sequence_type&>().push_back(fkyaml::node::mapping());
+            p_leaf = &p_leaf->get_value_ref<fkyaml::node::sequence_type&>().back();
+        }
+        else
+        {
+            p_leaf = &(*p_leaf)["key"];
+            *p_leaf = fkyaml::node::sequence();
+        }
+    }
+    p_leaf->get_value_ref<fkyaml::node::sequence_type&>().push_back(123);
+
+    fkyaml::node copied = root;
+    REQUIRE(copied == root);
+    REQUIRE_FALSE(copied != root);
+    REQUIRE_FALSE(copied < root);
+    REQUIRE_FALSE(root < copied);
+
+    fkyaml::node* p_copied_leaf = &copied;
+    while (!p_copied_leaf->is_integer())
+    {
+        p_copied_leaf = p_copied_leaf->is_sequence() ? &(*p_copied_leaf)[0] : &(*p_copied_leaf)["key"];
+    }
+    *p_copied_leaf = 456;
+    REQUIRE(copied != root);
+    REQUIRE(root < copied);
+    REQUIRE_FALSE(copied < root);
+}
+
+TEST_CASE("NodeClassTest_DestroyWithSharedDescendantsTest", "[NodeClassTest]")
+{
+    fkyaml::node subtree;
+    fkyaml::node sibling;
+    {
+        fkyaml::node root = fkyaml::node::deserialize(
+            std::string("foo:\n  - baz\n  - bar:\n      x: [1, 2]\n      y: 2\nqux:\n  quux:\n    corge: 5\n"));
+        root.make_copy_on_write();
+        subtree = root["foo"][1];
+        sibling = root["qux"];
+        // the root is destroyed here, releasing the containers shared with the copies.
+    }
+
+    REQUIRE(subtree == fkyaml::node::deserialize(std::string("bar:\n  x: [1, 2]\n  y: 2\n")));
+    REQUIRE(sibling["quux"]["corge"].get_value<int>() == 5);
+}
+
+TEST_CASE("NodeClassTest_CloneParallelTest", "[NodeClassTest]")
+{
+    // large enough to be split into chunks of sequence elements as well as subtrees.
+    fkyaml::node root = fkyaml::node::mapping();
+    root["items"] = fkyaml::node::sequence();
+    fkyaml::node::sequence_type& items = root["items"].get_value_ref<fkyaml::node::sequence_type&>();
+    for (int i = 0; i < 3000; i++)
+    {
+        items.push_back(fkyaml::node {{"id", i}, {"tags", fkyaml::node::sequence({"foo", "bar"})}});
+    }
+    for (int i = 0; i < 100; i++)
+    {
+        root["group" + std::to_string(i)] = fkyaml::node {{"values", fkyaml::node::sequence({i, i + 1})}};
+    }
+    root["meta"] = "baz";
+    root["meta"].add_anchor_name("anchor");
+
+    SECTION("clone a large tree")
+    {
+        auto num_threads = GENERATE(std::size_t(0), std::size_t(1), std::size_t(2), std::size_t(4));
+        fkyaml::node copy = root.clone_parallel(num_threads);
+        REQUIRE(copy == root);
+        REQUIRE(copy["meta"].has_anchor_name());
+        REQUIRE(copy["meta"].get_anchor_name() == "anchor");
+
+        copy["items"][2999]["tags"][1] = "qux";
+        copy["group99"]["values"][0] = 0;
+        REQUIRE(root["items"][2999]["tags"][1].get_value<std::string>() == "bar");
+        REQUIRE(root["group99"]["values"][0].get_value<int>() == 99);
+    }
+
+    SECTION("clone a tree with copy-on-write containers")
+    {
+        root.make_copy_on_write();
+        const fkyaml::node copy = root.clone_parallel(4);
+        REQUIRE(copy == root);
+
+        // shared containers are shared with the copy just as the copy constructor does.
+        const fkyaml::node& const_root = root;
+        REQUIRE(
+            &copy["items"].get_value_ref<const fkyaml::node::sequence_type&>() ==
+            &const_root["items"].get_value_ref<const fkyaml::node::sequence_type&>());
+    }
+
+    SECTION("clone scalars and empty containers")
+    {
+        auto node = GENERATE(
+            fkyaml::node(), fkyaml::node(true), fkyaml::node(123), fkyaml::node(3.14), fkyaml::node("foo"),
+            fkyaml::node::sequence(), fkyaml::node::mapping());
+        REQUIRE(node.clone_parallel(4) == node);
+    }
+}
+
+TEST_CASE("NodeClassTest_DestroyParallelTest", "[NodeClassTest]")
+{
+    fkyaml::node root = fkyaml::node::sequence();
+    fkyaml::node::sequence_type& items = root.get_value_ref<fkyaml::node::sequence_type&>();
+    for (int i = 0; i < 3000; i++)
+    {
+        items.push_back(fkyaml::node {{"id", i}, {"values", fkyaml::node::sequence({i, fkyaml::node::sequence({i})})}});
+    }
+    root.add_anchor_name("anchor");
+
+    SECTION("destroy a large tree")
+    {
+        auto num_threads = GENERATE(std::size_t(0), std::size_t(1), std::size_t(2), std::size_t(4));
+        root.destroy_parallel(num_threads);
+        REQUIRE(root.is_null());
+        REQUIRE_FALSE(root.has_anchor_name());
+    }
+
+    SECTION("destroy a tree with containers shared with other nodes")
+    {
+        root.make_copy_on_write();
+        fkyaml::node item = root[1500];
+        fkyaml::node copy = root;
+
+        root.destroy_parallel(4);
+        REQUIRE(root.is_null());
+        REQUIRE(item["values"][1][0].get_value<int>() == 1500);
+        REQUIRE(copy.size() == 3000);
+        REQUIRE(copy[2999]["id"].get_value<int>() == 2999);
+    }
+
+    SECTION("destroy a scalar")
+    {
+        fkyaml::node node = "foo";
+        node.destroy_parallel(4);
+        REQUIRE(node.is_null());
+    }
+}
+
+TEST_CASE("NodeClassTest_DestroyBranchingNodeTest", "[NodeClassTest]")
+{
+    // every container has several children which own nested containers, including the elements used to chain the
+    // containers to be destroyed.
+    fkyaml::node leaf = {{"x", {1, 2}}, {"y", {{"z", {3}}}}};
+    for (int i = 0; i < 8; i++)
+    {
+        fkyaml::node branch = fkyaml::node::mapping();
+        branch["a"] = {leaf, leaf};
+        branch["b"] = leaf;
+        branch["c"] = {{"d", leaf}};
+        leaf = std::move(branch);
+    }
+
+    fkyaml::node copied = leaf;
+    fkyaml::node shared_subtree;
+    {
+        fkyaml::node root = {leaf, {leaf, 123}};
+        root.make_copy_on_write();
+        shared_subtree = root[1][0]["a"];
+        // the root is destroyed here, leaving the containers shared with the copy.
+    }
+    leaf = nullptr;
+
+    REQUIRE(shared_subtree == copied["a"]);
+    const fkyaml::node* p_leaf = &shared_subtree[1];
+    for (int i = 0; i < 7; i++)
+    {
+        p_leaf = &(*p_leaf)["b"];
+    }
+    REQUIRE((*p_leaf)["y"]["z"][0].get_value<int>() == 3);
+}
+
 TEST_CASE("NodeClassTest_SequenceMoveCtorTest", "[NodeClassTest]")
 {
     fkyaml::node moved = {true, "test"};
@@ -403,6 +641,297 @@ TEST_CASE("NodeClassTest_DeserializeTest", "[NodeClassTest]")
     REQUIRE(node["foo"].get_value_ref<std::string&>() == "bar");
 }
 
+TEST_CASE("NodeClassTest_DeserializeWithKeyInternerTest", "[NodeClassTest]")
+{
+    const std::string input = "first:\n"
+                              "  app.kubernetes.io/managed-by: helm\n"
+                              "  name: foo\n"
+                              "second:\n"
+                              "  app.kubernetes.io/managed-by: kustomize\n"
+                              "  name: bar\n";
+    const std::string long_key = "app.kubernetes.io/managed-by";
+
+    fkyaml::key_interner interner;
+
+    SECTION("same result as deserialize")
+    {
+        fkyaml::node node = fkyaml::node::deserialize(input, interner);
+        REQUIRE(node == fkyaml::node::deserialize(input));
+        REQUIRE(node["first"][long_key].get_value<std::string>() == "helm");
+        REQUIRE(node["second"][long_key].get_value<std::string>() == "kustomize");
+
+        fkyaml::node node_from_itrs = fkyaml::node::deserialize(input.begin(), input.end(), interner);
+        REQUIRE(node_from_itrs == node);
+    }
+
+    SECTION("equal keys share one string")
+    {
+        fkyaml::node node = fkyaml::node::deserialize(input, interner);
+        REQUIRE(interner.size() == 1);
+
+        const fkyaml::node& first = node["first"];
+        const fkyaml::node& second = node["second"];
+        const std::string& first_key = first.begin().key().get_value_ref<const std::string&>();
+        const std::string& second_key = second.begin().key().get_value_ref<const std::string&>();
+        REQUIRE(first_key == long_key);
+        REQUIRE(&first_key == &second_key);
+
+        // the interner can be shared across deserializations.
+        fkyaml::node another = fkyaml::node::deserialize(input, interner);
+        REQUIRE(interner.size() == 1);
+        REQUIRE(&another["first"].begin().key().get_value_ref<const std::string&>() == &first_key);
+    }
+
+    SECTION("interned keys are copied before modifications")
+    {
+        fkyaml::node node = fkyaml::node::deserialize(input, interner);
+        interner.clear();
+
+        fkyaml::node key = node["first"].begin().key();
+        key.get_value_ref<std::string&>() += "!";
+        REQUIRE(key.get_value<std::string>() == long_key + "!");
+        REQUIRE(node["first"].begin().key().get_value<std::string>() == long_key);
+        REQUIRE(node["second"].begin().key().get_value<std::string>() == long_key);
+    }
+
+    SECTION("copy, move and swap nodes with interned keys")
+    {
+        fkyaml::node node = fkyaml::node::deserialize(input, interner);
+        fkyaml::node key = node["first"].begin().key();
+        fkyaml::node copied = key;
+        fkyaml::node moved = std::move(copied);
+        REQUIRE(moved == key);
+
+        fkyaml::node other = 123;
+        moved.swap(other);
+        REQUIRE(moved.get_value<int>() == 123);
+        REQUIRE(other.get_value<std::string>() == long_key);
+        REQUIRE_FALSE(other < key);
+        REQUIRE_FALSE(key < other);
+    }
+}
+
+TEST_CASE("NodeClassTest_DeserializeSelectPathsTest", "[NodeClassTest]")
+{
+    std::string source = "kind: Pod\n"
+                         "spec:\n"
+                         "  containers:\n"
+                         "    - name: foo\n"
+                         "      image: &img foo:1.0\n"
+                         "    - name: bar\n"
+                         "    - name: baz\n"
+                         "      image: baz:2.0\n"
+                         "  volumes: {x: 1}\n"
+                         "meta:\n"
+                         "  default: *img\n"
+                         "  true: 123";
+
+    SECTION("wildcard index")
+    {
+        std::vector<std::string> paths {"spec.containers[*].image"};
+        fkyaml::node node = fkyaml::node::deserialize(source, paths);
+        REQUIRE(node.size() == 1);
+        REQUIRE(node["spec"].size() == 1);
+        fkyaml::node& containers = node["spec"]["containers"];
+        REQUIRE(containers.size() == 2);
+        REQUIRE(containers[0].size() == 1);
+        REQUIRE(containers[0]["image"].get_value<std::string>() == "foo:1.0");
+        REQUIRE(containers[1]["image"].get_value<std::string>() == "baz:2.0");
+    }
+
+    SECTION("multiple paths")
+    {
+        std::vector<std::string> paths {"kind", "spec.containers[1]", "spec.volumes"};
+        fkyaml::node node = fkyaml::node::deserialize(source, paths);
+        fkyaml::node expected = {
+            {"kind", "Pod"}, {"spec", {{"containers", {{{"name", "bar"}}}}, {"volumes", {{"x", 1}}}}}};
+        REQUIRE(node == expected);
+    }
+
+    SECTION("wildcard key")
+    {
+        std::vector<std::string> paths {"meta.*"};
+        fkyaml::node node = fkyaml::node::deserialize(source, paths);
+        REQUIRE(node["meta"].size() == 2);
+        REQUIRE(node["meta"][true].get_value<int>() == 123);
+    }
+
+    SECTION("alias of an unselected anchor")
+    {
+        std::vector<std::string> paths {"meta.default"};
+        fkyaml::node node = fkyaml::node::deserialize(source, paths);
+        REQUIRE(node["meta"]["default"].get_value<std::string>() == "foo:1.0");
+        REQUIRE(node["meta"]["default"].is_anchor());
+    }
+
+    SECTION("alias of a selected anchor")
+    {
+        std::vector<std::string> paths {"spec.containers[0].image", "meta.default"};
+        fkyaml::node node = fkyaml::node::deserialize(source, paths);
+        REQUIRE(node["spec"]["containers"][0]["image"].is_anchor());
+        REQUIRE(node["meta"]["default"].is_alias());
+        REQUIRE(node["meta"]["default"].get_value<std::string>() == "foo:1.0");
+    }
+
+    SECTION("no match")
+    {
+        std::vector<std::string> paths {"spec.containers[3]", "spec.containers.image", "status"};
+        fkyaml::node node = fkyaml::node::deserialize(source, paths);
+        REQUIRE(node.is_mapping());
+        REQUIRE(node.empty());
+        REQUIRE(fkyaml::node::deserialize(source, std::vector<std::string>()).empty());
+    }
+
+    SECTION("whole document")
+    {
+        std::vector<std::string> paths {""};
+        REQUIRE(fkyaml::node::deserialize(source, paths) == fkyaml::node::deserialize(source));
+    }
+
+    SECTION("a pair of iterators")
+    {
+        std::vector<std::string> paths {"kind"};
+        fkyaml::node node = fkyaml::node::deserialize(source.begin(), source.end(), paths);
+        REQUIRE(node.size() == 1);
+        REQUIRE(node["kind"].get_value<std::string>() == "Pod");
+    }
+
+    SECTION("invalid paths")
+    {
+        auto path = GENERATE(
+            std::string("spec..image"),
+            std::string(".spec"),
+            std::string("spec."),
+            std::string("[0]"),
+            std::string("spec[]"),
+            std::string("spec[x]"),
+            std::string("spec[0"),
+            std::string("spec[0]image"));
+        std::vector<std::string> paths {path};
+        REQUIRE_THROWS_AS(fkyaml::node::deserialize(source, paths), fkyaml::exception);
+    }
+
+    SECTION("duplicate keys in selected branches")
+    {
+        std::vector<std::string> paths {"foo"};
+        REQUIRE_THROWS_AS(fkyaml::node::deserialize("foo: 1\nfoo: 2", paths), fkyaml::parse_error);
+        REQUIRE_NOTHROW(fkyaml::node::deserialize("foo: 1\nbar: 2\nbar: 3", paths));
+    }
+}
+
+TEST_CASE("NodeClassTest_DeserializeIntoTest", "[NodeClassTest]")
+{
+    SECTION("same result as deserialize")
+    {
+        auto before = GENERATE(
+            std::string("foo: bar\nbaz: [1, 2.5, true, null]\nqux:\n  - a: 1\n    b: 2\n  - c"),
+            std::string("foo: 1\nbaz: {a: b}\nqux: text"),
+            std::string("k: &x 1\nl: *x\nfoo: &y str"),
+            std::string(""));
+        auto after = GENERATE(
+            std::string("foo: bar\nbaz: [1, 2.5, true, null]\nqux:\n  - a: 1\n    b: 2\n  - c"),
+            std::string("baz: [3]\nfoo: baz\nqux:\n  - c\n  - a: 3\n  - e\nnew: {x: y}"),
+            std::string("%YAML 1.1\n---\nk: &x 1\nl: *x\nfoo: str"),
+            std::string("? a: b\n: 1\n? c\n: d"),
+            std::string(""));
+        fkyaml::node node = fkyaml::node::deserialize(before);
+        fkyaml::node::deserialize_into(after, node);
+        fkyaml::node expected = fkyaml::node::deserialize(after);
+        REQUIRE(node == expected);
+        REQUIRE(node.get_yaml_version() == expected.get_yaml_version());
+        REQUIRE(fkyaml::node::serialize(node) == fkyaml::node::serialize(expected));
+    }
+
+    SECTION("unchanged nodes are reused")
+    {
+        fkyaml::node node = fkyaml::node::deserialize("foo:\n  bar: a string which is long enough\n  baz: [1, 2]");
+        const fkyaml::node* p_bar = &node["foo"]["bar"];
+        const std::string* p_bar_str = &node["foo"]["bar"].get_value_ref<const std::string&>();
+        const fkyaml::node* p_elem = &node["foo"]["baz"][1];
+
+        fkyaml::node::deserialize_into("foo:\n  bar: a string which is long enough!\n  baz: [3, 4]", node);
+        REQUIRE(&node["foo"]["bar"] == p_bar);
+        REQUIRE(&node["foo"]["bar"].get_value_ref<const std::string&>() == p_bar_str);
+        REQUIRE(node["foo"]["bar"].get_value<std::string>() == "a string which is long enough!");
+        REQUIRE(&node["foo"]["baz"][1] == p_elem);
+        REQUIRE(node["foo"]["baz"][1].get_value<int>() == 4);
+    }
+
+    SECTION("order-preserving mapping")
+    {
+        using ordered_node_t = fkyaml::basic_node<std::vector, fkyaml::ordered_map>;
+        ordered_node_t node = ordered_node_t::deserialize("foo: 1\nbar: 2\nbaz: 3");
+        ordered_node_t::deserialize_into("baz: 4\nqux: 5\nfoo: 6", node);
+        REQUIRE(ordered_node_t::serialize(node) == "baz: 4\nqux: 5\nfoo: 6\n");
+    }
+
+    SECTION("a pair of iterators")
+    {
+        std::string source = "foo: bar";
+        fkyaml::node node = {{"foo", 123}, {"baz", true}};
+        fkyaml::node::deserialize_into(source.begin(), source.end(), node);
+        REQUIRE(node.size() == 1);
+        REQUIRE(node["foo"].get_value<std::string>() == "bar");
+    }
+
+    SECTION("duplicate keys")
+    {
+        fkyaml::node node = fkyaml::node::deserialize("foo: 1\nbar: 2");
+        REQUIRE_THROWS_AS(fkyaml::node::deserialize_into("foo: 1\nbar: 2\nfoo: 3", node), fkyaml::parse_error);
+        REQUIRE_THROWS_AS(fkyaml::node::deserialize_into("baz: 1\nbaz: 2", node), fkyaml::parse_error);
+    }
+
+    SECTION("undefined alias")
+    {
+        fkyaml::node node = fkyaml::node::deserialize("foo: &a 1\nbar: *a");
+        REQUIRE_THROWS_AS(fkyaml::node::deserialize_into("bar: *a", node), fkyaml::parse_error);
+    }
+}
+
+TEST_CASE("NodeClassTest_DeserializeDocsParallelTest", "[NodeClassTest]")
+{
+    std::string source;
+    for (int i = 0; i < 100; i++)
+    {
+        source += "---\nindex: " + std::to_string(i) + "\nseq:\n  - foo\n  - \"bar\"\n";
+    }
+
+    SECTION("documents are returned in order")
+    {
+        std::size_t num_threads = GENERATE(std::size_t(0), std::size_t(1), std::size_t(4));
+        std::vector<fkyaml::node> docs = fkyaml::node::deserialize_docs_parallel(source, num_threads);
+        REQUIRE(docs.size() == 100);
+        for (int i = 0; i < 100; i++)
+        {
+            REQUIRE(docs[i]["index"].get_value<int>() == i);
+            REQUIRE(docs[i]["seq"].size() == 2);
+        }
+    }
+
+    SECTION("a pair of iterators")
+    {
+        std::vector<fkyaml::node> docs =
+            fkyaml::node::deserialize_docs_parallel(source.begin(), source.end(), std::size_t(2));
+        REQUIRE(docs.size() == 100);
+        REQUIRE(docs[99]["index"].get_value<int>() == 99);
+    }
+
+    SECTION("directives apply only to the following document")
+    {
+        std::vector<fkyaml::node> docs = fkyaml::node::deserialize_docs_parallel("foo: 1\n...\n%YAML 1.1\n---\nbar: 2");
+        REQUIRE(docs.size() == 2);
+        REQUIRE(docs[0].get_yaml_version() == fkyaml::node::yaml_version_t::VER_1_2);
+        REQUIRE(docs[1].get_yaml_version() == fkyaml::node::yaml_version_t::VER_1_1);
+    }
+
+    SECTION("an error in a document")
+    {
+        source += "---\nfoo:\n  bar: baz\n qux: 1\n";
+        source += "---\nfoo: 1\n";
+        REQUIRE_THROWS_AS(fkyaml::node::deserialize_docs_parallel(source, std::size_t(4)), fkyaml::parse_error);
+    }
+}
+
 TEST_CASE("NodeClassTest_SerializeTest", "[NodeClassTest]")
 {
     fkyaml::node node = fkyaml::node::deserialize("foo: bar");
@@ -804,6 +1333,28 @@ TEST_CASE("NodeClassTest_SubscriptOperatorTest", "[NodeClassTest]")
                 REQUIRE_NOTHROW(node[std::move(node_key)]);
             }
         }
+
+        SECTION("Test the const subscript operators with missing keys.")
+        {
+            fkyaml::node plain = fkyaml::node::mapping({{"foo", 1}, {"bar", 2}});
+            fkyaml::node shared = plain;
+            shared.make_copy_on_write();
+            const fkyaml::node snapshot = shared;
+            const fkyaml::node& const_plain = plain;
+
+            // no mapping is modified regardless of whether it's shared with copy-on-write copies.
+            for (const fkyaml::node* p_node : {&const_plain, &snapshot})
+            {
+                const fkyaml::node& node = *p_node;
+                REQUIRE(node["missing"].is_null());
+                REQUIRE(node[std::string("missing")].is_null());
+                REQUIRE(node[fkyaml::node("missing")].is_null());
+                REQUIRE(node[123].is_null());
+                REQUIRE(node.size() == 2);
+                REQUIRE_FALSE(node.contains("missing"));
+                REQUIRE(node["foo"].get_value<int>() == 1);
+            }
+        }
     }
 
     SECTION("Test nothrow expected subscript operators for sequence nodes.")
@@ -1087,6 +1638,19 @@ TEST_CASE("NodeClassTest_LessThanOperatorTest", "[NodeClassTest]")
         REQUIRE(params[0] < params[1]);
     }
 
+    SECTION("The same container type and the target value has a less nested value than the compared one.")
+    {
+        fkyaml::node seq = fkyaml::node::sequence({1, fkyaml::node::sequence({2, 3})});
+        REQUIRE(seq < fkyaml::node::sequence({1, fkyaml::node::sequence({2, 4})}));
+        REQUIRE(seq < fkyaml::node::sequence({1, fkyaml::node::sequence({2, 3}), 4}));
+        REQUIRE_FALSE(seq < fkyaml::node::sequence({1, fkyaml::node::sequence({2})}));
+
+        fkyaml::node map = fkyaml::node::deserialize("foo:\n  bar: 1");
+        REQUIRE(map < fkyaml::node::deserialize("foo:\n  bar: 2"));
+        REQUIRE(map < fkyaml::node::deserialize("foo:\n  baz: 0"));
+        REQUIRE_FALSE(map < fkyaml::node::deserialize("foo:\n  bar: 0"));
+    }
+
     SECTION("The same type but the target value is greater than the compared one.")
     {
         auto params = GENERATE(
@@ -1436,10 +2000,146 @@ TEST_CASE("NodeClassTest_GreaterThanOrEqualToOperatorTest", "[NodeClassTest]")
     }
 }
 
+TEST_CASE("NodeClassTest_CompareTest", "[NodeClassTest]")
+{
+    SECTION("The same type and value.")
+    {
+        auto params = GENERATE(
+            fkyaml::node {{true, 123, "foo"}, {true, 123, "foo"}},
+            fkyaml::node {{{"foo", 123}, {"bar", true}}, {{"foo", 123}, {"bar", true}}},
+            fkyaml::node {nullptr, nullptr},
+            fkyaml::node {true, true},
+            fkyaml::node {123, 123},
+            fkyaml::node {3.14, 3.14},
+            fkyaml::node {"foo", "foo"});
+        REQUIRE(params[0].compare(params[1]) == 0);
+        REQUIRE(params[1].compare(params[0]) == 0);
+    }
+
+    SECTION("The target value is less than the compared one.")
+    {
+        auto params = GENERATE(
+            fkyaml::node {{true, 123}, {true, 123, "foo"}},
+            fkyaml::node {{{"bar", true}}, {{"foo", 123}, {"bar", true}}},
+            fkyaml::node {false, true},
+            fkyaml::node {123, 456},
+            fkyaml::node {3.14, 4.25},
+            fkyaml::node {"ab", "abc"},
+            fkyaml::node {"abc", "b"},
+            fkyaml::node {{true, 123, "foo"}, nullptr},
+            fkyaml::node {nullptr, "foo"},
+            fkyaml::node {123, 3.14});
+        REQUIRE(params[0].compare(params[1]) == -1);
+        REQUIRE(params[1].compare(params[0]) == 1);
+        REQUIRE(params[0] < params[1]);
+        REQUIRE(params[0] <= params[1]);
+        REQUIRE_FALSE(params[0] > params[1]);
+        REQUIRE_FALSE(params[0] >= params[1]);
+    }
+
+    SECTION("Nested containers.")
+    {
+        fkyaml::node seq = fkyaml::node::sequence({1, fkyaml::node::sequence({2, 3})});
+        REQUIRE(seq.compare(fkyaml::node::sequence({1, fkyaml::node::sequence({2, 4})})) == -1);
+        REQUIRE(seq.compare(fkyaml::node::sequence({1, fkyaml::node::sequence({2})})) == 1);
+
+        fkyaml::node map = fkyaml::node::deserialize("foo:\n  bar: 1");
+        REQUIRE(map.compare(fkyaml::node::deserialize("foo:\n  bar: 2")) == -1);
+        REQUIRE(map.compare(fkyaml::node::deserialize("foo:\n  bar: 0")) == 1);
+        REQUIRE(map.compare(fkyaml::node::deserialize("foo:\n  bar: 1")) == 0);
+    }
+
+    SECTION("Copy-on-write copies.")
+    {
+        fkyaml::node base = fkyaml::node::deserialize("foo: [1, 2, 3]\nbar:\n  baz: qux");
+        base.make_copy_on_write();
+        const fkyaml::node copy = base;
+        REQUIRE(copy.compare(base) == 0);
+        REQUIRE(copy["foo"].compare(base["foo"]) == 0);
+
+        fkyaml::node modified = base;
+        modified["bar"]["baz"] = "quz";
+        REQUIRE(base.compare(modified) == -1);
+        REQUIRE(modified.compare(base) == 1);
+    }
+}
+
 //
 // test cases for type property getter/checkers
 //
 
+TEST_CASE("NodeClassTest_EqualParallelTest", "[NodeClassTest]")
+{
+    fkyaml::node root = fkyaml::node::mapping();
+    root["items"] = fkyaml::node::sequence();
+    fkyaml::node::sequence_type& items = root["items"].get_value_ref<fkyaml::node::sequence_type&>();
+    for (int i = 0; i < 3000; i++)
+    {
+        items.push_back(fkyaml::node {{"id", i}, {"name", "item" + std::to_string(i)}});
+    }
+    for (int i = 0; i < 100; i++)
+    {
+        root["group" + std::to_string(i)] = fkyaml::node {{"values", fkyaml::node::sequence({i, i + 1})}};
+    }
+    fkyaml::node copy = root;
+    auto num_threads = GENERATE(std::size_t(0), std::size_t(1), std::size_t(2), std::size_t(4));
+
+    SECTION("equal trees")
+    {
+        REQUIRE(root.equal_parallel(copy, num_threads));
+        REQUIRE(copy.equal_parallel(root, num_threads));
+        REQUIRE(root.equal_parallel(root, num_threads));
+    }
+
+    SECTION("different elements of a large sequence")
+    {
+        copy["items"][2999]["name"] = "foo";
+        REQUIRE_FALSE(root.equal_parallel(copy, num_threads));
+        REQUIRE_FALSE(copy.equal_parallel(root, num_threads));
+    }
+
+    SECTION("different values of a small container")
+    {
+        copy["group50"]["values"][1] = 0;
+        REQUIRE_FALSE(root.equal_parallel(copy, num_threads));
+    }
+
+    SECTION("different keys")
+    {
+        copy.get_value_ref<fkyaml::node::mapping_type&>().erase("group0");
+        copy["group"] = fkyaml::node {{"values", fkyaml::node::sequence({0, 1})}};
+        REQUIRE_FALSE(root.equal_parallel(copy, num_threads));
+    }
+
+    SECTION("different sizes")
+    {
+        copy["items"].get_value_ref<fkyaml::node::sequence_type&>().pop_back();
+        REQUIRE_FALSE(root.equal_parallel(copy, num_threads));
+    }
+
+    SECTION("different types")
+    {
+        REQUIRE_FALSE(root.equal_parallel(root["items"], num_threads));
+        REQUIRE_FALSE(root.equal_parallel(fkyaml::node(123), num_threads));
+        REQUIRE(fkyaml::node(123).equal_parallel(fkyaml::node(123), num_threads));
+    }
+
+    SECTION("unordered nodes")
+    {
+        fkyaml::unordered_node lhs = fkyaml::unordered_node::mapping();
+        fkyaml::unordered_node rhs = fkyaml::unordered_node::mapping();
+        for (int i = 0; i < 2000; i++)
+        {
+            lhs["key" + std::to_string(i)] = fkyaml::unordered_node::sequence({i});
+            rhs["key" + std::to_string(1999 - i)] = fkyaml::unordered_node::sequence({1999 - i});
+        }
+        REQUIRE(lhs.equal_parallel(rhs, num_threads));
+
+        rhs["key1000"][0] = 0;
+        REQUIRE_FALSE(lhs.equal_parallel(rhs, num_threads));
+    }
+}
+
 TEST_CASE("NodeClassTest_TypeGetterTest", "[NodeClassTest]")
 {
     using NodeTypePair = std::pair<fkyaml::node, fkyaml::node::node_t>;
@@ -2347,6 +3047,59 @@ TEST_CASE("NodeClassTest_GetValueTest", "[NodeClassTest]")
     }
 }
 
+TEST_CASE("NodeClassTest_GetValueParallelTest", "[NodeClassTest]")
+{
+    fkyaml::node node = fkyaml::node::sequence();
+    fkyaml::node::sequence_type& seq = node.get_value_ref<fkyaml::node::sequence_type&>();
+    for (int i = 0; i < 3000; i++)
+    {
+        seq.push_back(i);
+    }
+    auto num_threads = GENERATE(std::size_t(0), std::size_t(1), std::size_t(2), std::size_t(4));
+
+    SECTION("convert into std::vector objects")
+    {
+        std::vector<int> ints = node.get_value_parallel<std::vector<int>>(num_threads);
+        REQUIRE(ints == node.get_value<std::vector<int>>());
+
+        std::vector<std::int16_t> shorts = node.get_value_parallel<std::vector<std::int16_t>>(num_threads);
+        REQUIRE(shorts.size() == 3000);
+        REQUIRE(shorts[2999] == 2999);
+
+        fkyaml::node bool_node = fkyaml::node::sequence();
+        for (int i = 0; i < 3000; i++)
+        {
+            bool_node.get_value_ref<fkyaml::node::sequence_type&>().push_back(i % 3 == 0);
+        }
+        std::vector<bool> bools = bool_node.get_value_parallel<std::vector<bool>>(num_threads);
+        REQUIRE(bools == bool_node.get_value<std::vector<bool>>());
+
+        std::vector<fkyaml::node> nodes = node.get_value_parallel<std::vector<fkyaml::node>>(num_threads);
+        REQUIRE(nodes == seq);
+    }
+
+    SECTION("convert an empty sequence")
+    {
+        REQUIRE(fkyaml::node::sequence().get_value_parallel<std::vector<int>>(num_threads).empty());
+    }
+
+    SECTION("non-sequence nodes")
+    {
+        REQUIRE_THROWS_AS(fkyaml::node(123).get_value_parallel<std::vector<int>>(num_threads), fkyaml::type_error);
+        REQUIRE_THROWS_AS(
+            fkyaml::node::mapping().get_value_parallel<std::vector<int>>(num_threads), fkyaml::type_error);
+    }
+
+    SECTION("elements which cannot be converted")
+    {
+        seq[100] = "foo";
+        seq[2500] = fkyaml::node::mapping();
+        REQUIRE_THROWS_WITH(
+            node.get_value_parallel<std::vector<int>>(num_threads),
+            Catch::Matchers::Contains("type=string"));
+    }
+}
+
 //
 // test cases for value reference getters
 //
@@ -2784,6 +3537,48 @@ TEST_CASE("NodeClassTest_GetValueRefForStringTest", "[NodeClassTest]")
         }
     }
 
+    SECTION("Test modification through references.")
+    {
+        auto str = GENERATE(
+            fkyaml::node::string_type(""),
+            fkyaml::node::string_type("short"),
+            fkyaml::node::string_type("a string which is too long to be stored in place"));
+        fkyaml::node node = str;
+
+        SECTION("Test a held reference.")
+        {
+            fkyaml::node::string_type& ref = node.get_value_ref<fkyaml::node::string_type&>();
+            ref += " and a suffix which makes it long";
+            REQUIRE(node.get_value_ref<fkyaml::node::string_type&>() == str + " and a suffix which makes it long");
+            REQUIRE(node.size() == str.size() + 33);
+            REQUIRE(node == fkyaml::node(str + " and a suffix which makes it long"));
+
+            ref = "x";
+            REQUIRE(node.get_value<std::string>() == "x");
+            REQUIRE(node.size() == 1);
+            REQUIRE(node == fkyaml::node("x"));
+        }
+
+        SECTION("Test a reference to a const node.")
+        {
+            const fkyaml::node& const_node = node;
+            const fkyaml::node::string_type& ref = const_node.get_value_ref<const fkyaml::node::string_type&>();
+            REQUIRE(ref == str);
+            // the same string object is referenced by later calls.
+            REQUIRE(&const_node.get_value_ref<const fkyaml::node::string_type&>() == &ref);
+            REQUIRE(const_node == fkyaml::node(str));
+        }
+
+        SECTION("Test a copy and a moved node.")
+        {
+            node.get_value_ref<fkyaml::node::string_type&>() += "!";
+            fkyaml::node copied = node;
+            fkyaml::node moved = std::move(node);
+            REQUIRE(copied.get_value<std::string>() == str + "!");
+            REQUIRE(moved.get_value<std::string>() == str + "!");
+        }
+    }
+
     SECTION("Test nothrow unexpected nodes.")
     {
         auto node = GENERATE(
@@ -2960,6 +3755,66 @@ TEST_CASE("NodeClassTest_SwapTest", "[NodeClassTest]")
     REQUIRE(rhs_node.get_value_ref<fkyaml::node::boolean_type&>() == true);
 }
 
+TEST_CASE("NodeClassTest_SwapStringTest", "[NodeClassTest]")
+{
+    auto lhs_str = GENERATE(std::string("short"), std::string("a string which is too long to be stored in place"));
+    auto rhs_str = GENERATE(std::string("foo"), std::string("another string which is too long to be stored in place"));
+
+    SECTION("string and string")
+    {
+        fkyaml::node lhs_node = lhs_str;
+        fkyaml::node rhs_node = rhs_str;
+        lhs_node.swap(rhs_node);
+        REQUIRE(lhs_node.get_value_ref<std::string&>() == rhs_str);
+        REQUIRE(rhs_node.get_value_ref<std::string&>() == lhs_str);
+    }
+
+    SECTION("string and non-string")
+    {
+        fkyaml::node lhs_node = lhs_str;
+        fkyaml::node rhs_node = {1, 2};
+        lhs_node.swap(rhs_node);
+        REQUIRE(lhs_node.is_sequence());
+        REQUIRE(lhs_node.size() == 2);
+        REQUIRE(rhs_node.get_value_ref<std::string&>() == lhs_str);
+
+        rhs_node.swap(lhs_node);
+        REQUIRE(lhs_node.get_value_ref<std::string&>() == lhs_str);
+        REQUIRE(rhs_node.is_sequence());
+    }
+}
+
+TEST_CASE("NodeClassTest_SelfSwapTest", "[NodeClassTest]")
+{
+    auto node = GENERATE(
+        fkyaml::node("short"),
+        fkyaml::node("a string which is too long to be stored in place"),
+        fkyaml::node {1, 2},
+        fkyaml::node {{"foo", "bar"}},
+        fkyaml::node(123));
+    fkyaml::node expected = node;
+    node.add_anchor_name("anchor_name");
+
+    node.swap(node);
+    REQUIRE(node == expected);
+    REQUIRE(node.get_anchor_name() == "anchor_name");
+}
+
+TEST_CASE("NodeClassTest_SwapPropertiesTest", "[NodeClassTest]")
+{
+    fkyaml::node lhs_node = true;
+    lhs_node.add_anchor_name("anchor_name");
+    fkyaml::node rhs_node = 123;
+    rhs_node.set_yaml_version(fkyaml::node::yaml_version_t::VER_1_1);
+    lhs_node.swap(rhs_node);
+
+    REQUIRE_FALSE(lhs_node.has_anchor_name());
+    REQUIRE(lhs_node.get_yaml_version() == fkyaml::node::yaml_version_t::VER_1_1);
+    REQUIRE(rhs_node.is_anchor());
+    REQUIRE(rhs_node.get_anchor_name() == "anchor_name");
+    REQUIRE(rhs_node.get_yaml_version() == fkyaml::node::yaml_version_t::VER_1_2);
+}
+
 TEST_CASE("NodeClassTest_ADLSwapTest", "[NodeClassTest]")
 {
     fkyaml::node lhs_node = true;
@@ -2973,3 +3828,813 @@ TEST_CASE("NodeClassTest_ADLSwapTest", "[NodeClassTest]")
     REQUIRE(rhs_node.is_boolean());
     REQUIRE(rhs_node.get_value_ref<fkyaml::node::boolean_type&>() == true);
 }
+
+//
+// test cases for compaction
+//
+
+TEST_CASE("NodeClassTest_CompactTest", "[NodeClassTest]")
+{
+    const std::string input = "first:\n"
+                              "  app.kubernetes.io/managed-by: a very long string value for the first entry\n"
+                              "  description: a very long string value which appears more than once\n"
+                              "  name: foo\n"
+                              "second:\n"
+                              "  app.kubernetes.io/managed-by: a very long string value for the second entry\n"
+                              "  description: a very long string value which appears more than once\n"
+                              "  name: foo\n"
+                              "third: [a very long string value which appears more than once, &anchor bar]\n";
+    const std::string long_key = "app.kubernetes.io/managed-by";
+
+    SECTION("compacted node is equal to the original")
+    {
+        fkyaml::node node = fkyaml::node::deserialize(input);
+        const fkyaml::node original = node;
+        node.compact();
+        REQUIRE(node == original);
+        REQUIRE(node["third"][1].is_anchor());
+        REQUIRE(node["third"][1].get_anchor_name() == "anchor");
+
+        // compaction can be repeated without any change.
+        node.compact();
+        REQUIRE(node == original);
+    }
+
+    SECTION("duplicated long strings are shared")
+    {
+        fkyaml::node node = fkyaml::node::deserialize(input);
+        node.compact();
+
+        const std::string& first_desc = node["first"]["description"].get_value_ref<const std::string&>();
+        const std::string& second_desc = node["second"]["description"].get_value_ref<const std::string&>();
+        const std::string& third_desc = node["third"][0].get_value_ref<const std::string&>();
+        REQUIRE(&first_desc == &second_desc);
+        REQUIRE(&first_desc == &third_desc);
+
+        const std::string& first_key = node["first"].begin().key().get_value_ref<const std::string&>();
+        const std::string& second_key = node["second"].begin().key().get_value_ref<const std::string&>();
+        REQUIRE(first_key == long_key);
+        REQUIRE(&first_key == &second_key);
+
+        // unique long strings are left as they are.
+        const std::string& first_val = node["first"][long_key].get_value_ref<const std::string&>();
+        const std::string& second_val = node["second"][long_key].get_value_ref<const std::string&>();
+        REQUIRE(&first_val != &second_val);
+    }
+
+    SECTION("compaction with a key interner")
+    {
+        fkyaml::key_interner interner;
+        fkyaml::node::key_interner_type::pointer p_str =
+            interner.intern(std::string("a very long string value for the first entry"));
+
+        fkyaml::node node = fkyaml::node::deserialize(input);
+        node.compact(interner);
+        REQUIRE(&node["first"][long_key].get_value_ref<const std::string&>() == p_str.get());
+        REQUIRE(interner.find("a very long string value which appears more than once") != nullptr);
+    }
+
+    SECTION("shared strings can be modified without affecting the others")
+    {
+        fkyaml::node node = fkyaml::node::deserialize(input);
+        node.compact();
+
+        node["first"]["description"].get_value_ref<std::string&>() = "modified";
+        REQUIRE(node["first"]["description"].get_value<std::string>() == "modified");
+        REQUIRE(
+            node["second"]["description"].get_value<std::string>() ==
+            "a very long string value which appears more than once");
+    }
+
+    SECTION("compaction of scalar nodes")
+    {
+        fkyaml::node node = 123;
+        node.compact();
+        REQUIRE(node.get_value<int>() == 123);
+    }
+}
+
+TEST_CASE("NodeClassTest_CompactSubtreeTest", "[NodeClassTest]")
+{
+    using mapping_type = fkyaml::node::mapping_type;
+    using sequence_type = fkyaml::node::sequence_type;
+
+    const std::string input = "web:\n"
+                              "  labels:\n"
+                              "    app: frontend\n"
+                              "    tier: public\n"
+                              "  ports:\n"
+                              "    - 80\n"
+                              "    - 443\n"
+                              "  ratio: 1.5\n"
+                              "api:\n"
+                              "  labels:\n"
+                              "    app: frontend\n"
+                              "    tier: public\n"
+                              "  ports:\n"
+                              "    - 80\n"
+                              "    - 443\n"
+                              "  ratio: 1.5\n"
+                              "db:\n"
+                              "  labels:\n"
+                              "    app: frontend\n"
+                              "    tier: public\n"
+                              "  ports:\n"
+                              "    - 80\n"
+                              "    - 443\n"
+                              "  ratio: 2.5\n";
+
+    SECTION("identical subtrees are shared")
+    {
+        fkyaml::node node = fkyaml::node::deserialize(input);
+        const fkyaml::node original = node;
+        node.compact();
+        REQUIRE(node == original);
+
+        const fkyaml::node& cnode = node;
+        const mapping_type& web = cnode["web"].get_value_ref<const mapping_type&>();
+        REQUIRE(&web == &cnode["api"].get_value_ref<const mapping_type&>());
+        REQUIRE(&web != &cnode["db"].get_value_ref<const mapping_type&>());
+
+        // the children of the different subtree are shared as well.
+        REQUIRE(
+            &cnode["web"]["labels"].get_value_ref<const mapping_type&>() ==
+            &cnode["db"]["labels"].get_value_ref<const mapping_type&>());
+        REQUIRE(
+            &cnode["web"]["ports"].get_value_ref<const sequence_type&>() ==
+            &cnode["db"]["ports"].get_value_ref<const sequence_type&>());
+
+        // compaction can be repeated without any change.
+        node.compact();
+        REQUIRE(node == original);
+    }
+
+    SECTION("shared subtrees can be modified without affecting the others")
+    {
+        fkyaml::node node = fkyaml::node::deserialize(input);
+        node.compact();
+
+        node["web"]["labels"]["app"] = "backend";
+        node["api"]["ports"].get_value_ref<sequence_type&>().emplace_back(8080);
+        REQUIRE(node["web"]["labels"]["app"].get_value<std::string>() == "backend");
+        REQUIRE(node["api"]["labels"]["app"].get_value<std::string>() == "frontend");
+        REQUIRE(node["db"]["labels"]["app"].get_value<std::string>() == "frontend");
+        REQUIRE(node["api"]["ports"].size() == 3);
+        REQUIRE(node["web"]["ports"].size() == 2);
+        REQUIRE(node["db"]["ports"].size() == 2);
+    }
+
+    SECTION("subtrees which are equal but not identical are not shared")
+    {
+        fkyaml::node node = fkyaml::node::deserialize("plain:\n"
+                                                      "  - foo\n"
+                                                      "  - bar\n"
+                                                      "anchored:\n"
+                                                      "  - &anchor foo\n"
+                                                      "  - bar\n");
+        node["negative_zero"] = fkyaml::node::sequence_type {fkyaml::node(-0.0)};
+        node["positive_zero"] = fkyaml::node::sequence_type {fkyaml::node(0.0)};
+        node["tiny"] = fkyaml::node::sequence_type {fkyaml::node(1e-300)};
+        const fkyaml::node original = node;
+        node.compact();
+        REQUIRE(node == original);
+
+        const fkyaml::node& cnode = node;
+        const sequence_type& plain = cnode["plain"].get_value_ref<const sequence_type&>();
+        REQUIRE(&plain != &cnode["anchored"].get_value_ref<const sequence_type&>());
+        REQUIRE(cnode["anchored"][0].get_anchor_name() == "anchor");
+
+        const sequence_type& zero = cnode["positive_zero"].get_value_ref<const sequence_type&>();
+        REQUIRE(&zero != &cnode["negative_zero"].get_value_ref<const sequence_type&>());
+        REQUIRE(&zero != &cnode["tiny"].get_value_ref<const sequence_type&>());
+        REQUIRE(std::signbit(cnode["negative_zero"][0].get_value<double>()));
+        REQUIRE(cnode["tiny"][0].get_value<double>() == 1e-300);
+    }
+
+    SECTION("properties of shared subtree roots are kept")
+    {
+        fkyaml::node node = fkyaml::node::deserialize("first:\n"
+                                                      "  - foo\n"
+                                                      "  - bar\n"
+                                                      "second:\n"
+                                                      "  - foo\n"
+                                                      "  - bar\n");
+        node["first"].add_anchor_name("first");
+        node.compact();
+
+        const fkyaml::node& cnode = node;
+        REQUIRE(
+            &cnode["first"].get_value_ref<const sequence_type&>() ==
+            &cnode["second"].get_value_ref<const sequence_type&>());
+        REQUIRE(cnode["first"].get_anchor_name() == "first");
+        REQUIRE_FALSE(cnode["second"].has_anchor_name());
+    }
+
+    SECTION("containers shared with other nodes are not copied")
+    {
+        fkyaml::node node = fkyaml::node::deserialize(input);
+        node.make_copy_on_write();
+        const fkyaml::node copy = node;
+        node.compact();
+
+        const fkyaml::node& cnode = node;
+        REQUIRE(&cnode.get_value_ref<const mapping_type&>() == &copy.get_value_ref<const mapping_type&>());
+        REQUIRE(
+            &cnode["web"].get_value_ref<const mapping_type&>() == &copy["web"].get_value_ref<const mapping_type&>());
+    }
+}
+
+TEST_CASE("NodeClassTest_CompactDocumentTest", "[NodeClassTest]")
+{
+    using mapping_type = fkyaml::node::mapping_type;
+
+    const std::string input = "first:\n"
+                              "  description: a very long string value which appears more than once\n"
+                              "  replicas: 3\n"
+                              "second:\n"
+                              "  description: a very long string value which appears more than once\n"
+                              "  replicas: 3\n";
+
+    SECTION("compact_document without a key interner")
+    {
+        const fkyaml::node node = fkyaml::node::compact_document(input);
+        REQUIRE(node == fkyaml::node::deserialize(input));
+        REQUIRE(
+            &node["first"].get_value_ref<const mapping_type&>() ==
+            &node["second"].get_value_ref<const mapping_type&>());
+    }
+
+    SECTION("compact_document with a key interner")
+    {
+        fkyaml::key_interner interner;
+        const fkyaml::node node = fkyaml::node::compact_document(input, interner);
+        REQUIRE(node == fkyaml::node::deserialize(input));
+        REQUIRE(
+            &node["first"]["description"].get_value_ref<const std::string&>() ==
+            interner.find("a very long string value which appears more than once").get());
+    }
+}
+
+TEST_CASE("NodeClassTest_CompactOrderedMapTest", "[NodeClassTest]")
+{
+    using ordered_node_t = fkyaml::basic_node<std::vector, fkyaml::ordered_map>;
+    ordered_node_t node = ordered_node_t::deserialize(
+        "zzz: a very long string value which appears more than once\n"
+        "aaa: a very long string value which appears more than once\n"
+        "a very long string value which appears more than once: key\n");
+    const ordered_node_t original = node;
+    node.compact();
+    REQUIRE(node == original);
+
+    // the order of entries is preserved.
+    auto itr = node.begin();
+    REQUIRE(itr.key().get_value<std::string>() == "zzz");
+    ++itr;
+    REQUIRE(itr.key().get_value<std::string>() == "aaa");
+    ++itr;
+    REQUIRE(&itr.key().get_value_ref<const std::string&>() == &node["zzz"].get_value_ref<const std::string&>());
+    REQUIRE(node["a very long string value which appears more than once"].get_value<std::string>() == "key");
+}
+
+//
+// test cases for copy-on-write sharing
+//
+
+TEST_CASE("NodeClassTest_MakeCopyOnWriteTest", "[NodeClassTest]")
+{
+    fkyaml::node base = fkyaml::node::deserialize("server:\n"
+                                                  "  host: localhost\n"
+                                                  "  ports: [80, 443]\n"
+                                                  "  description: a very long string value shared among snapshots\n"
+                                                  "client:\n"
+                                                  "  timeout: 30\n"
+                                                  "  retries: &retries 3\n");
+    const fkyaml::node original = base;
+    base.make_copy_on_write();
+    REQUIRE(base == original);
+
+    SECTION("copies share the values")
+    {
+        const fkyaml::node snapshot = base;
+        REQUIRE(snapshot == original);
+        REQUIRE(
+            &snapshot.get_value_ref<const fkyaml::node::mapping_type&>() ==
+            &base.get_value_ref<const fkyaml::node::mapping_type&>());
+        REQUIRE(
+            &snapshot["server"]["description"].get_value_ref<const std::string&>() ==
+            &base["server"]["description"].get_value_ref<const std::string&>());
+        REQUIRE(snapshot["client"]["retries"].is_anchor());
+    }
+
+    SECTION("modification copies only the path to the modified node")
+    {
+        fkyaml::node snapshot = base;
+        snapshot["server"]["ports"][0] = 8080;
+
+        REQUIRE(snapshot["server"]["ports"][0].get_value<int>() == 8080);
+        REQUIRE(base == original);
+
+        const fkyaml::node& const_base = base;
+        const fkyaml::node& const_snapshot = snapshot;
+        REQUIRE(
+            &const_snapshot["server"].get_value_ref<const fkyaml::node::mapping_type&>() !=
+            &const_base["server"].get_value_ref<const fkyaml::node::mapping_type&>());
+        REQUIRE(
+            &const_snapshot["client"].get_value_ref<const fkyaml::node::mapping_type&>() ==
+            &const_base["client"].get_value_ref<const fkyaml::node::mapping_type&>());
+
+        // further copies of the modified one are still copy-on-write.
+        fkyaml::node another = snapshot;
+        another["client"]["timeout"] = 60;
+        REQUIRE(snapshot["client"]["timeout"].get_value<int>() == 30);
+        REQUIRE(another["server"]["ports"][0].get_value<int>() == 8080);
+    }
+
+    SECTION("modification through references to values")
+    {
+        fkyaml::node snapshot = base;
+        snapshot["server"]["ports"].get_value_ref<fkyaml::node::sequence_type&>().push_back(8443);
+        snapshot["server"]["description"].get_value_ref<std::string&>() = "modified";
+        for (auto& port : snapshot["server"]["ports"])
+        {
+            port = port.get_value<int>() + 1;
+        }
+
+        REQUIRE(snapshot["server"]["ports"].size() == 3);
+        REQUIRE(snapshot["server"]["ports"][2].get_value<int>() == 8444);
+        REQUIRE(snapshot["server"]["description"].get_value<std::string>() == "modified");
+        REQUIRE(base == original);
+    }
+
+    SECTION("const access never modifies shared values")
+    {
+        const fkyaml::node snapshot = base;
+        REQUIRE(snapshot["missing"].is_null());
+        REQUIRE(snapshot.size() == 2);
+        REQUIRE_FALSE(snapshot.contains("missing"));
+    }
+
+    SECTION("shared values outlive the original node")
+    {
+        fkyaml::node snapshot = base;
+        base = nullptr;
+        REQUIRE(snapshot == original);
+        snapshot["client"]["retries"] = 5;
+        REQUIRE(snapshot["client"]["retries"].get_value<int>() == 5);
+    }
+
+    SECTION("snapshots in multiple threads")
+    {
+        std::vector<fkyaml::node> results(4);
+        std::vector<std::thread> threads;
+        for (std::size_t i = 0; i < results.size(); i++)
+        {
+            threads.emplace_back([&base, &results, i]() {
+                for (int j = 0; j < 100; j++)
+                {
+                    fkyaml::node snapshot = base;
+                    snapshot["client"]["timeout"] = static_cast<int>(i);
+                    results[i] = snapshot;
+                }
+            });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        for (std::size_t i = 0; i < results.size(); i++)
+        {
+            REQUIRE(results[i]["client"]["timeout"].get_value<int>() == static_cast<int>(i));
+        }
+        REQUIRE(base == original);
+    }
+
+    SECTION("const string access to snapshots in multiple threads")
+    {
+        const fkyaml::node snapshot = base;
+        std::vector<const std::string*> hosts(4, nullptr);
+        std::vector<const std::string*> descriptions(4, nullptr);
+        std::vector<int> results(4, 0);
+        std::vector<std::thread> threads;
+        for (std::size_t i = 0; i < results.size(); i++)
+        {
+            threads.emplace_back([&snapshot, &hosts, &descriptions, &results, i]() {
+                bool result = true;
+                for (int j = 0; j < 100; j++)
+                {
+                    const fkyaml::node& server = snapshot["server"];
+                    hosts[i] = &server["host"].get_value_ref<const std::string&>();
+                    descriptions[i] = &server["description"].get_value_ref<const std::string&>();
+                    result = result && *hosts[i] == "localhost" &&
+                             *descriptions[i] == "a very long string value shared among snapshots";
+                    for (auto itr = server.begin(); itr != server.end(); ++itr)
+                    {
+                        result = result && !itr.key().get_value_ref<const std::string&>().empty();
+                    }
+                }
+                results[i] = result ? 1 : 0;
+            });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        for (std::size_t i = 0; i < results.size(); i++)
+        {
+            REQUIRE(results[i] == 1);
+            // every thread references the same string even if it's stored in place.
+            REQUIRE(hosts[i] == hosts[0]);
+            REQUIRE(descriptions[i] == descriptions[0]);
+        }
+        REQUIRE(base == original);
+        REQUIRE(base.digest() == original.digest());
+    }
+}
+
+TEST_CASE("NodeClassTest_DigestTest", "[NodeClassTest]")
+{
+    fkyaml::node base = fkyaml::node::deserialize("server:\n"
+                                                  "  host: localhost\n"
+                                                  "  ports: [80, 443]\n"
+                                                  "client:\n"
+                                                  "  timeout: 30\n"
+                                                  "  ratio: 0.5\n");
+    const fkyaml::node original = base;
+    const std::uint64_t digest = original.digest();
+
+    SECTION("equal nodes have the same digest")
+    {
+        REQUIRE(base.digest() == digest);
+        base.make_copy_on_write();
+        REQUIRE(base.digest() == digest);
+        REQUIRE(fkyaml::node(base).digest() == digest);
+        REQUIRE(base["server"].digest() == original["server"].digest());
+        REQUIRE(fkyaml::node(123).digest() == fkyaml::node(123).digest());
+        REQUIRE(std::hash<fkyaml::node>()(original) == static_cast<std::size_t>(digest));
+    }
+
+    SECTION("different nodes mostly have different digests")
+    {
+        REQUIRE(fkyaml::node(123).digest() != fkyaml::node(456).digest());
+        REQUIRE(fkyaml::node("foo").digest() != fkyaml::node("bar").digest());
+        REQUIRE(fkyaml::node::sequence({1, 2}).digest() != fkyaml::node::sequence({2, 1}).digest());
+        REQUIRE(original["server"].digest() != original["client"].digest());
+        REQUIRE(fkyaml::node::sequence().digest() != fkyaml::node::mapping().digest());
+    }
+
+    SECTION("digests of copy-on-write copies are updated after modifications")
+    {
+        base.make_copy_on_write();
+        fkyaml::node snapshot = base;
+        REQUIRE(snapshot.digest() == digest);
+
+        base["server"]["ports"][0] = 8080;
+        REQUIRE(base.digest() != digest);
+        REQUIRE(snapshot.digest() == digest);
+        REQUIRE(base != snapshot);
+
+        base["server"]["ports"][0] = 80;
+        REQUIRE(base.digest() == digest);
+        REQUIRE(base == snapshot);
+
+        fkyaml::node copy = snapshot;
+        for (auto& port : copy["server"]["ports"])
+        {
+            port = 0;
+        }
+        REQUIRE(copy.digest() != digest);
+        REQUIRE(snapshot.digest() == digest);
+    }
+
+    SECTION("digests are updated after modifications through references")
+    {
+        base.make_copy_on_write();
+        fkyaml::node& ports = base["server"]["ports"];
+        REQUIRE(base.digest() == digest);
+        ports[1] = 8443;
+        REQUIRE(base.digest() != digest);
+        REQUIRE(base.digest() == fkyaml::node(base).digest());
+
+        fkyaml::node plain = original;
+        fkyaml::node& host = plain["server"]["host"];
+        REQUIRE(plain.digest() == digest);
+        host = "example.com";
+        REQUIRE(plain.digest() != digest);
+    }
+
+    SECTION("digests are consistent with comparisons")
+    {
+        base.make_copy_on_write();
+        fkyaml::node lhs = base;
+        fkyaml::node rhs = base;
+        lhs["client"]["timeout"] = 60;
+        rhs["client"]["timeout"] = 60;
+        REQUIRE(lhs.digest() == rhs.digest());
+        REQUIRE(lhs == rhs);
+
+        rhs["client"]["ratio"] = 0.25;
+        REQUIRE(lhs.digest() == rhs.digest());
+        REQUIRE(lhs != rhs);
+
+        rhs["client"]["timeout"] = 90;
+        REQUIRE(lhs.digest() != rhs.digest());
+        REQUIRE(lhs != rhs);
+    }
+}
+
+//
+// test cases for std::hash specialization
+//
+
+TEST_CASE("NodeClassTest_StdHashTest", "[NodeClassTest]")
+{
+    std::hash<fkyaml::node> hasher;
+
+    SECTION("equal nodes have the same hash value")
+    {
+        fkyaml::node node = fkyaml::node::deserialize("foo: [1, 2.5, true, null]\nbar:\n  baz: qux\nqux: 123");
+        fkyaml::node copy = node;
+        REQUIRE(node == copy);
+        REQUIRE(hasher(node) == hasher(copy));
+        REQUIRE(hasher(node["foo"]) == hasher(copy["foo"]));
+        REQUIRE(hasher(node["bar"]) == hasher(copy["bar"]));
+        REQUIRE(hasher(node["qux"]) == hasher(copy["qux"]));
+    }
+
+    SECTION("anchors are ignored")
+    {
+        fkyaml::node node = 123;
+        fkyaml::node anchor = 123;
+        anchor.add_anchor_name("anchor");
+        REQUIRE(hasher(node) == hasher(anchor));
+    }
+
+    SECTION("different nodes mostly have different hash values")
+    {
+        REQUIRE(hasher(fkyaml::node(123)) != hasher(fkyaml::node(456)));
+        REQUIRE(hasher(fkyaml::node("foo")) != hasher(fkyaml::node("bar")));
+        REQUIRE(hasher(fkyaml::node(true)) != hasher(fkyaml::node(false)));
+        REQUIRE(hasher(fkyaml::node::sequence({1, 2})) != hasher(fkyaml::node::sequence({2, 1})));
+        REQUIRE(hasher(fkyaml::node()) != hasher(fkyaml::node::sequence()));
+    }
+
+    SECTION("usable as keys of unordered containers")
+    {
+        std::unordered_set<fkyaml::node> set;
+        set.insert(fkyaml::node(123));
+        set.insert(fkyaml::node("foo"));
+        set.insert(fkyaml::node::mapping({{"bar", 1.5}}));
+        set.insert(fkyaml::node(123));
+        REQUIRE(set.size() == 3);
+        REQUIRE(set.count(fkyaml::node("foo")) == 1);
+        REQUIRE(set.count(fkyaml::node::mapping({{"bar", 1.5}})) == 1);
+        REQUIRE(set.count(fkyaml::node("bar")) == 0);
+    }
+
+    SECTION("string hash values are updated after modifications")
+    {
+        fkyaml::node node = "foo";
+        const std::size_t hash = hasher(node);
+        REQUIRE(hasher(node) == hash);
+        node.get_value_ref<std::string&>() = "bar";
+        REQUIRE(hasher(node) == hasher(fkyaml::node("bar")));
+        node = "foo";
+        REQUIRE(hasher(node) == hash);
+    }
+
+    SECTION("string hash values are updated after modifications through held references")
+    {
+        fkyaml::node node = "foo";
+        std::string& str = node.get_value_ref<std::string&>();
+        const std::size_t hash = hasher(node);
+        str = "xyz";
+        REQUIRE(hasher(node) == hasher(fkyaml::node("xyz")));
+        str = "foo";
+        REQUIRE(hasher(node) == hash);
+    }
+
+    SECTION("hash values of shared strings")
+    {
+        std::string input = "a: a very long string value to be shared\n"
+                            "b: a very long string value to be shared\n";
+        fkyaml::node node = fkyaml::node::deserialize(input);
+        node.compact();
+        const std::size_t hash = hasher(node["a"]);
+        REQUIRE(hasher(node["a"]) == hash);
+        REQUIRE(hasher(node["b"]) == hash);
+        node["a"].get_value_ref<std::string&>() = "foo";
+        REQUIRE(hasher(node["a"]) == hasher(fkyaml::node("foo")));
+        REQUIRE(hasher(node["b"]) == hash);
+    }
+
+    SECTION("deeply nested nodes")
+    {
+        fkyaml::node node = fkyaml::node::sequence();
+        fkyaml::node* p_node = &node;
+        for (int i = 0; i < 100000; i++)
+        {
+            p_node->get_value_ref<fkyaml::node::sequence_type&>().emplace_back(fkyaml::node::mapping());
+            fkyaml::node& child = p_node->get_value_ref<fkyaml::node::sequence_type&>().back();
+            child["child"] = fkyaml::node::sequence();
+            p_node = &child["child"];
+        }
+        fkyaml::node copy = node;
+        REQUIRE(hasher(node) == hasher(copy));
+    }
+}
+
+template <typename TestType>
+static void check_heterogeneous_lookups()
+{
+    TestType node = TestType::deserialize("foo: 1\n123: 2\n-1: 3\ntrue: 4\nbar: 5\n");
+    const TestType& const_node = node;
+    const char* p_key = "foo";
+    const char array_key[] = "bar";
+    std::string str_key = "foo";
+
+    // lookups with string keys
+    REQUIRE(const_node[p_key].template get_value<int>() == 1);
+    REQUIRE(const_node[array_key].template get_value<int>() == 5);
+    REQUIRE(const_node[str_key].template get_value<int>() == 1);
+    REQUIRE(node["foo"].template get_value<int>() == 1);
+    REQUIRE(const_node.contains("bar"));
+    REQUIRE(const_node.contains(str_key));
+    REQUIRE_FALSE(const_node.contains("fo"));
+    REQUIRE_FALSE(const_node.contains("foo2"));
+    REQUIRE_FALSE(const_node.contains(""));
+    REQUIRE_FALSE(const_node.contains("123"));
+#ifdef FK_YAML_HAS_CXX_17
+    REQUIRE(const_node[std::string_view("foo")].template get_value<int>() == 1);
+    REQUIRE_FALSE(const_node.contains(std::string_view("foo", 2)));
+#endif
+
+    // lookups with integer keys
+    REQUIRE(const_node[123].template get_value<int>() == 2);
+    REQUIRE(const_node[static_cast<short>(-1)].template get_value<int>() == 3);
+    REQUIRE(const_node[123u].template get_value<int>() == 2);
+    REQUIRE(const_node.contains(static_cast<std::int64_t>(-1)));
+    REQUIRE_FALSE(const_node.contains(124));
+    REQUIRE_FALSE(const_node.contains(1));
+
+    // lookups with other keys
+    REQUIRE(const_node[true].template get_value<int>() == 4);
+    REQUIRE(const_node.contains(TestType("foo")));
+    REQUIRE_FALSE(const_node.contains(false));
+    REQUIRE_FALSE(const_node.contains(nullptr));
+
+    // insertions with missing keys
+    node["baz"] = 6;
+    node[456] = 7;
+    REQUIRE(node.size() == 7);
+    REQUIRE(const_node["baz"].template get_value<int>() == 6);
+    REQUIRE(const_node[456].template get_value<int>() == 7);
+
+    // const lookups never insert missing keys.
+    REQUIRE(const_node["qux"].is_null());
+    REQUIRE(node.size() == 7);
+}
+
+TEST_CASE("NodeClassTest_HeterogeneousLookupTest", "[NodeClassTest]")
+{
+    SECTION("std::map")
+    {
+        check_heterogeneous_lookups<fkyaml::node>();
+    }
+
+    SECTION("fkyaml::ordered_map")
+    {
+        check_heterogeneous_lookups<fkyaml::basic_node<std::vector, fkyaml::ordered_map>>();
+    }
+
+    SECTION("std::unordered_map")
+    {
+        check_heterogeneous_lookups<fkyaml::unordered_node>();
+    }
+}
+
+TEST_CASE("NodeClassTest_TransparentComparatorTest", "[NodeClassTest]")
+{
+    std::less<fkyaml::node> less;
+    std::equal_to<fkyaml::node> equal_to;
+    std::hash<fkyaml::node> hasher;
+
+    std::vector<fkyaml::node> nodes {
+        fkyaml::node(),
+        fkyaml::node(true),
+        fkyaml::node(-1),
+        fkyaml::node(0),
+        fkyaml::node(123),
+        fkyaml::node(1.5),
+        fkyaml::node(""),
+        fkyaml::node("a"),
+        fkyaml::node("ab"),
+        fkyaml::node("b"),
+        fkyaml::node::sequence({1, 2}),
+        fkyaml::node::mapping({{"a", 1}})};
+
+    SECTION("string keys")
+    {
+        for (const char* key : {"", "a", "aa", "ab", "b", "ba"})
+        {
+            const fkyaml::node key_node = key;
+            REQUIRE(hasher(key) == hasher(key_node));
+            for (const fkyaml::node& n : nodes)
+            {
+                REQUIRE(less(n, key) == (n < key_node));
+                REQUIRE(less(key, n) == (key_node < n));
+                REQUIRE(equal_to(n, key) == (n == key_node));
+                REQUIRE(equal_to(key, n) == (n == key_node));
+            }
+        }
+    }
+
+    SECTION("integer keys")
+    {
+        for (int key : {-2, -1, 0, 1, 123, 124})
+        {
+            const fkyaml::node key_node = key;
+            REQUIRE(hasher(key) == hasher(key_node));
+            for (const fkyaml::node& n : nodes)
+            {
+                REQUIRE(less(n, key) == (n < key_node));
+                REQUIRE(less(key, n) == (key_node < n));
+                REQUIRE(equal_to(n, key) == (n == key_node));
+                REQUIRE(equal_to(key, n) == (n == key_node));
+            }
+        }
+    }
+
+    SECTION("lookups in standard containers")
+    {
+        std::map<fkyaml::node, int> map {{fkyaml::node("foo"), 1}, {fkyaml::node(123), 2}};
+        REQUIRE(map.find(fkyaml::node("foo"))->second == 1);
+        REQUIRE(map.count(fkyaml::node(123)) == 1);
+        REQUIRE(map.count(fkyaml::node("bar")) == 0);
+#ifdef FK_YAML_HAS_CXX_14
+        REQUIRE(map.find("foo")->second == 1);
+        REQUIRE(map.find(123)->second == 2);
+        REQUIRE(map.find("bar") == map.end());
+#endif
+    }
+}
+
+TEST_CASE("NodeClassTest_UnorderedNodeTest", "[NodeClassTest]")
+{
+    std::string input = "foo: bar\nbaz:\n  - 1\n  - a: b\nqux:\n  x: 1\n  y: [true, null]\n123: 1.5";
+    fkyaml::unordered_node node = fkyaml::unordered_node::deserialize(input);
+
+    SECTION("deserialization")
+    {
+        REQUIRE(node.size() == 4);
+        REQUIRE(node["foo"].get_value<std::string>() == "bar");
+        REQUIRE(node["baz"][1]["a"].get_value<std::string>() == "b");
+        REQUIRE(node["qux"]["y"][0].get_value<bool>() == true);
+        REQUIRE(node[123].get_value<double>() == 1.5);
+    }
+
+    SECTION("equality regardless of the insertion order")
+    {
+        fkyaml::unordered_node other = fkyaml::unordered_node::mapping();
+        other[123] = 1.5;
+        other["qux"] = fkyaml::unordered_node::mapping();
+        other["qux"]["y"] = fkyaml::unordered_node::sequence({true, nullptr});
+        other["qux"]["x"] = 1;
+        other["baz"] = fkyaml::unordered_node::sequence({1, fkyaml::unordered_node::mapping({{"a", "b"}})});
+        other["foo"] = "bar";
+        REQUIRE(other == node);
+        REQUIRE(std::hash<fkyaml::unordered_node>()(other) == std::hash<fkyaml::unordered_node>()(node));
+
+        other["qux"]["x"] = 2;
+        REQUIRE_FALSE(other == node);
+        other["qux"]["x"] = 1;
+        other["quux"] = 1;
+        other.get_value_ref<fkyaml::unordered_node::mapping_type&>().erase("foo");
+        REQUIRE_FALSE(other == node);
+    }
+
+    SECTION("copy")
+    {
+        fkyaml::unordered_node copy = node;
+        REQUIRE(copy == node);
+        copy["qux"]["y"][1] = 1;
+        REQUIRE(node["qux"]["y"][1].is_null());
+    }
+
+    SECTION("freeze")
+    {
+        fkyaml::basic_frozen_node<fkyaml::unordered_node> frozen = node.freeze();
+        REQUIRE(frozen["qux"]["x"].get_value<int>() == 1);
+        REQUIRE(frozen.materialize() == node);
+    }
+
+    SECTION("deserialize_into")
+    {
+        fkyaml::unordered_node::deserialize_into("foo: baz\nqux:\n  x: 2\nquux: 1", node);
+        REQUIRE(node.size() == 3);
+        REQUIRE(node["foo"].get_value<std::string>() == "baz");
+        REQUIRE(node["qux"]["x"].get_value<int>() == 2);
+        REQUIRE(node["quux"].get_value<int>() == 1);
+    }
+}
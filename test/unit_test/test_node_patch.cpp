@@ -0,0 +1,280 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.2
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <fkYAML/node.hpp>
+
+namespace test
+{
+
+using ordered_node = fkyaml::basic_node<std::vector, fkyaml::ordered_map>;
+
+template <typename BasicNodeType>
+void check_round_trip(const std::string& source_yaml, const std::string& target_yaml)
+{
+    const BasicNodeType source = BasicNodeType::deserialize(source_yaml);
+    const BasicNodeType target = BasicNodeType::deserialize(target_yaml);
+
+    BasicNodeType copied = source;
+    fkyaml::patch(copied, fkyaml::diff(source, target));
+    REQUIRE(copied == target);
+
+    BasicNodeType moved = source;
+    BasicNodeType target_copy = target;
+    fkyaml::patch(moved, fkyaml::diff(source, std::move(target_copy)));
+    REQUIRE(moved == target);
+}
+
+} // namespace test
+
+TEST_CASE("NodePatchTest_DiffEqualNodesTest")
+{
+    fkyaml::node source = fkyaml::node::deserialize("foo: 123\nbar:\n  - true\n  - baz: null");
+    fkyaml::node target = fkyaml::node::deserialize("foo: 123\nbar:\n  - true\n  - baz: null");
+    REQUIRE(fkyaml::diff(source, target).empty());
+    REQUIRE(fkyaml::diff(source, source).empty());
+}
+
+TEST_CASE("NodePatchTest_DiffScalarTest")
+{
+    SECTION("different values")
+    {
+        fkyaml::node_patch script = fkyaml::diff(fkyaml::node(123), fkyaml::node(456));
+        REQUIRE(script.size() == 1);
+        REQUIRE(script[0].op == fkyaml::node_edit::op_t::REPLACE);
+        REQUIRE(script[0].path.empty());
+        REQUIRE(script[0].value == fkyaml::node(456));
+    }
+
+    SECTION("different types")
+    {
+        fkyaml::node target = fkyaml::node::deserialize("foo: bar");
+        fkyaml::node_patch script = fkyaml::diff(fkyaml::node(123), target);
+        REQUIRE(script.size() == 1);
+        REQUIRE(script[0].op == fkyaml::node_edit::op_t::REPLACE);
+        REQUIRE(script[0].path.empty());
+        REQUIRE(script[0].value == target);
+    }
+}
+
+TEST_CASE("NodePatchTest_DiffMappingTest")
+{
+    fkyaml::node source = fkyaml::node::deserialize("a: 1\nb: 2\nc:\n  d: x");
+    fkyaml::node target = fkyaml::node::deserialize("a: 1\nc:\n  d: y\ne: 3");
+    fkyaml::node_patch script = fkyaml::diff(source, target);
+
+    REQUIRE(script.size() == 3);
+    REQUIRE(script[0].op == fkyaml::node_edit::op_t::REMOVE);
+    REQUIRE(script[0].path == std::vector<fkyaml::node> {"b"});
+    REQUIRE(script[0].value.is_null());
+    REQUIRE(script[1].op == fkyaml::node_edit::op_t::ADD);
+    REQUIRE(script[1].path == std::vector<fkyaml::node> {"e"});
+    REQUIRE(script[1].value == fkyaml::node(3));
+    REQUIRE(script[2].op == fkyaml::node_edit::op_t::REPLACE);
+    REQUIRE(script[2].path == std::vector<fkyaml::node> {"c", "d"});
+    REQUIRE(script[2].value == fkyaml::node("y"));
+
+    fkyaml::patch(source, script);
+    REQUIRE(source == target);
+}
+
+TEST_CASE("NodePatchTest_DiffSequenceTest")
+{
+    SECTION("shrunk sequence")
+    {
+        fkyaml::node source = fkyaml::node::deserialize("seq: [1, 2, 3, 4]");
+        fkyaml::node target = fkyaml::node::deserialize("seq: [1, 5]");
+        fkyaml::node_patch script = fkyaml::diff(source, target);
+
+        REQUIRE(script.size() == 3);
+        REQUIRE(script[0].op == fkyaml::node_edit::op_t::REMOVE);
+        REQUIRE(script[0].path == std::vector<fkyaml::node> {"seq", 3});
+        REQUIRE(script[1].op == fkyaml::node_edit::op_t::REMOVE);
+        REQUIRE(script[1].path == std::vector<fkyaml::node> {"seq", 2});
+        REQUIRE(script[2].op == fkyaml::node_edit::op_t::REPLACE);
+        REQUIRE(script[2].path == std::vector<fkyaml::node> {"seq", 1});
+        REQUIRE(script[2].value == fkyaml::node(5));
+
+        fkyaml::patch(source, script);
+        REQUIRE(source == target);
+    }
+
+    SECTION("grown sequence")
+    {
+        fkyaml::node source = fkyaml::node::deserialize("seq: [1]");
+        fkyaml::node target = fkyaml::node::deserialize("seq: [1, 2, 3]");
+        fkyaml::node_patch script = fkyaml::diff(source, target);
+
+        REQUIRE(script.size() == 2);
+        REQUIRE(script[0].op == fkyaml::node_edit::op_t::ADD);
+        REQUIRE(script[0].path == std::vector<fkyaml::node> {"seq", 1});
+        REQUIRE(script[0].value == fkyaml::node(2));
+        REQUIRE(script[1].op == fkyaml::node_edit::op_t::ADD);
+        REQUIRE(script[1].path == std::vector<fkyaml::node> {"seq", 2});
+        REQUIRE(script[1].value == fkyaml::node(3));
+
+        fkyaml::patch(source, script);
+        REQUIRE(source == target);
+    }
+}
+
+TEST_CASE("NodePatchTest_RoundTripTest")
+{
+    auto yamls = GENERATE(
+        std::make_pair(
+            std::string("a: 1\nb: [1, 2, 3]\nc:\n  d: x\n  e: y\nf: g"),
+            std::string("a: 2\nb: [1, 5]\nc:\n  d: x\n  z: 1\nf: [1]\nh: new")),
+        std::make_pair(std::string("a: 1\nb: [1, 2, 3]\nc: x"), std::string("c: y\nb: [1]\nd: 1")),
+        std::make_pair(std::string("a: 1\nb: 2\nc: 3"), std::string("c: 3\nb: 2\na: 1")),
+        std::make_pair(std::string("a:\n  b:\n    c: [1, 2]"), std::string("a: 1")),
+        std::make_pair(std::string("a: 1"), std::string("foo")));
+
+    SECTION("std::map")
+    {
+        test::check_round_trip<fkyaml::node>(yamls.first, yamls.second);
+    }
+
+    SECTION("fkyaml::ordered_map")
+    {
+        test::check_round_trip<test::ordered_node>(yamls.first, yamls.second);
+    }
+
+    SECTION("std::unordered_map")
+    {
+        test::check_round_trip<fkyaml::unordered_node>(yamls.first, yamls.second);
+    }
+}
+
+TEST_CASE("NodePatchTest_OrderedMappingTest")
+{
+    test::ordered_node source = test::ordered_node::deserialize("a: 1\nb: 2\nc: 3");
+    test::ordered_node target = test::ordered_node::deserialize("a: 1\nc: 3\nb: 2");
+    test::ordered_node patched = source;
+    fkyaml::patch(patched, fkyaml::diff(source, target));
+    REQUIRE(patched == target);
+
+    auto itr = patched.get_value_ref<const test::ordered_node::mapping_type&>().begin();
+    REQUIRE(itr->first == test::ordered_node("a"));
+    REQUIRE((++itr)->first == test::ordered_node("c"));
+    REQUIRE((++itr)->first == test::ordered_node("b"));
+}
+
+TEST_CASE("NodePatchTest_DiffMoveTest")
+{
+    fkyaml::node source = fkyaml::node::deserialize("a: 1\nb: [1, 2]");
+    fkyaml::node target = fkyaml::node::deserialize("a: 1\nb: [1, 2, 3]\nc:\n  d: e");
+    const fkyaml::node expected = target;
+
+    fkyaml::node_patch script = fkyaml::diff(source, std::move(target));
+    fkyaml::patch(source, std::move(script));
+    REQUIRE(source == expected);
+}
+
+TEST_CASE("NodePatchTest_SharedContainerTest")
+{
+    fkyaml::node source = fkyaml::node::deserialize("a:\n  b: [1, 2, 3]\nc:\n  d: x");
+    fkyaml::node target = source;
+    target["c"]["d"] = "y";
+    const fkyaml::node snapshot = target;
+
+    fkyaml::node_patch script = fkyaml::diff(source, std::move(target));
+    REQUIRE(script.size() == 1);
+    REQUIRE(script[0].path == std::vector<fkyaml::node> {"c", "d"});
+
+    fkyaml::patch(source, std::move(script));
+    REQUIRE(source == snapshot);
+    REQUIRE(snapshot["c"]["d"] == fkyaml::node("y"));
+    REQUIRE(snapshot["a"]["b"].size() == 3);
+}
+
+TEST_CASE("NodePatchTest_DeepNestingTest")
+{
+    const int depth = 10000;
+    fkyaml::node source = 0;
+    fkyaml::node target = 1;
+    for (int i = 0; i < depth; i++)
+    {
+        source = fkyaml::node::sequence({std::move(source)});
+        target = fkyaml::node::sequence({std::move(target)});
+    }
+
+    fkyaml::node_patch script = fkyaml::diff(source, target);
+    REQUIRE(script.size() == 1);
+    REQUIRE(script[0].path.size() == static_cast<std::size_t>(depth));
+
+    fkyaml::patch(source, script);
+    REQUIRE(source == target);
+}
+
+TEST_CASE("NodePatchTest_PatchRootTest")
+{
+    fkyaml::node root = fkyaml::node::deserialize("foo: bar");
+
+    SECTION("replace the root")
+    {
+        fkyaml::patch(root, fkyaml::node_patch {{fkyaml::node_edit::op_t::REPLACE, {}, fkyaml::node(123)}});
+        REQUIRE(root == fkyaml::node(123));
+    }
+
+    SECTION("remove the root")
+    {
+        fkyaml::node_patch script {{fkyaml::node_edit::op_t::REMOVE, {}, fkyaml::node()}};
+        REQUIRE_THROWS_AS(fkyaml::patch(root, script), fkyaml::exception);
+    }
+}
+
+TEST_CASE("NodePatchTest_PatchErrorTest")
+{
+    fkyaml::node root = fkyaml::node::deserialize("foo: bar\nseq: [1, 2]");
+
+    SECTION("missing key in the path")
+    {
+        fkyaml::node_patch script {{fkyaml::node_edit::op_t::REPLACE, {"baz", "qux"}, fkyaml::node(1)}};
+        REQUIRE_THROWS_AS(fkyaml::patch(root, script), fkyaml::exception);
+    }
+
+    SECTION("missing key to be removed")
+    {
+        fkyaml::node_patch script {{fkyaml::node_edit::op_t::REMOVE, {"baz"}, fkyaml::node()}};
+        REQUIRE_THROWS_AS(fkyaml::patch(root, script), fkyaml::exception);
+    }
+
+    SECTION("out-of-range index")
+    {
+        fkyaml::node_patch script {{fkyaml::node_edit::op_t::REPLACE, {"seq", 2}, fkyaml::node(1)}};
+        REQUIRE_THROWS_AS(fkyaml::patch(root, script), fkyaml::exception);
+    }
+
+    SECTION("non-integer index")
+    {
+        fkyaml::node_patch script {{fkyaml::node_edit::op_t::REPLACE, {"seq", "0"}, fkyaml::node(1)}};
+        REQUIRE_THROWS_AS(fkyaml::patch(root, script), fkyaml::type_error);
+    }
+
+    SECTION("scalar parent")
+    {
+        fkyaml::node_patch script {{fkyaml::node_edit::op_t::ADD, {"foo", "baz"}, fkyaml::node(1)}};
+        REQUIRE_THROWS_AS(fkyaml::patch(root, script), fkyaml::type_error);
+    }
+}
+
+TEST_CASE("NodePatchTest_PatchSequenceTest")
+{
+    fkyaml::node root = fkyaml::node::deserialize("seq: [1, 2]");
+    fkyaml::node_patch script {
+        {fkyaml::node_edit::op_t::ADD, {"seq", 0}, fkyaml::node(0)},
+        {fkyaml::node_edit::op_t::ADD, {"seq", 3}, fkyaml::node(3)},
+        {fkyaml::node_edit::op_t::REMOVE, {"seq", 1}, fkyaml::node()}};
+    fkyaml::patch(root, script);
+    REQUIRE(root == fkyaml::node::deserialize("seq: [0, 2, 3]"));
+}
@@ -0,0 +1,156 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.2
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <fkYAML/node.hpp>
+
+namespace test
+{
+
+const std::string path_test_yaml = "spec:\n"
+                                   "  template:\n"
+                                   "    spec:\n"
+                                   "      containers:\n"
+                                   "        - name: web\n"
+                                   "          image: nginx\n"
+                                   "        - name: sidecar\n"
+                                   "          image: envoy\n"
+                                   "  \"a.b\": dotted\n"
+                                   "  '[c]': bracketed\n"
+                                   "  3: three\n";
+
+} // namespace test
+
+TEST_CASE("NodePathClassTest_CompileTest")
+{
+    SECTION("default constructor")
+    {
+        fkyaml::path path;
+        REQUIRE(path.empty());
+        REQUIRE(path.size() == 0);
+    }
+
+    SECTION("valid expressions")
+    {
+        auto expr = GENERATE(
+            std::make_pair(std::string(""), std::size_t(0)),
+            std::make_pair(std::string("spec"), std::size_t(1)),
+            std::make_pair(std::string("spec.template"), std::size_t(2)),
+            std::make_pair(std::string("[0]"), std::size_t(1)),
+            std::make_pair(std::string("[0][1]"), std::size_t(2)),
+            std::make_pair(std::string("spec.containers[0].image"), std::size_t(4)),
+            std::make_pair(std::string("spec[\"a.b\"]"), std::size_t(2)),
+            std::make_pair(std::string("['[c]'].d"), std::size_t(2)));
+
+        fkyaml::path path(expr.first);
+        REQUIRE(path.size() == expr.second);
+        REQUIRE(path.empty() == (expr.second == 0));
+    }
+
+    SECTION("malformed expressions")
+    {
+        auto expr = GENERATE(
+            std::string(".spec"),
+            std::string("spec."),
+            std::string("spec..template"),
+            std::string("spec["),
+            std::string("spec[]"),
+            std::string("spec[-1]"),
+            std::string("spec[x]"),
+            std::string("spec[0"),
+            std::string("spec[\"a.b]"),
+            std::string("spec['a.b'"),
+            std::string("spec[0]template"),
+            std::string("spec[99999999999999999999]"));
+
+        REQUIRE_THROWS_AS(fkyaml::path(expr), fkyaml::exception);
+    }
+}
+
+TEST_CASE("NodePathClassTest_FindTest")
+{
+    const fkyaml::node root = fkyaml::node::deserialize(test::path_test_yaml);
+
+    SECTION("existing paths")
+    {
+        REQUIRE(fkyaml::path("").find(root) == &root);
+        REQUIRE(fkyaml::path("spec").find(root) == &root["spec"]);
+
+        const fkyaml::node* p_image = fkyaml::path("spec.template.spec.containers[1].image").find(root);
+        REQUIRE(p_image == &root["spec"]["template"]["spec"]["containers"][1]["image"]);
+        REQUIRE(p_image->get_value<std::string>() == "envoy");
+
+        REQUIRE(fkyaml::path("spec[\"a.b\"]").at(root).get_value<std::string>() == "dotted");
+        REQUIRE(fkyaml::path("spec['[c]']").at(root).get_value<std::string>() == "bracketed");
+    }
+
+    SECTION("an index as an integer mapping key")
+    {
+        REQUIRE(fkyaml::path("spec[3]").at(root).get_value<std::string>() == "three");
+    }
+
+    SECTION("missing paths")
+    {
+        auto expr = GENERATE(
+            std::string("status"),
+            std::string("spec.template.metadata"),
+            std::string("spec.template.spec.containers[2]"),
+            std::string("spec.template.spec.containers.name"),
+            std::string("spec.template.spec.containers[0].name.first"),
+            std::string("spec[4]"));
+
+        fkyaml::path path(expr);
+        REQUIRE(path.find(root) == nullptr);
+        REQUIRE_FALSE(path.contains(root));
+        REQUIRE_THROWS_AS(path.at(root), fkyaml::exception);
+    }
+}
+
+TEST_CASE("NodePathClassTest_MutableFindTest")
+{
+    fkyaml::node root = fkyaml::node::deserialize(test::path_test_yaml);
+    const fkyaml::node snapshot = root;
+    fkyaml::path path("spec.template.spec.containers[0].image");
+
+    SECTION("modify the node at the path")
+    {
+        path.at(root) = "apache";
+        REQUIRE(root["spec"]["template"]["spec"]["containers"][0]["image"].get_value<std::string>() == "apache");
+        REQUIRE(path.at(snapshot).get_value<std::string>() == "nginx");
+    }
+
+    SECTION("missing path")
+    {
+        fkyaml::path missing("spec.template.spec.containers[2]");
+        REQUIRE(missing.find(root) == nullptr);
+        REQUIRE_THROWS_AS(missing.at(root), fkyaml::exception);
+        REQUIRE(root == snapshot);
+    }
+}
+
+TEST_CASE("NodePathClassTest_OtherMappingTypesTest")
+{
+    SECTION("fkyaml::ordered_map")
+    {
+        using ordered_node = fkyaml::basic_node<std::vector, fkyaml::ordered_map>;
+        const ordered_node root = ordered_node::deserialize(test::path_test_yaml);
+        fkyaml::basic_node_path<ordered_node> path("spec.template.spec.containers[1].name");
+        REQUIRE(path.at(root).get_value<std::string>() == "sidecar");
+    }
+
+    SECTION("std::unordered_map")
+    {
+        const fkyaml::unordered_node root = fkyaml::unordered_node::deserialize(test::path_test_yaml);
+        fkyaml::basic_node_path<fkyaml::unordered_node> path("spec.template.spec.containers[1].name");
+        REQUIRE(path.at(root).get_value<std::string>() == "sidecar");
+    }
+}
@@ -0,0 +1,136 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.2
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <fkYAML/node.hpp>
+
+namespace test
+{
+
+fkyaml::node make_reclaimed_document()
+{
+    fkyaml::node root = fkyaml::node::mapping();
+    for (int i = 0; i < 100; i++)
+    {
+        fkyaml::node& entry = root[std::string("key") + std::to_string(i)];
+        entry = fkyaml::node::mapping();
+        entry["seq"] = fkyaml::node::sequence({1, 2, 3});
+        entry["str"] = std::string(64, 'x');
+    }
+    return root;
+}
+
+fkyaml::node make_deeply_nested_node(std::size_t depth)
+{
+    fkyaml::node root = fkyaml::node::sequence();
+    fkyaml::node* p_leaf = &root;
+    for (std::size_t i = 0; i < depth; i++)
+    {
+        fkyaml::node::sequence_type& seq = p_leaf->get_value_ref<fkyaml::node::sequence_type&>();
+        seq.push_back(fkyaml::node::sequence());
+        p_leaf = &seq.back();
+    }
+    return root;
+}
+
+} // namespace test
+
+TEST_CASE("NodeReclaimerClassTest_BackgroundTest", "[NodeReclaimerClassTest]")
+{
+    fkyaml::node_reclaimer reclaimer;
+
+    SECTION("retire and wait")
+    {
+        for (int i = 0; i < 10; i++)
+        {
+            fkyaml::node root = test::make_reclaimed_document();
+            reclaimer.retire(std::move(root));
+            REQUIRE(root.is_null());
+        }
+        reclaimer.wait();
+    }
+
+    SECTION("retire a deeply nested node")
+    {
+        reclaimer.retire(test::make_deeply_nested_node(100000));
+        reclaimer.wait();
+    }
+
+    SECTION("retire from multiple threads")
+    {
+        std::vector<std::thread> threads;
+        for (int i = 0; i < 4; i++)
+        {
+            threads.emplace_back([&reclaimer]() {
+                for (int j = 0; j < 10; j++)
+                {
+                    reclaimer.retire(test::make_reclaimed_document());
+                }
+            });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+        reclaimer.wait();
+    }
+
+    SECTION("destroy with retired nodes")
+    {
+        reclaimer.retire(test::make_reclaimed_document());
+        // the destructor destroys the retired nodes before returning.
+    }
+}
+
+TEST_CASE("NodeReclaimerClassTest_ManualTest", "[NodeReclaimerClassTest]")
+{
+    fkyaml::node_reclaimer reclaimer(false);
+
+    SECTION("reclaim")
+    {
+        reclaimer.retire(test::make_reclaimed_document());
+        reclaimer.retire(test::make_deeply_nested_node(100000));
+        reclaimer.reclaim();
+        // nothing to be reclaimed.
+        reclaimer.reclaim();
+    }
+
+    SECTION("wait")
+    {
+        reclaimer.retire(test::make_reclaimed_document());
+        reclaimer.wait();
+    }
+
+    SECTION("destroy with retired nodes")
+    {
+        reclaimer.retire(test::make_reclaimed_document());
+    }
+}
+
+TEST_CASE("NodeReclaimerClassTest_SharedContainerTest", "[NodeReclaimerClassTest]")
+{
+    fkyaml::node_reclaimer reclaimer;
+
+    fkyaml::node root = test::make_reclaimed_document();
+    root.make_copy_on_write();
+    fkyaml::node snapshot = root;
+
+    reclaimer.retire(std::move(root));
+    reclaimer.wait();
+
+    // the containers shared with the retired node are still alive.
+    REQUIRE(snapshot.size() == 100);
+    REQUIRE(snapshot["key99"]["seq"][2].get_value<int>() == 3);
+    REQUIRE(snapshot["key0"]["str"].get_value<std::string>() == std::string(64, 'x'));
+}
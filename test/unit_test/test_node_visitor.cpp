@@ -0,0 +1,237 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.2
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <fkYAML/node.hpp>
+
+namespace test
+{
+
+struct event_recorder : fkyaml::node_visitor
+{
+    bool start_mapping(const fkyaml::node& /*unused*/)
+    {
+        events.emplace_back("{");
+        return true;
+    }
+
+    void end_mapping(const fkyaml::node& /*unused*/)
+    {
+        events.emplace_back("}");
+    }
+
+    bool start_sequence(const fkyaml::node& /*unused*/)
+    {
+        events.emplace_back("[");
+        return true;
+    }
+
+    void end_sequence(const fkyaml::node& /*unused*/)
+    {
+        events.emplace_back("]");
+    }
+
+    bool mapping_value(const fkyaml::node& key, const fkyaml::node& /*unused*/)
+    {
+        const std::string& k = key.get_value_ref<const std::string&>();
+        events.push_back(k + ":");
+        return k != "skipped";
+    }
+
+    bool sequence_element(std::size_t index, const fkyaml::node& /*unused*/)
+    {
+        events.push_back("#" + std::to_string(index));
+        return true;
+    }
+
+    void null_scalar(const fkyaml::node& /*unused*/)
+    {
+        events.emplace_back("null");
+    }
+
+    void boolean_scalar(const fkyaml::node& /*unused*/, bool value)
+    {
+        events.emplace_back(value ? "true" : "false");
+    }
+
+    void integer_scalar(const fkyaml::node& /*unused*/, std::int64_t value)
+    {
+        events.push_back(std::to_string(value));
+    }
+
+    void float_number_scalar(const fkyaml::node& /*unused*/, double /*unused*/)
+    {
+        events.emplace_back("float");
+    }
+
+    void string_scalar(const fkyaml::node& /*unused*/, const std::string& value)
+    {
+        events.push_back("'" + value + "'");
+    }
+
+    std::vector<std::string> events;
+};
+
+struct password_redactor : fkyaml::node_visitor
+{
+    bool mapping_value(const fkyaml::node& key, fkyaml::node& value)
+    {
+        if (key.is_string() && key.get_value_ref<const std::string&>() == "password")
+        {
+            value = "***";
+            return false;
+        }
+        return true;
+    }
+};
+
+} // namespace test
+
+TEST_CASE("NodeVisitorTest_VisitTest")
+{
+    const fkyaml::node root = fkyaml::node::deserialize(
+        std::string("nil: ~\nbool: true\nint: 123\nfloat: 3.14\nstr: foo\nseq:\n  - 1\n  - bar\nskipped:\n  a: 1\n"));
+
+    test::event_recorder recorder;
+    fkyaml::visit(root, recorder);
+
+    std::vector<std::string> expected {
+        "{", "bool:", "true", "float:", "float", "int:", "123", "nil:", "null", "seq:", "[", "#0", "1", "#1", "'bar'",
+        "]", "skipped:", "str:", "'foo'", "}"};
+    REQUIRE(recorder.events == expected);
+}
+
+TEST_CASE("NodeVisitorTest_VisitRootScalarTest")
+{
+    const fkyaml::node root = 123;
+    test::event_recorder recorder;
+    fkyaml::visit(root, recorder);
+    REQUIRE(recorder.events == std::vector<std::string> {"123"});
+}
+
+TEST_CASE("NodeVisitorTest_VisitPruneContainerTest")
+{
+    struct pruner : fkyaml::node_visitor
+    {
+        bool start_mapping(const fkyaml::node& /*unused*/)
+        {
+            ++mappings;
+            return false;
+        }
+
+        void end_mapping(const fkyaml::node& /*unused*/)
+        {
+            ++ends;
+        }
+
+        void integer_scalar(const fkyaml::node& /*unused*/, std::int64_t /*unused*/)
+        {
+            ++integers;
+        }
+
+        int mappings = 0;
+        int ends = 0;
+        int integers = 0;
+    };
+
+    const fkyaml::node root = fkyaml::node::deserialize(std::string("a: 1\nb:\n  c: 2"));
+    pruner visitor;
+    fkyaml::visit(root, visitor);
+    REQUIRE(visitor.mappings == 1);
+    REQUIRE(visitor.ends == 1);
+    REQUIRE(visitor.integers == 0);
+}
+
+TEST_CASE("NodeVisitorTest_VisitModifyTest")
+{
+    fkyaml::node root = fkyaml::node::deserialize(
+        std::string("user: foo\npassword: bar\nservers:\n  - host: a\n    password: baz\n  - host: b\n"));
+    const fkyaml::node snapshot = root;
+
+    fkyaml::visit(root, test::password_redactor());
+
+    REQUIRE(root["password"].get_value<std::string>() == "***");
+    REQUIRE(root["servers"][0]["password"].get_value<std::string>() == "***");
+    REQUIRE(root["servers"][0]["host"].get_value<std::string>() == "a");
+    REQUIRE(root["user"].get_value<std::string>() == "foo");
+    REQUIRE(snapshot["password"].get_value<std::string>() == "bar");
+    REQUIRE(snapshot["servers"][0]["password"].get_value<std::string>() == "baz");
+}
+
+TEST_CASE("NodeVisitorTest_WalkTest")
+{
+    const fkyaml::node root = fkyaml::node::deserialize(std::string("a: 1\nb:\n  - 2\n  - 3\nc:\n  d: 4\n"));
+
+    SECTION("visit all nodes")
+    {
+        std::vector<fkyaml::node::node_t> types;
+        fkyaml::walk(root, [&types](const fkyaml::node& n) {
+            types.push_back(n.type());
+            return true;
+        });
+
+        std::vector<fkyaml::node::node_t> expected {
+            fkyaml::node::node_t::MAPPING,
+            fkyaml::node::node_t::INTEGER,
+            fkyaml::node::node_t::SEQUENCE,
+            fkyaml::node::node_t::INTEGER,
+            fkyaml::node::node_t::INTEGER,
+            fkyaml::node::node_t::MAPPING,
+            fkyaml::node::node_t::INTEGER};
+        REQUIRE(types == expected);
+    }
+
+    SECTION("skip the children of sequences")
+    {
+        int count = 0;
+        fkyaml::walk(root, [&count](const fkyaml::node& n) {
+            ++count;
+            return !n.is_sequence();
+        });
+        REQUIRE(count == 5);
+    }
+
+    SECTION("modify nodes")
+    {
+        fkyaml::node copy = root;
+        fkyaml::walk(copy, [](fkyaml::node& n) {
+            if (n.is_integer())
+            {
+                n = n.get_value<int>() * 10;
+            }
+            return true;
+        });
+        REQUIRE(copy == fkyaml::node::deserialize(std::string("a: 10\nb:\n  - 20\n  - 30\nc:\n  d: 40\n")));
+    }
+}
+
+TEST_CASE("NodeVisitorTest_DeepNestingTest")
+{
+    const int depth = 10000;
+    fkyaml::node root = fkyaml::node::sequence();
+    fkyaml::node* p_node = &root;
+    for (int i = 0; i < depth; i++)
+    {
+        fkyaml::node::sequence_type& seq = p_node->get_value_ref<fkyaml::node::sequence_type&>();
+        seq.emplace_back(i + 1 < depth ? fkyaml::node::sequence() : fkyaml::node(123));
+        p_node = &seq.back();
+    }
+
+    int count = 0;
+    fkyaml::walk(static_cast<const fkyaml::node&>(root), [&count](const fkyaml::node& /*unused*/) {
+        ++count;
+        return true;
+    });
+    REQUIRE(count == depth + 1);
+
+}
@@ -6,6 +6,7 @@
 // SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
 // SPDX-License-Identifier: MIT
 
+#include <iterator>
 #include <string>
 
 #include <catch2/catch.hpp>
@@ -110,3 +111,140 @@ TEST_CASE("OrderedMapClassTest_ConstFindTest", "[OrderedMapClassTest]")
     REQUIRE(map__.find("foo")->second == true);
     REQUIRE(map__.find("bar") == map__.end());
 }
+
+TEST_CASE("OrderedMapClassTest_EraseTest", "[OrderedMapClassTest]")
+{
+    fkyaml::ordered_map<std::string, int> map {{"foo", 1}, {"bar", 2}, {"baz", 3}, {"qux", 4}};
+
+    auto itr = map.erase(map.find("bar"));
+    REQUIRE(itr->first == "baz");
+    REQUIRE(map.size() == 3);
+    REQUIRE(map.find("bar") == map.end());
+    REQUIRE(map.at("baz") == 3);
+
+    const auto& const_map = map;
+    itr = map.erase(const_map.find("qux"));
+    REQUIRE(itr == map.end());
+    REQUIRE(map.size() == 2);
+
+    map.emplace("quux", 5);
+    itr = map.erase(map.cbegin(), map.cbegin() + 2);
+    REQUIRE(itr == map.begin());
+    REQUIRE(map.size() == 1);
+    REQUIRE(map.begin()->first == "quux");
+    REQUIRE(map.at("quux") == 5);
+    REQUIRE(map.find("foo") == map.end());
+}
+
+TEST_CASE("OrderedMapClassTest_HashIndexTest", "[OrderedMapClassTest]")
+{
+    // enough key-value pairs to build the hash index.
+    const int num = 100;
+    fkyaml::ordered_map<std::string, int> map;
+    for (int i = 0; i < num; i++)
+    {
+        REQUIRE(map.emplace("key" + std::to_string(i), i).second == true);
+    }
+    REQUIRE(map.emplace("key42", -1).second == false);
+    REQUIRE(map.size() == static_cast<std::size_t>(num));
+
+    // building the index allocates memory, so the functions which may build it must be able to throw.
+    STATIC_REQUIRE_FALSE(noexcept(map["key0"]));
+    STATIC_REQUIRE_FALSE(noexcept(map.emplace("key0", 0)));
+    STATIC_REQUIRE_FALSE(noexcept(map.find("key0")));
+
+    SECTION("lookups with the hash index")
+    {
+        for (int i = 0; i < num; i++)
+        {
+            std::string key = "key" + std::to_string(i);
+            REQUIRE(map.find(key) == map.begin() + i);
+            REQUIRE(map.at(key) == i);
+            REQUIRE(map[key] == i);
+        }
+        REQUIRE(map.find("key100") == map.end());
+        REQUIRE_THROWS_AS(map.at("key100"), fkyaml::exception);
+
+        const fkyaml::ordered_map<std::string, int>& const_map = map;
+        REQUIRE(const_map.find("key99") == const_map.begin() + 99);
+        REQUIRE(const_map.at("key0") == 0);
+        REQUIRE(const_map.find("key100") == const_map.end());
+    }
+
+    SECTION("insertion order is preserved")
+    {
+        int i = 0;
+        for (const auto& pair : map)
+        {
+            REQUIRE(pair.first == "key" + std::to_string(i));
+            REQUIRE(pair.second == i);
+            i++;
+        }
+    }
+
+    SECTION("lookups after removing the last key-value pair")
+    {
+        map.pop_back();
+        REQUIRE(map.size() == static_cast<std::size_t>(num - 1));
+        REQUIRE(map.find("key99") == map.end());
+        REQUIRE(map.at("key98") == 98);
+        REQUIRE(map.emplace("key99", -1).second == true);
+        REQUIRE(map.at("key99") == -1);
+    }
+
+    SECTION("lookups after appending key-value pairs with the base container")
+    {
+        map.emplace_back("key100", 100);
+        REQUIRE(map.find("key100") == map.begin() + 100);
+        REQUIRE(map.emplace("key100", -1).second == false);
+    }
+
+    SECTION("lookups after clearing key-value pairs")
+    {
+        map.clear();
+        REQUIRE(map.find("key0") == map.end());
+        REQUIRE(map.emplace("key0", 0).second == true);
+        REQUIRE(map.at("key0") == 0);
+    }
+
+    SECTION("lookups after moving key-value pairs")
+    {
+        fkyaml::ordered_map<std::string, int> moved = std::move(map);
+        REQUIRE(moved.at("key50") == 50);
+
+        map = fkyaml::ordered_map<std::string, int> {{"foo", 1}};
+        REQUIRE(map.at("foo") == 1);
+        REQUIRE(map.find("key50") == map.end());
+    }
+
+    SECTION("lookups after swapping key-value pairs")
+    {
+        fkyaml::ordered_map<std::string, int> other {{"foo", 1}};
+        map.swap(other);
+        REQUIRE(map.at("foo") == 1);
+        REQUIRE(map.find("key50") == map.end());
+        REQUIRE(other.at("key50") == 50);
+        REQUIRE(other.find("foo") == other.end());
+    }
+}
+
+TEST_CASE("OrderedMapClassTest_NonHashableKeyTest", "[OrderedMapClassTest]")
+{
+    struct key_type
+    {
+        int value;
+        bool operator==(const key_type& rhs) const
+        {
+            return value == rhs.value;
+        }
+    };
+
+    fkyaml::ordered_map<key_type, int> map;
+    for (int i = 0; i < 100; i++)
+    {
+        REQUIRE(map.emplace(key_type {i}, i).second == true);
+    }
+    REQUIRE(map.emplace(key_type {42}, -1).second == false);
+    REQUIRE(map.at(key_type {42}) == 42);
+    REQUIRE(map.find(key_type {100}) == map.end());
+}
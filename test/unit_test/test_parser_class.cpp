@@ -0,0 +1,181 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.2
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <sstream>
+#include <string>
+#include <utility>
+
+#include <catch2/catch.hpp>
+
+#include <fkYAML/node.hpp>
+
+namespace
+{
+
+// the number of memory allocations in this test program, which is counted by the replaced operator new below.
+std::atomic<std::size_t> g_allocation_count {0};
+
+} // namespace
+
+// GCC reports the replaced functions below as mismatched when they are inlined into callers.
+#if defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 11)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void* operator new(std::size_t size)
+{
+    ++g_allocation_count;
+    void* p = std::malloc(size != 0 ? size : 1);
+    if (p == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+#if defined(__cpp_sized_deallocation)
+void operator delete(void* p, std::size_t /*unused*/) noexcept
+{
+    std::free(p);
+}
+#endif
+
+#if defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 11)
+#pragma GCC diagnostic pop
+#endif
+
+TEST_CASE("ParserClassTest_ParseTest", "[ParserClassTest]")
+{
+    auto input = GENERATE(
+        std::string("foo: bar\nbaz: [1, 2.5, true, null]\nqux:\n  - a: 1\n    b: 2\n  - c"),
+        std::string("%YAML 1.1\n---\nfoo: &a bar\nbaz: *a"),
+        std::string("? a: b\n: 1\n? c\n: d"),
+        std::string("foo: |\n  literal\n  text\nbar: >\n  folded\n  text\n"),
+        std::string(""));
+
+    fkyaml::parser parser;
+    fkyaml::node expected = fkyaml::node::deserialize(input);
+    fkyaml::node actual = parser.parse(input);
+    REQUIRE(actual == expected);
+    REQUIRE(actual.get_yaml_version() == expected.get_yaml_version());
+}
+
+TEST_CASE("ParserClassTest_ReuseTest", "[ParserClassTest]")
+{
+    fkyaml::parser parser;
+
+    SECTION("parse different inputs in turn")
+    {
+        fkyaml::node first = parser.parse(std::string("%YAML 1.1\n---\nfoo: &a [1, 2]\nbar: baz"));
+        REQUIRE(first.get_yaml_version() == fkyaml::node::yaml_version_t::VER_1_1);
+        REQUIRE(first.size() == 2);
+
+        fkyaml::node second = parser.parse(std::string("qux: 123"));
+        REQUIRE(second.get_yaml_version() == fkyaml::node::yaml_version_t::VER_1_2);
+        REQUIRE(second.size() == 1);
+        REQUIRE(second["qux"].get_value<int>() == 123);
+
+        // the previous result is not affected by later parses.
+        REQUIRE(first["foo"][1].get_value<int>() == 2);
+        REQUIRE(first["bar"].get_value<std::string>() == "baz");
+    }
+
+    SECTION("anchors are not carried over to the next input")
+    {
+        REQUIRE_NOTHROW(parser.parse(std::string("foo: &anchor bar")));
+        REQUIRE_THROWS_AS(parser.parse(std::string("foo: *anchor")), fkyaml::parse_error);
+    }
+
+    SECTION("parse after an error")
+    {
+        REQUIRE_THROWS_AS(parser.parse(std::string("foo: 1\nfoo: 2")), fkyaml::parse_error);
+        fkyaml::node node = parser.parse(std::string("foo: 1\nbar: 2"));
+        REQUIRE(node.size() == 2);
+        REQUIRE(node["foo"].get_value<int>() == 1);
+        REQUIRE(node["bar"].get_value<int>() == 2);
+    }
+
+    SECTION("parse a shorter input after a longer one")
+    {
+        parser.parse(std::string("foo: a very long string value which fills the input buffer"));
+        fkyaml::node node = parser.parse(std::string("a: b"));
+        REQUIRE(node.size() == 1);
+        REQUIRE(node["a"].get_value<std::string>() == "b");
+    }
+}
+
+TEST_CASE("ParserClassTest_RetainedBuffersTest", "[ParserClassTest]")
+{
+    // the comment makes the input too long to be stored in the small buffer of std::string.
+    std::string long_input = "# a comment which makes the input buffer allocated on the heap\nfoo: 'bar'\n";
+    std::string short_input = "foo: bar";
+
+    fkyaml::parser parser;
+    parser.parse(long_input);
+
+    // only the nodes in the resulting tree are allocated once the buffers have been grown enough.
+    std::size_t count = g_allocation_count;
+    fkyaml::node expected = fkyaml::node::mapping();
+    expected["foo"] = "bar";
+    const std::size_t node_allocation_count = g_allocation_count - count;
+
+    count = g_allocation_count;
+    fkyaml::node node = parser.parse(long_input);
+    REQUIRE(g_allocation_count - count == node_allocation_count);
+    REQUIRE(node == expected);
+
+    count = g_allocation_count;
+    node = parser.parse(short_input);
+    REQUIRE(g_allocation_count - count == node_allocation_count);
+    REQUIRE(node == expected);
+}
+
+TEST_CASE("ParserClassTest_InputTypesTest", "[ParserClassTest]")
+{
+    fkyaml::parser parser;
+
+    SECTION("iterators")
+    {
+        std::string input = "foo: bar";
+        fkyaml::node node = parser.parse(input.begin(), input.end());
+        REQUIRE(node["foo"].get_value<std::string>() == "bar");
+    }
+
+    SECTION("stream")
+    {
+        std::stringstream ss("foo: bar");
+        fkyaml::node node = parser.parse(ss);
+        REQUIRE(node["foo"].get_value<std::string>() == "bar");
+    }
+
+    SECTION("UTF-16 string")
+    {
+        fkyaml::node node = parser.parse(std::u16string(u"foo: bar"));
+        REQUIRE(node["foo"].get_value<std::string>() == "bar");
+    }
+}
+
+TEST_CASE("ParserClassTest_MoveTest", "[ParserClassTest]")
+{
+    fkyaml::parser parser;
+    parser.parse(std::string("foo: bar"));
+
+    fkyaml::parser moved = std::move(parser);
+    fkyaml::node node = moved.parse(std::string("baz: qux"));
+    REQUIRE(node["baz"].get_value<std::string>() == "qux");
+}
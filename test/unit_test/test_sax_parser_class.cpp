@@ -0,0 +1,367 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.2
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <fkYAML/node.hpp>
+
+// records parse events as strings. (doesn't derive from fkyaml::node::sax_handler_type)
+struct event_recorder
+{
+    bool start_document(fkyaml::node::yaml_version_t version)
+    {
+        events.push_back(version == fkyaml::node::yaml_version_t::VER_1_1 ? "+DOC 1.1" : "+DOC 1.2");
+        return check_limit();
+    }
+    bool end_document()
+    {
+        events.push_back("-DOC");
+        return check_limit();
+    }
+    bool start_mapping()
+    {
+        events.push_back("+MAP");
+        return check_limit();
+    }
+    bool end_mapping()
+    {
+        events.push_back("-MAP");
+        return check_limit();
+    }
+    bool start_sequence()
+    {
+        events.push_back("+SEQ");
+        return check_limit();
+    }
+    bool end_sequence()
+    {
+        events.push_back("-SEQ");
+        return check_limit();
+    }
+    bool key()
+    {
+        events.push_back("KEY");
+        return check_limit();
+    }
+    bool scalar(std::nullptr_t)
+    {
+        events.push_back("null");
+        return check_limit();
+    }
+    bool scalar(fkyaml::node::boolean_type value)
+    {
+        events.push_back(value ? "true" : "false");
+        return check_limit();
+    }
+    bool scalar(fkyaml::node::integer_type value)
+    {
+        events.push_back("int " + std::to_string(value));
+        return check_limit();
+    }
+    bool scalar(fkyaml::node::float_number_type value)
+    {
+        events.push_back("float " + std::to_string(value));
+        return check_limit();
+    }
+    bool scalar(fkyaml::node::string_type& value)
+    {
+        events.push_back("str " + value);
+        return check_limit();
+    }
+    bool anchor(const fkyaml::node::string_type& name)
+    {
+        events.push_back("&" + name);
+        return check_limit();
+    }
+    bool alias(const fkyaml::node::string_type& name)
+    {
+        events.push_back("*" + name);
+        return check_limit();
+    }
+
+    bool check_limit() const
+    {
+        return events.size() < limit;
+    }
+
+    std::vector<std::string> events;
+    std::size_t limit = static_cast<std::size_t>(-1);
+};
+
+static std::vector<std::string> record(const std::string& input)
+{
+    event_recorder recorder;
+    bool is_completed = fkyaml::node::sax_parse(input, recorder);
+    REQUIRE(is_completed);
+    return recorder.events;
+}
+
+TEST_CASE("SaxParserClassTest_EmptyInputTest", "[SaxParserClassTest]")
+{
+    std::vector<std::string> expected {"+DOC 1.2", "+MAP", "-MAP", "-DOC"};
+    REQUIRE(record("") == expected);
+}
+
+TEST_CASE("SaxParserClassTest_BlockMappingTest", "[SaxParserClassTest]")
+{
+    SECTION("scalar values")
+    {
+        std::vector<std::string> expected {
+            "+DOC 1.2", "+MAP", "KEY", "str foo", "str bar", "KEY", "str baz", "int 123", "KEY",
+            "str qux",  "true", "KEY", "str x",   "null",    "-MAP", "-DOC"};
+        REQUIRE(record("foo: bar\nbaz: 123\nqux: true\nx: ~") == expected);
+    }
+
+    SECTION("nested mappings")
+    {
+        std::vector<std::string> expected {
+            "+DOC 1.2", "+MAP", "KEY", "str foo", "+MAP", "KEY",  "str bar", "+MAP", "KEY",
+            "str baz",  "null", "-MAP", "KEY",    "str qux", "float 1.500000", "-MAP", "KEY",
+            "str x",    "int 1", "-MAP", "-DOC"};
+        REQUIRE(record("foo:\n  bar:\n    baz: ~\n  qux: 1.5\nx: 1") == expected);
+    }
+}
+
+TEST_CASE("SaxParserClassTest_SequenceTest", "[SaxParserClassTest]")
+{
+    SECTION("block sequence")
+    {
+        std::vector<std::string> expected {
+            "+DOC 1.2", "+MAP", "KEY", "str foo", "+SEQ", "int 1", "str bar", "-SEQ", "-MAP", "-DOC"};
+        REQUIRE(record("foo:\n  - 1\n  - bar") == expected);
+    }
+
+    SECTION("block sequence of mappings")
+    {
+        std::vector<std::string> expected {
+            "+DOC 1.2", "+MAP",    "KEY", "str foo", "+SEQ",    "+MAP",  "KEY",  "str a", "int 1", "KEY",
+            "str b",    "int 2",   "-MAP", "+MAP",   "KEY",     "str a", "int 3", "-MAP", "-SEQ",  "-MAP",
+            "-DOC"};
+        REQUIRE(record("foo:\n  - a: 1\n    b: 2\n  - a: 3") == expected);
+    }
+
+    SECTION("flow sequence")
+    {
+        std::vector<std::string> expected {
+            "+DOC 1.2", "+MAP", "KEY", "str foo", "+SEQ", "int 1", "false", "-SEQ", "KEY", "str bar", "+SEQ",
+            "-SEQ",     "-MAP", "-DOC"};
+        REQUIRE(record("foo: [1, false]\nbar: []") == expected);
+    }
+
+    SECTION("flow containers in a flow sequence")
+    {
+        std::vector<std::string> expected {
+            "+DOC 1.2", "+MAP",  "KEY",   "str foo", "+SEQ", "int 1", "+MAP", "KEY",  "str x", "str y",
+            "-MAP",     "+SEQ",  "int 2", "-SEQ",    "-SEQ", "KEY",   "str bar", "int 3", "-MAP", "-DOC"};
+        REQUIRE(record("foo: [1, {x: y}, [2]]\nbar: 3") == expected);
+    }
+
+    SECTION("flow mapping in a flow sequence at the root")
+    {
+        std::vector<std::string> expected {
+            "+DOC 1.2", "+SEQ", "+MAP", "KEY", "str x", "str y", "-MAP", "-SEQ", "-DOC"};
+        REQUIRE(record("[{x: y}]") == expected);
+    }
+}
+
+TEST_CASE("SaxParserClassTest_ExplicitKeyTest", "[SaxParserClassTest]")
+{
+    SECTION("scalar key")
+    {
+        std::vector<std::string> expected {"+DOC 1.2", "+MAP", "KEY", "str foo", "str bar", "-MAP", "-DOC"};
+        REQUIRE(record("? foo\n: bar") == expected);
+    }
+
+    SECTION("mapping key")
+    {
+        std::vector<std::string> expected {
+            "+DOC 1.2", "+MAP", "KEY", "+MAP", "KEY", "str a", "str b", "-MAP", "int 1", "-MAP", "-DOC"};
+        REQUIRE(record("? a: b\n: 1") == expected);
+    }
+}
+
+TEST_CASE("SaxParserClassTest_AnchorAndAliasTest", "[SaxParserClassTest]")
+{
+    std::vector<std::string> expected {
+        "+DOC 1.2", "+MAP", "KEY", "str foo", "&anchor", "int 1", "KEY", "str bar", "*anchor", "-MAP", "-DOC"};
+    REQUIRE(record("foo: &anchor 1\nbar: *anchor") == expected);
+
+    event_recorder recorder;
+    REQUIRE_THROWS_AS(fkyaml::node::sax_parse("foo: *anchor", recorder), fkyaml::parse_error);
+}
+
+TEST_CASE("SaxParserClassTest_YamlVersionTest", "[SaxParserClassTest]")
+{
+    std::vector<std::string> expected {"+DOC 1.1", "+MAP", "KEY", "str foo", "str bar", "-MAP", "-DOC"};
+    REQUIRE(record("%YAML 1.1\n---\nfoo: bar") == expected);
+}
+
+TEST_CASE("SaxParserClassTest_StopParsingTest", "[SaxParserClassTest]")
+{
+    event_recorder recorder;
+    recorder.limit = 4;
+    REQUIRE_FALSE(fkyaml::node::sax_parse("foo: bar\nbaz: 123", recorder));
+
+    std::vector<std::string> expected {"+DOC 1.2", "+MAP", "KEY", "str foo"};
+    REQUIRE(recorder.events == expected);
+}
+
+TEST_CASE("SaxParserClassTest_IteratorInputTest", "[SaxParserClassTest]")
+{
+    std::string input = "foo: bar";
+    event_recorder recorder;
+    REQUIRE(fkyaml::node::sax_parse(input.begin(), input.end(), recorder));
+
+    std::vector<std::string> expected {"+DOC 1.2", "+MAP", "KEY", "str foo", "str bar", "-MAP", "-DOC"};
+    REQUIRE(recorder.events == expected);
+}
+
+TEST_CASE("SaxParserClassTest_DerivedHandlerTest", "[SaxParserClassTest]")
+{
+    // counts scalars and moves string values out of the parser.
+    struct counting_handler : public fkyaml::node::sax_handler_type
+    {
+        bool start_document(yaml_version_t) override
+        {
+            return true;
+        }
+        bool end_document() override
+        {
+            return true;
+        }
+        bool start_mapping() override
+        {
+            ++containers;
+            return true;
+        }
+        bool end_mapping() override
+        {
+            return true;
+        }
+        bool start_sequence() override
+        {
+            ++containers;
+            return true;
+        }
+        bool end_sequence() override
+        {
+            return true;
+        }
+        bool key() override
+        {
+            return true;
+        }
+        bool scalar(std::nullptr_t) override
+        {
+            ++scalars;
+            return true;
+        }
+        bool scalar(boolean_type) override
+        {
+            ++scalars;
+            return true;
+        }
+        bool scalar(integer_type) override
+        {
+            ++scalars;
+            return true;
+        }
+        bool scalar(float_number_type) override
+        {
+            ++scalars;
+            return true;
+        }
+        bool scalar(string_type& value) override
+        {
+            ++scalars;
+            strings.push_back(std::move(value));
+            return true;
+        }
+        bool anchor(const string_type&) override
+        {
+            return true;
+        }
+        bool alias(const string_type&) override
+        {
+            ++scalars;
+            return true;
+        }
+
+        int containers = 0;
+        int scalars = 0;
+        std::vector<std::string> strings;
+    };
+
+    counting_handler handler;
+    fkyaml::node::sax_handler_type& base = handler;
+    REQUIRE(fkyaml::node::sax_parse("foo: [1, 2.5, null]\nbar:\n  baz: qux", base));
+    REQUIRE(handler.containers == 3);
+    REQUIRE(handler.scalars == 7);
+    std::vector<std::string> expected_strings {"foo", "bar", "baz", "qux"};
+    REQUIRE(handler.strings == expected_strings);
+}
+
+TEST_CASE("SaxParserClassTest_RawScalarHandlerTest", "[SaxParserClassTest]")
+{
+    // records the texts of scalars instead of their values.
+    struct raw_event_recorder : public event_recorder
+    {
+        bool raw_scalar(fkyaml::node::node_t type, fkyaml::node::string_type& text)
+        {
+            switch (type)
+            {
+            case fkyaml::node::node_t::NULL_OBJECT:
+                events.push_back("raw null " + text);
+                break;
+            case fkyaml::node::node_t::BOOLEAN:
+                events.push_back("raw bool " + text);
+                break;
+            case fkyaml::node::node_t::INTEGER:
+                events.push_back("raw int " + text);
+                break;
+            case fkyaml::node::node_t::FLOAT_NUMBER:
+                events.push_back("raw float " + text);
+                break;
+            default:
+                events.push_back("raw str " + text);
+                break;
+            }
+            return check_limit();
+        }
+    };
+
+    // the integer out of range is never converted.
+    std::string input = "foo: 99999999999999999999999999\nbar: [1.50, ~, True, 'x']\nbaz:\n";
+    raw_event_recorder recorder;
+    REQUIRE(fkyaml::node::sax_parse(input, recorder));
+
+    std::vector<std::string> expected {
+        "+DOC 1.2",
+        "+MAP",
+        "KEY",
+        "raw str foo",
+        "raw int 99999999999999999999999999",
+        "KEY",
+        "raw str bar",
+        "+SEQ",
+        "raw float 1.50",
+        "raw null ~",
+        "raw bool True",
+        "raw str x",
+        "-SEQ",
+        "KEY",
+        "raw str baz",
+        "raw null ",
+        "-MAP",
+        "-DOC"};
+    REQUIRE(recorder.events == expected);
+}